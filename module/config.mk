@@ -73,14 +73,20 @@ CSRCS = \
 	../module/preset_r_mode.c   				\
 	../module/preset_w_mode.c   				\
 	../module/usb_disk_mode.c   				\
+	../src/arena.c						\
 	../src/command.c					\
+	../src/cost.c						\
+	../src/dispatch.c					\
+	../src/fuse.c						\
 	../src/every.c					\
 	../src/helpers.c					\
 	../src/match_token.c					\
+	../src/profiler.c					\
 	../src/scanner.c					\
 	../src/state.c						\
 	../src/table.c						\
 	../src/teletype.c					\
+	../src/trigger.c					\
 	../src/turtle.c					\
 	../src/chaos.c					\
 	../src/ops/op.c						\
@@ -250,7 +256,7 @@ CFLAGS = -fshort-enums -fno-common
 # The most relevant symbols to define for the preprocessor are:
 #   BOARD      Target board in use, see boards/board.h for a list.
 #   EXT_BOARD  Optional extension board in use, see boards/board.h for a list.
-CPPFLAGS = -D BOARD=USER_BOARD -D UHD_ENABLE
+CPPFLAGS = -D BOARD=USER_BOARD -D UHD_ENABLE -D TELETYPE_THREADED
 
 # Extra flags to use when linking
 # NVRAM size may need to change if additional data is to be stored in scenes.
@@ -3,6 +3,7 @@
 #include <string.h>
 
 // this
+#include "cost.h"
 #include "flash.h"
 #include "globals.h"
 #include "keyboard_helper.h"
@@ -25,6 +26,7 @@ static uint8_t line_no1, line_no2;
 static uint8_t script;
 static error_t status;
 static char error_msg[TELE_ERROR_MSG_LENGTH];
+static bool show_cost;
 static tele_command_t undo_buffer[UNDO_DEPTH][SCRIPT_MAX_COMMANDS];
 static uint8_t undo_comments[UNDO_DEPTH][SCRIPT_MAX_COMMANDS];
 static uint8_t undo_length[UNDO_DEPTH];
@@ -270,13 +272,16 @@ void process_edit_keys(uint8_t k, uint8_t m, bool is_held_key) {
         u8 idx = min(line_no1, line_no2);
         line_no1 = idx;
         tele_command_t command;
+        compiled_command_t compiled;
         command.comment = false;
         for (u8 i = 0; i < copy_buffer_len; i++) {
-            if (parse(copy_buffer[i], &command, error_msg) != E_OK) continue;
-            if (validate(&command, error_msg) != E_OK) continue;
+            if (parse_and_compile(copy_buffer[i], &command, &compiled,
+                                  error_msg) != E_OK)
+                continue;
             if (command.length == 0) continue;
 
-            ss_insert_script_command(&scene_state, script, idx++, &command);
+            ss_insert_script_compiled(&scene_state, script, idx++, &command,
+                                      &compiled);
             if (line_no2 < (SCRIPT_MAX_COMMANDS - 1)) line_no2++;
             if (idx >= SCRIPT_MAX_COMMANDS) break;
         }
@@ -314,13 +319,10 @@ void process_edit_keys(uint8_t k, uint8_t m, bool is_held_key) {
         dirty |= D_MESSAGE;  // something will happen
 
         tele_command_t command;
+        compiled_command_t compiled;
         command.comment = false;
-        status = parse(line_editor_get(&le), &command, error_msg);
-
-        if (status != E_OK)
-            return;  // quit, screen_refresh_edit will display the error message
-
-        status = validate(&command, error_msg);
+        status = parse_and_compile(line_editor_get(&le), &command, &compiled,
+                                   error_msg);
         if (status != E_OK)
             return;  // quit, screen_refresh_edit will display the error message
 
@@ -332,13 +334,14 @@ void process_edit_keys(uint8_t k, uint8_t m, bool is_held_key) {
             }
         }
         else {
-            ss_overwrite_script_command(&scene_state, script, line_no1,
-                                        &command);
+            ss_overwrite_script_compiled(&scene_state, script, line_no1,
+                                         &command, &compiled);
             if (line_no1 < SCRIPT_MAX_COMMANDS - 1) { line_no1++; }
         }
         line_editor_set_command(
             &le, ss_get_script_command(&scene_state, script, line_no1));
         line_no2 = line_no1;
+        show_cost = true;
         dirty |= D_LIST | D_INPUT;
     }
     // shift-<enter>: insert command
@@ -348,25 +351,24 @@ void process_edit_keys(uint8_t k, uint8_t m, bool is_held_key) {
         dirty |= D_MESSAGE;  // something will happen
 
         tele_command_t command;
+        compiled_command_t compiled;
         command.comment = false;
-        status = parse(line_editor_get(&le), &command, error_msg);
-
-        if (status != E_OK)
-            return;  // quit, screen_refresh_edit will display the error message
-
-        status = validate(&command, error_msg);
+        status = parse_and_compile(line_editor_get(&le), &command, &compiled,
+                                   error_msg);
         if (status != E_OK)
             return;  // quit, screen_refresh_edit will display the error message
 
         save_undo();
         if (command.length > 0) {
-            ss_insert_script_command(&scene_state, script, line_no1, &command);
+            ss_insert_script_compiled(&scene_state, script, line_no1, &command,
+                                      &compiled);
             if (line_no1 < (SCRIPT_MAX_COMMANDS - 1)) { line_no1++; }
         }
 
         line_editor_set_command(
             &le, ss_get_script_command(&scene_state, script, line_no1));
         line_no2 = line_no1;
+        show_cost = true;
         dirty |= D_LIST | D_INPUT;
     }
     // alt-slash comment toggle selected lines
@@ -436,6 +438,16 @@ uint8_t screen_refresh_edit() {
             }
             status = E_OK;
         }
+        else if (show_cost) {
+            // the worst case number of OPs and MODs a trigger can run, with a
+            // + when an L range isn't known and has been counted once
+            cost_t cost = script_cost(&scene_state, script, NULL);
+            strcpy(s, "WORST CASE ");
+            itoa(cost.cost > INT32_MAX ? INT32_MAX : cost.cost, s + strlen(s),
+                 10);
+            strcat(s, cost.unknown_loops ? "+ OPS" : " OPS");
+            show_cost = false;
+        }
         else {
             s[0] = 0;
         }
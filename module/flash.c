@@ -11,7 +11,7 @@
 // this
 #include "teletype.h"
 
-#define FIRSTRUN_KEY 0x22
+#define FIRSTRUN_KEY 0x23
 #define BUTTON_STATE_SIZE (GRID_BUTTON_COUNT >> 3)
 
 typedef struct {
@@ -40,14 +40,68 @@ typedef const struct {
 
 static __attribute__((__section__(".flash_nvram"))) nvram_data_t f;
 
+// The layout of the flash written with OLD_FIRSTRUN_KEY (v4.0.0), before each
+// word of a command was packed in to 3 bytes. Its scenes, calibration and
+// device config are converted to the current layout rather than cleared.
+#define OLD_FIRSTRUN_KEY 0x22
+
+typedef struct {
+    uint8_t tag;  // a tele_word_t, a byte as the firmware uses -fshort-enums
+    int16_t value;
+} old_tele_data_t;
+
+typedef struct {
+    uint8_t length;
+    int8_t separator;
+    old_tele_data_t data[COMMAND_MAX_LENGTH];
+    bool comment;
+} old_tele_command_t;
+
+typedef struct {
+    uint8_t l;
+    old_tele_command_t c[SCRIPT_MAX_COMMANDS];
+    every_count_t every[SCRIPT_MAX_COMMANDS];
+    uint32_t last_time;
+} old_scene_script_t;
+
+typedef const struct {
+    old_scene_script_t scripts[SCRIPT_COUNT - 1];  // Exclude TEMP script
+    scene_pattern_t patterns[PATTERN_COUNT];
+    grid_data_t grid_data;
+    char text[SCENE_TEXT_LINES][SCENE_TEXT_CHARS];
+} old_nvram_scene_t;
+
+typedef const struct {
+    old_nvram_scene_t scenes[SCENE_SLOTS];
+    uint8_t last_scene;
+    tele_mode_t last_mode;
+    uint8_t fresh;
+    cal_data_t cal;
+    device_config_t device_config;
+} old_nvram_data_t;
+
+// the same flash as f, as it was laid out with OLD_FIRSTRUN_KEY
+static old_nvram_data_t *const old_f = (old_nvram_data_t *)&f;
+
+// a scene to write to flash, static as it's too big for the stack
+static scene_state_t flash_scene;
+
 static void pack_grid(scene_state_t *scene);
 static void unpack_grid(scene_state_t *scene);
+static void flash_migrate(void);
 
 u8 is_flash_fresh() {
-    return f.fresh != FIRSTRUN_KEY;
+    return old_f->fresh != OLD_FIRSTRUN_KEY && f.fresh != FIRSTRUN_KEY;
 }
 
 void flash_prepare() {
+    // the old key goes first, in the old layout f.fresh is in the middle of a
+    // scene and could be FIRSTRUN_KEY by chance
+    if (old_f->fresh == OLD_FIRSTRUN_KEY) {
+        flash_migrate();
+        return;
+    }
+
     // if it's not empty return
     if (f.fresh != FIRSTRUN_KEY) {
         int confirm = 1;
@@ -72,14 +126,13 @@ void flash_prepare() {
         print_dbg_ulong(sizeof(f));
 
         // blank scene to write to flash
-        scene_state_t scene;
-        ss_init(&scene);
+        ss_init(&flash_scene);
 
         char text[SCENE_TEXT_LINES][SCENE_TEXT_CHARS];
         memset(text, 0, SCENE_TEXT_LINES * SCENE_TEXT_CHARS);
 
         for (uint8_t i = 0; i < SCENE_SLOTS; i++) {
-            flash_write(i, &scene, &text);
+            flash_write(i, &flash_scene, &text);
         }
 
         cal_data_t cal = { 0,
@@ -123,6 +176,7 @@ void flash_read(uint8_t preset_no, scene_state_t *scene,
     memcpy(ss_scripts_ptr(scene), &f.scenes[preset_no].scripts,
            // Exclude size of TEMP script as above
            ss_scripts_size() - sizeof(scene_script_t));
+    ss_compile_scripts(scene);
     if (init_pattern) {
         memcpy(ss_patterns_ptr(scene), &f.scenes[preset_no].patterns,
                ss_patterns_size());
@@ -181,6 +235,57 @@ void flash_get_device_config(device_config_t *device_config) {
     *device_config = f.device_config;
 }
 
+// Converts the flash from the OLD_FIRSTRUN_KEY layout in place. Scenes are
+// smaller than they were, so converting them in slot order only ever writes
+// over scenes that have already been read. The settings after the scenes are
+// read before any are written. The old key is cleared last, so that it only
+// runs once.
+static void flash_migrate() {
+    print_dbg("\r\n:::: converting scenes to the packed command format");
+
+    const uint8_t last_scene = old_f->last_scene;
+    const tele_mode_t last_mode = old_f->last_mode;
+    cal_data_t cal = old_f->cal;
+    device_config_t device_config = old_f->device_config;
+    char text[SCENE_TEXT_LINES][SCENE_TEXT_CHARS];
+
+    ss_init(&flash_scene);
+    for (uint8_t i = 0; i < SCENE_SLOTS; i++) {
+        old_nvram_scene_t *old = &old_f->scenes[i];
+
+        for (uint8_t s = 0; s < SCRIPT_COUNT - 1; s++) {
+            scene_script_t *script = &flash_scene.scripts[s];
+            script->l = old->scripts[s].l;
+            script->last_time = old->scripts[s].last_time;
+            for (uint8_t l = 0; l < SCRIPT_MAX_COMMANDS; l++) {
+                const old_tele_command_t *from = &old->scripts[s].c[l];
+                tele_command_t *to = &script->c[l];
+                to->length = from->length;
+                to->separator = from->separator;
+                to->comment = from->comment;
+                for (uint8_t w = 0; w < COMMAND_MAX_LENGTH; w++)
+                    td_set(&to->data[w], from->data[w].tag,
+                           from->data[w].value);
+                script->every[l] = old->scripts[s].every[l];
+            }
+        }
+        memcpy(ss_patterns_ptr(&flash_scene), &old->patterns,
+               ss_patterns_size());
+        memcpy(&grid_data, &old->grid_data, sizeof(grid_data_t));
+        unpack_grid(&flash_scene);
+        memcpy(text, &old->text, SCENE_TEXT_LINES * SCENE_TEXT_CHARS);
+
+        flash_write(i, &flash_scene, &text);
+    }
+
+    flash_update_cal(&cal);
+    flash_update_device_config(&device_config);
+    flash_update_last_saved_scene(last_scene < SCENE_SLOTS ? last_scene : 0);
+    flash_update_last_mode(last_mode);
+    flashc_memset8((void *)&f.fresh, FIRSTRUN_KEY, 1, true);
+    flashc_memset8((void *)&old_f->fresh, 0, 1, true);
+}
+
 static void pack_grid(scene_state_t *scene) {
     uint8_t byte = 0;
     uint8_t byte_count = 0;
@@ -15,6 +15,8 @@
 // holds the current scene
 extern scene_state_t scene_state;
 extern char scene_text[SCENE_TEXT_LINES][SCENE_TEXT_CHARS];
+// the scripts being run a slice at a time (see SCRIPT.SLICE)
+extern script_runs_t script_runs;
 
 // the current preset
 extern uint8_t preset_select;
@@ -120,7 +120,7 @@ const char* help2[HELP2_LENGTH] = { "2/16 VARIABLES",
                                     "PRINT X",
                                     "    GET/PRINT VALUE" };
 
-#define HELP3_LENGTH 61
+#define HELP3_LENGTH 68
 const char* help3[HELP3_LENGTH] = { "3/16 PARAMETERS",
                                     " ",
                                     "TR A-D|SET TR VALUE (0,1)",
@@ -161,6 +161,13 @@ const char* help3[HELP3_LENGTH] = { "3/16 PARAMETERS",
                                     "SCRIPT.POL",
                                     "   GET/SET ACTIVE SCRIPT EDGES",
                                     "   1 RISING, 2 FALLING, 3 BOTH",
+                                    "SCRIPT.SLICE",
+                                    "   WORDS PER SLICE, 0 RUN ALL",
+                                    "SCRIPT.Q X|GET/SET TRIGGER QUEUE",
+                                    "SCRIPT.QP X|GET/SET QUEUE POLICY",
+                                    "   0 DROP NEW, 1 OLD, 2 MERGE",
+                                    "SCRIPT.DROP X|DROPPED TRIGGERS",
+                                    "SCRIPT.OVER X|QUEUE OVERRUNS",
                                     "SCENE|GET/SET SCENE #",
                                     "SCENE.G|SET SCENE, EXCL GRID",
                                     "SCENE.P|SET SCENE, EXCL PATTERN",
@@ -321,13 +321,11 @@ void execute_line() {
     dirty |= D_INPUT;
 
     tele_command_t command;
+    compiled_command_t compiled;
     command.comment = false;
 
-    status = parse(line_editor_get(&le), &command, error_msg);
-    if (status != E_OK)
-        return;  // quit, screen_refresh_live will display the error message
-
-    status = validate(&command, error_msg);
+    status = parse_and_compile(line_editor_get(&le), &command, &compiled,
+                               error_msg);
     if (status != E_OK)
         return;  // quit, screen_refresh_live will display the error message
 
@@ -355,7 +353,8 @@ void execute_line() {
         memcpy(&history[0], &command, sizeof(command));
 
         ss_clear_script(&scene_state, TEMP_SCRIPT);
-        ss_overwrite_script_command(&scene_state, TEMP_SCRIPT, 0, &command);
+        ss_overwrite_script_compiled(&scene_state, TEMP_SCRIPT, 0, &command,
+                                     &compiled);
         exec_state_t es;
         es_init(&es);
         es_push(&es);
@@ -724,6 +723,9 @@ void refresh_activities() {
         uint8_t script_pol = ss_get_script_pol(&scene_state, i);
         if (script_pol & 1) { line[0].data[87 + i + stagger] = mute_fg; }
         if (script_pol & 2) { line[0].data[87 + i + stagger + 1] = mute_fg; }
+        // inputs that have dropped trigger edges, see SCRIPT.DROP
+        line[0].data[87 + i + 640] =
+            scene_state.triggers.inputs[i].dropped ? 15 : 0;
     }
 
     line[0].dirty = 1;
@@ -34,8 +34,8 @@
 #include "util.h"
 
 // this
-#include "chaos.h"
 #include "conf_board.h"
+#include "dispatch.h"
 #include "edit_mode.h"
 #include "flash.h"
 #include "globals.h"
@@ -52,20 +52,16 @@
 
 #ifdef TELETYPE_PROFILE
 #include "profile.h"
+#include "profiler.h"
 
-profile_t prof_Script[SCRIPT_COUNT], prof_Delay[DELAY_SIZE], prof_CV, prof_ADC,
-    prof_ScreenRefresh;
-
-void tele_profile_script(size_t s) {
-    profile_update(&prof_Script[s]);
-}
+profile_t prof_CV, prof_ADC, prof_ScreenRefresh;
+#endif
 
-void tele_profile_delay(uint8_t d) {
-    profile_update(&prof_Delay[d]);
+void tele_profile_print(const char *line) {
+    print_dbg("\r\n");
+    print_dbg(line);
 }
 
-#endif
-
 ////////////////////////////////////////////////////////////////////////////////
 // constants
 
@@ -79,6 +75,7 @@ void tele_profile_delay(uint8_t d) {
 
 scene_state_t scene_state;
 char scene_text[SCENE_TEXT_LINES][SCENE_TEXT_CHARS];
+script_runs_t script_runs;
 uint8_t preset_select;
 region line[8] = {
     {.w = 128, .h = 8, .x = 0, .y = 0 },  {.w = 128, .h = 8, .x = 0, .y = 8 },
@@ -121,6 +118,14 @@ static uint8_t mod_key = 0, hold_key, hold_key_count = 0;
 static uint64_t last_adc_tick = 0;
 static midi_behavior_t midi_behavior;
 
+// the next delay or TR pulse deadline, kept up to date by check_events so that
+// deadlineTimer_callback doesn't need to look at scene_state
+static volatile bool deadline_pending = false;
+static volatile uint32_t next_deadline;
+
+// the events taken from the event queue, see check_events
+static dispatch_t dispatch;
+
 // timers
 static softTimer_t clockTimer = {.next = NULL, .prev = NULL };
 static softTimer_t refreshTimer = {.next = NULL, .prev = NULL };
@@ -133,6 +138,7 @@ static softTimer_t monomePollTimer = {.next = NULL, .prev = NULL };
 static softTimer_t monomeRefreshTimer = {.next = NULL, .prev = NULL };
 static softTimer_t gridFaderTimer = {.next = NULL, .prev = NULL };
 static softTimer_t midiScriptTimer = {.next = NULL, .prev = NULL };
+static softTimer_t deadlineTimer = {.next = NULL, .prev = NULL };
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -150,6 +156,7 @@ static void monome_poll_timer_callback(void* obj);
 static void monome_refresh_timer_callback(void* obj);
 static void grid_fader_timer_callback(void* obj);
 static void midiScriptTimer_callback(void* obj);
+static void deadlineTimer_callback(void* o);
 
 // event handler prototypes
 static void handler_None(int32_t data);
@@ -282,6 +289,16 @@ void metroTimer_callback(void* o) {
     event_post(&e);
 }
 
+// runs every ms so that delays and TR pulses happen on the ms they are due
+// rather than on the next clockTimer tick
+void deadlineTimer_callback(void* o) {
+    if (deadline_pending && (int32_t)(get_ticks() - next_deadline) >= 0) {
+        deadline_pending = false;
+        event_t e = {.type = kEventTimer, .data = 1 };
+        event_post(&e);
+    }
+}
+
 // monome polling callback
 static void monome_poll_timer_callback(void* obj) {
     // asynchronous, non-blocking read
@@ -493,15 +510,11 @@ void handler_Trigger(int32_t data) {
     u8 input = device_config.flip ? 7 - data : data;
     if (!ss_get_mute(&scene_state, input)) {
         bool tr_state = gpio_get_pin_value(A00 + data);
-        if (tr_state) {
-            if (scene_state.variables.script_pol[input] & 1) {
-                run_script(&scene_state, input);
-            }
-        }
-        else {
-            if (scene_state.variables.script_pol[input] & 2) {
-                run_script(&scene_state, input);
-            }
+        uint8_t edge = tr_state ? 1 : 2;
+        if (scene_state.variables.script_pol[input] & edge) {
+            // the script runs from check_events, see SCRIPT.Q
+            if (!trigger_push(&scene_state.triggers, input, tr_state))
+                set_mutes_updated();
         }
     }
 }
@@ -535,7 +548,13 @@ void handler_ScreenRefresh(int32_t data) {
 }
 
 void handler_EventTimer(int32_t data) {
-    tele_tick(&scene_state, RATE_CLOCK);
+    // posted by deadlineTimer_callback
+    if (data) {
+        tele_run_deadlines(&scene_state);
+        return;
+    }
+
+    tele_tick(&scene_state);
 
     if (ss_counter < SS_TIMEOUT) {
         ss_counter++;
@@ -553,8 +572,9 @@ void handler_AppCustom(int32_t data) {
     // data argument. For now, we're just using it for the metro
     if (ss_get_script_len(&scene_state, METRO_SCRIPT)) {
         set_metro_icon(true);
-        run_script(&scene_state, METRO_SCRIPT);
-        if (grid_connected && grid_control_mode)
+        // skipped while the last tick's run is still going a slice at a time
+        if (tele_run_script(&scene_state, &script_runs, METRO_SCRIPT) &&
+            grid_connected && grid_control_mode)
             grid_metro_triggered(&scene_state);
     }
     else
@@ -741,7 +761,42 @@ static void assign_msc_event_handlers(void) {
 // app event loop
 void check_events(void) {
     event_t e;
-    if (event_next(&e)) { (app_event_handlers)[e.type](e.data); }
+    bool ran = false;
+
+    // take all the events there's room for, so that triggers, the metro and
+    // delays go ahead of any screen refreshes and keys that arrived first
+    while (!dispatch_full(&dispatch) && event_next(&e))
+        dispatch_push(&dispatch, dispatch_priority(e.type), e.type, e.data);
+
+    uint8_t type;
+    int32_t data;
+    if (dispatch_pop(&dispatch, &type, &data)) {
+        (app_event_handlers)[type](data);
+        ran = true;
+    }
+
+    // a script for one queued trigger edge a turn, so that the other events
+    // get in between a burst of them
+    bool tr_state;
+    int8_t input = trigger_pop(&scene_state.triggers,
+                               tele_running_inputs(&script_runs), &tr_state);
+    if (input >= 0) {
+        tele_run_script(&scene_state, &script_runs, input);
+        ran = true;
+    }
+
+    // each script running a slice at a time (see SCRIPT.SLICE) gets a slice
+    ran |= tele_run_slices(&scene_state, &script_runs);
+
+    if (ran) {
+        // any event or script may have added or run delays and TR pulses
+        uint32_t deadline;
+        deadline_pending = false;
+        if (tele_next_deadline(&scene_state, &deadline)) {
+            next_deadline = deadline;
+            deadline_pending = true;
+        }
+    }
 }
 
 
@@ -1067,12 +1122,15 @@ void tele_ii_rx(uint8_t addr, uint8_t* data, uint8_t l) {
 void tele_scene(uint8_t i, uint8_t init_grid, uint8_t init_pattern) {
     if (i >= SCENE_SLOTS) return;
     preset_select = i;
+    script_runs_init_others(&script_runs);
     flash_read(i, &scene_state, &scene_text, init_pattern, init_grid, 0);
     set_dash_updated();
     if (init_grid) scene_state.grid.scr_dirty = scene_state.grid.grid_dirty = 1;
 }
 
 void tele_kill() {
+    script_runs_init(&script_runs);
+    trigger_clear(&scene_state.triggers);
     for (int i = 0; i < 4; i++) {
         aout[i].step = 1;
         tele_tr(i, 0);
@@ -1115,6 +1173,7 @@ int main(void) {
     init_gpio();
     assign_main_event_handlers();
     init_events();
+    dispatch_init(&dispatch);
     init_tc();
     init_spi();
     init_adc();
@@ -1136,6 +1195,7 @@ int main(void) {
     print_dbg("\r\n\r\n// teletype! //////////////////////////////// ");
 
     ss_init(&scene_state);
+    script_runs_init(&script_runs);
 
     // screen init
     render_init();
@@ -1191,6 +1251,7 @@ int main(void) {
     timer_add(&refreshTimer, 63, &refreshTimer_callback, NULL);
     timer_add(&gridFaderTimer, 25, &grid_fader_timer_callback, NULL);
     timer_add(&midiScriptTimer, 25, &midiScriptTimer_callback, NULL);
+    timer_add(&deadlineTimer, 1, &deadlineTimer_callback, NULL);
 
     // update IN and PARAM in case Init uses them
     tele_update_adc(1);
@@ -1199,8 +1260,6 @@ int main(void) {
     metro_timer_enabled = false;
     tele_metro_updated();
 
-    // init chaos generator
-    chaos_init();
     clear_delays(&scene_state);
 
     aout[0].slew = 1;
@@ -1223,18 +1282,9 @@ int main(void) {
 #ifdef TELETYPE_PROFILE
         count = (count + 1) % (FCPU_HZ / 10);
         if (count == 0) {
+            print_dbg("\r\n");
+            profiler_dump(tele_profile_print);
             print_dbg("\r\n\r\nProfile Data (us)");
-            for (uint8_t i = 0; i < SCRIPT_COUNT - 1; i++) {
-                print_dbg("\r\nScript ");
-                print_dbg_ulong(i);
-                print_dbg(":\t");
-                print_dbg_ulong(profile_delta_us(&prof_Script[i]));
-            }
-            uint32_t total = 0;
-            for (uint8_t i = 0; i < DELAY_SIZE; i++)
-                total += profile_delta_us(&prof_Delay[i]);
-            print_dbg("\r\nDelays (total):\t");
-            print_dbg_ulong(total);
             print_dbg("\r\nCV Write:\t");
             print_dbg_ulong(profile_delta_us(&prof_CV));
             print_dbg("\r\nADC Read:\t");
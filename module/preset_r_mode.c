@@ -113,6 +113,8 @@ void do_preset_read() {
     ss_set_scene(&scene_state, preset_select);
 
     set_dash_updated();
+    script_runs_init(&script_runs);
+    trigger_clear(&scene_state.triggers);
     scene_state.initializing = true;
     run_script(&scene_state, INIT_SCRIPT);
     scene_state.initializing = false;
@@ -71,7 +71,8 @@ void tele_usb_disk() {
         region_draw(&line[0]);
 
         for (int i = 0; i < SCENE_SLOTS; i++) {
-            scene_state_t scene;
+            // static as it's too big for the stack
+            static scene_state_t scene;
             ss_init(&scene);
 
             char text[SCENE_TEXT_LINES][SCENE_TEXT_CHARS];
@@ -222,7 +223,8 @@ void tele_usb_disk() {
         region_draw(&line[1]);
 
         for (int i = 0; i < SCENE_SLOTS; i++) {
-            scene_state_t scene;
+            // static as it's too big for the stack
+            static scene_state_t scene;
             ss_init(&scene);
             char text[SCENE_TEXT_LINES][SCENE_TEXT_CHARS];
             memset(text, 0, SCENE_TEXT_LINES * SCENE_TEXT_CHARS);
@@ -302,26 +304,17 @@ void tele_usb_disk() {
                             if (c == '\n') {
                                 if (p && l < SCRIPT_MAX_COMMANDS) {
                                     tele_command_t temp;
+                                    compiled_command_t compiled;
                                     temp.comment = false;
                                     error_t status;
                                     char error_msg[TELE_ERROR_MSG_LENGTH];
-                                    status = parse(input, &temp, error_msg);
+                                    status = parse_and_compile(
+                                        input, &temp, &compiled, error_msg);
 
                                     if (status == E_OK) {
-                                        status = validate(&temp, error_msg);
-
-                                        if (status == E_OK) {
-                                            ss_overwrite_script_command(
-                                                &scene, s, l, &temp);
-                                            l++;
-                                        }
-                                        else {
-                                            print_dbg("\r\nvalidate: ");
-                                            print_dbg(tele_error(status));
-                                            print_dbg(" >> ");
-                                            print_dbg("\r\nINPUT: ");
-                                            print_dbg(input);
-                                        }
+                                        ss_overwrite_script_compiled(
+                                            &scene, s, l, &temp, &compiled);
+                                        l++;
                                     }
                                     else {
                                         print_dbg("\r\nERROR: ");
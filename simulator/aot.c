@@ -0,0 +1,74 @@
+#include "aot.h"
+
+// FNV-1a
+static uint32_t hash_bytes(uint32_t h, const void *data, size_t length) {
+    const uint8_t *p = data;
+    for (size_t i = 0; i < length; i++) {
+        h ^= p[i];
+        h *= 16777619;
+    }
+    return h;
+}
+
+static uint32_t hash_u32(uint32_t h, uint32_t v) {
+    return hash_bytes(h, &v, sizeof(v));
+}
+
+uint32_t aot_hash(scene_state_t *ss) {
+    uint32_t h = 2166136261;
+    // the generated C has offsets in to scene_state_t and OP indices
+    h = hash_u32(h, sizeof(scene_state_t));
+    h = hash_u32(h, E_OP__LENGTH);
+    h = hash_u32(h, E_MOD__LENGTH);
+
+    for (size_t s = 0; s <= INIT_SCRIPT; s++) {
+        const uint8_t len = ss_get_script_len(ss, s);
+        h = hash_u32(h, len);
+        for (size_t i = 0; i < len; i++) {
+            const tele_command_t *c = ss_get_script_command(ss, s, i);
+            h = hash_u32(h, ss_get_script_comment(ss, s, i));
+            h = hash_u32(h, c->length);
+            h = hash_u32(h, (uint32_t)c->separator);
+            h = hash_bytes(h, c->data, c->length * sizeof(tele_data_t));
+        }
+    }
+
+    return h;
+}
+
+const aot_scene_t *aot_find(scene_state_t *ss) {
+    const uint32_t h = aot_hash(ss);
+    for (size_t i = 0; aot_scenes[i]; i++)
+        if (aot_scenes[i]->hash == h) return aot_scenes[i];
+    return NULL;
+}
+
+void aot_run_script(const aot_scene_t *a, scene_state_t *ss, size_t script_no) {
+    exec_state_t es;
+    es_init(&es);
+    es_push(&es);
+    a->scripts[script_no](ss, &es);
+}
+
+void aot_run_line(scene_state_t *ss, exec_state_t *es, size_t script_no,
+                  size_t line_no) {
+    const tele_command_view_t command = {
+        .base = ss_get_script_command(ss, script_no, line_no),
+        .compiled = ss_get_script_compiled(ss, script_no, line_no),
+        .offset = 0,
+        .length = ss_get_script_command(ss, script_no, line_no)->length
+    };
+    process_command(ss, es, &command);
+}
+
+tele_command_view_t aot_post(scene_state_t *ss, size_t script_no,
+                             size_t line_no) {
+    const tele_command_t *c = ss_get_script_command(ss, script_no, line_no);
+    const tele_command_view_t post = {
+        .base = c,
+        .compiled = ss_get_script_compiled(ss, script_no, line_no),
+        .offset = c->separator + 1,
+        .length = c->length - c->separator - 1
+    };
+    return post;
+}
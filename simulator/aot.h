@@ -0,0 +1,119 @@
+#ifndef _AOT_H_
+#define _AOT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ops/controlflow.h"
+#include "ops/maths.h"
+#include "ops/op.h"
+#include "state.h"
+#include "teletype.h"
+#include "teletype_io.h"
+
+// Scenes compiled ahead of time by ttc (see ttc.c) in to a C function per
+// script, which runner and batch link in and use in place of run_script for
+// any scene they load that has the same scripts. The generated C only uses
+// what's declared here.
+
+typedef void (*aot_script_t)(scene_state_t *ss, exec_state_t *es);
+
+typedef struct {
+    const char *name;
+    // aot_hash of the scene that was compiled
+    uint32_t hash;
+    // the scripts that run_script can run, 1 to 8, M and I
+    aot_script_t scripts[INIT_SCRIPT + 1];
+} aot_scene_t;
+
+// the compiled scenes, ending with NULL, this comes from the generated C
+extern const aot_scene_t *const aot_scenes[];
+
+// a hash of the scripts of ss and of the layout of scene_state_t, so that a
+// compiled scene is only used for the scene it was compiled from, by a build
+// of the same tree
+uint32_t aot_hash(scene_state_t *ss);
+// the compiled scene for the scripts of ss, or NULL
+const aot_scene_t *aot_find(scene_state_t *ss);
+// runs a script of a compiled scene as run_script does
+void aot_run_script(const aot_scene_t *a, scene_state_t *ss, size_t script_no);
+
+// what the generated C falls back to for lines it doesn't compile, and for
+// MODs that run their POST command themselves (e.g. DEL)
+void aot_run_line(scene_state_t *ss, exec_state_t *es, size_t script_no,
+                  size_t line_no);
+tele_command_view_t aot_post(scene_state_t *ss, size_t script_no,
+                             size_t line_no);
+
+
+////////////////////////////////////////////////////////////////////////////////
+// inline OPs, the others are the *_value helpers of ops/maths.h
+
+// es_variables, without a call
+#define AOT_EV(es) (&(es)->variables[(es)->exec_depth - 1])
+
+// the OPs that are a C operator, the first param is a, as it's the first off
+// the stack
+static inline int16_t aot_add(int16_t a, int16_t b) {
+    return a + b;
+}
+
+static inline int16_t aot_sub(int16_t a, int16_t b) {
+    return a - b;
+}
+
+static inline int16_t aot_eq(int16_t a, int16_t b) {
+    return a == b;
+}
+
+static inline int16_t aot_ne(int16_t a, int16_t b) {
+    return a != b;
+}
+
+static inline int16_t aot_lt(int16_t a, int16_t b) {
+    return a < b;
+}
+
+static inline int16_t aot_gt(int16_t a, int16_t b) {
+    return a > b;
+}
+
+static inline int16_t aot_lte(int16_t a, int16_t b) {
+    return a <= b;
+}
+
+static inline int16_t aot_gte(int16_t a, int16_t b) {
+    return a >= b;
+}
+
+static inline int16_t aot_nz(int16_t a) {
+    return a != 0;
+}
+
+static inline int16_t aot_ez(int16_t a) {
+    return a == 0;
+}
+
+static inline int16_t aot_and(int16_t a, int16_t b) {
+    return a && b;
+}
+
+static inline int16_t aot_or(int16_t a, int16_t b) {
+    return a || b;
+}
+
+// the OPs with a random state
+static inline int16_t aot_rand(scene_state_t *ss, int16_t a) {
+    return rand_value(&ss->rand_states.s.rand.rand, a);
+}
+
+static inline int16_t aot_rrand(scene_state_t *ss, int16_t a, int16_t b) {
+    return rrand_value(&ss->rand_states.s.rand.rand, a, b);
+}
+
+static inline int16_t aot_toss(scene_state_t *ss) {
+    return toss_value(&ss->rand_states.s.toss.rand);
+}
+
+#endif
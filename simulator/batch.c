@@ -0,0 +1,273 @@
+// Batch scene renderer
+//
+// Renders many scenes at once, one per thread, each against its own virtual
+// clock, and writes a trace per scene in the same format as runner. Either
+// give it a list of scene files, or one scene and -n to render it with n
+// different SEEDs:
+//
+//     batch -o out a.txt b.txt c.txt    writes out/a.txt, out/b.txt, out/c.txt
+//     batch -o out -n 100 a.txt         writes out/a.0.txt ... out/a.99.txt
+//
+// With -m the seeds are rendered in groups of that many lanes, each group on
+// a thread, with the variables of the group kept together so that most lines
+// of script run across the whole group at once (see lanes.h). A scene that
+// uses SCRIPT.SLICE can't run on lanes, its seeds are rendered one at a time
+// on the group's thread instead.
+//
+// Every scene is seeded (with -s, or 0) after it's loaded, so that a trace
+// only depends on the scene, the seed and the events, the same scene run with
+// `runner -s` gives the same trace. All the scenes share the events from -e.
+//
+// Scenes compiled in to the build (see ttc.c) run their compiled scripts,
+// unless -i is given, but not with -m.
+//
+// When it's done it prints how many seconds of scene time it rendered per
+// second of wall time.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "lanes.h"
+#include "render.h"
+#include "scene_file.h"
+
+#ifdef TELETYPE_PROFILE
+#error "the profiler isn't thread safe, use runner to profile a scene"
+#endif
+
+typedef struct {
+    const char *scene_path;
+    uint16_t seed;
+    // with -m, render seeds seed to seed + lanes - 1 together
+    size_t lanes;
+} job_t;
+
+static job_t *jobs;
+static size_t job_count;
+static size_t next_job = 0;
+static pthread_mutex_t job_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static uint32_t duration = 60000;
+static const event_t *events = NULL;
+static size_t event_count = 0;
+static const char *out_dir = NULL;
+static size_t seeds = 0;
+static bool interpret = false;
+
+static size_t rendered = 0;
+static uint64_t outputs = 0;
+
+
+// the file name of path without its extension
+static void base_name(const char *path, char *out, size_t size) {
+    const char *slash = strrchr(path, '/');
+    const char *start = slash ? slash + 1 : path;
+    const char *dot = strrchr(start, '.');
+    size_t length = dot && dot != start ? (size_t)(dot - start) : strlen(start);
+    if (length >= size) length = size - 1;
+    memcpy(out, start, length);
+    out[length] = '\0';
+}
+
+// opens the trace of a scene and loads it in to r
+static bool load(render_t *r, const char *scene_path, uint16_t seed) {
+    char base[128];
+    char trace_path[256];
+    base_name(scene_path, base, sizeof(base));
+    if (seeds)
+        snprintf(trace_path, sizeof(trace_path), "%s/%s.%" PRIu16 ".txt",
+                 out_dir, base, seed);
+    else
+        snprintf(trace_path, sizeof(trace_path), "%s/%s.txt", out_dir, base);
+
+    FILE *trace = fopen(trace_path, "w");
+    if (!trace) {
+        perror(trace_path);
+        return false;
+    }
+
+    render_init(r, trace, events, event_count);
+    FILE *f = fopen(scene_path, "r");
+    if (!f || !scene_file_read(f, &r->ss)) {
+        perror(scene_path);
+        if (f) fclose(f);
+        fclose(trace);
+        return false;
+    }
+    fclose(f);
+
+    ss_rand_seed(&r->ss, seed);
+    if (!interpret) r->aot = aot_find(&r->ss);
+    return true;
+}
+
+static void finish(render_t *r) {
+    fclose(r->trace);
+    pthread_mutex_lock(&job_lock);
+    rendered++;
+    outputs += r->trace_lines;
+    pthread_mutex_unlock(&job_lock);
+}
+
+static void render_job(const job_t *job) {
+    // a scene_state_t is too big for some threads' stacks
+    render_t *r = malloc(sizeof(render_t));
+    if (r && load(r, job->scene_path, job->seed)) {
+        render_run(r, duration);
+        finish(r);
+    }
+    free(r);
+}
+
+static void lanes_job(const job_t *job) {
+    render_t *r = malloc(job->lanes * sizeof(render_t));
+    size_t loaded = 0;
+    while (r && loaded < job->lanes &&
+           load(&r[loaded], job->scene_path, job->seed + loaded))
+        loaded++;
+
+    lanes_t l;
+    if (loaded == job->lanes && !lanes_can_run(&r[0].ss)) {
+        for (size_t i = 0; i < loaded; i++) {
+            render_run(&r[i], duration);
+            finish(&r[i]);
+        }
+    }
+    else if (loaded == job->lanes && lanes_init(&l, r, job->lanes)) {
+        lanes_run(&l, duration);
+        lanes_free(&l);
+        for (size_t i = 0; i < loaded; i++) finish(&r[i]);
+    }
+    else {
+        for (size_t i = 0; i < loaded; i++) fclose(r[i].trace);
+    }
+    free(r);
+}
+
+static void *worker(void *arg) {
+    while (true) {
+        pthread_mutex_lock(&job_lock);
+        size_t i = next_job++;
+        pthread_mutex_unlock(&job_lock);
+        if (i >= job_count) break;
+
+        if (jobs[i].lanes)
+            lanes_job(&jobs[i]);
+        else
+            render_job(&jobs[i]);
+    }
+
+    return NULL;
+}
+
+static double now(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: batch [-t ms] [-e events] [-j threads] [-s seed] "
+            "[-n seeds [-m lanes]] [-i] -o dir scene.txt...\n"
+            "  -t ms       how long to run each scene for (default 60000)\n"
+            "  -e events   file of input events to play to every scene\n"
+            "  -j threads  how many scenes to render at once (default one "
+            "per core)\n"
+            "  -s seed     the SEED for every scene (default 0)\n"
+            "  -n seeds    render a single scene with seeds seed to "
+            "seed + n - 1\n"
+            "  -m lanes    render that many seeds at a time on each thread\n"
+            "  -i          interpret scenes even if they're compiled in\n"
+            "  -o dir      write the traces here\n");
+    exit(1);
+}
+
+int main(int argc, char **argv) {
+    const char *events_path = NULL;
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    uint16_t first_seed = 0;
+    size_t lanes = 0;
+    const char **scene_paths = malloc(argc * sizeof(char *));
+    size_t scene_count = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+            duration = strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc)
+            events_path = argv[++i];
+        else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+            threads = strtol(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+            first_seed = strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            seeds = strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc)
+            lanes = strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            out_dir = argv[++i];
+        else if (strcmp(argv[i], "-i") == 0)
+            interpret = true;
+        else if (argv[i][0] != '-')
+            scene_paths[scene_count++] = argv[i];
+        else
+            usage();
+    }
+    if (!out_dir || scene_count == 0 || (seeds && scene_count != 1) ||
+        (lanes && !seeds))
+        usage();
+    if (threads < 1) threads = 1;
+
+    if (events_path) {
+        FILE *f = fopen(events_path, "r");
+        event_t *e = NULL;
+        if (!f || !(e = render_read_events(f, &event_count))) {
+            perror(events_path);
+            return 1;
+        }
+        fclose(f);
+        events = e;
+    }
+
+    size_t scenes = seeds ? seeds : scene_count;
+    size_t per_job = lanes ? lanes : 1;
+    job_count = (scenes + per_job - 1) / per_job;
+    jobs = malloc(job_count * sizeof(job_t));
+    for (size_t i = 0; i < job_count; i++) {
+        jobs[i].scene_path = scene_paths[seeds ? 0 : i];
+        jobs[i].seed = seeds ? first_seed + i * per_job : first_seed;
+        jobs[i].lanes = 0;
+        if (lanes)
+            jobs[i].lanes = i + 1 < job_count ? lanes : scenes - i * per_job;
+    }
+
+    if ((size_t)threads > job_count) threads = job_count;
+    pthread_t *pool = malloc(threads * sizeof(pthread_t));
+
+    double start = now();
+    for (long i = 0; i < threads; i++)
+        pthread_create(&pool[i], NULL, worker, NULL);
+    for (long i = 0; i < threads; i++) pthread_join(pool[i], NULL);
+    double elapsed = now() - start;
+
+    double simulated = (double)duration / 1000.0 * rendered;
+    fprintf(stderr,
+            "rendered %zu scenes of %" PRIu32 " ms on %ld threads in %.3f s, "
+            "%.0f simulated s per s, %" PRIu64 " outputs\n",
+            rendered, duration, threads, elapsed,
+            elapsed > 0 ? simulated / elapsed : 0, outputs);
+
+    free(pool);
+    free(jobs);
+    free((event_t *)events);
+    free(scene_paths);
+
+    return rendered == scenes ? 0 : 1;
+}
@@ -0,0 +1,680 @@
+#include "lanes.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ops/controlflow.h"
+#include "ops/maths.h"
+#include "ops/op.h"
+#include "teletype.h"
+#include "teletype_io.h"
+
+// must match module/main.c
+#define RATE_CLOCK 10
+
+static const size_t var_offsets[LANE_VARS] = {
+    offsetof(scene_state_t, variables.a), offsetof(scene_state_t, variables.b),
+    offsetof(scene_state_t, variables.c), offsetof(scene_state_t, variables.d),
+    offsetof(scene_state_t, variables.x), offsetof(scene_state_t, variables.y),
+    offsetof(scene_state_t, variables.z), offsetof(scene_state_t, variables.t)
+};
+
+typedef enum {
+    K_CLEAR,  // the start of a sub
+    K_NUMBER,
+    K_GET,
+    K_SET,
+    K_ADD,
+    K_SUB,
+    K_MUL,
+    K_DIV,
+    K_MOD,
+    K_MIN,
+    K_MAX,
+    K_LIM,
+    K_WRAP,
+    K_AVG,
+    K_EQ,
+    K_NE,
+    K_LT,
+    K_GT,
+    K_LTE,
+    K_GTE,
+    K_NZ,
+    K_EZ,
+    K_ABS,
+    K_SGN,
+    K_AND,
+    K_OR,
+    K_RAND,
+    K_RRAND,
+    K_TOSS
+} kernel_t;
+
+// OPs are matched by their get fn, so that aliases match too
+static const struct {
+    const tele_op_t *op;
+    kernel_t kernel;
+} vector_ops[] = {
+    { &op_ADD, K_ADD },     { &op_SUB, K_SUB },     { &op_MUL, K_MUL },
+    { &op_DIV, K_DIV },     { &op_MOD, K_MOD },     { &op_MIN, K_MIN },
+    { &op_MAX, K_MAX },     { &op_LIM, K_LIM },     { &op_WRAP, K_WRAP },
+    { &op_AVG, K_AVG },     { &op_EQ, K_EQ },       { &op_NE, K_NE },
+    { &op_LT, K_LT },       { &op_GT, K_GT },       { &op_LTE, K_LTE },
+    { &op_GTE, K_GTE },     { &op_NZ, K_NZ },       { &op_EZ, K_EZ },
+    { &op_ABS, K_ABS },     { &op_SGN, K_SGN },     { &op_AND, K_AND },
+    { &op_OR, K_OR },       { &op_RAND, K_RAND },   { &op_RRAND, K_RRAND },
+    { &op_TOSS, K_TOSS }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// planning
+
+static int8_t lane_var(int16_t op) {
+    if (tele_ops[op]->get != op_peek_i16) return -1;
+    for (int8_t v = 0; v < LANE_VARS; v++)
+        if ((size_t)tele_op_data[op] == var_offsets[v]) return v;
+    return -1;
+}
+
+static void add_step(lane_line_t *line, kernel_t kernel, int16_t value) {
+    line->steps[line->step_count].kernel = kernel;
+    line->steps[line->step_count].value = value;
+    line->step_count++;
+}
+
+// works out the steps of a line, returns false if it has to run on each lane
+static bool plan_line(lane_line_t *line, const tele_command_t *c,
+                      const compiled_command_t *cc) {
+    line->step_count = 0;
+
+    // a MOD decides for itself whether to run its POST command
+    if (c->separator != -1) return false;
+
+    for (uint8_t s = 0; s < cc->pre_count; s++) {
+        uint8_t depth = 0;
+        add_step(line, K_CLEAR, 0);
+
+        // right to left, as process_command runs it
+        for (int8_t idx = cc->subs[s].end; idx >= cc->subs[s].start; idx--) {
+            const tele_word_t tag = td_tag(&c->data[idx]);
+            const int16_t value = td_value(&c->data[idx]);
+
+            if (cc->fold_ends & (1 << idx)) {
+                for (uint8_t f = 0; f < cc->fold_count; f++) {
+                    if (cc->folds[f].end == idx) {
+                        add_step(line, K_NUMBER, cc->folds[f].value);
+                        idx = cc->folds[f].start;
+                        break;
+                    }
+                }
+                depth++;
+            }
+            else if (td_is_number(&c->data[idx])) {
+                add_step(line, K_NUMBER, value);
+                depth++;
+            }
+            else if (tag == OP && lane_var(value) >= 0) {
+                if (op_compiled_fn(c, cc, idx) == op_poke_i16) {
+                    if (depth == 0) return false;
+                    add_step(line, K_SET, lane_var(value));
+                    depth--;
+                }
+                else {
+                    add_step(line, K_GET, lane_var(value));
+                    depth++;
+                }
+            }
+            else if (tag == OP) {
+                size_t i = 0;
+                while (i < sizeof(vector_ops) / sizeof(vector_ops[0]) &&
+                       vector_ops[i].op->get != op_compiled_fn(c, cc, idx))
+                    i++;
+                if (i == sizeof(vector_ops) / sizeof(vector_ops[0]))
+                    return false;
+
+                const uint8_t params = tele_ops[value]->params;
+                if (depth < params) return false;
+                add_step(line, vector_ops[i].kernel, 0);
+                depth = depth - params + 1;
+            }
+            else
+                return false;
+
+            if (depth > STACK_SIZE) return false;
+        }
+    }
+
+    return true;
+}
+
+// a line of just SCRIPT n, returns the script it calls or -1
+static int8_t plan_call(const tele_command_t *c, const compiled_command_t *cc) {
+    if (c->length != 2 || c->separator != -1 || td_tag(&c->data[0]) != OP ||
+        op_compiled_fn(c, cc, 0) != op_SCRIPT.set ||
+        td_tag(&c->data[1]) != NUMBER)
+        return -1;
+
+    // as op_SCRIPT_set checks it
+    uint16_t a = td_value(&c->data[1]) - 1;
+    return a <= INIT_SCRIPT ? a : -1;
+}
+
+static void plan(lanes_t *l) {
+    scene_state_t *ss = &l->render[0].ss;
+    for (size_t s = 0; s < SCRIPT_COUNT; s++) {
+        l->script_len[s] = ss_get_script_len(ss, s);
+        for (size_t i = 0; i < l->script_len[s]; i++) {
+            const tele_command_t *c = ss_get_script_command(ss, s, i);
+            const compiled_command_t *cc = ss_get_script_compiled(ss, s, i);
+            l->lines[s][i].comment = ss_get_script_comment(ss, s, i);
+            l->lines[s][i].call = plan_call(c, cc);
+            l->lines[s][i].vector = plan_line(&l->lines[s][i], c, cc);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// running across lanes
+
+// Runs the steps of a line on every lane, for the lanes that aren't running
+// only the values on the stack change, and those are thrown away. Each step
+// is a loop over the lanes, those without side effects run on every lane so
+// that the compiler can vectorise them.
+static void run_vector(lanes_t *l, const lane_line_t *line,
+                       const bool *running) {
+    const size_t n = l->count;
+    uint8_t top = 0;
+
+    for (uint8_t s = 0; s < line->step_count; s++) {
+        const lane_step_t *step = &line->steps[s];
+        // the first param is at the top of the stack
+        int16_t *a = top > 0 ? l->stack[top - 1] : NULL;
+        int16_t *b = top > 1 ? l->stack[top - 2] : NULL;
+        int16_t *c = top > 2 ? l->stack[top - 3] : NULL;
+
+        switch (step->kernel) {
+            case K_CLEAR: top = 0; break;
+            case K_NUMBER:
+                for (size_t i = 0; i < n; i++) l->stack[top][i] = step->value;
+                top++;
+                break;
+            case K_GET:
+                memcpy(l->stack[top], l->vars[step->value],
+                       n * sizeof(int16_t));
+                top++;
+                break;
+            case K_SET:
+                for (size_t i = 0; i < n; i++)
+                    if (running[i]) l->vars[step->value][i] = a[i];
+                top--;
+                break;
+            case K_ADD:
+                for (size_t i = 0; i < n; i++) b[i] = a[i] + b[i];
+                top--;
+                break;
+            case K_SUB:
+                for (size_t i = 0; i < n; i++) b[i] = a[i] - b[i];
+                top--;
+                break;
+            case K_MUL:
+                for (size_t i = 0; i < n; i++) b[i] = mul_value(a[i], b[i]);
+                top--;
+                break;
+            case K_DIV:
+                for (size_t i = 0; i < n; i++) b[i] = div_value(a[i], b[i]);
+                top--;
+                break;
+            case K_MOD:
+                for (size_t i = 0; i < n; i++) b[i] = mod_value(a[i], b[i]);
+                top--;
+                break;
+            case K_MIN:
+                for (size_t i = 0; i < n; i++) b[i] = min_value(a[i], b[i]);
+                top--;
+                break;
+            case K_MAX:
+                for (size_t i = 0; i < n; i++) b[i] = max_value(a[i], b[i]);
+                top--;
+                break;
+            case K_LIM:
+                // LIM i a b
+                for (size_t i = 0; i < n; i++)
+                    c[i] = lim_value(a[i], b[i], c[i]);
+                top -= 2;
+                break;
+            case K_WRAP:
+                for (size_t i = 0; i < n; i++)
+                    c[i] = wrap_value(a[i], b[i], c[i]);
+                top -= 2;
+                break;
+            case K_AVG:
+                for (size_t i = 0; i < n; i++) b[i] = avg_value(a[i], b[i]);
+                top--;
+                break;
+            case K_EQ:
+                for (size_t i = 0; i < n; i++) b[i] = a[i] == b[i];
+                top--;
+                break;
+            case K_NE:
+                for (size_t i = 0; i < n; i++) b[i] = a[i] != b[i];
+                top--;
+                break;
+            case K_LT:
+                for (size_t i = 0; i < n; i++) b[i] = a[i] < b[i];
+                top--;
+                break;
+            case K_GT:
+                for (size_t i = 0; i < n; i++) b[i] = a[i] > b[i];
+                top--;
+                break;
+            case K_LTE:
+                for (size_t i = 0; i < n; i++) b[i] = a[i] <= b[i];
+                top--;
+                break;
+            case K_GTE:
+                for (size_t i = 0; i < n; i++) b[i] = a[i] >= b[i];
+                top--;
+                break;
+            case K_NZ:
+                for (size_t i = 0; i < n; i++) a[i] = a[i] != 0;
+                break;
+            case K_EZ:
+                for (size_t i = 0; i < n; i++) a[i] = a[i] == 0;
+                break;
+            case K_ABS:
+                for (size_t i = 0; i < n; i++) a[i] = abs_value(a[i]);
+                break;
+            case K_SGN:
+                for (size_t i = 0; i < n; i++) a[i] = sgn_value(a[i]);
+                break;
+            case K_AND:
+                for (size_t i = 0; i < n; i++) b[i] = a[i] && b[i];
+                top--;
+                break;
+            case K_OR:
+                for (size_t i = 0; i < n; i++) b[i] = a[i] || b[i];
+                top--;
+                break;
+            // each lane has its own random states, and they must only move
+            // on for the lanes that are running
+            case K_RAND:
+                for (size_t i = 0; i < n; i++) {
+                    if (!running[i]) continue;
+                    scene_state_t *ss = &l->render[i].ss;
+                    a[i] = rand_value(&ss->rand_states.s.rand.rand, a[i]);
+                }
+                break;
+            case K_RRAND:
+                for (size_t i = 0; i < n; i++) {
+                    if (!running[i]) continue;
+                    scene_state_t *ss = &l->render[i].ss;
+                    b[i] = rrand_value(&ss->rand_states.s.rand.rand, a[i],
+                                       b[i]);
+                }
+                top--;
+                break;
+            case K_TOSS:
+                for (size_t i = 0; i < n; i++) {
+                    if (!running[i]) continue;
+                    scene_state_t *ss = &l->render[i].ss;
+                    l->stack[top][i] = toss_value(&ss->rand_states.s.toss.rand);
+                }
+                top++;
+                break;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// running on a lane
+
+static void lane_select(lanes_t *l, size_t i) {
+    l->render[i].ticks = l->ticks;
+    render_select(&l->render[i]);
+}
+
+// copy the arrays of lane i in to its scene_state_t, before running anything
+// on it, and back afterwards, along with its metro and next deadline
+static void lane_enter(lanes_t *l, size_t i) {
+    char *base = (char *)&l->render[i].ss;
+    for (size_t v = 0; v < LANE_VARS; v++)
+        *(int16_t *)(base + var_offsets[v]) = l->vars[v][i];
+    lane_select(l, i);
+}
+
+static void lane_leave(lanes_t *l, size_t i) {
+    render_t *r = &l->render[i];
+    const char *base = (const char *)&r->ss;
+    for (size_t v = 0; v < LANE_VARS; v++)
+        l->vars[v][i] = *(const int16_t *)(base + var_offsets[v]);
+
+    l->metro_on[i] = r->metro_enabled;
+    l->metro_next[i] = r->metro_next;
+    l->pending[i] = tele_next_deadline(&r->ss, &l->deadline[i]);
+}
+
+// a line of a script, as run_script_with_exec_state runs it
+static void run_line(scene_state_t *ss, exec_state_t *es, size_t script_no,
+                     size_t line_no) {
+    const tele_command_view_t command = {
+        .base = ss_get_script_command(ss, script_no, line_no),
+        .compiled = ss_get_script_compiled(ss, script_no, line_no),
+        .offset = 0,
+        .length = ss_get_script_command(ss, script_no, line_no)->length
+    };
+
+    es_set_line_number(es, line_no);
+    do {
+        process_command(ss, es, &command);
+    } while (es_variables(es)->while_continue && !es_variables(es)->breaking);
+}
+
+static void run_lines(lanes_t *l, size_t script_no, uint8_t depth);
+
+// a line of SCRIPT n on the lanes running at depth, as op_SCRIPT_set runs it
+static void call_script(lanes_t *l, size_t script_no, uint8_t depth) {
+    const size_t n = l->count;
+    const bool *caller = l->running[depth];
+    bool *started = l->started[depth + 1];
+    bool any = false;
+
+    for (size_t i = 0; i < n; i++) {
+        started[i] = false;
+        if (!caller[i]) continue;
+
+        exec_state_t *es = &l->es[i];
+        es_push(es);
+        if (es->overflow) continue;
+
+        // see run_script_lanes
+        scene_state_t *ss = &l->render[i].ss;
+        if (ss_get_script_len(ss, script_no) != l->script_len[script_no]) {
+            lane_enter(l, i);
+            run_script_with_exec_state(ss, es, script_no);
+            lane_leave(l, i);
+            continue;
+        }
+
+        started[i] = true;
+        any = true;
+    }
+
+    if (any) run_lines(l, script_no, depth + 1);
+
+    for (size_t i = 0; i < n; i++)
+        if (caller[i]) es_pop(&l->es[i]);
+}
+
+// runs a script on the lanes in l->started[depth], as
+// run_script_with_exec_state runs it on each of them
+static void run_lines(lanes_t *l, size_t script_no, uint8_t depth) {
+    const size_t n = l->count;
+    const size_t len = l->script_len[script_no];
+    const bool *started = l->started[depth];
+    bool *running = l->running[depth];
+    bool any = false;
+
+    for (size_t i = 0; i < n; i++) {
+        running[i] = started[i];
+        if (running[i]) es_set_script_number(&l->es[i], script_no);
+        any |= running[i];
+    }
+
+    for (size_t line = 0; line < len && any; line++) {
+        const lane_line_t *plan = &l->lines[script_no][line];
+        if (plan->comment) continue;
+
+        // a lane stops at a BREAK, or if the script was cleared as it ran
+        any = false;
+        for (size_t i = 0; i < n; i++) {
+            if (running[i] &&
+                (es_variables(&l->es[i])->breaking ||
+                 ss_get_script_len(&l->render[i].ss, script_no) <= line))
+                running[i] = false;
+            any |= running[i];
+        }
+        if (!any) break;
+
+        if (plan->call >= 0 && depth + 1 < EXEC_DEPTH) {
+            for (size_t i = 0; i < n; i++)
+                if (running[i]) es_set_line_number(&l->es[i], line);
+            call_script(l, plan->call, depth);
+            continue;
+        }
+
+        if (plan->vector) {
+            run_vector(l, plan, running);
+            continue;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            if (!running[i]) continue;
+            lane_enter(l, i);
+            run_line(&l->render[i].ss, &l->es[i], script_no, line);
+            lane_leave(l, i);
+        }
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        if (!started[i]) continue;
+        es_variables(&l->es[i])->breaking = false;
+        lane_select(l, i);
+        ss_update_script_last(&l->render[i].ss, script_no);
+    }
+}
+
+// runs a script on the lanes in l->mask, as run_script does
+static void run_script_lanes(lanes_t *l, size_t script_no) {
+    bool *started = l->started[0];
+    bool any = false;
+
+    for (size_t i = 0; i < l->count; i++) {
+        started[i] = false;
+        if (!l->mask[i]) continue;
+
+        // INIT and INIT.SCRIPT can clear a lane's scripts, then it can't use
+        // the plan and runs the script on its own
+        scene_state_t *ss = &l->render[i].ss;
+        if (ss_get_script_len(ss, script_no) != l->script_len[script_no]) {
+            lane_enter(l, i);
+            run_script(ss, script_no);
+            lane_leave(l, i);
+            continue;
+        }
+
+        es_init(&l->es[i]);
+        es_push(&l->es[i]);
+        started[i] = true;
+        any = true;
+    }
+
+    if (any) run_lines(l, script_no, 0);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// lanes_t
+
+bool lanes_can_run(scene_state_t *ss) {
+    for (size_t s = 0; s < SCRIPT_COUNT; s++) {
+        for (size_t i = 0; i < ss_get_script_len(ss, s); i++) {
+            const tele_command_t *c = ss_get_script_command(ss, s, i);
+            for (size_t w = 0; w < c->length; w++) {
+                if (td_tag(&c->data[w]) != OP) continue;
+                const int16_t op = td_value(&c->data[w]);
+                if (op == E_OP_SCRIPT_SLICE || op == E_OP_SYM_DOLLAR_SLICE)
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool lanes_init(lanes_t *l, render_t *render, size_t count) {
+    memset(l, 0, sizeof(*l));
+    l->count = count;
+    l->render = render;
+
+    bool ok = true;
+    for (size_t v = 0; v < LANE_VARS; v++)
+        ok &= (l->vars[v] = malloc(count * sizeof(int16_t))) != NULL;
+    for (size_t s = 0; s < STACK_SIZE; s++)
+        ok &= (l->stack[s] = malloc(count * sizeof(int16_t))) != NULL;
+    ok &= (l->es = malloc(count * sizeof(exec_state_t))) != NULL;
+    ok &= (l->mask = malloc(count * sizeof(bool))) != NULL;
+    ok &= (l->popped = malloc(count * sizeof(int8_t))) != NULL;
+    ok &= (l->metro_on = malloc(count * sizeof(bool))) != NULL;
+    ok &= (l->metro_next = malloc(count * sizeof(uint32_t))) != NULL;
+    ok &= (l->pending = malloc(count * sizeof(bool))) != NULL;
+    ok &= (l->deadline = malloc(count * sizeof(uint32_t))) != NULL;
+    for (size_t d = 0; d < EXEC_DEPTH; d++) {
+        ok &= (l->started[d] = malloc(count * sizeof(bool))) != NULL;
+        ok &= (l->running[d] = malloc(count * sizeof(bool))) != NULL;
+    }
+
+    if (!ok) lanes_free(l);
+    return ok;
+}
+
+void lanes_free(lanes_t *l) {
+    for (size_t v = 0; v < LANE_VARS; v++) free(l->vars[v]);
+    for (size_t s = 0; s < STACK_SIZE; s++) free(l->stack[s]);
+    free(l->es);
+    free(l->mask);
+    free(l->popped);
+    free(l->metro_on);
+    free(l->metro_next);
+    free(l->pending);
+    free(l->deadline);
+    for (size_t d = 0; d < EXEC_DEPTH; d++) {
+        free(l->started[d]);
+        free(l->running[d]);
+    }
+    memset(l, 0, sizeof(*l));
+}
+
+// queues the edge on each lane that runs a script for it, as render_run does
+static void queue_input(lanes_t *l, uint8_t input, bool state) {
+    for (size_t i = 0; i < l->count; i++)
+        if (render_input(&l->render[i], input, state))
+            trigger_push(&l->render[i].ss.triggers, input, state);
+}
+
+// takes an edge off each lane's trigger queue and runs its script, on the
+// lanes that took one for the same input together, returns false if no lane
+// had an edge queued
+static bool run_queued(lanes_t *l) {
+    bool any = false;
+    for (size_t i = 0; i < l->count; i++) {
+        bool state;
+        // lanes run scripts to the end, so no input is ever busy
+        l->popped[i] = trigger_pop(&l->render[i].ss.triggers, 0, &state);
+        any |= l->popped[i] >= 0;
+    }
+    if (!any) return false;
+
+    for (uint8_t input = 0; input < TRIGGER_INPUTS; input++) {
+        bool run = false;
+        for (size_t i = 0; i < l->count; i++) {
+            l->mask[i] = l->popped[i] == input;
+            run |= l->mask[i];
+        }
+        if (run) run_script_lanes(l, input);
+    }
+    return true;
+}
+
+// tele_run_deadlines on the lanes that have something due
+static void run_deadlines(lanes_t *l, uint32_t ticks) {
+    for (size_t i = 0; i < l->count; i++) {
+        if (!l->pending[i] || (int32_t)(l->deadline[i] - ticks) > 0) continue;
+        lane_enter(l, i);
+        tele_run_deadlines(&l->render[i].ss);
+        lane_leave(l, i);
+    }
+}
+
+// follows render_run, a step at a time on every lane
+void lanes_run(lanes_t *l, uint32_t duration) {
+    const size_t n = l->count;
+    const event_t *events = l->render[0].events;
+    const size_t event_count = l->render[0].event_count;
+    size_t next_event = 0;
+
+    plan(l);
+
+    l->ticks = 0;
+    for (size_t i = 0; i < n; i++) {
+        lane_select(l, i);
+        clear_delays(&l->render[i].ss);
+        tele_metro_updated();
+        lane_leave(l, i);
+        l->mask[i] = true;
+    }
+    run_script_lanes(l, INIT_SCRIPT);
+    for (size_t i = 0; i < n; i++) l->render[i].ss.initializing = false;
+
+    while (l->ticks < duration) {
+        const uint32_t ticks = ++l->ticks;
+
+        while (next_event < event_count && events[next_event].time <= ticks) {
+            const event_t *e = &events[next_event++];
+            switch (e->type) {
+                case EVENT_TR:
+                    if (e->value == -1) {
+                        queue_input(l, e->index, true);
+                        queue_input(l, e->index, false);
+                    }
+                    else
+                        queue_input(l, e->index, e->value);
+                    break;
+                case EVENT_IN:
+                    for (size_t i = 0; i < n; i++)
+                        ss_set_in(&l->render[i].ss, e->value);
+                    break;
+                case EVENT_PARAM:
+                    for (size_t i = 0; i < n; i++)
+                        ss_set_param(&l->render[i].ss, e->value);
+                    break;
+            }
+        }
+
+        // the first turn of render_run in a ms, one edge after the events
+        run_queued(l);
+
+        bool metro = false;
+        for (size_t i = 0; i < n; i++) {
+            l->mask[i] = l->metro_on[i] &&
+                         (int32_t)(ticks - l->metro_next[i]) >= 0;
+            if (!l->mask[i]) continue;
+            l->render[i].ticks = ticks;
+            l->mask[i] = render_metro(&l->render[i]);
+            l->metro_next[i] = l->render[i].metro_next;
+            metro |= l->mask[i];
+        }
+        if (metro) run_script_lanes(l, METRO_SCRIPT);
+
+        run_deadlines(l, ticks);
+
+        // its later turns, lanes don't slice runs and there are no more
+        // events or metro ticks in this ms, so only edges and what they make
+        // due now (e.g. TR.TIME 0) are left
+        while (run_queued(l)) run_deadlines(l, ticks);
+
+        if (ticks % RATE_CLOCK == 0) {
+            for (size_t i = 0; i < n; i++) {
+                if (!l->render[i].ss.turtle.stepped) continue;
+                lane_enter(l, i);
+                tele_tick(&l->render[i].ss);
+                lane_leave(l, i);
+            }
+        }
+    }
+
+    // leave the variables where the rest of teletype expects them
+    for (size_t i = 0; i < n; i++) lane_enter(l, i);
+}
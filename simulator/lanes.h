@@ -0,0 +1,79 @@
+#ifndef _LANES_H_
+#define _LANES_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "render.h"
+
+// Many copies (lanes) of the same scene, usually with different SEEDs, run in
+// step. A, B, C, D, X, Y, Z and T are kept as an array per variable, and a
+// script line that only uses those, numbers and arithmetic, comparison and
+// random OPs is run one word at a time across every lane, as is a line of just
+// SCRIPT n. Any other line, e.g. one with a MOD where the lanes can take
+// different paths, and every delay, runs on each lane's own render_t, as
+// runner would run it. Patterns, the queue and the trigger queues (see
+// SCRIPT.Q) stay in each lane's scene, the lanes that take an edge for the
+// same input off their queue run its script together.
+//
+// The traces of each lane are the same as rendering it on its own. Lanes
+// always run scripts to the end, so a scene that uses SCRIPT.SLICE can't be
+// run on lanes, check with lanes_can_run and render each lane on its own.
+
+// the variables kept as arrays, in this order
+#define LANE_VARS 8
+
+// a line of script is at most a step per word and one more per sub
+#define LANE_STEPS (COMMAND_MAX_LENGTH + COMMAND_MAX_SUBS)
+
+typedef struct {
+    uint8_t kernel;
+    int16_t value;  // the number to push, or the index of the variable
+} lane_step_t;
+
+typedef struct {
+    bool vector;  // false if the line has to run on each lane
+    bool comment;
+    int8_t call;  // the script called by a line of just SCRIPT n, or -1
+    uint8_t step_count;
+    lane_step_t steps[LANE_STEPS];
+} lane_line_t;
+
+typedef struct {
+    size_t count;
+    // each lane's scene, all must have the same scripts when lanes_run starts
+    render_t *render;
+
+    int16_t *vars[LANE_VARS];
+    int16_t *stack[STACK_SIZE];
+    exec_state_t *es;
+    // the lanes to run a script on, and those that started and are still
+    // running each level of SCRIPT
+    bool *mask;
+    // the input of the edge each lane took off its trigger queue, or -1
+    int8_t *popped;
+    bool *started[EXEC_DEPTH];
+    bool *running[EXEC_DEPTH];
+
+    // copies of each lane's metro and next deadline, so that finding the
+    // lanes with something to do each ms doesn't touch their render_t
+    uint32_t ticks;
+    bool *metro_on;
+    uint32_t *metro_next;
+    bool *pending;
+    uint32_t *deadline;
+
+    lane_line_t lines[SCRIPT_COUNT][SCRIPT_MAX_COMMANDS];
+    uint8_t script_len[SCRIPT_COUNT];
+} lanes_t;
+
+// returns false if the scene uses SCRIPT.SLICE
+bool lanes_can_run(scene_state_t *ss);
+// returns false if there wasn't enough memory, render is the caller's
+bool lanes_init(lanes_t *l, render_t *render, size_t count);
+void lanes_free(lanes_t *l);
+// runs every lane until duration ms, as render_run does
+void lanes_run(lanes_t *l, uint32_t duration);
+
+#endif
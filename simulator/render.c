@@ -0,0 +1,289 @@
+#include "render.h"
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "teletype.h"
+#include "teletype_io.h"
+
+// must match module/main.c
+#define RATE_CLOCK 10
+
+// the render running on this thread
+static __thread render_t *current;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// teletype_io.h
+
+uint32_t tele_get_ticks() {
+    return current->ticks;
+}
+
+void tele_metro_updated() {
+    render_t *r = current;
+    r->metro_period = r->ss.variables.m;
+    if (r->metro_period < METRO_MIN_UNSUPPORTED_MS)
+        r->metro_period = METRO_MIN_UNSUPPORTED_MS;
+
+    bool m_act = r->ss.variables.m_act;
+    if (m_act && !r->metro_enabled) r->metro_next = r->ticks + r->metro_period;
+    r->metro_enabled = m_act;
+}
+
+void tele_metro_reset() {
+    current->metro_next = current->ticks + current->metro_period;
+}
+
+void tele_tr(uint8_t i, int16_t v) {
+    fprintf(current->trace, "%" PRIu32 "\tTR\t%" PRIu8 "\t%" PRId16 "\n",
+            current->ticks, i + 1, v);
+    current->trace_lines++;
+}
+
+void tele_cv(uint8_t i, int16_t v, uint8_t s) {
+    fprintf(current->trace,
+            "%" PRIu32 "\tCV\t%" PRIu8 "\t%" PRId16 "\t%" PRIu8 "\n",
+            current->ticks, i + 1, v, s);
+    current->trace_lines++;
+}
+
+void tele_cv_slew(uint8_t i, int16_t v) {
+    fprintf(current->trace, "%" PRIu32 "\tCV.SLEW\t%" PRIu8 "\t%" PRId16 "\n",
+            current->ticks, i + 1, v);
+    current->trace_lines++;
+}
+
+void tele_cv_off(uint8_t i, int16_t v) {
+    fprintf(current->trace, "%" PRIu32 "\tCV.OFF\t%" PRIu8 "\t%" PRId16 "\n",
+            current->ticks, i + 1, v);
+    current->trace_lines++;
+}
+
+void tele_ii_tx(uint8_t addr, uint8_t *data, uint8_t l) {
+    fprintf(current->trace, "%" PRIu32 "\tII\t0x%02" PRIx8, current->ticks,
+            addr);
+    for (size_t i = 0; i < l; i++)
+        fprintf(current->trace, "\t%" PRIu8, data[i]);
+    fprintf(current->trace, "\n");
+    current->trace_lines++;
+}
+
+// there's nothing on the bus to answer
+void tele_ii_rx(uint8_t addr, uint8_t *data, uint8_t l) {
+    memset(data, 0, l);
+}
+
+// IN and PARAM are only changed by events
+void tele_update_adc(uint8_t force) {}
+
+void tele_scene(uint8_t i, uint8_t init_grid, uint8_t init_pattern) {
+    fprintf(stderr, "%" PRIu32 ": SCENE %" PRIu8 " ignored\n", current->ticks,
+            i);
+}
+
+bool tele_get_input_state(uint8_t n) {
+    return n < TRIGGER_INPUTS && current->input_state[n];
+}
+
+void tele_has_delays(bool has_delays) {}
+void tele_has_stack(bool has_stack) {}
+void tele_pattern_updated() {}
+void tele_vars_updated() {}
+void tele_kill() {
+    script_runs_init(&current->runs);
+    trigger_clear(&current->ss.triggers);
+}
+void tele_mute() {}
+void tele_save_calibration() {}
+
+void tele_profile_print(const char *line) {
+    fprintf(stderr, "%s\n", line);
+}
+void grid_key_press(uint8_t x, uint8_t y, uint8_t z) {}
+void device_flip() {}
+void set_live_submode(uint8_t submode) {}
+void select_dash_screen(uint8_t screen) {}
+void print_dashboard_value(uint8_t index, int16_t value) {}
+int16_t get_dashboard_value(uint8_t index) {
+    return 0;
+}
+void reset_midi_counter() {}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// events
+
+static int compare_events(const void *a, const void *b) {
+    const event_t *ea = a;
+    const event_t *eb = b;
+    if (ea->time != eb->time) return ea->time < eb->time ? -1 : 1;
+    // keep the file order for events at the same time
+    return ea < eb ? -1 : ea > eb;
+}
+
+event_t *render_read_events(FILE *f, size_t *count) {
+    size_t size = 64;
+    event_t *events = malloc(size * sizeof(event_t));
+    char line[128];
+    size_t line_no = 0;
+
+    *count = 0;
+    while (fgets(line, sizeof(line), f)) {
+        line_no++;
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\0') continue;
+
+        event_t e;
+        char type[8];
+        int32_t value = -1;
+        int32_t index = 0;
+        uint32_t time;
+        int n = sscanf(line, "%" SCNu32 " %7s %" SCNd32 " %" SCNd32, &time,
+                       type, &index, &value);
+        e.time = time;
+
+        if (n >= 3 && strcmp(type, "TR") == 0 && index >= 1 &&
+            index <= TRIGGER_INPUTS) {
+            e.type = EVENT_TR;
+            e.index = index - 1;
+            e.value = n == 4 ? value != 0 : -1;
+        }
+        else if (n == 3 && strcmp(type, "IN") == 0) {
+            e.type = EVENT_IN;
+            e.value = index;
+        }
+        else if (n == 3 && strcmp(type, "PARAM") == 0) {
+            e.type = EVENT_PARAM;
+            e.value = index;
+        }
+        else {
+            fprintf(stderr, "bad event on line %zu: %s", line_no, line);
+            continue;
+        }
+
+        if (*count == size) {
+            size *= 2;
+            events = realloc(events, size * sizeof(event_t));
+        }
+        events[(*count)++] = e;
+    }
+
+    if (ferror(f)) {
+        free(events);
+        return NULL;
+    }
+    qsort(events, *count, sizeof(event_t), compare_events);
+    return events;
+}
+
+// follows handler_Trigger in module/main.c, returns true if the input's script
+// should run
+bool render_input(render_t *r, uint8_t input, bool state) {
+    r->input_state[input] = state;
+    if (ss_get_mute(&r->ss, input)) return false;
+    return r->ss.variables.script_pol[input] & (state ? 1 : 2);
+}
+
+static void run(render_t *r, size_t script_no) {
+    // compiled scripts can only run to the end
+    if (r->aot && r->ss.variables.script_slice == 0)
+        aot_run_script(r->aot, &r->ss, script_no);
+    else
+        tele_run_script(&r->ss, &r->runs, script_no);
+}
+
+// the script runs when render_run pops the edge off the trigger queue
+static void trigger(render_t *r, uint8_t input, bool state) {
+    if (render_input(r, input, state))
+        trigger_push(&r->ss.triggers, input, state);
+}
+
+static void run_event(render_t *r, const event_t *e) {
+    switch (e->type) {
+        case EVENT_TR:
+            if (e->value == -1) {
+                trigger(r, e->index, true);
+                trigger(r, e->index, false);
+            }
+            else
+                trigger(r, e->index, e->value);
+            break;
+        case EVENT_IN: ss_set_in(&r->ss, e->value); break;
+        case EVENT_PARAM: ss_set_param(&r->ss, e->value); break;
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// running
+
+void render_select(render_t *r) {
+    current = r;
+}
+
+// returns true if the metro script should run at r->ticks
+bool render_metro(render_t *r) {
+    if (!r->metro_enabled || (int32_t)(r->ticks - r->metro_next) < 0)
+        return false;
+    r->metro_next += r->metro_period;
+    return ss_get_script_len(&r->ss, METRO_SCRIPT);
+}
+
+void render_init(render_t *r, FILE *trace, const event_t *events,
+                 size_t event_count) {
+    current = r;
+    r->aot = NULL;
+    script_runs_init(&r->runs);
+    r->ticks = 0;
+    r->trace = trace;
+    r->trace_lines = 0;
+    r->metro_enabled = false;
+    r->metro_period = 0;
+    r->metro_next = 0;
+    for (size_t i = 0; i < TRIGGER_INPUTS; i++) r->input_state[i] = false;
+    r->events = events;
+    r->event_count = event_count;
+    r->next_event = 0;
+    // ss_init expects a zeroed scene, as INIT does
+    memset(&r->ss, 0, sizeof(r->ss));
+    ss_init(&r->ss);
+}
+
+void render_run(render_t *r, uint32_t duration) {
+    current = r;
+
+    // the same start up as module/main.c
+    clear_delays(&r->ss);
+    tele_metro_updated();
+    run(r, INIT_SCRIPT);
+    r->ss.initializing = false;
+
+    // step 1 ms at a time, as the hardware's deadline timer does
+    while (r->ticks < duration) {
+        r->ticks++;
+
+        // a turn of check_events at a time: the events that are due, one
+        // edge, then a slice of each unfinished run. The clock only moves on
+        // when there's nothing left to do, so that edges that come together,
+        // and a sliced run, finish in the ms they started in.
+        for (;;) {
+            while (r->next_event < r->event_count &&
+                   r->events[r->next_event].time <= r->ticks)
+                run_event(r, &r->events[r->next_event++]);
+
+            bool state;
+            const int8_t input = trigger_pop(
+                &r->ss.triggers, tele_running_inputs(&r->runs), &state);
+            if (input >= 0) run(r, input);
+
+            if (render_metro(r)) run(r, METRO_SCRIPT);
+            tele_run_deadlines(&r->ss);
+
+            const bool sliced = tele_run_slices(&r->ss, &r->runs);
+            if (input < 0 && !sliced) break;
+        }
+
+        if (r->ticks % RATE_CLOCK == 0) tele_tick(&r->ss);
+    }
+}
@@ -0,0 +1,66 @@
+#ifndef _RENDER_H_
+#define _RENDER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "aot.h"
+#include "state.h"
+#include "teletype.h"
+
+// A scene played against its own virtual clock, as fast as the host allows,
+// writing every CV, TR and I2C output to a timestamped trace (see runner.c for
+// the formats). Each thread can render one scene at a time, the teletype_io.h
+// callbacks find it through a thread local pointer, so renders on different
+// threads don't share anything.
+
+#define EVENT_TR 0
+#define EVENT_IN 1
+#define EVENT_PARAM 2
+
+typedef struct {
+    uint32_t time;
+    uint8_t type;
+    uint8_t index;
+    int16_t value;  // -1 for both edges of a trigger
+} event_t;
+
+typedef struct {
+    scene_state_t ss;
+    // the compiled scripts of ss to run in place of run_script, or NULL
+    const aot_scene_t *aot;
+    // the scripts running a slice at a time, see render_run
+    script_runs_t runs;
+    uint32_t ticks;
+    FILE *trace;
+    uint32_t trace_lines;
+
+    bool metro_enabled;
+    uint32_t metro_period;
+    uint32_t metro_next;
+
+    bool input_state[TRIGGER_INPUTS];
+
+    // shared between renders, they are only read
+    const event_t *events;
+    size_t event_count;
+    size_t next_event;
+} render_t;
+
+// reads an event file, sorted by time, returns NULL if it couldn't be read
+event_t *render_read_events(FILE *f, size_t *count);
+
+// sets up r on this thread, ready for the scene to be loaded in to r->ss
+void render_init(render_t *r, FILE *trace, const event_t *events,
+                 size_t event_count);
+// runs the INIT script and then the scene until duration ms
+void render_run(render_t *r, uint32_t duration);
+
+// for running a scene one step at a time (see lanes.c), the teletype_io.h
+// callbacks go to r until another render is selected
+void render_select(render_t *r);
+bool render_input(render_t *r, uint8_t input, bool state);
+bool render_metro(render_t *r);
+
+#endif
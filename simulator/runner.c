@@ -0,0 +1,201 @@
+// Headless scene runner
+//
+// Runs a scene in the USB disk text format against a virtual clock, as fast as
+// the host allows, and writes every CV, TR and I2C output as a timestamped
+// trace. Input events come from an optional event file, one per line:
+//
+//     <ms> TR <1-8> [0|1]   trigger input edge, without a state both edges
+//     <ms> IN <0-16383>     set IN
+//     <ms> PARAM <0-16383>  set PARAM
+//
+// Blank lines and lines starting with # are ignored.
+//
+// With -w the worst case cost of each script is printed before it runs, as the
+// number of OPs and MODs a trigger can run (see src/cost.h). With -W the cost
+// is in ns, from the output of `make bench` in tests.
+//
+// With -s every random state is seeded after the scene is loaded, as SEED
+// does, see batch.c.
+//
+// If the scene was compiled in to this build (see ttc.c) its compiled scripts
+// run instead of the interpreter, unless -i is given.
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cost.h"
+#include "ops/op.h"
+#include "profiler.h"
+#include "render.h"
+#include "scene_file.h"
+#include "teletype.h"
+#include "teletype_io.h"
+
+static render_t render;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// cost
+
+// reads the "kind name ns/op" lines of tests/bench.c, an OP with a get and a
+// set costs the slower of the two
+static bool read_cost_table(FILE *f, cost_table_t *table) {
+    memset(table, 0, sizeof(*table));
+
+    char line[128];
+    while (fgets(line, sizeof(line), f)) {
+        char kind[16], name[32];
+        double ns;
+        if (line[0] == '#' ||
+            sscanf(line, "%15[^\t]\t%31[^\t]\t%lf", kind, name, &ns) != 3)
+            continue;
+
+        uint32_t cost = ns < 1 ? 1 : ns + 0.5;
+        if (strcmp(kind, "get") == 0 || strcmp(kind, "set") == 0) {
+            for (size_t i = 0; i < E_OP__LENGTH; i++)
+                if (strcmp(tele_ops[i]->name, name) == 0 && cost > table->op[i])
+                    table->op[i] = cost;
+        }
+        else if (strcmp(kind, "mod") == 0) {
+            for (size_t i = 0; i < E_MOD__LENGTH; i++)
+                if (strcmp(tele_mods[i]->name, name) == 0) table->mod[i] = cost;
+        }
+    }
+
+    // anything that wasn't benchmarked still costs something
+    for (size_t i = 0; i < E_OP__LENGTH; i++)
+        if (table->op[i] == 0) table->op[i] = 1;
+    for (size_t i = 0; i < E_MOD__LENGTH; i++)
+        if (table->mod[i] == 0) table->mod[i] = 1;
+
+    return !ferror(f);
+}
+
+static void print_costs(scene_state_t *ss, const cost_table_t *table) {
+    static const char *names[SCRIPT_COUNT - 1] = { "1", "2", "3", "4", "5",
+                                                   "6", "7", "8", "M", "I" };
+    for (size_t i = TT_SCRIPT_1; i <= INIT_SCRIPT; i++) {
+        if (!ss_get_script_len(ss, i)) continue;
+        cost_t c = script_cost(ss, i, table);
+        fprintf(stderr, "script %s: worst case %" PRIu32 "%s %s\n", names[i],
+                c.cost, c.unknown_loops ? "+" : "", table ? "ns" : "ops");
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// main
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: runner [-t ms] [-e events] [-o trace] [-s seed] "
+            "[-w | -W bench] [-i] scene.txt\n"
+            "  -t ms      how long to run the scene for (default 60000)\n"
+            "  -e events  file of input events to play\n"
+            "  -o trace   write the trace here instead of stdout\n"
+            "  -s seed    SEED the scene before it runs\n"
+            "  -w         print the worst case OPs per trigger of each script\n"
+            "  -W bench   print it in ns, from the output of make bench\n"
+            "  -i         interpret the scene even if it's compiled in\n");
+    exit(1);
+}
+
+int main(int argc, char **argv) {
+    uint32_t duration = 60000;
+    const char *scene_path = NULL;
+    const char *events_path = NULL;
+    const char *trace_path = NULL;
+    const char *cost_path = NULL;
+    bool costs = false;
+    bool seeded = false;
+    uint16_t seed = 0;
+    bool interpret = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+            duration = strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc)
+            events_path = argv[++i];
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            trace_path = argv[++i];
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            seeded = true;
+            seed = strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "-w") == 0)
+            costs = true;
+        else if (strcmp(argv[i], "-i") == 0)
+            interpret = true;
+        else if (strcmp(argv[i], "-W") == 0 && i + 1 < argc) {
+            costs = true;
+            cost_path = argv[++i];
+        }
+        else if (argv[i][0] != '-' && !scene_path)
+            scene_path = argv[i];
+        else
+            usage();
+    }
+    if (!scene_path) usage();
+
+    FILE *trace = trace_path ? fopen(trace_path, "w") : stdout;
+    if (!trace) {
+        perror(trace_path);
+        return 1;
+    }
+
+    size_t event_count = 0;
+    event_t *events = NULL;
+    if (events_path) {
+        FILE *f = fopen(events_path, "r");
+        if (!f || !(events = render_read_events(f, &event_count))) {
+            perror(events_path);
+            return 1;
+        }
+        fclose(f);
+    }
+
+    render_init(&render, trace, events, event_count);
+    FILE *f = fopen(scene_path, "r");
+    if (!f || !scene_file_read(f, &render.ss)) {
+        perror(scene_path);
+        return 1;
+    }
+    fclose(f);
+    if (seeded) ss_rand_seed(&render.ss, seed);
+    if (!interpret) render.aot = aot_find(&render.ss);
+
+    if (costs) {
+        static cost_table_t table;
+        if (cost_path) {
+            f = fopen(cost_path, "r");
+            if (!f || !read_cost_table(f, &table)) {
+                perror(cost_path);
+                return 1;
+            }
+            fclose(f);
+        }
+        print_costs(&render.ss, cost_path ? &table : NULL);
+    }
+
+    clock_t start = clock();
+    render_run(&render, duration);
+
+    double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+    fprintf(stderr,
+            "ran %" PRIu32 " ms %s in %.3f s (%.0fx real time), %" PRIu32
+            " outputs\n",
+            duration, render.aot ? "compiled" : "interpreted", elapsed,
+            elapsed > 0 ? duration / 1000.0 / elapsed : 0, render.trace_lines);
+#ifdef TELETYPE_PROFILE
+    profiler_dump(tele_profile_print);
+    profiler_dump_ops(tele_profile_print);
+#endif
+
+    if (trace != stdout) fclose(trace);
+    free(events);
+
+    return 0;
+}
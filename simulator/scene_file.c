@@ -0,0 +1,155 @@
+#include "scene_file.h"
+
+#include <ctype.h>
+#include <string.h>
+
+#include "teletype.h"
+
+// section numbers, scripts use their script number, the description isn't
+// needed to run a scene so nothing is done with it
+#define SECTION_DESCRIPTION 99
+#define SECTION_PATTERNS 10
+#define SECTION_GRID 11
+#define SECTION_END -1
+
+// this follows tele_usb_disk() in module/usb_disk_mode.c so that a scene
+// behaves the same in the simulator as it does once loaded onto a teletype
+bool scene_file_read(FILE *f, scene_state_t *ss) {
+    int c;
+    uint8_t l = 0;
+    uint8_t p = 0;
+    int8_t s = SECTION_DESCRIPTION;
+    uint8_t b = 0;
+    int16_t num = 0;
+    int16_t neg = 1;
+    uint8_t grid_state = 0;
+    uint16_t grid_count = 0;
+    uint8_t grid_num = 0;
+    bool grid_digit = false;
+
+    char input[64];
+    memset(input, 0, sizeof(input));
+
+    if (ferror(f)) return false;
+
+    while ((c = getc(f)) != EOF && s != SECTION_END) {
+        c = toupper(c);
+        if (c == '\r') continue;
+
+        if (c == '#') {
+            c = toupper(getc(f));
+            if (c == EOF)
+                s = SECTION_END;
+            else if (c == 'M')
+                s = METRO_SCRIPT;
+            else if (c == 'I')
+                s = INIT_SCRIPT;
+            else if (c == 'P')
+                s = SECTION_PATTERNS;
+            else if (c == 'G') {
+                grid_state = grid_num = grid_count = 0;
+                s = SECTION_GRID;
+            }
+            else {
+                s = c - '1';
+                if (s < 0 || s > 7) s = SECTION_END;
+            }
+
+            l = 0;
+            p = 0;
+
+            // skip the rest of the section header
+            while (c != EOF && c != '\n') c = getc(f);
+        }
+        // SCRIPTS
+        else if (s >= 0 && s <= INIT_SCRIPT) {
+            if (c == '\n') {
+                if (p && l < SCRIPT_MAX_COMMANDS) {
+                    tele_command_t temp;
+                    compiled_command_t compiled;
+                    temp.comment = false;
+                    char error_msg[TELE_ERROR_MSG_LENGTH];
+                    error_t status =
+                        parse_and_compile(input, &temp, &compiled, error_msg);
+
+                    if (status == E_OK) {
+                        ss_overwrite_script_compiled(ss, s, l, &temp,
+                                                     &compiled);
+                        l++;
+                    }
+                    else {
+                        fprintf(stderr, "%s: %s >> %s\n", tele_error(status),
+                                error_msg, input);
+                    }
+                }
+                memset(input, 0, sizeof(input));
+                p = 0;
+            }
+            else if (p < sizeof(input) - 1)
+                input[p++] = c;
+        }
+        // PATTERNS
+        // l: len wrap start end v[64]
+        else if (s == SECTION_PATTERNS) {
+            if (c == '\n' || c == '\t') {
+                if (b < PATTERN_COUNT) {
+                    if (l > 3)
+                        ss_set_pattern_val(ss, b, l - 4, neg * num);
+                    else if (l == 0)
+                        ss_set_pattern_len(ss, b, num);
+                    else if (l == 1)
+                        ss_set_pattern_wrap(ss, b, num);
+                    else if (l == 2)
+                        ss_set_pattern_start(ss, b, num);
+                    else if (l == 3)
+                        ss_set_pattern_end(ss, b, num);
+                }
+
+                b++;
+                num = 0;
+                neg = 1;
+
+                if (c == '\n') {
+                    if (p) l++;
+                    if (l > PATTERN_LENGTH + 4) s = SECTION_END;
+                    b = 0;
+                    p = 0;
+                }
+            }
+            else {
+                if (c == '-')
+                    neg = -1;
+                else if (c >= '0' && c <= '9')
+                    num = num * 10 + (c - '0');
+                p++;
+            }
+        }
+        // GRID
+        else if (s == SECTION_GRID) {
+            if (grid_state == 0) {
+                if (c >= '0' && c <= '9') {
+                    ss->grid.button[grid_count].state = c != '0';
+                    if (++grid_count >= GRID_BUTTON_COUNT) {
+                        grid_count = 0;
+                        grid_state = 1;
+                    }
+                }
+            }
+            else if (c >= '0' && c <= '9') {
+                grid_num = grid_num * 10 + c - '0';
+                grid_digit = true;
+            }
+            else if (c == '\t' || c == '\n') {
+                // skips the blank line between the buttons and the faders
+                if (grid_digit && grid_count < GRID_FADER_COUNT) {
+                    ss->grid.fader[grid_count].value = grid_num;
+                    grid_num = 0;
+                    grid_digit = false;
+                    grid_count++;
+                }
+            }
+        }
+    }
+
+    return !ferror(f);
+}
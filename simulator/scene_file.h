@@ -0,0 +1,15 @@
+#ifndef _SCENE_FILE_H_
+#define _SCENE_FILE_H_
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "state.h"
+
+// Reads a scene in the USB disk text format (see presets/tt*.txt) into ss,
+// the description at the top of the file is skipped. Lines that don't parse
+// or validate are reported on stderr and left out, as the firmware does.
+// Returns false if the file couldn't be read at all.
+bool scene_file_read(FILE *f, scene_state_t *ss);
+
+#endif
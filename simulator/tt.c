@@ -1,3 +1,5 @@
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
 #include <ctype.h>
 #include <errno.h>
 #include <inttypes.h>
@@ -12,7 +14,9 @@
 
 
 uint32_t tele_get_ticks() {
-    return 0;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
 }
 
 void tele_metro_updated() {
@@ -129,8 +133,9 @@ bool tele_get_input_state(uint8_t n) {
 
 void tele_save_calibration() {}
 
-void tele_profile_script(size_t s) {}
-void tele_profile_delay(uint8_t d) {}
+void tele_profile_print(const char *line) {
+    printf("%s\n", line);
+}
 
 void grid_key_press(uint8_t x, uint8_t y, uint8_t z) {
     printf("GRID KEY PRESS x:%" PRIu8 " y:%" PRIu8 " z:%" PRIu8, x, y, z);
@@ -175,19 +180,16 @@ int main() {
         }
 
         tele_command_t temp;
+        compiled_command_t compiled;
         exec_state_t es;
         es_init(&es);
         char error_msg[TELE_ERROR_MSG_LENGTH];
-        status = parse(in, &temp, error_msg);
+        status = parse_and_compile(in, &temp, &compiled, error_msg);
         if (status == E_OK) {
-            status = validate(&temp, error_msg);
-            printf("validate: %s", tele_error(status));
-            if (error_msg[0]) printf(": %s", error_msg);
-            printf("\n");
-            if (status == E_OK) {
-                process_result_t output = process_command(&ss, &es, &temp);
-                if (output.has_value) { printf(">>> %i\n", output.value); }
-            }
+            tele_command_view_t command = command_view(&temp);
+            command.compiled = &compiled;
+            process_result_t output = process_command(&ss, &es, &command);
+            if (output.has_value) { printf(">>> %i\n", output.value); }
         }
         else {
             printf("ERROR: %s", tele_error(status));
@@ -195,7 +197,8 @@ int main() {
             printf("\n");
         }
 
-        // tele_tick(100);
+        // run anything that has come due while waiting for input
+        tele_tick(&ss);
         printf("\n");
     } while (in[0] != 10);
 
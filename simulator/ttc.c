@@ -0,0 +1,598 @@
+// Scene compiler
+//
+// Translates scenes in the USB disk text format in to C, with a function per
+// script, for runner and batch to link in (see aot.h):
+//
+//     ttc a.txt b.txt > scenes.c
+//
+// Each line of script becomes the C that running it does. Numbers, and the
+// constant expressions folded when a command is compiled, are literals,
+// variables are read and written in place, arithmetic, comparison and random
+// OPs and I are inline, and SCRIPT calls the script's function. IF, ELIF,
+// ELSE, L, W, EVERY, SKIP, OTHER and PROB are C around a function for their
+// POST command. Any other OP is called through its descriptor with its params
+// on a command_state_t, and any other MOD gets the line's POST command to run
+// with process_command, as do delays when they're due. Everything runs in the
+// same order as in the interpreter, so the traces are the same.
+//
+// A compiled scene is only used for a scene with exactly the same scripts.
+// Scenes that change their scripts as they run (INIT, INIT.SCENE, INIT.SCRIPT
+// or INIT.SCRIPT.ALL) are left to the interpreter. With no scenes it writes an
+// empty list.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "aot.h"
+#include "ops/controlflow.h"
+#include "ops/maths.h"
+#include "ops/op.h"
+#include "ops/variables.h"
+#include "render.h"
+#include "scene_file.h"
+
+// ttc is a build without any compiled scenes
+const aot_scene_t *const aot_scenes[] = { NULL };
+
+// the variables that are read and written in place, by their offset
+static const struct {
+    size_t offset;
+    const char *field;
+} fields[] = {
+    { offsetof(scene_state_t, variables.a), "variables.a" },
+    { offsetof(scene_state_t, variables.b), "variables.b" },
+    { offsetof(scene_state_t, variables.c), "variables.c" },
+    { offsetof(scene_state_t, variables.d), "variables.d" },
+    { offsetof(scene_state_t, variables.x), "variables.x" },
+    { offsetof(scene_state_t, variables.y), "variables.y" },
+    { offsetof(scene_state_t, variables.z), "variables.z" },
+    { offsetof(scene_state_t, variables.t), "variables.t" },
+    { offsetof(scene_state_t, variables.drunk_max), "variables.drunk_max" },
+    { offsetof(scene_state_t, variables.drunk_min), "variables.drunk_min" },
+    { offsetof(scene_state_t, variables.drunk_wrap), "variables.drunk_wrap" },
+    { offsetof(scene_state_t, variables.o_inc), "variables.o_inc" },
+    { offsetof(scene_state_t, variables.o_max), "variables.o_max" },
+    { offsetof(scene_state_t, variables.o_min), "variables.o_min" },
+    { offsetof(scene_state_t, variables.o_wrap), "variables.o_wrap" }
+};
+
+// the inline OPs (see aot.h and ops/maths.h), matched by their get fn so that
+// aliases match
+static const struct {
+    const tele_op_t *op;
+    const char *fn;
+    bool random;  // takes ss for its random state
+} inline_ops[] = {
+    { &op_ADD, "aot_add", false },     { &op_SUB, "aot_sub", false },
+    { &op_MUL, "mul_value", false },   { &op_DIV, "div_value", false },
+    { &op_MOD, "mod_value", false },   { &op_MIN, "min_value", false },
+    { &op_MAX, "max_value", false },   { &op_LIM, "lim_value", false },
+    { &op_WRAP, "wrap_value", false }, { &op_AVG, "avg_value", false },
+    { &op_EQ, "aot_eq", false },       { &op_NE, "aot_ne", false },
+    { &op_LT, "aot_lt", false },       { &op_GT, "aot_gt", false },
+    { &op_LTE, "aot_lte", false },     { &op_GTE, "aot_gte", false },
+    { &op_NZ, "aot_nz", false },       { &op_EZ, "aot_ez", false },
+    { &op_ABS, "abs_value", false },   { &op_SGN, "sgn_value", false },
+    { &op_AND, "aot_and", false },     { &op_OR, "aot_or", false },
+    { &op_RAND, "aot_rand", true },    { &op_RRAND, "aot_rrand", true },
+    { &op_TOSS, "aot_toss", true }
+};
+
+#define INLINE_OP_COUNT (sizeof(inline_ops) / sizeof(inline_ops[0]))
+
+// the OPs and MODs that need an extern declaration
+static bool used_ops[E_OP__LENGTH];
+static bool used_mods[E_MOD__LENGTH];
+// if the scene has a SCRIPT with a param that isn't a number
+static bool calls;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// translating
+
+// a value on the stack while translating a sub, a literal or a local
+typedef struct {
+    bool literal;
+    int16_t value;
+    char name[16];
+} value_t;
+
+typedef struct {
+    FILE *f;
+    scene_state_t *ss;
+    size_t scene;
+    size_t script;
+    size_t line;
+    // the next local, and whether the function needs a command_state_t
+    unsigned locals;
+    bool uses_cs;
+    value_t stack[COMMAND_MAX_LENGTH];
+    uint8_t top;
+} emit_t;
+
+static void emit(emit_t *e, const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    fprintf(e->f, "    ");
+    vfprintf(e->f, format, args);
+    fprintf(e->f, "\n");
+    va_end(args);
+}
+
+static void push_literal(emit_t *e, int16_t value) {
+    value_t *v = &e->stack[e->top++];
+    v->literal = true;
+    v->value = value;
+    if (value == INT16_MIN)
+        snprintf(v->name, sizeof(v->name), "(-32767 - 1)");
+    else
+        snprintf(v->name, sizeof(v->name), "%d", value);
+}
+
+// pushes a new local, the caller emits the expression that sets it
+static const char *push_local(emit_t *e) {
+    value_t *v = &e->stack[e->top++];
+    v->literal = false;
+    snprintf(v->name, sizeof(v->name), "v%u", e->locals++);
+    return v->name;
+}
+
+// the nth param, counting from 0 at the top of the stack
+static const char *param(emit_t *e, uint8_t n) {
+    return e->stack[e->top - 1 - n].name;
+}
+
+// puts the top count values on cs in the order they'd be there when running
+static void emit_params(emit_t *e, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++)
+        emit(e, "cs.stack.values[%u] = %s;", i, param(e, count - 1 - i));
+    emit(e, "cs.stack.top = %u;", count);
+    e->top -= count;
+    e->uses_cs = true;
+}
+
+static const char *field_of(int16_t op) {
+    if (tele_ops[op]->get != op_peek_i16) return NULL;
+    for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++)
+        if ((size_t)tele_op_data[op] == fields[i].offset)
+            return fields[i].field;
+    return NULL;
+}
+
+static bool emit_op(emit_t *e, int16_t op, tele_op_fn_t fn) {
+    const tele_op_t *o = tele_ops[op];
+    const bool set = fn == o->set && fn != o->get;
+    const uint8_t params = o->params + (set ? 1 : 0);
+    if (fn == NULL || e->top < params) return false;
+
+    const char *field = field_of(op);
+    if (field && set) {
+        emit(e, "ss->%s = %s;", field, param(e, 0));
+        emit(e, "tele_vars_updated();");
+        e->top--;
+        return true;
+    }
+    if (field) {
+        emit(e, "const int16_t %s = ss->%s;", push_local(e), field);
+        return true;
+    }
+
+    if (fn == op_I.set) {
+        emit(e, "AOT_EV(es)->i = %s;", param(e, 0));
+        e->top--;
+        return true;
+    }
+    if (fn == op_I.get) {
+        emit(e, "const int16_t %s = AOT_EV(es)->i;", push_local(e));
+        return true;
+    }
+
+    if (fn == op_SCRIPT.set) {
+        const value_t *v = &e->stack[e->top - 1];
+        // as op_SCRIPT_set
+        const uint16_t script = (uint16_t)(v->value - 1);
+        if (!v->literal) {
+            emit(e, "s%zu_call(ss, es, %s);", e->scene, v->name);
+            calls = true;
+        }
+        else if (script <= INIT_SCRIPT) {
+            emit(e, "es_push(es);");
+            emit(e, "if (!es->overflow) s%zu_%u(ss, es);", e->scene, script);
+            emit(e, "es_pop(es);");
+        }
+        e->top--;
+        return true;
+    }
+
+    for (size_t i = 0; i < INLINE_OP_COUNT; i++) {
+        if (inline_ops[i].op->get != fn) continue;
+        char call[64];
+        int n = snprintf(call, sizeof(call), "%s(%s", inline_ops[i].fn,
+                         inline_ops[i].random ? "ss" : "");
+        for (uint8_t p = 0; p < params; p++)
+            n += snprintf(call + n, sizeof(call) - n, "%s%s",
+                          p || inline_ops[i].random ? ", " : "", param(e, p));
+        snprintf(call + n, sizeof(call) - n, ")");
+        e->top -= params;
+        emit(e, "const int16_t %s = %s;", push_local(e), call);
+        return true;
+    }
+
+    const char *symbol = tele_op_symbols[op];
+    used_ops[op] = true;
+    emit_params(e, params);
+    emit(e, "%s.%s(%s.data, ss, es, &cs);", symbol, set ? "set" : "get",
+         symbol);
+    if (!set && o->returns)
+        emit(e, "const int16_t %s = cs_pop(&cs);", push_local(e));
+    return true;
+}
+
+// MODs are matched by their fn, so that aliases (e.g. EV) match too
+static bool is_mod(int16_t mod, tele_mod_idx_t other) {
+    return tele_mods[mod]->func == tele_mods[other]->func;
+}
+
+// the C for the MODs in native_mod, with the parts of their fns that
+// ops/controlflow.c shares, with post the call that runs the POST command, or
+// a call to any other MOD
+static bool emit_mod(emit_t *e, int16_t mod, const char *post) {
+    const tele_mod_t *m = tele_mods[mod];
+    if (e->top != m->params) return false;
+    const char *a = m->params > 0 ? param(e, 0) : NULL;
+    const char *b = m->params > 1 ? param(e, 1) : NULL;
+
+    if (post && is_mod(mod, E_MOD_PROB))
+        emit(e, "if (mod_PROB_start(ss, %s)) %s;", a, post);
+    else if (post && is_mod(mod, E_MOD_IF))
+        emit(e, "if (mod_IF_start(es, %s)) %s;", a, post);
+    else if (post && is_mod(mod, E_MOD_ELIF))
+        emit(e, "if (mod_ELIF_start(es, %s)) %s;", a, post);
+    else if (post && is_mod(mod, E_MOD_ELSE))
+        emit(e, "if (mod_ELSE_start(es)) %s;", post);
+    else if (post && is_mod(mod, E_MOD_L)) {
+        // I is kept through a pointer, as in mod_L_func
+        emit(e, "loop_state_t loop;");
+        emit(e, "mod_L_start(es, %s, %s, &loop);", a, b);
+        emit(e, "int16_t *i = &AOT_EV(es)->i;");
+        emit(e, "do {");
+        emit(e, "    %s;", post);
+        emit(e, "} while (mod_L_next(es, i, &loop));");
+    }
+    else if (post && is_mod(mod, E_MOD_W)) {
+        emit(e, "if (mod_W_start(es, %s)) {", a);
+        emit(e, "    %s;", post);
+        emit(e, "    mod_W_next(es);");
+        emit(e, "}");
+    }
+    else if (post && is_mod(mod, E_MOD_EVERY))
+        emit(e, "if (mod_EVERY_start(ss, es, %s)) %s;", a, post);
+    else if (post && is_mod(mod, E_MOD_SKIP))
+        emit(e, "if (mod_SKIP_start(ss, es, %s)) %s;", a, post);
+    else if (post && is_mod(mod, E_MOD_OTHER))
+        emit(e, "if (mod_OTHER_start(ss)) %s;", post);
+    else {
+        const char *symbol = tele_mod_symbols[mod];
+        used_mods[mod] = true;
+        emit_params(e, m->params);
+        emit(e, "const tele_command_view_t post =");
+        emit(e, "    aot_post(ss, %zu, %zu);", e->script, e->line);
+        emit(e, "%s.func(ss, es, &cs, &post);", symbol);
+    }
+
+    e->top = 0;
+    return true;
+}
+
+// true if emit_mod runs the POST command of this MOD with a function
+static bool native_mod(int16_t mod) {
+    static const tele_mod_idx_t native[] = { E_MOD_PROB,  E_MOD_IF,
+                                             E_MOD_ELIF,  E_MOD_ELSE,
+                                             E_MOD_L,     E_MOD_W,
+                                             E_MOD_EVERY, E_MOD_SKIP,
+                                             E_MOD_OTHER };
+    for (size_t i = 0; i < sizeof(native) / sizeof(native[0]); i++)
+        if (is_mod(mod, native[i])) return true;
+    return false;
+}
+
+// translates the subs of a line as process_compiled_subs runs them, post is
+// the call that runs the line's POST command for a MOD in them, returns false
+// if it can't
+static bool emit_subs(emit_t *e, const tele_command_t *c,
+                      const compiled_command_t *cc, bool pre,
+                      const char *post) {
+    const compiled_sub_t *subs = pre ? cc->subs : &cc->subs[cc->pre_count];
+    const uint8_t count = pre ? cc->pre_count : cc->post_count;
+
+    for (uint8_t s = 0; s < count; s++) {
+        // a line only starts if the script isn't breaking
+        if (s > 0 || !pre) emit(e, "if (AOT_EV(es)->breaking) return;");
+        e->top = 0;
+
+        for (int8_t idx = subs[s].end; idx >= subs[s].start; idx--) {
+            const tele_word_t tag = td_tag(&c->data[idx]);
+            const int16_t value = td_value(&c->data[idx]);
+            if (e->top == COMMAND_MAX_LENGTH) return false;
+
+            if (cc->fold_ends & (1 << idx)) {
+                for (uint8_t f = 0; f < cc->fold_count; f++) {
+                    if (cc->folds[f].end == idx) {
+                        push_literal(e, cc->folds[f].value);
+                        idx = cc->folds[f].start;
+                        break;
+                    }
+                }
+            }
+            else if (tag == OP) {
+                if (!emit_op(e, value, op_compiled_fn(c, cc, idx)))
+                    return false;
+            }
+            else if (td_is_number(&c->data[idx])) {
+                push_literal(e, value);
+            }
+            else if (tag == MOD) {
+                if (!emit_mod(e, value, post)) return false;
+            }
+        }
+
+        // a value left over is the result of the line, which isn't used
+        for (uint8_t i = 0; i < e->top; i++)
+            if (!e->stack[i].literal) emit(e, "(void)%s;", e->stack[i].name);
+    }
+
+    return true;
+}
+
+static bool edits_scripts(const tele_command_t *c) {
+    for (uint8_t i = 0; i < c->length; i++) {
+        const int16_t v = td_value(&c->data[i]);
+        if (td_tag(&c->data[i]) == OP &&
+            (v == E_OP_INIT || v == E_OP_INIT_SCENE || v == E_OP_INIT_SCRIPT ||
+             v == E_OP_INIT_SCRIPT_ALL))
+            return true;
+    }
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// scenes
+
+static const char *script_name(size_t script) {
+    static const char *const names[] = { "1", "2", "3", "4", "5",
+                                         "6", "7", "8", "M", "I" };
+    return names[script];
+}
+
+// translates the PRE or POST part of a line in to a function, or failing that
+// writes a function that runs it with process_command, returns false then
+static bool write_part(FILE *out, emit_t *e, const char *comment,
+                       const char *name, bool pre, const char *post) {
+    const tele_command_t *c = ss_get_script_command(e->ss, e->script, e->line);
+    const compiled_command_t *cc =
+        ss_get_script_compiled(e->ss, e->script, e->line);
+    char *body;
+    size_t size;
+    e->f = open_memstream(&body, &size);
+    e->locals = 0;
+    e->uses_cs = false;
+    const bool translated = emit_subs(e, c, cc, pre, post);
+    fclose(e->f);
+
+    if (!translated) {
+        free(body);
+        e->f = open_memstream(&body, &size);
+        e->uses_cs = false;
+        if (pre)
+            emit(e, "aot_run_line(ss, es, %zu, %zu);", e->script, e->line);
+        else {
+            emit(e, "const tele_command_view_t post =");
+            emit(e, "    aot_post(ss, %zu, %zu);", e->script, e->line);
+            emit(e, "process_command(ss, es, &post);");
+        }
+        fclose(e->f);
+    }
+
+    fprintf(out, "// %s\n", comment);
+    fprintf(out, "static void %s(scene_state_t *ss, exec_state_t *es) {\n",
+            name);
+    if (e->uses_cs) fprintf(out, "    command_state_t cs;\n");
+    fprintf(out, "%s}\n\n", body);
+    free(body);
+    return translated;
+}
+
+// translates a script, as run_script_with_exec_state runs it, with a function
+// per line
+static void write_script(FILE *out, scene_state_t *ss, size_t scene,
+                         size_t script) {
+    emit_t e = {.ss = ss, .scene = scene, .script = script };
+    const uint8_t len = ss_get_script_len(ss, script);
+
+    for (size_t i = 0; i < len; i++) {
+        if (ss_get_script_comment(ss, script, i)) continue;
+        const tele_command_t *c = ss_get_script_command(ss, script, i);
+        char text[256], comment[320], name[48], post_name[64], post[80];
+        print_command(c, text);
+        e.line = i;
+        snprintf(name, sizeof(name), "s%zu_%zu_%zu", scene, script, i);
+        snprintf(comment, sizeof(comment), "%s:%zu %s", script_name(script),
+                 i + 1, text);
+
+        if (c->separator < 0 || !native_mod(td_value(&c->data[0]))) {
+            write_part(out, &e, comment, name, true, NULL);
+            continue;
+        }
+
+        // the POST only has a function if the PRE is translated, which
+        // calls it, so the PRE is translated first and written after it
+        snprintf(post_name, sizeof(post_name), "%s_post", name);
+        snprintf(post, sizeof(post), "%s(ss, es)", post_name);
+        char *pre_text;
+        size_t pre_size;
+        FILE *pre_out = open_memstream(&pre_text, &pre_size);
+        const bool translated =
+            write_part(pre_out, &e, comment, name, true, post);
+        fclose(pre_out);
+        if (translated) {
+            snprintf(comment, sizeof(comment), "%s:%zu POST of %s",
+                     script_name(script), i + 1, text);
+            write_part(out, &e, comment, post_name, false, NULL);
+        }
+        fputs(pre_text, out);
+        free(pre_text);
+    }
+
+    fprintf(out, "// script %s\n", script_name(script));
+    fprintf(out,
+            "static void s%zu_%zu(scene_state_t *ss, exec_state_t *es) {\n",
+            scene, script);
+    fprintf(out, "    es_set_script_number(es, %zu);\n", script);
+    bool lines = false;
+    for (size_t i = 0; i < len; i++) {
+        if (ss_get_script_comment(ss, script, i)) continue;
+        fprintf(out, "    AOT_EV(es)->line_number = %zu;\n", i);
+        fprintf(out, "    if (AOT_EV(es)->breaking) goto done;\n");
+        fprintf(out, "    do s%zu_%zu_%zu(ss, es);\n", scene, script, i);
+        fprintf(out, "    while (AOT_EV(es)->while_continue && "
+                     "!AOT_EV(es)->breaking);\n");
+        lines = true;
+    }
+    if (lines) fprintf(out, "done:\n");
+    fprintf(out, "    AOT_EV(es)->breaking = false;\n");
+    fprintf(out, "    ss_update_script_last(ss, %zu);\n", script);
+    fprintf(out, "}\n\n");
+}
+
+static void write_scene(FILE *out, scene_state_t *ss, size_t scene,
+                        const char *path) {
+    fprintf(out,
+            "////////////////////////////////////////////////////////////"
+            "////////////////////\n");
+    fprintf(out, "// %s\n\n", path);
+
+    for (size_t s = 0; s <= INIT_SCRIPT; s++)
+        fprintf(out,
+                "static void s%zu_%zu(scene_state_t *ss, exec_state_t *es);\n",
+                scene, s);
+    fprintf(out, "\n");
+
+    char *scripts;
+    size_t size;
+    FILE *f = open_memstream(&scripts, &size);
+    calls = false;
+    for (size_t s = 0; s <= INIT_SCRIPT; s++) write_script(f, ss, scene, s);
+    fclose(f);
+
+    // SCRIPT with a param that isn't a number, as op_SCRIPT_set
+    if (calls) {
+        fprintf(out,
+                "static void s%zu_call(scene_state_t *ss, exec_state_t *es, "
+                "int16_t n) {\n",
+                scene);
+        fprintf(out, "    static const aot_script_t scripts[] = {");
+        for (size_t s = 0; s <= INIT_SCRIPT; s++)
+            fprintf(out, "%s s%zu_%zu", s ? "," : "", scene, s);
+        fprintf(out, " };\n");
+        fprintf(out, "    uint16_t a = n - 1;\n");
+        fprintf(out, "    if (a > INIT_SCRIPT) return;\n");
+        fprintf(out, "    es_push(es);\n");
+        fprintf(out, "    if (!es->overflow) scripts[a](ss, es);\n");
+        fprintf(out, "    es_pop(es);\n");
+        fprintf(out, "}\n\n");
+    }
+    fputs(scripts, out);
+    free(scripts);
+
+    fprintf(out, "static const aot_scene_t scene%zu = {\n", scene);
+    fprintf(out, "    .name = \"%s\",\n", path);
+    fprintf(out, "    .hash = 0x%08" PRIx32 ",\n", aot_hash(ss));
+    fprintf(out, "    .scripts = {");
+    for (size_t s = 0; s <= INIT_SCRIPT; s++)
+        fprintf(out, "%s s%zu_%zu", s ? "," : "", scene, s);
+    fprintf(out, " }\n};\n\n");
+}
+
+// loads a scene, returns false if it can't be read
+static bool load(render_t *r, const char *path) {
+    render_init(r, NULL, NULL, 0);
+    FILE *f = fopen(path, "r");
+    if (!f || !scene_file_read(f, &r->ss)) {
+        perror(path);
+        if (f) fclose(f);
+        return false;
+    }
+    fclose(f);
+    return true;
+}
+
+static bool compilable(scene_state_t *ss, const char *path) {
+    for (size_t s = 0; s <= INIT_SCRIPT; s++)
+        for (size_t i = 0; i < ss_get_script_len(ss, s); i++)
+            if (!ss_get_script_comment(ss, s, i) &&
+                edits_scripts(ss_get_script_command(ss, s, i))) {
+                fprintf(stderr,
+                        "%s: script %s changes the scripts, leaving it to "
+                        "the interpreter\n",
+                        path, script_name(s));
+                return false;
+            }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    // a scene_state_t is too big for some stacks
+    render_t *r = malloc(sizeof(render_t));
+    char *body;
+    size_t size;
+    FILE *out = open_memstream(&body, &size);
+    const char **names = malloc(argc * sizeof(char *));
+    size_t count = 0;
+    bool ok = true;
+
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] == '-') {
+            fprintf(stderr, "usage: ttc scene.txt... > scenes.c\n");
+            return 1;
+        }
+        if (!load(r, argv[i])) {
+            ok = false;
+            continue;
+        }
+        if (!compilable(&r->ss, argv[i])) continue;
+        write_scene(out, &r->ss, count, argv[i]);
+        names[count++] = argv[i];
+    }
+    fclose(out);
+
+    printf("// Generated by ttc (see simulator/ttc.c) from:\n");
+    if (count == 0) printf("//     no scenes\n");
+    for (size_t i = 0; i < count; i++) printf("//     %s\n", names[i]);
+    printf("\n#include \"aot.h\"\n\n");
+    bool externs = false;
+    for (size_t i = 0; i < E_OP__LENGTH; i++)
+        if (used_ops[i]) {
+            printf("extern const tele_op_t %s;\n", tele_op_symbols[i]);
+            externs = true;
+        }
+    for (size_t i = 0; i < E_MOD__LENGTH; i++)
+        if (used_mods[i]) {
+            printf("extern const tele_mod_t %s;\n", tele_mod_symbols[i]);
+            externs = true;
+        }
+    printf("%s%s", externs ? "\n" : "", body);
+    printf("const aot_scene_t *const aot_scenes[] = {");
+    for (size_t i = 0; i < count; i++) printf(" &scene%zu,", i);
+    printf(" NULL };\n");
+
+    free(body);
+    free(names);
+    free(r);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+#include "arena.h"
+
+#include <string.h>  // memcpy
+
+static uint8_t blocks_for(uint8_t length) {
+    return (length + ARENA_BLOCK_WORDS - 1) / ARENA_BLOCK_WORDS;
+}
+
+void arena_init(command_arena_t *a) {
+    for (uint8_t i = 0; i < ARENA_BLOCKS - 1; i++) a->blocks[i].next = i + 1;
+    a->blocks[ARENA_BLOCKS - 1].next = ARENA_NONE;
+    a->free = 0;
+    a->free_count = ARENA_BLOCKS;
+}
+
+uint8_t arena_free_blocks(const command_arena_t *a) {
+    return a->free_count;
+}
+
+// copy the words of cmd in to the arena, returns false (and stores nothing)
+// if there aren't enough free blocks, if the view is of a POST command the
+// copy will not have a PRE separator
+bool arena_store(command_arena_t *a, arena_command_t *out,
+                 const tele_command_view_t *cmd) {
+    uint8_t needed = blocks_for(cmd->length);
+    if (needed > a->free_count) return false;
+
+    out->block = needed ? a->free : ARENA_NONE;
+    out->length = cmd->length;
+    out->separator = cmd->offset == 0 ? cmd->base->separator : -1;
+    out->source = ARENA_NONE;
+    out->offset = cmd->offset;
+
+    const tele_data_t *src = &cmd->base->data[cmd->offset];
+    uint8_t remaining = cmd->length;
+    uint8_t last = ARENA_NONE;
+    while (remaining) {
+        uint8_t n =
+            remaining < ARENA_BLOCK_WORDS ? remaining : ARENA_BLOCK_WORDS;
+        last = a->free;
+        memcpy(a->blocks[last].data, src, n * sizeof(tele_data_t));
+        a->free = a->blocks[last].next;
+        src += n;
+        remaining -= n;
+    }
+    if (needed) a->blocks[last].next = ARENA_NONE;
+    a->free_count -= needed;
+
+    return true;
+}
+
+void arena_load(const command_arena_t *a, const arena_command_t *c,
+                tele_command_t *out) {
+    out->length = c->length;
+    out->separator = c->separator;
+    out->comment = false;
+
+    uint8_t block = c->block;
+    for (uint8_t i = 0; i < c->length; i += ARENA_BLOCK_WORDS) {
+        uint8_t n = c->length - i < ARENA_BLOCK_WORDS ? c->length - i
+                                                      : ARENA_BLOCK_WORDS;
+        memcpy(&out->data[i], a->blocks[block].data, n * sizeof(tele_data_t));
+        block = a->blocks[block].next;
+    }
+}
+
+// give the blocks of c back to the arena, c is left empty
+void arena_release(command_arena_t *a, arena_command_t *c) {
+    if (c->block != ARENA_NONE) {
+        uint8_t last = c->block;
+        uint8_t count = 1;
+        while (a->blocks[last].next != ARENA_NONE) {
+            last = a->blocks[last].next;
+            count++;
+        }
+        a->blocks[last].next = a->free;
+        a->free = c->block;
+        a->free_count += count;
+    }
+    c->block = ARENA_NONE;
+    c->length = 0;
+}
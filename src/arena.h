@@ -0,0 +1,57 @@
+#ifndef _ARENA_H_
+#define _ARENA_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "command.h"
+
+// Shared storage for the commands kept by DEL and S, so that each only takes
+// as many words as it has instead of a whole tele_command_t.
+//
+// - the arena is ARENA_BLOCKS blocks of ARENA_BLOCK_WORDS words, a command is
+//   stored in a chain of as many blocks as it needs
+// - free blocks are kept on a list, so storing and freeing a command only
+//   touches its own blocks (at most COMMAND_MAX_LENGTH / ARENA_BLOCK_WORDS)
+// - a command that doesn't fit in the free blocks isn't stored at all,
+//   arena_store returns false and the DEL or S is dropped, as it is when
+//   there are no free delay slots or the S stack is full
+// - the longest POST command of a DEL or S takes 2 blocks, so 64 of the
+//   longest DELs fit with the S stack full, as the 64 delay slots of v4.0.0
+//   did, and all DELAY_SIZE delays fit when they're a block each
+
+#define ARENA_BLOCK_WORDS 7
+#define ARENA_BLOCKS 160
+#define ARENA_NONE 0xFF
+
+typedef struct {
+    tele_data_t data[ARENA_BLOCK_WORDS];
+    uint8_t next;  // the next block of the command, or the free list
+} arena_block_t;
+
+typedef struct {
+    arena_block_t blocks[ARENA_BLOCKS];
+    uint8_t free;  // first free block, ARENA_NONE if full
+    uint8_t free_count;
+} command_arena_t;
+
+// a stored command, held by its owner
+typedef struct {
+    uint8_t block;  // first block, ARENA_NONE if empty
+    uint8_t length;
+    int8_t separator;
+    // set by the owner, the script line the words were copied from, so that
+    // it can run them from that line's compiled form, ARENA_NONE if none
+    uint8_t source;
+    uint8_t offset;  // of the words in the command they were copied from
+} arena_command_t;
+
+void arena_init(command_arena_t *a);
+uint8_t arena_free_blocks(const command_arena_t *a);
+bool arena_store(command_arena_t *a, arena_command_t *out,
+                 const tele_command_view_t *cmd);
+void arena_load(const command_arena_t *a, const arena_command_t *c,
+                tele_command_t *out);
+void arena_release(command_arena_t *a, arena_command_t *c);
+
+#endif
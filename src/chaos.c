@@ -1,9 +1,9 @@
 #include "chaos.h"
 
-static int16_t cellular_get_val(void);
-static int16_t logistic_get_val(void);
-static int16_t cubic_get_val(void);
-static int16_t henon_get_val(void);
+static int16_t cellular_get_val(chaos_state_t*);
+static int16_t logistic_get_val(chaos_state_t*);
+static int16_t cubic_get_val(chaos_state_t*);
+static int16_t henon_get_val(chaos_state_t*);
 static void chaos_scale_values(chaos_state_t*);
 
 // constants defining I/O ranges
@@ -17,12 +17,13 @@ static const float chaos_henon_b = 0.3;
 static const int chaos_cell_count = 8;
 static const int chaos_cell_max = 0xff;
 
-static chaos_state_t chaos_state = {
-    .ix = 5000, .ir = 5000, .alg = CHAOS_ALGO_LOGISTIC
-};
-
-void chaos_init() {
-    chaos_scale_values(&chaos_state);
+void chaos_init(chaos_state_t* state) {
+    state->ix = 5000;
+    state->ir = 5000;
+    state->fx0 = 0.f;
+    state->fx1 = 0.f;
+    state->alg = CHAOS_ALGO_LOGISTIC;
+    chaos_scale_values(state);
 }
 
 // scale integer state and param values to float,
@@ -54,41 +55,40 @@ static void chaos_scale_values(chaos_state_t* state) {
     }
 }
 
-void chaos_set_val(int16_t val) {
-    chaos_state.ix = val;
-    chaos_scale_values(&chaos_state);
+void chaos_set_val(chaos_state_t* state, int16_t val) {
+    state->ix = val;
+    chaos_scale_values(state);
 }
 
-static int16_t logistic_get_val() {
-    if (chaos_state.fx < 0.f) { chaos_state.fx = 0.f; }
-    chaos_state.fx = chaos_state.fx * chaos_state.fr * (1.f - chaos_state.fx);
-    chaos_state.ix = chaos_state.fx * (float)chaos_value_max;
-    return chaos_state.ix;
+static int16_t logistic_get_val(chaos_state_t* state) {
+    if (state->fx < 0.f) { state->fx = 0.f; }
+    state->fx = state->fx * state->fr * (1.f - state->fx);
+    state->ix = state->fx * (float)chaos_value_max;
+    return state->ix;
 }
 
-static int16_t cubic_get_val() {
-    float x3 = chaos_state.fx * chaos_state.fx * chaos_state.fx;
-    chaos_state.fx =
-        chaos_state.fr * x3 + chaos_state.fx * (1.f - chaos_state.fr);
-    chaos_state.ix = chaos_state.fx * (float)chaos_value_max;
-    return chaos_state.ix;
+static int16_t cubic_get_val(chaos_state_t* state) {
+    float x3 = state->fx * state->fx * state->fx;
+    state->fx = state->fr * x3 + state->fx * (1.f - state->fr);
+    state->ix = state->fx * (float)chaos_value_max;
+    return state->ix;
 }
 
-static int16_t henon_get_val() {
-    float x0_2 = chaos_state.fx0 * chaos_state.fx0;
-    float x = 1.f - (x0_2 * chaos_state.fr) + (chaos_henon_b * chaos_state.fx1);
+static int16_t henon_get_val(chaos_state_t* state) {
+    float x0_2 = state->fx0 * state->fx0;
+    float x = 1.f - (x0_2 * state->fr) + (chaos_henon_b * state->fx1);
     // reflect bounds to avoid blowup
     while (x < -1.5) { x = -1.5 - x; }
     while (x > 1.5) { x = 1.5 - x; }
-    chaos_state.fx1 = chaos_state.fx0;
-    chaos_state.fx0 = chaos_state.fx;
-    chaos_state.fx = x;
-    chaos_state.ix = x / 1.5 * (float)chaos_value_max;
-    return chaos_state.ix;
+    state->fx1 = state->fx0;
+    state->fx0 = state->fx;
+    state->fx = x;
+    state->ix = x / 1.5 * (float)chaos_value_max;
+    return state->ix;
 }
 
-static int16_t cellular_get_val() {
-    uint8_t x = (uint8_t)chaos_state.ix;
+static int16_t cellular_get_val(chaos_state_t* state) {
+    uint8_t x = (uint8_t)state->ix;
     uint8_t y = 0;
     uint8_t code = 0;
     for (int i = 0; i < chaos_cell_count; ++i) {
@@ -112,39 +112,39 @@ static int16_t cellular_get_val() {
         if (x & (1 << i)) { code |= 0b010; }
         // lookup the bit in the rule specified by this code;
         // this is the new bit value
-        if (chaos_state.ir & (1 << code)) { y |= (1 << i); }
+        if (state->ir & (1 << code)) { y |= (1 << i); }
     }
-    chaos_state.ix = y;
-    return chaos_state.ix;
+    state->ix = y;
+    return state->ix;
 }
 
 
-int16_t chaos_get_val() {
-    switch (chaos_state.alg) {
-        case CHAOS_ALGO_LOGISTIC: return logistic_get_val();
-        case CHAOS_ALGO_CUBIC: return cubic_get_val();
-        case CHAOS_ALGO_HENON: return henon_get_val();
-        case CHAOS_ALGO_CELLULAR: return cellular_get_val();
+int16_t chaos_get_val(chaos_state_t* state) {
+    switch (state->alg) {
+        case CHAOS_ALGO_LOGISTIC: return logistic_get_val(state);
+        case CHAOS_ALGO_CUBIC: return cubic_get_val(state);
+        case CHAOS_ALGO_HENON: return henon_get_val(state);
+        case CHAOS_ALGO_CELLULAR: return cellular_get_val(state);
         default: return 0;
     }
 }
 
-void chaos_set_r(int16_t r) {
-    chaos_state.ir = r;
-    chaos_scale_values(&chaos_state);
+void chaos_set_r(chaos_state_t* state, int16_t r) {
+    state->ir = r;
+    chaos_scale_values(state);
 }
 
-int16_t chaos_get_r() {
-    return chaos_state.ir;
+int16_t chaos_get_r(chaos_state_t* state) {
+    return state->ir;
 }
 
-void chaos_set_alg(int16_t a) {
+void chaos_set_alg(chaos_state_t* state, int16_t a) {
     if (a < 0) { a = 0; }
     if (a >= CHAOS_ALGO_COUNT) { a = CHAOS_ALGO_COUNT - 1; }
-    chaos_state.alg = a;
-    chaos_scale_values(&chaos_state);
+    state->alg = a;
+    chaos_scale_values(state);
 }
 
-int16_t chaos_get_alg() {
-    return chaos_state.alg;
+int16_t chaos_get_alg(chaos_state_t* state) {
+    return state->alg;
 }
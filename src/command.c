@@ -10,21 +10,21 @@ void copy_command(tele_command_t *dst, const tele_command_t *src) {
     memcpy(dst, src, sizeof(tele_command_t));
 }
 
-void copy_post_command(tele_command_t *dst, const tele_command_t *src) {
-    dst->length = src->length - src->separator - 1;
-    dst->separator = -1;
-    memcpy(dst->data, &src->data[src->separator + 1],
-           dst->length * sizeof(tele_data_t));
+tele_command_view_t command_view(const tele_command_t *c) {
+    tele_command_view_t v = {
+        .base = c, .compiled = NULL, .offset = 0, .length = c->length
+    };
+    return v;
 }
 
 void print_command(const tele_command_t *cmd, char *out) {
     out[0] = 0;
     for (size_t i = 0; i < cmd->length; i++) {
-        tele_word_t tag = cmd->data[i].tag;
-        int16_t value = cmd->data[i].value;
+        tele_word_t tag = td_tag(&cmd->data[i]);
+        int16_t value = td_value(&cmd->data[i]);
 
         switch (tag) {
-            case OP: strcat(out, tele_ops[value]->name); break;
+            case OP: strcat(out, tele_op_names[value]); break;
             case NUMBER: {
                 char number[8];
                 itoa(value, number, 10);
@@ -58,7 +58,7 @@ void print_command(const tele_command_t *cmd, char *out) {
         // first check if we're not at the end
         if (i < cmd->length - 1) {
             // otherwise, only add a space if the next tag is a not a seperator
-            tele_word_t next_tag = cmd->data[i + 1].tag;
+            tele_word_t next_tag = td_tag(&cmd->data[i + 1]);
             if (next_tag != PRE_SEP && next_tag != SUB_SEP) {
                 strcat(out, " ");
             }
@@ -5,6 +5,8 @@
 #include <stdint.h>
 
 #define COMMAND_MAX_LENGTH 16
+// a sub command needs at least 1 word and a SUB_SEP after it
+#define COMMAND_MAX_SUBS (COMMAND_MAX_LENGTH / 2 + 1)
 
 typedef enum {
     NUMBER,
@@ -17,11 +19,35 @@ typedef enum {
     SUB_SEP
 } tele_word_t;
 
+// A word of a command, packed in to 3 bytes with no padding, as commands are
+// stored for every script line, delay and stack entry. Use the td_ functions
+// rather than the fields.
 typedef struct {
-    tele_word_t tag;
-    int16_t value;
+    uint8_t tag;       // a tele_word_t
+    uint8_t value[2];  // an int16_t, low byte first
 } tele_data_t;
 
+static inline tele_word_t td_tag(const tele_data_t *d) {
+    return (tele_word_t)d->tag;
+}
+
+// NUMBER, XNUMBER, BNUMBER and RNUMBER are all numbers, they only differ in
+// how they're printed
+static inline bool td_is_number(const tele_data_t *d) {
+    const tele_word_t tag = td_tag(d);
+    return tag == NUMBER || tag == XNUMBER || tag == BNUMBER || tag == RNUMBER;
+}
+
+static inline int16_t td_value(const tele_data_t *d) {
+    return (int16_t)(d->value[0] | (d->value[1] << 8));
+}
+
+static inline void td_set(tele_data_t *d, tele_word_t tag, int16_t value) {
+    d->tag = tag;
+    d->value[0] = (uint16_t)value & 0xFF;
+    d->value[1] = (uint16_t)value >> 8;
+}
+
 typedef struct {
     uint8_t length;
     int8_t separator;
@@ -29,8 +55,23 @@ typedef struct {
     bool comment;
 } tele_command_t;
 
+// defined in state.h
+struct compiled_command_s;
+
+// A non-owning view of either a whole command or its POST command (the words
+// after the PRE separator). MODs are handed a view of their POST command so
+// that it can be run without copying it, only ops that need to keep it beyond
+// the life of the script (e.g. DEL, S) copy the words out to the arena.
+typedef struct {
+    const tele_command_t *base;
+    // the compiled form of base, or NULL if it needs compiling before running
+    const struct compiled_command_s *compiled;
+    uint8_t offset;
+    uint8_t length;
+} tele_command_view_t;
+
 void copy_command(tele_command_t *dst, const tele_command_t *src);
-void copy_post_command(tele_command_t *dst, const tele_command_t *src);
+tele_command_view_t command_view(const tele_command_t *c);
 void print_command(const tele_command_t *c, char *out);
 
 #endif
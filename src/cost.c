@@ -0,0 +1,174 @@
+#include "cost.h"
+
+#include <string.h>
+
+#include "ops/op.h"
+
+// the costs of the scripts are kept per exec depth, as the same script called
+// deeper can follow fewer SCRIPTs, which keeps the work linear in the depth
+typedef struct {
+    scene_state_t *ss;
+    const cost_table_t *table;
+    cost_t memo[EXEC_DEPTH][SCRIPT_COUNT];
+    bool known[EXEC_DEPTH][SCRIPT_COUNT];
+} cost_context_t;
+
+static cost_t script_cost_at(cost_context_t *ctx, script_number_t script,
+                             uint8_t depth);
+
+static uint32_t add_sat(uint32_t a, uint32_t b) {
+    return a > UINT32_MAX - b ? UINT32_MAX : a + b;
+}
+
+static uint32_t mul_sat(uint32_t a, uint32_t b) {
+    uint64_t r = (uint64_t)a * b;
+    return r > UINT32_MAX ? UINT32_MAX : r;
+}
+
+static void cost_add(cost_t *total, cost_t c) {
+    total->cost = add_sat(total->cost, c.cost);
+    total->unknown_loops |= c.unknown_loops;
+}
+
+static bool is_script_op(const tele_data_t *d) {
+    return td_tag(d) == OP &&
+           (td_value(d) == E_OP_SCRIPT || td_value(d) == E_OP_SYM_DOLLAR);
+}
+
+// the words in c->data[start, end), which must be a single sub command
+static cost_t sub_cost(cost_context_t *ctx, const tele_command_t *c,
+                       int16_t start, int16_t end, uint8_t depth) {
+    cost_t total = { .cost = 0, .unknown_loops = false };
+
+    for (int16_t idx = start; idx < end; idx++) {
+        const tele_data_t *d = &c->data[idx];
+        if (td_tag(d) == OP)
+            total.cost = add_sat(total.cost,
+                                 ctx->table ? ctx->table->op[td_value(d)] : 1);
+    }
+
+    // SCRIPT n runs script n, unless the exec stack is already full
+    if (end - start < 2 || !is_script_op(&c->data[start]) ||
+        depth >= EXEC_DEPTH)
+        return total;
+
+    if (end - start == 2 && td_is_number(&c->data[start + 1])) {
+        int16_t script = td_value(&c->data[start + 1]) - 1;
+        if (script >= TT_SCRIPT_1 && script <= INIT_SCRIPT)
+            cost_add(&total, script_cost_at(ctx, script, depth + 1));
+    }
+    else {
+        cost_t worst = { .cost = 0, .unknown_loops = false };
+        for (int16_t s = TT_SCRIPT_1; s <= INIT_SCRIPT; s++) {
+            cost_t called = script_cost_at(ctx, s, depth + 1);
+            if (called.cost > worst.cost) worst.cost = called.cost;
+            worst.unknown_loops |= called.unknown_loops;
+        }
+        cost_add(&total, worst);
+    }
+
+    return total;
+}
+
+static cost_t words_cost(cost_context_t *ctx, const tele_command_t *c,
+                         int16_t start, int16_t end, uint8_t depth) {
+    cost_t total = { .cost = 0, .unknown_loops = false };
+    int16_t sub_start = start;
+
+    for (int16_t idx = start; idx < end; idx++) {
+        if (td_tag(&c->data[idx]) == SUB_SEP) {
+            cost_add(&total, sub_cost(ctx, c, sub_start, idx, depth));
+            sub_start = idx + 1;
+        }
+    }
+    cost_add(&total, sub_cost(ctx, c, sub_start, end, depth));
+
+    return total;
+}
+
+static cost_t command_cost_at(cost_context_t *ctx, const tele_command_t *c,
+                              uint8_t depth) {
+    if (c->length == 0 || td_tag(&c->data[0]) != MOD || c->separator < 0 ||
+        c->separator >= c->length)
+        return words_cost(ctx, c, 0, c->length, depth);
+
+    const int16_t sep = c->separator;
+    const tele_mod_idx_t mod = td_value(&c->data[0]);
+
+    cost_t pre = words_cost(ctx, c, 1, sep, depth);
+    pre.cost = add_sat(pre.cost, ctx->table ? ctx->table->mod[mod] : 1);
+    cost_t post = words_cost(ctx, c, sep + 1, c->length, depth);
+    uint32_t times = 1;
+
+    switch (mod) {
+        case E_MOD_L:
+            if (sep == 3 && td_is_number(&c->data[1]) &&
+                td_is_number(&c->data[2])) {
+                int32_t a = td_value(&c->data[1]);
+                int32_t b = td_value(&c->data[2]);
+                times = (a < b ? b - a : a - b) + 1;
+            }
+            else
+                post.unknown_loops = true;
+            break;
+        case E_MOD_W:
+            // the condition is run again for every loop too
+            cost_add(&pre, post);
+            pre.cost = mul_sat(pre.cost, WHILE_DEPTH);
+            return pre;
+        case E_MOD_P_MAP:
+        case E_MOD_PN_MAP: times = PATTERN_LENGTH; break;
+        case E_MOD_JF0: times = 2; break;
+        case E_MOD_CROWN: times = 4; break;
+        case E_MOD_DEL:
+        case E_MOD_DEL_X:
+        case E_MOD_DEL_R:
+        case E_MOD_DEL_G:
+        case E_MOD_DEL_B:
+        case E_MOD_S: times = 0; break;
+        default: break;
+    }
+
+    post.cost = mul_sat(post.cost, times);
+    cost_add(&pre, post);
+    return pre;
+}
+
+static cost_t script_cost_at(cost_context_t *ctx, script_number_t script,
+                             uint8_t depth) {
+    if (ctx->known[depth - 1][script]) return ctx->memo[depth - 1][script];
+
+    cost_t total = { .cost = 0, .unknown_loops = false };
+    for (uint8_t i = 0; i < ss_get_script_len(ctx->ss, script); i++) {
+        if (ss_get_script_comment(ctx->ss, script, i)) continue;
+        cost_add(&total,
+                 command_cost_at(ctx, ss_get_script_command(ctx->ss, script, i),
+                                 depth));
+    }
+
+    ctx->memo[depth - 1][script] = total;
+    ctx->known[depth - 1][script] = true;
+    return total;
+}
+
+static void cost_context_init(cost_context_t *ctx, scene_state_t *ss,
+                              const cost_table_t *table) {
+    ctx->ss = ss;
+    ctx->table = table;
+    memset(ctx->known, 0, sizeof(ctx->known));
+}
+
+cost_t script_cost(scene_state_t *ss, script_number_t script,
+                   const cost_table_t *table) {
+    cost_context_t ctx;
+    cost_context_init(&ctx, ss, table);
+    // a triggered script runs at an exec depth of 1
+    return script_cost_at(&ctx, script, 1);
+}
+
+cost_t command_cost(scene_state_t *ss, const tele_command_t *c,
+                    const cost_table_t *table) {
+    cost_context_t ctx;
+    cost_context_init(&ctx, ss, table);
+    return command_cost_at(&ctx, c, 1);
+}
@@ -0,0 +1,41 @@
+#ifndef _COST_H_
+#define _COST_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "command.h"
+#include "ops/op_enum.h"
+#include "state.h"
+
+// Static worst case cost of a script, the number of OPs and MODs run by one
+// trigger of it, or their total weight when given a cost_table_t (e.g. ns per
+// OP from the benchmarks).
+//
+// - L is multiplied out when both its ends are numbers, otherwise it's counted
+//   once and unknown_loops is set
+// - W is counted WHILE_DEPTH times, P.MAP and PN.MAP PATTERN_LENGTH times,
+//   JF0 twice and CROWN 4 times
+// - SCRIPT is followed until the exec stack would overflow, a SCRIPT without
+//   a number for its script counts as the worst script it could call
+// - the command of a DEL or S mod doesn't count, it runs in a later event
+// - commented lines don't count, as they don't run
+
+typedef struct {
+    uint32_t op[E_OP__LENGTH];
+    uint32_t mod[E_MOD__LENGTH];
+} cost_table_t;
+
+typedef struct {
+    uint32_t cost;       // saturates at UINT32_MAX
+    bool unknown_loops;  // an L without a constant range was counted once
+} cost_t;
+
+// table may be NULL to count every OP and MOD as 1
+cost_t script_cost(scene_state_t *ss, script_number_t script,
+                   const cost_table_t *table);
+// the cost of c as a line of script, SCRIPT calls are followed through ss
+cost_t command_cost(scene_state_t *ss, const tele_command_t *c,
+                    const cost_table_t *table);
+
+#endif
@@ -0,0 +1,69 @@
+#include "dispatch.h"
+
+// libavr32
+#include "events.h"
+
+dispatch_priority_t dispatch_priority(uint8_t type) {
+    switch (type) {
+        case kEventTrigger:
+        case kEventTimer:
+        case kEventAppCustom: return DISPATCH_TIMING;
+        case kEventFront:
+        case kEventKeyTimer:
+        case kEventHidConnect:
+        case kEventHidDisconnect:
+        case kEventHidTimer:
+        case kEventScreenRefresh:
+        case kEventMonomePoll:
+        case kEventMonomeRefresh: return DISPATCH_UI;
+        default: return DISPATCH_IO;
+    }
+}
+
+void dispatch_init(dispatch_t *d) {
+    for (uint8_t p = 0; p < DISPATCH_PRIORITIES; p++) {
+        d->queues[p].head = 0;
+        d->queues[p].count = 0;
+        d->queues[p].passed = 0;
+    }
+    d->count = 0;
+}
+
+bool dispatch_full(const dispatch_t *d) {
+    return d->count >= DISPATCH_EVENTS;
+}
+
+bool dispatch_push(dispatch_t *d, dispatch_priority_t priority, uint8_t type,
+                   int32_t data) {
+    if (dispatch_full(d) || priority >= DISPATCH_PRIORITIES) return false;
+    dispatch_queue_t *q = &d->queues[priority];
+    dispatch_event_t *e = &q->events[(q->head + q->count) % DISPATCH_EVENTS];
+    e->type = type;
+    e->data = data;
+    q->count++;
+    d->count++;
+    return true;
+}
+
+bool dispatch_pop(dispatch_t *d, uint8_t *type, int32_t *data) {
+    int8_t next = -1;
+    // a starved priority goes first, then the highest
+    for (uint8_t p = 0; p < DISPATCH_PRIORITIES && next < 0; p++)
+        if (d->queues[p].count && d->queues[p].passed >= DISPATCH_STARVE)
+            next = p;
+    for (uint8_t p = 0; p < DISPATCH_PRIORITIES && next < 0; p++)
+        if (d->queues[p].count) next = p;
+    if (next < 0) return false;
+
+    for (uint8_t p = next + 1; p < DISPATCH_PRIORITIES; p++)
+        if (d->queues[p].count) d->queues[p].passed++;
+
+    dispatch_queue_t *q = &d->queues[next];
+    *type = q->events[q->head].type;
+    *data = q->events[q->head].data;
+    q->head = (q->head + 1) % DISPATCH_EVENTS;
+    q->count--;
+    q->passed = 0;
+    d->count--;
+    return true;
+}
@@ -0,0 +1,57 @@
+#ifndef _DISPATCH_H_
+#define _DISPATCH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The events the target has taken from its event queue but not handled yet,
+// handled by priority rather than in the order they arrived, so that a
+// trigger doesn't wait behind a screen refresh.
+//
+// - dispatch_priority gives each libavr32 event type a priority, events of
+//   the same priority are handled in the order they arrived
+// - an event that has been passed over DISPATCH_STARVE times, by events of a
+//   higher priority, goes next, so that the screen still refreshes under a
+//   flood of triggers
+// - there's room for DISPATCH_EVENTS events in all, the target leaves the rest
+//   in its own queue until there's room
+
+#define DISPATCH_EVENTS 16
+#define DISPATCH_STARVE 8
+
+typedef enum {
+    DISPATCH_TIMING,  // triggers, the metro, the clock and delays
+    DISPATCH_IO,      // MIDI, grid keys, the ADC and devices coming and going
+    DISPATCH_UI,      // the keyboard coming and going and its keys, the front
+                      // button and screen refreshes
+    DISPATCH_PRIORITIES
+} dispatch_priority_t;
+
+typedef struct {
+    uint8_t type;
+    int32_t data;
+} dispatch_event_t;
+
+typedef struct {
+    dispatch_event_t events[DISPATCH_EVENTS];
+    uint8_t head;
+    uint8_t count;
+    uint8_t passed;  // events of a higher priority that went first
+} dispatch_queue_t;
+
+typedef struct {
+    dispatch_queue_t queues[DISPATCH_PRIORITIES];
+    uint8_t count;
+} dispatch_t;
+
+// the priority of an event type, an etype from events.h
+dispatch_priority_t dispatch_priority(uint8_t type);
+void dispatch_init(dispatch_t *d);
+bool dispatch_full(const dispatch_t *d);
+// returns false, dropping the event, if it's full
+bool dispatch_push(dispatch_t *d, dispatch_priority_t priority, uint8_t type,
+                   int32_t data);
+// takes the next event to handle, returns false if there aren't any
+bool dispatch_pop(dispatch_t *d, uint8_t *type, int32_t *data);
+
+#endif
@@ -0,0 +1,100 @@
+#include "fuse.h"
+
+#include "ops/hardware.h"
+#include "ops/maths.h"
+#include "ops/op.h"
+#include "ops/patterns.h"
+#include "teletype_io.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// MATCHING ////////////////////////////////////////////////////////////////////
+
+// OPs are matched by their get fn, so that aliases match too
+static bool is_op(const tele_data_t *d, const tele_op_t *op) {
+    return td_tag(d) == OP && tele_op_get[td_value(d)] == op->get;
+}
+
+static bool is_variable(const tele_data_t *d) {
+    return td_tag(d) == OP && tele_op_get[td_value(d)] == op_peek_i16;
+}
+
+static bool same_variable(const tele_data_t *a, const tele_data_t *b) {
+    return is_variable(a) && is_variable(b) &&
+           tele_op_data[td_value(a)] == tele_op_data[td_value(b)];
+}
+
+// V ADD V n or V SUB V n, starting at d[0]
+static fused_t match_step(const tele_data_t *d, fused_t add, fused_t sub) {
+    if (!td_is_number(&d[3])) return FUSED_NONE;
+    if (is_op(&d[1], &op_ADD)) return add;
+    if (is_op(&d[1], &op_SUB)) return sub;
+    return FUSED_NONE;
+}
+
+fused_t fuse_sub(const tele_command_t *c, uint8_t start, uint8_t end) {
+    if (end < start) return FUSED_NONE;
+
+    const tele_data_t *d = &c->data[start];
+    const uint8_t length = end - start + 1;
+
+    if (length == 2 && is_op(&d[0], &op_TR_PULSE) && td_is_number(&d[1]))
+        return FUSED_TR_P;
+
+    if (length == 4 && is_op(&d[0], &op_CV) && td_is_number(&d[1]) &&
+        is_op(&d[2], &op_N) && is_op(&d[3], &op_P_NEXT))
+        return FUSED_CV_N_P_NEXT;
+
+    if (length == 4 && same_variable(&d[0], &d[2]))
+        return match_step(d, FUSED_VAR_ADD, FUSED_VAR_SUB);
+
+    if (length == 7 && same_variable(&d[0], &d[3]) && is_op(&d[1], &op_WRAP) &&
+        td_is_number(&d[5]) && td_is_number(&d[6]))
+        return match_step(&d[1], FUSED_VAR_WRAP_ADD, FUSED_VAR_WRAP_SUB);
+
+    return FUSED_NONE;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// RUNNING /////////////////////////////////////////////////////////////////////
+
+static int16_t *variable(scene_state_t *ss, const tele_data_t *d) {
+    return (int16_t *)((char *)ss + (size_t)tele_op_data[td_value(d)]);
+}
+
+static void set_variable(int16_t *v, int16_t value) {
+    *v = value;
+    tele_vars_updated();
+}
+
+void run_fused(fused_t fused, scene_state_t *ss, const tele_command_t *c,
+               uint8_t start) {
+    const tele_data_t *d = &c->data[start];
+    int16_t *v;
+
+    switch (fused) {
+        case FUSED_VAR_ADD:
+            v = variable(ss, &d[0]);
+            set_variable(v, *v + td_value(&d[3]));
+            break;
+        case FUSED_VAR_SUB:
+            v = variable(ss, &d[0]);
+            set_variable(v, *v - td_value(&d[3]));
+            break;
+        case FUSED_VAR_WRAP_ADD:
+            v = variable(ss, &d[0]);
+            set_variable(v, wrap_value(*v + td_value(&d[4]), td_value(&d[5]),
+                                       td_value(&d[6])));
+            break;
+        case FUSED_VAR_WRAP_SUB:
+            v = variable(ss, &d[0]);
+            set_variable(v, wrap_value(*v - td_value(&d[4]), td_value(&d[5]),
+                                       td_value(&d[6])));
+            break;
+        case FUSED_CV_N_P_NEXT:
+            cv_set(ss, td_value(&d[1]), note_number_to_volts(p_next(ss)));
+            break;
+        case FUSED_TR_P: tr_pulse(ss, td_value(&d[1])); break;
+        case FUSED_NONE: break;
+    }
+}
@@ -0,0 +1,39 @@
+#ifndef _FUSE_H_
+#define _FUSE_H_
+
+#include <stdint.h>
+
+#include "command.h"
+#include "state.h"
+
+// Fused commands, a single handler for a whole sub command of a common shape,
+// in place of running each of its words.
+//
+// - V ADD V n, V SUB V n: V is A-D, T, X-Z or another simple variable, n is a
+//   number and the same V must be on both sides (also with + and -)
+// - V WRAP ADD V n a b, V WRAP SUB V n a b: as above with numbers a and b (also
+//   with WRP)
+// - CV n N P.NEXT
+// - TR.P n (also TR.PULSE)
+//
+// The handlers read their numbers from the words of the command, so a sub only
+// needs to know which of these it is, and they do exactly what the words
+// would.
+
+typedef enum {
+    FUSED_NONE = 0,
+    FUSED_VAR_ADD,
+    FUSED_VAR_SUB,
+    FUSED_VAR_WRAP_ADD,
+    FUSED_VAR_WRAP_SUB,
+    FUSED_CV_N_P_NEXT,
+    FUSED_TR_P,
+} fused_t;
+
+// the fused form of the sub command from c->data[start] to c->data[end]
+// (inclusive), FUSED_NONE if it isn't one
+fused_t fuse_sub(const tele_command_t *c, uint8_t start, uint8_t end);
+void run_fused(fused_t fused, scene_state_t *ss, const tele_command_t *c,
+               uint8_t start);
+
+#endif
@@ -0,0 +1,146 @@
+#include "match_token.h"
+
+#include <string.h>
+
+#include "ops/op.h"
+#include "ops/op_enum.h"
+#include "ops/op_hash.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// NUMBERS /////////////////////////////////////////////////////////////////////
+
+// numbers are any of:
+//
+// - decimal: an optional '-' and then 0-9, with a leading 0 it's octal and
+//   stops at the first 8 or 9 (as strtol with a base of 0)
+// - hex: 'X' and then 0-9 A-F, as a 16 bit pattern
+// - binary: 'B' and then 0 and 1, as a 16 bit pattern
+// - reversed binary: 'R' and then 0 and 1, with the first digit as bit 0
+//
+// decimals are clamped to an int16_t
+
+static bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+static bool is_binary(char c) {
+    return c == '0' || c == '1';
+}
+
+static bool is_hex(char c) {
+    return is_digit(c) || (c >= 'A' && c <= 'F');
+}
+
+static bool all_of(const char *s, size_t len, bool (*f)(char)) {
+    if (len == 0) return false;
+    for (size_t i = 0; i < len; i++)
+        if (!f(s[i])) return false;
+    return true;
+}
+
+static int16_t decimal_value(const char *s, size_t len) {
+    bool negative = s[0] == '-';
+    size_t i = negative ? 1 : 0;
+    uint8_t base = s[i] == '0' ? 8 : 10;
+
+    // stop counting once it's past anything that can be clamped
+    int32_t v = 0;
+    for (; i < len && s[i] - '0' < base; i++) {
+        v = v * base + (s[i] - '0');
+        if (v > INT16_MAX + 1) v = INT16_MAX + 1;
+    }
+
+    if (negative) v = -v;
+    if (v > INT16_MAX) v = INT16_MAX;
+    return v;
+}
+
+static bool match_number(const char *token, size_t len, tele_data_t *out) {
+    const char *digits = token + 1;
+    uint16_t v = 0;
+
+    switch (token[0]) {
+        case 'X':
+            if (!all_of(digits, len - 1, is_hex)) return false;
+            for (size_t i = 0; i < len - 1; i++)
+                v = (v << 4) | (is_digit(digits[i]) ? digits[i] - '0'
+                                                    : digits[i] - 'A' + 10);
+            td_set(out, XNUMBER, (int16_t)v);
+            return true;
+        case 'B':
+            if (!all_of(digits, len - 1, is_binary)) return false;
+            for (size_t i = 0; i < len - 1; i++)
+                v = (v << 1) | (digits[i] - '0');
+            td_set(out, BNUMBER, (int16_t)v);
+            return true;
+        case 'R':
+            if (!all_of(digits, len - 1, is_binary)) return false;
+            for (size_t i = 0; i < len - 1 && i < 16; i++)
+                if (digits[i] == '1') v |= 1 << i;
+            td_set(out, RNUMBER, (int16_t)v);
+            return true;
+        case '-':
+            if (!all_of(digits, len - 1, is_digit)) return false;
+            break;
+        default:
+            if (!all_of(token, len, is_digit)) return false;
+            break;
+    }
+
+    td_set(out, NUMBER, decimal_value(token, len));
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// OPS AND MODS ////////////////////////////////////////////////////////////////
+
+// these must match fnv1a and mix in utils/op_enums.py
+
+static uint32_t op_hash(const char *token, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (uint8_t)token[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static uint16_t op_hash_slot(uint32_t h) {
+    uint32_t x = h ^ (op_hash_displacements[h >> (32 - OP_HASH_BUCKET_BITS)] *
+                      0x9E3779B9u);
+    x ^= x >> 16;
+    x *= 0x045D9F3Bu;
+    x ^= x >> 16;
+    return x & (OP_HASH_SLOT_COUNT - 1);
+}
+
+static bool name_equals(const char *name, const char *token, size_t len) {
+    return strncmp(name, token, len) == 0 && name[len] == 0;
+}
+
+static bool match_op_or_mod(const char *token, size_t len, tele_data_t *out) {
+    uint16_t idx = op_hash_slots[op_hash_slot(op_hash(token, len))];
+
+    if (idx < E_OP__LENGTH) {
+        if (!name_equals(tele_op_names[idx], token, len)) return false;
+        td_set(out, OP, idx);
+        return true;
+    }
+    else if (idx != OP_HASH_EMPTY) {
+        idx -= E_OP__LENGTH;
+        if (!name_equals(tele_mods[idx]->name, token, len)) return false;
+        td_set(out, MOD, idx);
+        return true;
+    }
+
+    return false;
+}
+
+// matches a single token, the first len chars of token, which doesn't need to
+// be NUL terminated, return value indicates success or failure
+bool match_token(const char *token, const size_t len, tele_data_t *out) {
+    if (len == 0) return false;
+    // a number wins over an OP with the same name
+    return match_number(token, len, out) || match_op_or_mod(token, len, out);
+}
@@ -5,163 +5,163 @@
 #include "teletype_io.h"
 
 
-static void op_ANS_G_LED_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_ANS_G_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_ANS_G_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_ANS_G_P_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_ANS_A_LED_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_ANS_A_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_ANS_APP_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_ANS_APP_set(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-
-static void op_KR_PRE_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_KR_PRE_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_KR_PAT_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_KR_PAT_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_KR_SCALE_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_KR_SCALE_set(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_KR_PERIOD_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_KR_PERIOD_set(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_KR_POS_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_KR_POS_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_KR_L_ST_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_KR_L_ST_set(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_KR_L_LEN_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_KR_L_LEN_set(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_KR_RES_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_KR_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_KR_MUTE_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_KR_MUTE_set(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_KR_TMUTE_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_KR_CLK_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_KR_PG_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_KR_PG_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_KR_CUE_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_KR_CUE_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_KR_DIR_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_KR_DIR_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_KR_DUR_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_ME_PRE_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_ME_PRE_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_ME_RES_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_ME_STOP_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_ME_SCALE_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_ME_SCALE_set(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_ME_PERIOD_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_ME_PERIOD_set(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_ME_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-
-static void op_LV_PRE_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_LV_PRE_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_LV_RES_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_LV_POS_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_LV_POS_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_LV_L_ST_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_LV_L_ST_set(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_LV_L_LEN_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_LV_L_LEN_set(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_LV_L_DIR_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_LV_L_DIR_set(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_LV_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-
-static void op_CY_PRE_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_CY_PRE_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_CY_RES_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_CY_POS_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_CY_POS_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_CY_REV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_CY_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-
-static void op_MID_SHIFT_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_MID_SLEW_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-
-static void op_ARP_STY_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_ARP_HLD_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_ARP_RPT_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_ARP_GT_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_ARP_DIV_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_ARP_RES_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_ARP_SHIFT_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_ARP_SLEW_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_ARP_FIL_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_ARP_ROT_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_ARP_ER_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
+void op_ANS_G_LED_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_ANS_G_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_ANS_G_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_ANS_G_P_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_ANS_A_LED_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_ANS_A_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_ANS_APP_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_ANS_APP_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+
+void op_KR_PRE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_KR_PRE_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_KR_PAT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_KR_PAT_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_KR_SCALE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_KR_SCALE_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_KR_PERIOD_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_KR_PERIOD_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_KR_POS_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_KR_POS_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_KR_L_ST_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_KR_L_ST_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_KR_L_LEN_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_KR_L_LEN_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_KR_RES_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_KR_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_KR_MUTE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_KR_MUTE_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_KR_TMUTE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_KR_CLK_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_KR_PG_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_KR_PG_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_KR_CUE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_KR_CUE_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_KR_DIR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_KR_DIR_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_KR_DUR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_ME_PRE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_ME_PRE_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_ME_RES_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_ME_STOP_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_ME_SCALE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_ME_SCALE_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_ME_PERIOD_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_ME_PERIOD_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_ME_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+
+void op_LV_PRE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_LV_PRE_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_LV_RES_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_LV_POS_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_LV_POS_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_LV_L_ST_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_LV_L_ST_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_LV_L_LEN_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_LV_L_LEN_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_LV_L_DIR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_LV_L_DIR_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_LV_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+
+void op_CY_PRE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_CY_PRE_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_CY_RES_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_CY_POS_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_CY_POS_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_CY_REV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_CY_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+
+void op_MID_SHIFT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_MID_SLEW_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+
+void op_ARP_STY_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_ARP_HLD_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_ARP_RPT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_ARP_GT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_ARP_DIV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_ARP_RES_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_ARP_SHIFT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_ARP_SLEW_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_ARP_FIL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_ARP_ROT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_ARP_ER_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
 
 
 // clang-format off
@@ -227,9 +227,8 @@ const tele_op_t op_ARP_ER      = MAKE_GET_OP(ARP.ER         , op_ARP_ER_get
 // clang-format on
 
 
-static void op_ANS_G_LED_get(const void *NOTUSED(data),
-                             scene_state_t *NOTUSED(ss),
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ANS_G_LED_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t x = cs_pop(cs);
     int16_t y = cs_pop(cs);
 
@@ -245,8 +244,8 @@ static void op_ANS_G_LED_get(const void *NOTUSED(data),
     cs_push(cs, d[0]);
 }
 
-static void op_ANS_G_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs) {
+void op_ANS_G_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs) {
     int16_t x = cs_pop(cs);
     int16_t y = cs_pop(cs);
 
@@ -262,8 +261,8 @@ static void op_ANS_G_get(const void *data, scene_state_t *ss, exec_state_t *es,
     cs_push(cs, d[0]);
 }
 
-static void op_ANS_G_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ANS_G_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t x = cs_pop(cs);
     int16_t y = cs_pop(cs);
     int16_t z = cs_pop(cs);
@@ -274,9 +273,8 @@ static void op_ANS_G_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     tele_ii_tx(ES, d, 4);
 }
 
-static void op_ANS_G_P_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ANS_G_P_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t x = cs_pop(cs);
     int16_t y = cs_pop(cs);
 
@@ -290,9 +288,8 @@ static void op_ANS_G_P_get(const void *NOTUSED(data),
     tele_ii_tx(ES, d, 4);
 }
 
-static void op_ANS_A_LED_get(const void *NOTUSED(data),
-                             scene_state_t *NOTUSED(ss),
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ANS_A_LED_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t n = cs_pop(cs);
     int16_t i = cs_pop(cs);
 
@@ -305,8 +302,8 @@ static void op_ANS_A_LED_get(const void *NOTUSED(data),
     cs_push(cs, d[0]);
 }
 
-static void op_ANS_A_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ANS_A_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t n = cs_pop(cs);
     int16_t delta = cs_pop(cs);
 
@@ -315,9 +312,8 @@ static void op_ANS_A_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     tele_ii_tx(II_CY_ADDR, d, 3);
 }
 
-static void op_ANS_APP_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ANS_APP_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t d[] = { II_ANSIBLE_APP | II_GET };
     tele_ii_tx(II_ANSIBLE_ADDR, d, 1);
     tele_ii_tx(II_LV_ADDR, d, 1);
@@ -340,9 +336,8 @@ static void op_ANS_APP_get(const void *NOTUSED(data),
     cs_push(cs, d[0]);
 }
 
-static void op_ANS_APP_set(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ANS_APP_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t n = cs_pop(cs);
 
     uint8_t d[] = { II_ANSIBLE_APP, n };
@@ -356,15 +351,15 @@ static void op_ANS_APP_set(const void *NOTUSED(data),
     tele_ii_tx(ES, d, 2);
 }
 
-static void op_KR_PRE_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_PRE_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_KR_PRESET, a };
     tele_ii_tx(II_KR_ADDR, d, 2);
 }
 
-static void op_KR_PRE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_PRE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t d[] = { II_KR_PRESET | II_GET };
     uint8_t addr = II_KR_ADDR;
     tele_ii_tx(addr, d, 1);
@@ -373,15 +368,15 @@ static void op_KR_PRE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     cs_push(cs, d[0]);
 }
 
-static void op_KR_PAT_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_PAT_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_KR_PATTERN, a };
     tele_ii_tx(II_KR_ADDR, d, 2);
 }
 
-static void op_KR_PAT_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_PAT_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t d[] = { II_KR_PATTERN | II_GET };
     uint8_t addr = II_KR_ADDR;
     tele_ii_tx(addr, d, 1);
@@ -390,17 +385,15 @@ static void op_KR_PAT_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     cs_push(cs, d[0]);
 }
 
-static void op_KR_SCALE_set(const void *NOTUSED(data),
-                            scene_state_t *NOTUSED(ss),
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_SCALE_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_KR_SCALE, a };
     tele_ii_tx(II_KR_ADDR, d, 2);
 }
 
-static void op_KR_SCALE_get(const void *NOTUSED(data),
-                            scene_state_t *NOTUSED(ss),
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_SCALE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t d[] = { II_KR_SCALE | II_GET };
     uint8_t addr = II_KR_ADDR;
     tele_ii_tx(addr, d, 1);
@@ -409,17 +402,15 @@ static void op_KR_SCALE_get(const void *NOTUSED(data),
     cs_push(cs, d[0]);
 }
 
-static void op_KR_PERIOD_set(const void *NOTUSED(data),
-                             scene_state_t *NOTUSED(ss),
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_PERIOD_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_KR_PERIOD, a >> 8, a & 0xff };
     tele_ii_tx(II_KR_ADDR, d, 3);
 }
 
-static void op_KR_PERIOD_get(const void *NOTUSED(data),
-                             scene_state_t *NOTUSED(ss),
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_PERIOD_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t d[] = { II_KR_PERIOD | II_GET, 0 };
     uint8_t addr = II_KR_ADDR;
     tele_ii_tx(addr, d, 1);
@@ -429,8 +420,8 @@ static void op_KR_PERIOD_get(const void *NOTUSED(data),
     cs_push(cs, (d[0] << 8) + d[1]);
 }
 
-static void op_KR_POS_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_POS_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     int16_t c = cs_pop(cs);
@@ -438,8 +429,8 @@ static void op_KR_POS_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     tele_ii_tx(II_KR_ADDR, d, 4);
 }
 
-static void op_KR_POS_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_POS_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     uint8_t d[] = { II_KR_POS | II_GET, a, b };
@@ -450,9 +441,8 @@ static void op_KR_POS_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     cs_push(cs, d[0]);
 }
 
-static void op_KR_L_ST_set(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_L_ST_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     int16_t c = cs_pop(cs);
@@ -460,9 +450,8 @@ static void op_KR_L_ST_set(const void *NOTUSED(data),
     tele_ii_tx(II_KR_ADDR, d, 4);
 }
 
-static void op_KR_L_ST_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_L_ST_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     uint8_t d[] = { II_KR_LOOP_ST | II_GET, a, b };
@@ -473,9 +462,8 @@ static void op_KR_L_ST_get(const void *NOTUSED(data),
     cs_push(cs, d[0]);
 }
 
-static void op_KR_L_LEN_set(const void *NOTUSED(data),
-                            scene_state_t *NOTUSED(ss),
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_L_LEN_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     int16_t c = cs_pop(cs);
@@ -483,9 +471,8 @@ static void op_KR_L_LEN_set(const void *NOTUSED(data),
     tele_ii_tx(II_KR_ADDR, d, 4);
 }
 
-static void op_KR_L_LEN_get(const void *NOTUSED(data),
-                            scene_state_t *NOTUSED(ss),
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_L_LEN_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     uint8_t d[] = { II_KR_LOOP_LEN | II_GET, a, b };
@@ -496,16 +483,16 @@ static void op_KR_L_LEN_get(const void *NOTUSED(data),
     cs_push(cs, d[0]);
 }
 
-static void op_KR_RES_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_RES_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     uint8_t d[] = { II_KR_RESET, a, b };
     tele_ii_tx(II_KR_ADDR, d, 3);
 }
 
-static void op_KR_CV_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_CV_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     a--;
     uint8_t d[] = { II_KR_CV | II_GET, a & 0x3 };
@@ -517,18 +504,16 @@ static void op_KR_CV_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     cs_push(cs, (d[0] << 8) + d[1]);
 }
 
-static void op_KR_MUTE_set(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_MUTE_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     uint8_t d[] = { II_KR_MUTE, a, b };
     tele_ii_tx(II_KR_ADDR, d, 3);
 }
 
-static void op_KR_MUTE_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_MUTE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_KR_MUTE | II_GET, a };
     uint8_t addr = II_KR_ADDR;
@@ -538,24 +523,23 @@ static void op_KR_MUTE_get(const void *NOTUSED(data),
     cs_push(cs, d[0]);
 }
 
-static void op_KR_TMUTE_get(const void *NOTUSED(data),
-                            scene_state_t *NOTUSED(ss),
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_TMUTE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_KR_TMUTE, a };
     tele_ii_tx(II_KR_ADDR, d, 2);
 }
 
-static void op_KR_CLK_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_CLK_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_KR_CLK, a };
     tele_ii_tx(II_KR_ADDR, d, 2);
 }
 
 
-static void op_KR_PG_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_PG_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t d[] = { II_KR_PAGE | II_GET };
     tele_ii_tx(II_KR_ADDR, d, 1);
 
@@ -564,16 +548,16 @@ static void op_KR_PG_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     cs_push(cs, d[0]);
 }
 
-static void op_KR_PG_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_PG_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t n = cs_pop(cs);
 
     uint8_t d[] = { II_KR_PAGE, n };
     tele_ii_tx(II_KR_ADDR, d, 2);
 }
 
-static void op_KR_CUE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_CUE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t d[] = { II_KR_CUE | II_GET };
     tele_ii_tx(II_KR_ADDR, d, 1);
 
@@ -582,16 +566,16 @@ static void op_KR_CUE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     cs_push(cs, (int8_t)d[0]);
 }
 
-static void op_KR_CUE_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_CUE_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t pat = cs_pop(cs);
 
     uint8_t d[] = { II_KR_CUE, pat };
     tele_ii_tx(II_KR_ADDR, d, 2);
 }
 
-static void op_KR_DIR_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_DIR_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t n = cs_pop(cs);
     uint8_t d[] = { II_KR_DIR | II_GET, n };
     tele_ii_tx(II_KR_ADDR, d, 2);
@@ -601,8 +585,8 @@ static void op_KR_DIR_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     cs_push(cs, d[0]);
 }
 
-static void op_KR_DIR_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_DIR_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t n = cs_pop(cs);
     int16_t x = cs_pop(cs);
 
@@ -610,8 +594,8 @@ static void op_KR_DIR_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     tele_ii_tx(II_KR_ADDR, d, 3);
 }
 
-static void op_KR_DUR_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_KR_DUR_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     a--;
     uint8_t d[] = { II_KR_DURATION | II_GET, a & 0x3 };
@@ -624,15 +608,15 @@ static void op_KR_DUR_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
 }
 
 
-static void op_ME_PRE_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ME_PRE_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_MP_PRESET, a };
     tele_ii_tx(II_MP_ADDR, d, 2);
 }
 
-static void op_ME_PRE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ME_PRE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t d[] = { II_MP_PRESET | II_GET };
     uint8_t addr = II_MP_ADDR;
     tele_ii_tx(addr, d, 1);
@@ -641,32 +625,29 @@ static void op_ME_PRE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     cs_push(cs, d[0]);
 }
 
-static void op_ME_RES_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ME_RES_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_MP_RESET, a };
     tele_ii_tx(II_MP_ADDR, d, 2);
 }
 
-static void op_ME_STOP_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ME_STOP_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_MP_STOP, a };
     tele_ii_tx(II_MP_ADDR, d, 2);
 }
 
-static void op_ME_SCALE_set(const void *NOTUSED(data),
-                            scene_state_t *NOTUSED(ss),
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ME_SCALE_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_MP_SCALE, a };
     tele_ii_tx(II_MP_ADDR, d, 2);
 }
 
-static void op_ME_SCALE_get(const void *NOTUSED(data),
-                            scene_state_t *NOTUSED(ss),
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ME_SCALE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t d[] = { II_MP_SCALE | II_GET };
     uint8_t addr = II_MP_ADDR;
     tele_ii_tx(addr, d, 1);
@@ -675,17 +656,15 @@ static void op_ME_SCALE_get(const void *NOTUSED(data),
     cs_push(cs, d[0]);
 }
 
-static void op_ME_PERIOD_set(const void *NOTUSED(data),
-                             scene_state_t *NOTUSED(ss),
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ME_PERIOD_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_MP_PERIOD, a >> 8, a & 0xff };
     tele_ii_tx(II_MP_ADDR, d, 3);
 }
 
-static void op_ME_PERIOD_get(const void *NOTUSED(data),
-                             scene_state_t *NOTUSED(ss),
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ME_PERIOD_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t d[] = { II_MP_PERIOD | II_GET, 0 };
     uint8_t addr = II_MP_ADDR;
     tele_ii_tx(addr, d, 1);
@@ -695,8 +674,8 @@ static void op_ME_PERIOD_get(const void *NOTUSED(data),
     cs_push(cs, (d[0] << 8) + d[1]);
 }
 
-static void op_ME_CV_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ME_CV_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     a--;
     uint8_t d[] = { II_MP_CV | II_GET, a & 0x3 };
@@ -708,15 +687,15 @@ static void op_ME_CV_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     cs_push(cs, (d[0] << 8) + d[1]);
 }
 
-static void op_LV_PRE_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_LV_PRE_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_LV_PRESET, a };
     tele_ii_tx(II_LV_ADDR, d, 2);
 }
 
-static void op_LV_PRE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_LV_PRE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t d[] = { II_LV_PRESET | II_GET };
     uint8_t addr = II_LV_ADDR;
     tele_ii_tx(addr, d, 1);
@@ -725,22 +704,22 @@ static void op_LV_PRE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     cs_push(cs, d[0]);
 }
 
-static void op_LV_RES_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_LV_RES_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_LV_RESET, a };
     tele_ii_tx(II_LV_ADDR, d, 2);
 }
 
-static void op_LV_POS_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs) {
+void op_LV_POS_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_LV_POS, a };
     tele_ii_tx(II_LV_ADDR, d, 2);
 }
 
-static void op_LV_POS_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs) {
+void op_LV_POS_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs) {
     uint8_t d[] = { II_LV_POS | II_GET };
     uint8_t addr = II_LV_ADDR;
     tele_ii_tx(addr, d, 1);
@@ -749,15 +728,15 @@ static void op_LV_POS_get(const void *data, scene_state_t *ss, exec_state_t *es,
     cs_push(cs, d[0]);
 }
 
-static void op_LV_L_ST_set(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs) {
+void op_LV_L_ST_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_LV_L_ST, a };
     tele_ii_tx(II_LV_ADDR, d, 2);
 }
 
-static void op_LV_L_ST_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs) {
+void op_LV_L_ST_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs) {
     uint8_t d[] = { II_LV_L_ST | II_GET };
     uint8_t addr = II_LV_ADDR;
     tele_ii_tx(addr, d, 1);
@@ -766,15 +745,15 @@ static void op_LV_L_ST_get(const void *data, scene_state_t *ss,
     cs_push(cs, d[0]);
 }
 
-static void op_LV_L_LEN_set(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs) {
+void op_LV_L_LEN_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_LV_L_LEN, a };
     tele_ii_tx(II_LV_ADDR, d, 2);
 }
 
-static void op_LV_L_LEN_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs) {
+void op_LV_L_LEN_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs) {
     uint8_t d[] = { II_LV_L_LEN | II_GET };
     uint8_t addr = II_LV_ADDR;
     tele_ii_tx(addr, d, 1);
@@ -783,15 +762,15 @@ static void op_LV_L_LEN_get(const void *data, scene_state_t *ss,
     cs_push(cs, d[0]);
 }
 
-static void op_LV_L_DIR_set(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs) {
+void op_LV_L_DIR_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_LV_L_DIR, a };
     tele_ii_tx(II_LV_ADDR, d, 2);
 }
 
-static void op_LV_L_DIR_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs) {
+void op_LV_L_DIR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs) {
     uint8_t d[] = { II_LV_L_DIR | II_GET };
     uint8_t addr = II_LV_ADDR;
     tele_ii_tx(addr, d, 1);
@@ -800,8 +779,8 @@ static void op_LV_L_DIR_get(const void *data, scene_state_t *ss,
     cs_push(cs, d[0]);
 }
 
-static void op_LV_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs) {
+void op_LV_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs) {
     int16_t a = cs_pop(cs);
     a--;
     uint8_t d[] = { II_LV_CV | II_GET, a & 0x3 };
@@ -813,15 +792,15 @@ static void op_LV_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
     cs_push(cs, (d[0] << 8) + d[1]);
 }
 
-static void op_CY_PRE_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs) {
+void op_CY_PRE_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_CY_PRESET, a };
     tele_ii_tx(II_CY_ADDR, d, 2);
 }
 
-static void op_CY_PRE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_CY_PRE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t d[] = { II_CY_PRESET | II_GET };
     uint8_t addr = II_CY_ADDR;
     tele_ii_tx(addr, d, 1);
@@ -830,23 +809,23 @@ static void op_CY_PRE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     cs_push(cs, d[0]);
 }
 
-static void op_CY_RES_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_CY_RES_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_CY_RESET, a };
     tele_ii_tx(II_CY_ADDR, d, 2);
 }
 
-static void op_CY_POS_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_CY_POS_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     uint8_t d[] = { II_CY_POS, a, b };
     tele_ii_tx(II_CY_ADDR, d, 3);
 }
 
-static void op_CY_POS_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_CY_POS_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_CY_POS | II_GET, a };
     uint8_t addr = II_CY_ADDR;
@@ -856,15 +835,15 @@ static void op_CY_POS_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     cs_push(cs, d[0]);
 }
 
-static void op_CY_REV_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_CY_REV_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_CY_REV, a };
     tele_ii_tx(II_CY_ADDR, d, 2);
 }
 
-static void op_CY_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs) {
+void op_CY_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs) {
     int16_t a = cs_pop(cs);
     a--;
     uint8_t d[] = { II_CY_CV | II_GET, a & 0x3 };
@@ -876,41 +855,36 @@ static void op_CY_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
     cs_push(cs, (d[0] << 8) + d[1]);
 }
 
-static void op_MID_SHIFT_get(const void *NOTUSED(data),
-                             scene_state_t *NOTUSED(ss),
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MID_SHIFT_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_MID_SHIFT, a >> 8, a & 0xff };
     tele_ii_tx(II_MID_ADDR, d, 3);
 }
 
-static void op_MID_SLEW_get(const void *NOTUSED(data),
-                            scene_state_t *NOTUSED(ss),
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MID_SLEW_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_MID_SLEW, a >> 8, a & 0xff };
     tele_ii_tx(II_MID_ADDR, d, 3);
 }
 
-static void op_ARP_STY_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ARP_STY_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_ARP_STYLE, a };
     tele_ii_tx(II_ARP_ADDR, d, 2);
 }
 
-static void op_ARP_HLD_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ARP_HLD_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_ARP_HOLD, a & 0xff };
     tele_ii_tx(II_ARP_ADDR, d, 2);
 }
 
-static void op_ARP_RPT_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ARP_RPT_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     int16_t c = cs_pop(cs);
@@ -918,69 +892,63 @@ static void op_ARP_RPT_get(const void *NOTUSED(data),
     tele_ii_tx(II_ARP_ADDR, d, 5);
 }
 
-static void op_ARP_GT_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ARP_GT_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     uint8_t d[] = { II_ARP_GATE, a & 0xff, b & 0xff };
     tele_ii_tx(II_ARP_ADDR, d, 3);
 }
 
-static void op_ARP_DIV_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ARP_DIV_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     uint8_t d[] = { II_ARP_DIV, a & 0xff, b & 0xff };
     tele_ii_tx(II_ARP_ADDR, d, 3);
 }
 
-static void op_ARP_RES_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ARP_RES_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { II_ARP_RESET, a };
     tele_ii_tx(II_ARP_ADDR, d, 2);
 }
 
-static void op_ARP_SHIFT_get(const void *NOTUSED(data),
-                             scene_state_t *NOTUSED(ss),
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ARP_SHIFT_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     uint8_t d[] = { II_ARP_SHIFT, a, b >> 8, b & 0xff };
     tele_ii_tx(II_ARP_ADDR, d, 4);
 }
 
-static void op_ARP_SLEW_get(const void *NOTUSED(data),
-                            scene_state_t *NOTUSED(ss),
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ARP_SLEW_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     uint8_t d[] = { II_ARP_SLEW, a, b >> 8, b & 0xff };
     tele_ii_tx(II_ARP_ADDR, d, 4);
 }
 
-static void op_ARP_FIL_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ARP_FIL_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     uint8_t d[] = { II_ARP_FILL, a, b };
     tele_ii_tx(II_ARP_ADDR, d, 3);
 }
 
-static void op_ARP_ROT_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ARP_ROT_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     uint8_t d[] = { II_ARP_ROT, a, b >> 8, b & 0xff };
     tele_ii_tx(II_ARP_ADDR, d, 4);
 }
 
-static void op_ARP_ER_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ARP_ER_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     int16_t c = cs_pop(cs);
@@ -7,52 +7,72 @@
 
 static void mod_PROB_func(scene_state_t *ss, exec_state_t *es,
                           command_state_t *cs,
-                          const tele_command_t *post_command);
+                          const tele_command_view_t *post_command);
 static void mod_IF_func(scene_state_t *ss, exec_state_t *es,
                         command_state_t *cs,
-                        const tele_command_t *post_command);
+                        const tele_command_view_t *post_command);
 static void mod_ELIF_func(scene_state_t *ss, exec_state_t *es,
                           command_state_t *cs,
-                          const tele_command_t *post_command);
+                          const tele_command_view_t *post_command);
 static void mod_ELSE_func(scene_state_t *ss, exec_state_t *es,
                           command_state_t *cs,
-                          const tele_command_t *post_command);
+                          const tele_command_view_t *post_command);
 static void mod_L_func(scene_state_t *ss, exec_state_t *es, command_state_t *cs,
-                       const tele_command_t *post_command);
+                       const tele_command_view_t *post_command);
 static void mod_W_func(scene_state_t *ss, exec_state_t *es, command_state_t *cs,
-                       const tele_command_t *post_command);
+                       const tele_command_view_t *post_command);
 static void mod_EVERY_func(scene_state_t *ss, exec_state_t *es,
                            command_state_t *cs,
-                           const tele_command_t *post_command);
+                           const tele_command_view_t *post_command);
 static void mod_SKIP_func(scene_state_t *ss, exec_state_t *es,
                           command_state_t *cs,
-                          const tele_command_t *post_command);
+                          const tele_command_view_t *post_command);
 static void mod_OTHER_func(scene_state_t *ss, exec_state_t *es,
                            command_state_t *cs,
-                           const tele_command_t *post_command);
-
-static void op_SCENE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                           const tele_command_view_t *post_command);
+
+void op_SCENE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_SCENE_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_SCENE_G_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_SCENE_P_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_SCRIPT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_SCRIPT_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_SCRIPT_POL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_SCRIPT_POL_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_SCRIPT_SLICE_get(const void *data, scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs);
-static void op_SCENE_set(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_SCRIPT_SLICE_set(const void *data, scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs);
-static void op_SCENE_G_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_SCENE_P_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_SCRIPT_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_SCRIPT_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_SCRIPT_POL_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_SCRIPT_POL_set(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_KILL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_SCRIPT_Q_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_SCRIPT_Q_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_SCRIPT_QP_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_SCRIPT_QP_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_SCRIPT_DROP_get(const void *data, scene_state_t *ss, exec_state_t *es,
                         command_state_t *cs);
-static void op_BREAK_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_SYNC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_SCRIPT_DROP_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_SCRIPT_OVER_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_SCRIPT_OVER_set(const void *data, scene_state_t *ss, exec_state_t *es,
                         command_state_t *cs);
+void op_KILL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_BREAK_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_SYNC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
 
 
 // clang-format off
@@ -71,6 +91,16 @@ const tele_op_t op_SCRIPT = MAKE_GET_SET_OP(SCRIPT, op_SCRIPT_get, op_SCRIPT_set
 const tele_op_t op_SYM_DOLLAR = MAKE_ALIAS_OP($, op_SCRIPT_get, op_SCRIPT_set, 0, true);
 const tele_op_t op_SCRIPT_POL = MAKE_GET_SET_OP(SCRIPT.POL, op_SCRIPT_POL_get, op_SCRIPT_POL_set, 1, true);
 const tele_op_t op_SYM_DOLLAR_POL = MAKE_ALIAS_OP($.POL, op_SCRIPT_POL_get, op_SCRIPT_POL_set, 1, true);
+const tele_op_t op_SCRIPT_SLICE = MAKE_GET_SET_OP(SCRIPT.SLICE, op_SCRIPT_SLICE_get, op_SCRIPT_SLICE_set, 0, true);
+const tele_op_t op_SYM_DOLLAR_SLICE = MAKE_ALIAS_OP($.SLICE, op_SCRIPT_SLICE_get, op_SCRIPT_SLICE_set, 0, true);
+const tele_op_t op_SCRIPT_Q = MAKE_GET_SET_OP(SCRIPT.Q, op_SCRIPT_Q_get, op_SCRIPT_Q_set, 1, true);
+const tele_op_t op_SYM_DOLLAR_Q = MAKE_ALIAS_OP($.Q, op_SCRIPT_Q_get, op_SCRIPT_Q_set, 1, true);
+const tele_op_t op_SCRIPT_QP = MAKE_GET_SET_OP(SCRIPT.QP, op_SCRIPT_QP_get, op_SCRIPT_QP_set, 1, true);
+const tele_op_t op_SYM_DOLLAR_QP = MAKE_ALIAS_OP($.QP, op_SCRIPT_QP_get, op_SCRIPT_QP_set, 1, true);
+const tele_op_t op_SCRIPT_DROP = MAKE_GET_SET_OP(SCRIPT.DROP, op_SCRIPT_DROP_get, op_SCRIPT_DROP_set, 1, true);
+const tele_op_t op_SYM_DOLLAR_DROP = MAKE_ALIAS_OP($.DROP, op_SCRIPT_DROP_get, op_SCRIPT_DROP_set, 1, true);
+const tele_op_t op_SCRIPT_OVER = MAKE_GET_SET_OP(SCRIPT.OVER, op_SCRIPT_OVER_get, op_SCRIPT_OVER_set, 1, true);
+const tele_op_t op_SYM_DOLLAR_OVER = MAKE_ALIAS_OP($.OVER, op_SCRIPT_OVER_get, op_SCRIPT_OVER_set, 1, true);
 const tele_op_t op_KILL = MAKE_GET_OP(KILL, op_KILL_get, 0, false);
 const tele_op_t op_SCENE_G = MAKE_GET_OP(SCENE.G, op_SCENE_G_get, 1, false);
 const tele_op_t op_SCENE_P = MAKE_GET_OP(SCENE.P, op_SCENE_P_get, 1, false);
@@ -80,146 +110,178 @@ const tele_op_t op_BRK = MAKE_ALIAS_OP(BRK, op_BREAK_get, NULL, 0, false);
 const tele_op_t op_SYNC = MAKE_GET_OP(SYNC, op_SYNC_get, 1, false);
 // clang-format on
 
+bool mod_PROB_start(scene_state_t *ss, int16_t a) {
+    random_state_t *r = &ss->rand_states.s.prob.rand;
+    return random_next(r) % 100 < a;
+}
+
 static void mod_PROB_func(scene_state_t *ss, exec_state_t *es,
                           command_state_t *cs,
-                          const tele_command_t *post_command) {
+                          const tele_command_view_t *post_command) {
     int16_t a = cs_pop(cs);
-    random_state_t *r = &ss->rand_states.s.prob.rand;
+    if (mod_PROB_start(ss, a)) process_command(ss, es, post_command);
+}
 
-    if (random_next(r) % 100 < a) { process_command(ss, es, post_command); }
+bool mod_IF_start(exec_state_t *es, int16_t a) {
+    es_variables(es)->if_else_condition = a != 0;
+    return a != 0;
 }
 
 static void mod_IF_func(scene_state_t *ss, exec_state_t *es,
                         command_state_t *cs,
-                        const tele_command_t *post_command) {
+                        const tele_command_view_t *post_command) {
     int16_t a = cs_pop(cs);
+    if (mod_IF_start(es, a)) process_command(ss, es, post_command);
+}
 
-    es_variables(es)->if_else_condition = false;
-    if (a) {
-        es_variables(es)->if_else_condition = true;
-        process_command(ss, es, post_command);
-    }
+bool mod_ELIF_start(exec_state_t *es, int16_t a) {
+    if (es_variables(es)->if_else_condition || !a) return false;
+    es_variables(es)->if_else_condition = true;
+    return true;
 }
 
 static void mod_ELIF_func(scene_state_t *ss, exec_state_t *es,
                           command_state_t *cs,
-                          const tele_command_t *post_command) {
+                          const tele_command_view_t *post_command) {
     int16_t a = cs_pop(cs);
+    if (mod_ELIF_start(es, a)) process_command(ss, es, post_command);
+}
 
-    if (!es_variables(es)->if_else_condition) {
-        if (a) {
-            es_variables(es)->if_else_condition = true;
-            process_command(ss, es, post_command);
-        }
-    }
+bool mod_ELSE_start(exec_state_t *es) {
+    if (es_variables(es)->if_else_condition) return false;
+    es_variables(es)->if_else_condition = true;
+    return true;
 }
 
 static void mod_ELSE_func(scene_state_t *ss, exec_state_t *es,
                           command_state_t *NOTUSED(cs),
-                          const tele_command_t *post_command) {
-    if (!es_variables(es)->if_else_condition) {
-        es_variables(es)->if_else_condition = true;
-        process_command(ss, es, post_command);
+                          const tele_command_view_t *post_command) {
+    if (mod_ELSE_start(es)) process_command(ss, es, post_command);
+}
+
+void mod_L_start(exec_state_t *es, int16_t a, int16_t b, loop_state_t *loop) {
+    es_variables(es)->i = a;
+    // iterate with higher precision to account for b == 32767
+    loop->l = a;
+    loop->end = b;
+    loop->forward = a < b;
+}
+
+bool mod_L_next(exec_state_t *es, int16_t *i, loop_state_t *loop) {
+    const bool breaking = es_variables(es)->breaking;
+
+    // Forward loop
+    if (loop->forward) {
+        if (breaking) return false;
+        // the increment statement has careful syntax, because the
+        // ++ operator has precedence over the dereference * operator
+        (*i)++;
+        if (++loop->l <= loop->end) return true;
+        (*i)--;  // past end of loop, leave I in the correct state
+        return false;
     }
+    // Reverse loop (also works for equal values (either loop would))
+    (*i)--;
+    if (--loop->l >= loop->end && !breaking) return true;
+    if (!breaking) (*i)++;
+    return false;
 }
 
 static void mod_L_func(scene_state_t *ss, exec_state_t *es, command_state_t *cs,
-                       const tele_command_t *post_command) {
+                       const tele_command_view_t *post_command) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
+    loop_state_t loop;
+    mod_L_start(es, a, b, &loop);
 
     // using a pointer means that the loop contents can a interact with the
     // iterator, allowing users to roll back a loop or advance it faster
     int16_t *i = &es_variables(es)->i;
-    *i = a;
+    do {
+        process_command(ss, es, post_command);
+    } while (mod_L_next(es, i, &loop));
+}
 
-    // Forward loop
-    if (a < b) {
-        // continue the loop whenever the _pointed-to_ I meets the condition
-        // this means that I can be interacted with inside the loop command
-
-        // iterate with higher precision to account for b == 32767
-        for (int32_t l = a; l <= b; l++) {
-            process_command(ss, es, post_command);
-            if (es_variables(es)->breaking) break;
-            // the increment statement has careful syntax, because the
-            // ++ operator has precedence over the dereference * operator
-            (*i)++;
-        }
+bool mod_W_start(exec_state_t *es, int16_t a) {
+    if (a) return true;
+    es_variables(es)->while_continue = false;
+    return false;
+}
 
-        if (!es_variables(es)->breaking)
-            (*i)--;  // past end of loop, leave I in the correct state
-    }
-    // Reverse loop (also works for equal values (either loop would))
-    else {
-        for (int32_t l = a; l >= b && !es_variables(es)->breaking; l--) {
-            process_command(ss, es, post_command);
-            (*i)--;
-        }
-        if (!es_variables(es)->breaking) (*i)++;
-    }
+void mod_W_next(exec_state_t *es) {
+    es_variables(es)->while_depth++;
+    if (es_variables(es)->while_depth < WHILE_DEPTH)
+        es_variables(es)->while_continue = true;
+    else
+        es_variables(es)->while_continue = false;
 }
 
 static void mod_W_func(scene_state_t *ss, exec_state_t *es, command_state_t *cs,
-                       const tele_command_t *post_command) {
+                       const tele_command_view_t *post_command) {
     int16_t a = cs_pop(cs);
-    if (a) {
+    if (mod_W_start(es, a)) {
         process_command(ss, es, post_command);
-        es_variables(es)->while_depth++;
-        if (es_variables(es)->while_depth < WHILE_DEPTH)
-            es_variables(es)->while_continue = true;
-        else
-            es_variables(es)->while_continue = false;
+        mod_W_next(es);
     }
-    else
-        es_variables(es)->while_continue = false;
 }
 
-static void mod_EVERY_func(scene_state_t *ss, exec_state_t *es,
-                           command_state_t *cs,
-                           const tele_command_t *post_command) {
-    int16_t mod = cs_pop(cs);
+static every_count_t *mod_every(scene_state_t *ss, exec_state_t *es,
+                                bool skip, int16_t mod) {
     every_count_t *every = ss_get_every(ss, es_variables(es)->script_number,
                                         es_variables(es)->line_number);
-    every_set_skip(every, false);
+    every_set_skip(every, skip);
     every_set_mod(every, mod);
     every_tick(every);
-    if (every_is_now(ss, every)) process_command(ss, es, post_command);
+    return every;
+}
+
+bool mod_EVERY_start(scene_state_t *ss, exec_state_t *es, int16_t mod) {
+    return every_is_now(ss, mod_every(ss, es, false, mod));
+}
+
+static void mod_EVERY_func(scene_state_t *ss, exec_state_t *es,
+                           command_state_t *cs,
+                           const tele_command_view_t *post_command) {
+    int16_t mod = cs_pop(cs);
+    if (mod_EVERY_start(ss, es, mod)) process_command(ss, es, post_command);
+}
+
+bool mod_SKIP_start(scene_state_t *ss, exec_state_t *es, int16_t mod) {
+    return skip_is_now(ss, mod_every(ss, es, true, mod));
 }
 
 static void mod_SKIP_func(scene_state_t *ss, exec_state_t *es,
                           command_state_t *cs,
-                          const tele_command_t *post_command) {
+                          const tele_command_view_t *post_command) {
     int16_t mod = cs_pop(cs);
-    every_count_t *every = ss_get_every(ss, es_variables(es)->script_number,
-                                        es_variables(es)->line_number);
-    every_set_skip(every, true);
-    every_set_mod(every, mod);
-    every_tick(every);
-    if (skip_is_now(ss, every)) process_command(ss, es, post_command);
+    if (mod_SKIP_start(ss, es, mod)) process_command(ss, es, post_command);
+}
+
+bool mod_OTHER_start(scene_state_t *ss) {
+    return !ss->every_last;
 }
 
 static void mod_OTHER_func(scene_state_t *ss, exec_state_t *es,
                            command_state_t *NOTUSED(cs),
-                           const tele_command_t *post_command) {
-    if (!ss->every_last) process_command(ss, es, post_command);
+                           const tele_command_view_t *post_command) {
+    if (mod_OTHER_start(ss)) process_command(ss, es, post_command);
 }
 
 
-static void op_SYNC_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SYNC_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t count = cs_pop(cs);
     ss->every_last = false;
     ss_sync_every(ss, count);
 }
 
-static void op_SCENE_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SCENE_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->variables.scene);
 }
 
-static void op_SCENE_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SCENE_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t scene = cs_pop(cs);
     if (!ss->initializing) {
         ss->variables.scene = scene;
@@ -227,8 +289,8 @@ static void op_SCENE_set(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_SCENE_G_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SCENE_G_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t scene = cs_pop(cs);
     if (!ss->initializing) {
         ss->variables.scene = scene;
@@ -236,8 +298,8 @@ static void op_SCENE_G_get(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_SCENE_P_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SCENE_P_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t scene = cs_pop(cs);
     if (!ss->initializing) {
         ss->variables.scene = scene;
@@ -245,15 +307,15 @@ static void op_SCENE_P_get(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_SCRIPT_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *es, command_state_t *cs) {
+void op_SCRIPT_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *es, command_state_t *cs) {
     int16_t sn = es_variables(es)->script_number + 1;
     if (sn == 11) sn = 0;
     cs_push(cs, sn);
 }
 
-static void op_SCRIPT_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *es, command_state_t *cs) {
+void op_SCRIPT_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *es, command_state_t *cs) {
     uint16_t a = cs_pop(cs) - 1;
     if (a > INIT_SCRIPT || a < TT_SCRIPT_1) return;
 
@@ -264,8 +326,8 @@ static void op_SCRIPT_set(const void *NOTUSED(data), scene_state_t *ss,
     es_pop(es);
 }
 
-static void op_SCRIPT_POL_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SCRIPT_POL_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint16_t a = cs_pop(cs) - 1;
     if (a > TT_SCRIPT_8 || a < TT_SCRIPT_1) {
         cs_push(cs, 0);
@@ -274,8 +336,8 @@ static void op_SCRIPT_POL_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, ss_get_script_pol(ss, a));
 }
 
-static void op_SCRIPT_POL_set(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SCRIPT_POL_set(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t a = cs_pop(cs);
     uint8_t pol = cs_pop(cs);
     if (pol > 3) return;
@@ -290,11 +352,109 @@ static void op_SCRIPT_POL_set(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_KILL_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es),
-                        command_state_t *NOTUSED(cs)) {
+void op_SCRIPT_SLICE_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+    cs_push(cs, ss->variables.script_slice);
+}
+
+void op_SCRIPT_SLICE_set(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+    int16_t a = cs_pop(cs);
+    ss->variables.script_slice = a < 0 ? 0 : a;
+}
+
+// the trigger queue of each input, x is the input from 1, and for set 0 is
+// every input
+void op_SCRIPT_Q_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
+    uint16_t a = cs_pop(cs) - 1;
+    if (a >= TRIGGER_INPUTS) {
+        cs_push(cs, 0);
+        return;
+    }
+    cs_push(cs, ss->triggers.inputs[a].depth);
+}
+
+void op_SCRIPT_Q_set(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
+    int16_t a = cs_pop(cs);
+    int16_t depth = cs_pop(cs);
+    for (uint8_t i = 0; i < TRIGGER_INPUTS; i++)
+        if (a == 0 || a == i + 1) trigger_set_depth(&ss->triggers, i, depth);
+}
+
+void op_SCRIPT_QP_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+    uint16_t a = cs_pop(cs) - 1;
+    if (a >= TRIGGER_INPUTS) {
+        cs_push(cs, 0);
+        return;
+    }
+    cs_push(cs, ss->triggers.inputs[a].policy);
+}
+
+void op_SCRIPT_QP_set(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+    int16_t a = cs_pop(cs);
+    int16_t policy = cs_pop(cs);
+    if (policy < 0 || policy >= TRIGGER_POLICY_COUNT) return;
+    for (uint8_t i = 0; i < TRIGGER_INPUTS; i++)
+        if (a == 0 || a == i + 1)
+            trigger_set_policy(&ss->triggers, i, policy);
+}
+
+// for get 0 is the sum of every input's count
+static void get_trigger_count(scene_state_t *ss, command_state_t *cs,
+                              bool overruns) {
+    int16_t a = cs_pop(cs);
+    int32_t total = 0;
+    for (uint8_t i = 0; i < TRIGGER_INPUTS; i++) {
+        if (a != 0 && a != i + 1) continue;
+        const trigger_input_t *in = &ss->triggers.inputs[i];
+        total += overruns ? in->overruns : in->dropped;
+    }
+    cs_push(cs, total > INT16_MAX ? INT16_MAX : total);
+}
+
+static void set_trigger_count(scene_state_t *ss, command_state_t *cs,
+                              bool overruns) {
+    int16_t a = cs_pop(cs);
+    int16_t value = cs_pop(cs);
+    if (value < 0) value = 0;
+    for (uint8_t i = 0; i < TRIGGER_INPUTS; i++) {
+        if (a != 0 && a != i + 1) continue;
+        trigger_input_t *in = &ss->triggers.inputs[i];
+        if (overruns)
+            in->overruns = value;
+        else
+            in->dropped = value;
+    }
+}
+
+void op_SCRIPT_DROP_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+    get_trigger_count(ss, cs, false);
+}
+
+void op_SCRIPT_DROP_set(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+    set_trigger_count(ss, cs, false);
+}
+
+void op_SCRIPT_OVER_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+    get_trigger_count(ss, cs, true);
+}
+
+void op_SCRIPT_OVER_set(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+    set_trigger_count(ss, cs, true);
+}
+
+void op_KILL_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *NOTUSED(cs)) {
     // clear stack
-    ss->stack_op.top = 0;
+    ss_stack_op_clear(ss);
     tele_has_stack(false);
     // disable metronome
     ss->variables.m_act = 0;
@@ -303,7 +463,7 @@ static void op_KILL_get(const void *NOTUSED(data), scene_state_t *ss,
     tele_kill();
 }
 
-static void op_BREAK_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                         exec_state_t *es, command_state_t *NOTUSED(cs)) {
+void op_BREAK_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                  exec_state_t *es, command_state_t *NOTUSED(cs)) {
     es_variables(es)->breaking = true;
 }
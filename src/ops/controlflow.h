@@ -2,6 +2,7 @@
 #define _OPS_CONTROLFLOW_H_
 
 #include "ops/op.h"
+#include "teletype.h"
 
 extern const tele_mod_t mod_PROB;
 extern const tele_mod_t mod_IF;
@@ -14,10 +15,38 @@ extern const tele_mod_t mod_EV;
 extern const tele_mod_t mod_SKIP;
 extern const tele_mod_t mod_OTHER;
 
+// The MOD funcs without their POST, shared with the sliced runs (see
+// run_mod_start in teletype.c) and the compiled scenes of the simulator. The
+// params are the MOD's, in the order they come off the stack, and each
+// returns true if the POST should run. After each run of the POST, L carries
+// on while mod_L_next returns true, with i the loop's I, and W calls
+// mod_W_next.
+bool mod_PROB_start(scene_state_t *ss, int16_t a);
+bool mod_IF_start(exec_state_t *es, int16_t a);
+bool mod_ELIF_start(exec_state_t *es, int16_t a);
+bool mod_ELSE_start(exec_state_t *es);
+void mod_L_start(exec_state_t *es, int16_t a, int16_t b, loop_state_t *loop);
+bool mod_L_next(exec_state_t *es, int16_t *i, loop_state_t *loop);
+bool mod_W_start(exec_state_t *es, int16_t a);
+void mod_W_next(exec_state_t *es);
+bool mod_EVERY_start(scene_state_t *ss, exec_state_t *es, int16_t mod);
+bool mod_SKIP_start(scene_state_t *ss, exec_state_t *es, int16_t mod);
+bool mod_OTHER_start(scene_state_t *ss);
+
 extern const tele_op_t op_SCRIPT;
 extern const tele_op_t op_SYM_DOLLAR;
 extern const tele_op_t op_SCRIPT_POL;
 extern const tele_op_t op_SYM_DOLLAR_POL;
+extern const tele_op_t op_SCRIPT_SLICE;
+extern const tele_op_t op_SYM_DOLLAR_SLICE;
+extern const tele_op_t op_SCRIPT_Q;
+extern const tele_op_t op_SYM_DOLLAR_Q;
+extern const tele_op_t op_SCRIPT_QP;
+extern const tele_op_t op_SYM_DOLLAR_QP;
+extern const tele_op_t op_SCRIPT_DROP;
+extern const tele_op_t op_SYM_DOLLAR_DROP;
+extern const tele_op_t op_SCRIPT_OVER;
+extern const tele_op_t op_SYM_DOLLAR_OVER;
 extern const tele_op_t op_KILL;
 extern const tele_op_t op_SCENE;
 extern const tele_op_t op_SCENE_G;
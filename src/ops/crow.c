@@ -10,68 +10,66 @@
 // helper macros for terse inline defns
 #define CR_PROTO_MOD(name)                                                     \
     static void name(scene_state_t *ss, exec_state_t *es, command_state_t *cs, \
-                     const tele_command_t *post_command)
-#define CR_PROTO_GET(name)                                                  \
-    static void name(const void *data, scene_state_t *ss, exec_state_t *es, \
-                     command_state_t *cs)
+                     const tele_command_view_t *post_command)
+#define CR_PROTO_GET(name)                                           \
+    void name(const void *data, scene_state_t *ss, exec_state_t *es, \
+              command_state_t *cs)
 
 
 // device selection ops & mods
 
-static u8 unit = CROW_ADDR_0;
-
 CR_PROTO_MOD(mod_CROWALL_func) {
-    u8 u = unit;
-    unit = CROW_ADDR_0;
+    u8 u = ss->i2c.crow;
+    ss->i2c.crow = CROW_ADDR_0;
     process_command(ss, es, post_command);
-    unit = CROW_ADDR_1;
+    ss->i2c.crow = CROW_ADDR_1;
     process_command(ss, es, post_command);
-    unit = CROW_ADDR_2;
+    ss->i2c.crow = CROW_ADDR_2;
     process_command(ss, es, post_command);
-    unit = CROW_ADDR_3;
+    ss->i2c.crow = CROW_ADDR_3;
     process_command(ss, es, post_command);
-    unit = u;
+    ss->i2c.crow = u;
 }
 CR_PROTO_MOD(mod_CROW1_func) {
-    u8 u = unit;
-    unit = CROW_ADDR_0;
+    u8 u = ss->i2c.crow;
+    ss->i2c.crow = CROW_ADDR_0;
     process_command(ss, es, post_command);
-    unit = u;
+    ss->i2c.crow = u;
 }
 CR_PROTO_MOD(mod_CROW2_func) {
-    u8 u = unit;
-    unit = CROW_ADDR_1;
+    u8 u = ss->i2c.crow;
+    ss->i2c.crow = CROW_ADDR_1;
     process_command(ss, es, post_command);
-    unit = u;
+    ss->i2c.crow = u;
 }
 CR_PROTO_MOD(mod_CROW3_func) {
-    u8 u = unit;
-    unit = CROW_ADDR_2;
+    u8 u = ss->i2c.crow;
+    ss->i2c.crow = CROW_ADDR_2;
     process_command(ss, es, post_command);
-    unit = u;
+    ss->i2c.crow = u;
 }
 CR_PROTO_MOD(mod_CROW4_func) {
-    u8 u = unit;
-    unit = CROW_ADDR_3;
+    u8 u = ss->i2c.crow;
+    ss->i2c.crow = CROW_ADDR_3;
     process_command(ss, es, post_command);
-    unit = u;
+    ss->i2c.crow = u;
 }
 CR_PROTO_GET(op_CROW_SEL_get) {
     switch (cs_pop(cs)) {
         case 2: {
-            unit = CROW_ADDR_1;
+            ss->i2c.crow = CROW_ADDR_1;
             break;
         }
         case 3: {
-            unit = CROW_ADDR_2;
+            ss->i2c.crow = CROW_ADDR_2;
             break;
         }
         case 4: {
-            unit = CROW_ADDR_3;
+            ss->i2c.crow = CROW_ADDR_3;
             break;
         }
         default: {
-            unit = CROW_ADDR_0;
+            ss->i2c.crow = CROW_ADDR_0;
             break;
         }
     }
@@ -81,16 +79,16 @@ CR_PROTO_GET(op_CROW_SEL_get) {
 // send commands to crow
 
 CR_PROTO_GET(op_CROW_V_get) {
-    i2c_write_8_16(cs, unit, CROW_VOLTS);
+    i2c_write_8_16(cs, ss->i2c.crow, CROW_VOLTS);
 }
 CR_PROTO_GET(op_CROW_SLEW_get) {
-    i2c_write_8_16(cs, unit, CROW_SLEW);
+    i2c_write_8_16(cs, ss->i2c.crow, CROW_SLEW);
 }
 CR_PROTO_GET(op_CROW_CALL1_get) {
-    i2c_write_16(cs, unit, CROW_CALL1);
+    i2c_write_16(cs, ss->i2c.crow, CROW_CALL1);
 }
 CR_PROTO_GET(op_CROW_CALL2_get) {
-    i2c_write_16_16(cs, unit, CROW_CALL2);
+    i2c_write_16_16(cs, ss->i2c.crow, CROW_CALL2);
 }
 CR_PROTO_GET(op_CROW_CALL3_get) {
     int16_t a = cs_pop(cs);
@@ -98,7 +96,7 @@ CR_PROTO_GET(op_CROW_CALL3_get) {
     int16_t c = cs_pop(cs);
     uint8_t d[] = { CROW_CALL3, a >> 8, a & 0xff, b >> 8,
                     b & 0xff,   c >> 8, c & 0xFF };
-    tele_ii_tx(unit, d, 7);
+    tele_ii_tx(ss->i2c.crow, d, 7);
 }
 CR_PROTO_GET(op_CROW_CALL4_get) {
     int16_t a = cs_pop(cs);
@@ -107,10 +105,10 @@ CR_PROTO_GET(op_CROW_CALL4_get) {
     int16_t e = cs_pop(cs);
     uint8_t d[] = { CROW_CALL4, a >> 8,   a & 0xff, b >> 8,  b & 0xff,
                     c >> 8,     c & 0xFF, e >> 8,   e & 0xFF };
-    tele_ii_tx(unit, d, 9);
+    tele_ii_tx(ss->i2c.crow, d, 9);
 }
 CR_PROTO_GET(op_CROW_RESET_get) {
-    i2c_write_0(cs, unit, CROW_RESET);
+    i2c_write_0(cs, ss->i2c.crow, CROW_RESET);
 }
 CR_PROTO_GET(op_CROW_PULSE_get) {
     int16_t a = cs_pop(cs);
@@ -118,7 +116,7 @@ CR_PROTO_GET(op_CROW_PULSE_get) {
     int16_t c = cs_pop(cs);
     int16_t e = cs_pop(cs);
     uint8_t d[] = { CROW_PULSE, a, b >> 8, b & 0xff, c >> 8, c & 0xFF, e };
-    tele_ii_tx(unit, d, 7);
+    tele_ii_tx(ss->i2c.crow, d, 7);
 }
 CR_PROTO_GET(op_CROW_AR_get) {
     int16_t a = cs_pop(cs);
@@ -127,7 +125,7 @@ CR_PROTO_GET(op_CROW_AR_get) {
     int16_t e = cs_pop(cs);
     uint8_t d[] = { CROW_AR, a,        b >> 8, b & 0xff,
                     c >> 8,  c & 0xFF, e >> 8, e & 0xFF };
-    tele_ii_tx(unit, d, 8);
+    tele_ii_tx(ss->i2c.crow, d, 8);
 }
 CR_PROTO_GET(op_CROW_LFO_get) {
     int16_t a = cs_pop(cs);
@@ -136,7 +134,7 @@ CR_PROTO_GET(op_CROW_LFO_get) {
     int16_t e = cs_pop(cs);
     uint8_t d[] = { CROW_LFO, a,        b >> 8, b & 0xff,
                     c >> 8,   c & 0xFF, e >> 8, e & 0xFF };
-    tele_ii_tx(unit, d, 8);
+    tele_ii_tx(ss->i2c.crow, d, 8);
 }
 
 
@@ -144,40 +142,40 @@ CR_PROTO_GET(op_CROW_LFO_get) {
 
 CR_PROTO_GET(op_CROW_IN_get) {
     u8 d[] = { CROW_IN, cs_pop(cs) };
-    tele_ii_tx(unit, d, 2);
+    tele_ii_tx(ss->i2c.crow, d, 2);
     u8 r[2];
-    tele_ii_rx(unit, r, 2);
+    tele_ii_rx(ss->i2c.crow, r, 2);
     cs_push(cs, (r[0] << 8) + r[1]);
 }
 CR_PROTO_GET(op_CROW_OUT_get) {
     u8 d[] = { CROW_OUT, cs_pop(cs) };
-    tele_ii_tx(unit, d, 2);
+    tele_ii_tx(ss->i2c.crow, d, 2);
     u8 r[2];
-    tele_ii_rx(unit, r, 2);
+    tele_ii_rx(ss->i2c.crow, r, 2);
     cs_push(cs, (r[0] << 8) + r[1]);
 }
 CR_PROTO_GET(op_CROW_Q0_get) {
     u8 d[] = { CROW_QUERY0 };
-    tele_ii_tx(unit, d, 1);
+    tele_ii_tx(ss->i2c.crow, d, 1);
     u8 r[2];
-    tele_ii_rx(unit, r, 2);
+    tele_ii_rx(ss->i2c.crow, r, 2);
     cs_push(cs, (r[0] << 8) + r[1]);
 }
 CR_PROTO_GET(op_CROW_Q1_get) {
     u16 a = cs_pop(cs);
     u8 d[] = { CROW_QUERY1, a >> 8, a & 0xFF };
-    tele_ii_tx(unit, d, 3);
+    tele_ii_tx(ss->i2c.crow, d, 3);
     u8 r[2];
-    tele_ii_rx(unit, r, 2);
+    tele_ii_rx(ss->i2c.crow, r, 2);
     cs_push(cs, (r[0] << 8) + r[1]);
 }
 CR_PROTO_GET(op_CROW_Q2_get) {
     u16 a = cs_pop(cs);
     u16 b = cs_pop(cs);
     u8 d[] = { CROW_QUERY2, a >> 8, a & 0xFF, b >> 8, b & 0xFF };
-    tele_ii_tx(unit, d, 5);
+    tele_ii_tx(ss->i2c.crow, d, 5);
     u8 r[2];
-    tele_ii_rx(unit, r, 2);
+    tele_ii_rx(ss->i2c.crow, r, 2);
     cs_push(cs, (r[0] << 8) + r[1]);
 }
 CR_PROTO_GET(op_CROW_Q3_get) {
@@ -187,9 +185,9 @@ CR_PROTO_GET(op_CROW_Q3_get) {
     u8 d[] = {
         CROW_QUERY2, a >> 8, a & 0xFF, b >> 8, b & 0xFF, c >> 8, c & 0xFF
     };
-    tele_ii_tx(unit, d, 7);
+    tele_ii_tx(ss->i2c.crow, d, 7);
     u8 r[2];
-    tele_ii_rx(unit, r, 2);
+    tele_ii_rx(ss->i2c.crow, r, 2);
     cs_push(cs, (r[0] << 8) + r[1]);
 }
 
@@ -6,30 +6,30 @@
 
 static bool delay_common_add(scene_state_t *ss, exec_state_t *es,
                              int16_t delay_time,
-                             const tele_command_t *post_command);
+                             const tele_command_view_t *post_command);
 
 static void mod_DEL_func(scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs,
-                         const tele_command_t *post_command);
+                         const tele_command_view_t *post_command);
 
-static void op_DEL_CLR_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
+void op_DEL_CLR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
 
 static void mod_DEL_X_func(scene_state_t *ss, exec_state_t *es,
                            command_state_t *cs,
-                           const tele_command_t *post_command);
+                           const tele_command_view_t *post_command);
 
 static void mod_DEL_R_func(scene_state_t *ss, exec_state_t *es,
                            command_state_t *cs,
-                           const tele_command_t *post_command);
+                           const tele_command_view_t *post_command);
 
 static void mod_DEL_G_func(scene_state_t *ss, exec_state_t *es,
                            command_state_t *cs,
-                           const tele_command_t *post_command);
+                           const tele_command_view_t *post_command);
 
 static void mod_DEL_B_func(scene_state_t *ss, exec_state_t *es,
                            command_state_t *cs,
-                           const tele_command_t *post_command);
+                           const tele_command_view_t *post_command);
 
 const tele_mod_t mod_DEL = MAKE_MOD(DEL, mod_DEL_func, 1);
 const tele_op_t op_DEL_CLR = MAKE_GET_OP(DEL.CLR, op_DEL_CLR_get, 0, false);
@@ -42,46 +42,28 @@ const tele_mod_t mod_DEL_B = MAKE_MOD(DEL.B, mod_DEL_B_func, 2);
 // NOTE it is the responsibility of the callee to call tele_has_delays
 static bool delay_common_add(scene_state_t *ss, exec_state_t *es,
                              int16_t delay_time,
-                             const tele_command_t *post_command) {
-    int16_t i = 0;
-
-    // 0 is the magic number for an empty slot.
-    // Be careful not to set delay.time[i] to 0 before calling this function.
-    while (ss->delay.time[i] != 0 && i != DELAY_SIZE) i++;
-
-    if (delay_time < 1) delay_time = 1;
-
-    if (i < DELAY_SIZE) {
-        ss->delay.count++;
-        ss->delay.time[i] = delay_time;
-        ss->delay.origin_script[i] = es_variables(es)->script_number;
-        ss->delay.origin_i[i] = es_variables(es)->i;
-        copy_command(&ss->delay.commands[i], post_command);
-
-        return true;
-    }
-
-    return false;
+                             const tele_command_view_t *post_command) {
+    return ss_delay_add(ss, delay_time, es_variables(es)->script_number,
+                        es_variables(es)->i, post_command);
 }
 
 static void mod_DEL_func(scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs,
-                         const tele_command_t *post_command) {
+                         const tele_command_view_t *post_command) {
     int16_t delay_time = cs_pop(cs);
 
     delay_common_add(ss, es, delay_time, post_command);
-    tele_has_delays(ss->delay.count > 0);
+    tele_has_delays(ss_delay_count(ss) > 0);
 }
 
-static void op_DEL_CLR_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es),
-                           command_state_t *NOTUSED(cs)) {
+void op_DEL_CLR_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *NOTUSED(cs)) {
     clear_delays(ss);
 }
 
 static void mod_DEL_X_func(scene_state_t *ss, exec_state_t *es,
                            command_state_t *cs,
-                           const tele_command_t *post_command) {
+                           const tele_command_view_t *post_command) {
     int16_t num_delays = cs_pop(cs);
     int16_t delay_time = cs_pop(cs);
     int16_t delay_time_next;
@@ -101,12 +83,12 @@ static void mod_DEL_X_func(scene_state_t *ss, exec_state_t *es,
         num_delays--;
     }
 
-    tele_has_delays(ss->delay.count > 0);
+    tele_has_delays(ss_delay_count(ss) > 0);
 }
 
 static void mod_DEL_R_func(scene_state_t *ss, exec_state_t *es,
                            command_state_t *cs,
-                           const tele_command_t *post_command) {
+                           const tele_command_view_t *post_command) {
     int16_t num_delays = cs_pop(cs);
     int16_t delay_time = cs_pop(cs);
     int16_t delay_time_next;
@@ -126,12 +108,12 @@ static void mod_DEL_R_func(scene_state_t *ss, exec_state_t *es,
         num_delays--;
     }
 
-    tele_has_delays(ss->delay.count > 0);
+    tele_has_delays(ss_delay_count(ss) > 0);
 }
 
 static void mod_DEL_G_func(scene_state_t *ss, exec_state_t *es,
                            command_state_t *cs,
-                           const tele_command_t *post_command) {
+                           const tele_command_view_t *post_command) {
     int16_t num_delays = cs_pop(cs);
     int16_t delay_time = cs_pop(cs);
     int16_t delay_mult_num = cs_pop(cs);
@@ -154,12 +136,12 @@ static void mod_DEL_G_func(scene_state_t *ss, exec_state_t *es,
         num_delays--;
     }
 
-    tele_has_delays(ss->delay.count > 0);
+    tele_has_delays(ss_delay_count(ss) > 0);
 }
 
 static void mod_DEL_B_func(scene_state_t *ss, exec_state_t *es,
                            command_state_t *cs,
-                           const tele_command_t *post_command) {
+                           const tele_command_view_t *post_command) {
     int16_t base_time = cs_pop(cs);
     if (base_time < 1) base_time = 1;
     int16_t mask = cs_pop(cs);
@@ -176,5 +158,5 @@ static void mod_DEL_B_func(scene_state_t *ss, exec_state_t *es,
         }
     }
 
-    tele_has_delays(ss->delay.count > 0);
+    tele_has_delays(ss_delay_count(ss) > 0);
 }
\ No newline at end of file
@@ -6,128 +6,128 @@
 
 static void mod_EX1_func(scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs,
-                         const tele_command_t *post_command);
+                         const tele_command_view_t *post_command);
 static void mod_EX2_func(scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs,
-                         const tele_command_t *post_command);
+                         const tele_command_view_t *post_command);
 static void mod_EX3_func(scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs,
-                         const tele_command_t *post_command);
+                         const tele_command_view_t *post_command);
 static void mod_EX4_func(scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs,
-                         const tele_command_t *post_command);
-static void op_EX_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         const tele_command_view_t *post_command);
+void op_EX_get(const void *data, scene_state_t *ss, exec_state_t *es,
+               command_state_t *cs);
+void op_EX_set(const void *data, scene_state_t *ss, exec_state_t *es,
+               command_state_t *cs);
+void op_EX_PRESET_get(const void *data, scene_state_t *ss, exec_state_t *es,
                       command_state_t *cs);
-static void op_EX_set(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_EX_PRESET_set(const void *data, scene_state_t *ss, exec_state_t *es,
                       command_state_t *cs);
-static void op_EX_PRESET_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_EX_PRESET_set(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_EX_SAVE_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_EX_RESET_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_EX_ALG_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_EX_ALG_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_EX_CTRL_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_EX_PARAM_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_EX_PARAM_set(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_EX_PV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_EX_MIN_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_EX_MAX_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_EX_REC_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_EX_PLAY_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_EX_AL_P_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_EX_AL_CLK_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_EX_M_CH_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_EX_M_CH_set(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_EX_M_N_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_EX_M_NO_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_EX_M_PB_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_EX_M_CC_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_EX_M_PRG_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_EX_M_CLK_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_EX_M_START_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_EX_M_STOP_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_EX_M_CONT_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_EX_SB_CH_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_EX_SB_CH_set(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_EX_SB_N_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_EX_SB_NO_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_EX_SB_PB_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_EX_SB_CC_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_EX_SB_PRG_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_EX_SB_CLK_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_EX_SB_START_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_EX_SB_STOP_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_EX_SB_CONT_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_EX_VOX_P_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_EX_VOX_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_EX_VOX_O_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_EX_NOTE_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_EX_NOTE_O_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_EX_ALLOFF_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_EX_T_get(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_EX_SAVE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_EX_RESET_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_EX_ALG_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_EX_ALG_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_EX_CTRL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_EX_PARAM_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_EX_PARAM_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_EX_PV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_EX_MIN_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_EX_MAX_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_EX_REC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_EX_PLAY_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_EX_AL_P_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_EX_AL_CLK_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_EX_M_CH_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_EX_M_CH_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_EX_M_N_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_EX_M_NO_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_EX_M_PB_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_EX_M_CC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_EX_M_PRG_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_EX_M_CLK_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_EX_M_START_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_EX_M_STOP_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_EX_M_CONT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_EX_SB_CH_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_EX_SB_CH_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_EX_SB_N_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_EX_SB_NO_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_EX_SB_PB_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_EX_SB_CC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_EX_SB_PRG_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_EX_SB_CLK_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_EX_SB_START_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_EX_SB_STOP_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_EX_SB_CONT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_EX_VOX_P_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_EX_VOX_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_EX_VOX_O_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_EX_NOTE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_EX_NOTE_O_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_EX_ALLOFF_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_EX_T_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_EX_TV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_EX_LP_REC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_EX_LP_PLAY_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_EX_LP_REV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_EX_LP_DOWN_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_EX_LP_CLR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_EX_LP_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_EX_LP_REVQ_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_EX_LP_DOWNQ_get(const void *data, scene_state_t *ss, exec_state_t *es,
                         command_state_t *cs);
-static void op_EX_TV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_EX_LP_REC_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_EX_LP_PLAY_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_EX_LP_REV_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_EX_LP_DOWN_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_EX_LP_CLR_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_EX_LP_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_EX_LP_REVQ_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_EX_LP_DOWNQ_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
 // clang-format off
                    
 const tele_mod_t mod_EX1       = MAKE_MOD(EX1, mod_EX1_func, 0);
@@ -203,371 +203,360 @@ const tele_op_t op_EX_TV  = MAKE_ALIAS_OP(EX.TV,  op_EX_TV_get,     NULL, 2, fal
 
 // clang-format on
 
-static u8 unit = 0;
-static u8 midi_channel = 0;
-static u8 sb_channel = 0;
-static u8 data[4];
-
-static inline void send1(u8 cmd) {
-    data[0] = cmd;
-    tele_ii_tx(DISTING_EX_1 + unit, data, 1);
+static inline void send1(scene_state_t *ss, u8 cmd) {
+    u8 d[] = { cmd };
+    tele_ii_tx(DISTING_EX_1 + ss->i2c.disting, d, 1);
 }
 
-static inline void send2(u8 cmd, u8 b1) {
-    data[0] = cmd;
-    data[1] = b1;
-    tele_ii_tx(DISTING_EX_1 + unit, data, 2);
+static inline void send2(scene_state_t *ss, u8 cmd, u8 b1) {
+    u8 d[] = { cmd, b1 };
+    tele_ii_tx(DISTING_EX_1 + ss->i2c.disting, d, 2);
 }
 
-static inline void send3(u8 cmd, u8 b1, u8 b2) {
-    data[0] = cmd;
-    data[1] = b1;
-    data[2] = b2;
-    tele_ii_tx(DISTING_EX_1 + unit, data, 3);
+static inline void send3(scene_state_t *ss, u8 cmd, u8 b1, u8 b2) {
+    u8 d[] = { cmd, b1, b2 };
+    tele_ii_tx(DISTING_EX_1 + ss->i2c.disting, d, 3);
 }
 
-static inline void send4(u8 cmd, u8 b1, u8 b2, u8 b3) {
-    data[0] = cmd;
-    data[1] = b1;
-    data[2] = b2;
-    data[3] = b3;
-    tele_ii_tx(DISTING_EX_1 + unit, data, 4);
+static inline void send4(scene_state_t *ss, u8 cmd, u8 b1, u8 b2, u8 b3) {
+    u8 d[] = { cmd, b1, b2, b3 };
+    tele_ii_tx(DISTING_EX_1 + ss->i2c.disting, d, 4);
 }
 
 static void mod_EX1_func(scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs,
-                         const tele_command_t *post_command) {
-    u8 u = unit;
-    unit = 0;
+                         const tele_command_view_t *post_command) {
+    u8 u = ss->i2c.disting;
+    ss->i2c.disting = 0;
     process_command(ss, es, post_command);
-    unit = u;
+    ss->i2c.disting = u;
 }
 
 static void mod_EX2_func(scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs,
-                         const tele_command_t *post_command) {
-    u8 u = unit;
-    unit = 1;
+                         const tele_command_view_t *post_command) {
+    u8 u = ss->i2c.disting;
+    ss->i2c.disting = 1;
     process_command(ss, es, post_command);
-    unit = u;
+    ss->i2c.disting = u;
 }
 
 static void mod_EX3_func(scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs,
-                         const tele_command_t *post_command) {
-    u8 u = unit;
-    unit = 2;
+                         const tele_command_view_t *post_command) {
+    u8 u = ss->i2c.disting;
+    ss->i2c.disting = 2;
     process_command(ss, es, post_command);
-    unit = u;
+    ss->i2c.disting = u;
 }
 
 static void mod_EX4_func(scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs,
-                         const tele_command_t *post_command) {
-    u8 u = unit;
-    unit = 3;
+                         const tele_command_view_t *post_command) {
+    u8 u = ss->i2c.disting;
+    ss->i2c.disting = 3;
     process_command(ss, es, post_command);
-    unit = u;
+    ss->i2c.disting = u;
 }
 
-static void op_EX_get(const void *NOTUSED(data), scene_state_t *ss,
-                      exec_state_t *NOTUSED(es), command_state_t *cs) {
-    cs_push(cs, unit + 1);
+void op_EX_get(const void *NOTUSED(data), scene_state_t *ss,
+               exec_state_t *NOTUSED(es), command_state_t *cs) {
+    cs_push(cs, ss->i2c.disting + 1);
 }
 
-static void op_EX_set(const void *NOTUSED(data), scene_state_t *ss,
-                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_set(const void *NOTUSED(data), scene_state_t *ss,
+               exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 u = cs_pop(cs) - 1;
     if (u < 0 || u > 3) return;
-    unit = u;
+    ss->i2c.disting = u;
 }
 
-static void op_EX_PRESET_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
-    send1(0x43);
+void op_EX_PRESET_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+    send1(ss, 0x43);
 
-    data[0] = data[1] = 0;
-    tele_ii_rx(DISTING_EX_1 + unit, data, 2);
+    u8 r[2] = { 0, 0 };
+    tele_ii_rx(DISTING_EX_1 + ss->i2c.disting, r, 2);
 
-    cs_push(cs, (data[0] << 8) + data[1]);
+    cs_push(cs, (r[0] << 8) + r[1]);
 }
 
-static void op_EX_PRESET_set(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_PRESET_set(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 preset = cs_pop(cs);
-    send3(0x40, preset >> 8, preset);
+    send3(ss, 0x40, preset >> 8, preset);
 }
 
-static void op_EX_SAVE_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_SAVE_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 preset = cs_pop(cs);
-    send3(0x41, preset >> 8, preset);
+    send3(ss, 0x41, preset >> 8, preset);
 }
 
-static void op_EX_RESET_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
-    send1(0x42);
+void op_EX_RESET_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
+    send1(ss, 0x42);
 }
 
-static void op_EX_ALG_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
-    send1(0x45);
+void op_EX_ALG_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
+    send1(ss, 0x45);
 
-    data[0] = 0;
-    tele_ii_rx(DISTING_EX_1 + unit, data, 1);
-    cs_push(cs, data[0]);
+    u8 r[1] = { 0 };
+    tele_ii_rx(DISTING_EX_1 + ss->i2c.disting, r, 1);
+    cs_push(cs, r[0]);
 }
 
-static void op_EX_ALG_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_ALG_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 algo = cs_pop(cs);
-    send2(0x44, algo);
+    send2(ss, 0x44, algo);
 }
 
-static void op_EX_CTRL_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_CTRL_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 controller = cs_pop(cs);
     u16 value = cs_pop(cs);
-    send4(0x11, controller, value >> 8, value);
+    send4(ss, 0x11, controller, value >> 8, value);
 }
 
-static void op_EX_PARAM_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_PARAM_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 param = cs_pop(cs);
-    send2(0x48, param);
+    send2(ss, 0x48, param);
 
-    data[0] = data[1] = 0;
-    tele_ii_rx(DISTING_EX_1 + unit, data, 2);
-    u16 value = (data[0] << 8) + data[1];
+    u8 r[2] = { 0, 0 };
+    tele_ii_rx(DISTING_EX_1 + ss->i2c.disting, r, 2);
+    u16 value = (r[0] << 8) + r[1];
     cs_push(cs, (s16)value);
 }
 
-static void op_EX_PARAM_set(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_PARAM_set(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 param = cs_pop(cs);
     u16 value = cs_pop(cs);
-    send4(0x46, param, value >> 8, value);
+    send4(ss, 0x46, param, value >> 8, value);
 }
 
-static void op_EX_PV_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_PV_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 param = cs_pop(cs);
     u16 value = cs_pop(cs);
-    send4(0x47, param, value >> 8, value);
+    send4(ss, 0x47, param, value >> 8, value);
 }
 
-static void op_EX_MIN_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_MIN_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 param = cs_pop(cs);
-    send2(0x49, param);
+    send2(ss, 0x49, param);
 
-    data[0] = data[1] = 0;
-    tele_ii_rx(DISTING_EX_1 + unit, data, 2);
-    u16 value = (data[0] << 8) + data[1];
+    u8 r[2] = { 0, 0 };
+    tele_ii_rx(DISTING_EX_1 + ss->i2c.disting, r, 2);
+    u16 value = (r[0] << 8) + r[1];
     cs_push(cs, (s16)value);
 }
 
-static void op_EX_MAX_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_MAX_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 param = cs_pop(cs);
-    send2(0x4A, param);
+    send2(ss, 0x4A, param);
 
-    data[0] = data[1] = 0;
-    tele_ii_rx(DISTING_EX_1 + unit, data, 2);
-    u16 value = (data[0] << 8) + data[1];
+    u8 r[2] = { 0, 0 };
+    tele_ii_rx(DISTING_EX_1 + ss->i2c.disting, r, 2);
+    u16 value = (r[0] << 8) + r[1];
     cs_push(cs, (s16)value);
 }
 
-static void op_EX_REC_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
-    send2(0x4B, cs_pop(cs) ? 1 : 0);
+void op_EX_REC_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
+    send2(ss, 0x4B, cs_pop(cs) ? 1 : 0);
 }
 
-static void op_EX_PLAY_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
-    send2(0x4C, cs_pop(cs) ? 1 : 0);
+void op_EX_PLAY_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
+    send2(ss, 0x4C, cs_pop(cs) ? 1 : 0);
 }
 
-static void op_EX_AL_P_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_AL_P_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 pitch = cs_pop(cs);
-    send3(0x4D, pitch >> 8, pitch);
+    send3(ss, 0x4D, pitch >> 8, pitch);
 }
 
-static void op_EX_AL_CLK_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
-    send1(0x4E);
+void op_EX_AL_CLK_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+    send1(ss, 0x4E);
 }
 
-static void op_EX_M_CH_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
-    cs_push(cs, midi_channel + 1);
+void op_EX_M_CH_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
+    cs_push(cs, ss->i2c.disting_midi_channel + 1);
 }
 
-static void op_EX_M_CH_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_M_CH_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 ch = cs_pop(cs) - 1;
     if (ch < 0 || ch > 15) return;
-    midi_channel = ch;
+    ss->i2c.disting_midi_channel = ch;
 }
 
-static void op_EX_M_N_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_M_N_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 note = cs_pop(cs);
     u16 velocity = cs_pop(cs);
     if (note > 127) return;
     if (velocity > 127) velocity = 127;
-    send4(0x4F, 0x90 + midi_channel, note, velocity);
+    send4(ss, 0x4F, 0x90 + ss->i2c.disting_midi_channel, note, velocity);
 }
 
-static void op_EX_M_NO_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_M_NO_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 note = cs_pop(cs);
     if (note > 127) return;
-    send4(0x4F, 0x80 + midi_channel, note, 0);
+    send4(ss, 0x4F, 0x80 + ss->i2c.disting_midi_channel, note, 0);
 }
 
-static void op_EX_M_PB_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_M_PB_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 bend = cs_pop(cs);
-    send4(0x4F, 0xE0 + midi_channel, bend, bend >> 8);
+    send4(ss, 0x4F, 0xE0 + ss->i2c.disting_midi_channel, bend, bend >> 8);
 }
 
-static void op_EX_M_CC_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_M_CC_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 controller = cs_pop(cs);
     u16 value = cs_pop(cs);
     if (controller > 127) return;
     if (value > 127) value = 127;
-    send4(0x4F, 0xB0 + midi_channel, controller, value);
+    send4(ss, 0x4F, 0xB0 + ss->i2c.disting_midi_channel, controller, value);
 }
 
-static void op_EX_M_PRG_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_M_PRG_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 program = cs_pop(cs);
     if (program > 127) return;
-    send3(0x4F, 0xC0 + midi_channel, program);
+    send3(ss, 0x4F, 0xC0 + ss->i2c.disting_midi_channel, program);
 }
 
-static void op_EX_M_CLK_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
-    send3(0x4F, 0xF8 + midi_channel, 0xF8);
+void op_EX_M_CLK_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
+    send3(ss, 0x4F, 0xF8 + ss->i2c.disting_midi_channel, 0xF8);
 }
 
-static void op_EX_M_START_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
-    send3(0x4F, 0xFA + midi_channel, 0xFA);
+void op_EX_M_START_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+    send3(ss, 0x4F, 0xFA + ss->i2c.disting_midi_channel, 0xFA);
 }
 
-static void op_EX_M_STOP_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
-    send3(0x4F, 0xFC + midi_channel, 0xFC);
+void op_EX_M_STOP_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+    send3(ss, 0x4F, 0xFC + ss->i2c.disting_midi_channel, 0xFC);
 }
 
-static void op_EX_M_CONT_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
-    send3(0x4F, 0xFB + midi_channel, 0xFB);
+void op_EX_M_CONT_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+    send3(ss, 0x4F, 0xFB + ss->i2c.disting_midi_channel, 0xFB);
 }
 
-static void op_EX_SB_CH_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
-    cs_push(cs, sb_channel + 1);
+void op_EX_SB_CH_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
+    cs_push(cs, ss->i2c.disting_sb_channel + 1);
 }
 
-static void op_EX_SB_CH_set(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_SB_CH_set(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 ch = cs_pop(cs) - 1;
     if (ch < 0 || ch > 15) return;
-    sb_channel = ch;
+    ss->i2c.disting_sb_channel = ch;
 }
 
-static void op_EX_SB_N_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_SB_N_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 note = cs_pop(cs);
     u16 velocity = cs_pop(cs);
     if (note > 127) return;
     if (velocity > 127) velocity = 127;
-    send4(0x50, 0x90 + sb_channel, note, velocity);
+    send4(ss, 0x50, 0x90 + ss->i2c.disting_sb_channel, note, velocity);
 }
 
-static void op_EX_SB_NO_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_SB_NO_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 note = cs_pop(cs);
     if (note > 127) return;
-    send4(0x50, 0x80 + sb_channel, note, 0);
+    send4(ss, 0x50, 0x80 + ss->i2c.disting_sb_channel, note, 0);
 }
 
-static void op_EX_SB_PB_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_SB_PB_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 bend = cs_pop(cs);
-    send4(0x50, 0xE0 + sb_channel, bend, bend >> 8);
+    send4(ss, 0x50, 0xE0 + ss->i2c.disting_sb_channel, bend, bend >> 8);
 }
 
-static void op_EX_SB_CC_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_SB_CC_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 controller = cs_pop(cs);
     u16 value = cs_pop(cs);
     if (controller > 127) return;
     if (value > 127) value = 127;
-    send4(0x50, 0xB0 + sb_channel, controller, value);
+    send4(ss, 0x50, 0xB0 + ss->i2c.disting_sb_channel, controller, value);
 }
 
-static void op_EX_SB_PRG_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_SB_PRG_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 program = cs_pop(cs);
     if (program > 127) return;
-    send3(0x50, 0xC0 + sb_channel, program);
+    send3(ss, 0x50, 0xC0 + ss->i2c.disting_sb_channel, program);
 }
 
-static void op_EX_SB_CLK_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
-    send3(0x50, 0xF8 + sb_channel, 0xF8);
+void op_EX_SB_CLK_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+    send3(ss, 0x50, 0xF8 + ss->i2c.disting_sb_channel, 0xF8);
 }
 
-static void op_EX_SB_START_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
-    send3(0x50, 0xFA + sb_channel, 0xFA);
+void op_EX_SB_START_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+    send3(ss, 0x50, 0xFA + ss->i2c.disting_sb_channel, 0xFA);
 }
 
-static void op_EX_SB_STOP_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
-    send3(0x50, 0xFC + sb_channel, 0xFC);
+void op_EX_SB_STOP_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+    send3(ss, 0x50, 0xFC + ss->i2c.disting_sb_channel, 0xFC);
 }
 
-static void op_EX_SB_CONT_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
-    send3(0x50, 0xFB + sb_channel, 0xFB);
+void op_EX_SB_CONT_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+    send3(ss, 0x50, 0xFB + ss->i2c.disting_sb_channel, 0xFB);
 }
 
-static void op_EX_VOX_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_VOX_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 voice = cs_pop(cs) - 1;
     s16 pitch = cs_pop(cs);
     u16 velocity = cs_pop(cs);
     if (voice < 0) return;
 
-    send4(0x51, voice, (u16)pitch >> 8, pitch);
-    send4(0x52, voice, velocity >> 8, velocity);
+    send4(ss, 0x51, voice, (u16)pitch >> 8, pitch);
+    send4(ss, 0x52, voice, velocity >> 8, velocity);
 }
 
-static void op_EX_VOX_P_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_VOX_P_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 voice = cs_pop(cs) - 1;
     s16 pitch = cs_pop(cs);
     if (voice < 0) return;
 
-    send4(0x51, voice, pitch >> 8, pitch);
+    send4(ss, 0x51, voice, pitch >> 8, pitch);
 }
 
-static void op_EX_VOX_O_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_VOX_O_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 voice = cs_pop(cs) - 1;
     if (voice < -1) return;
 
     if (voice == -1)
-        send1(0x57);
+        send1(ss, 0x57);
     else
-        send2(0x53, voice);
+        send2(ss, 0x53, voice);
 }
 
 static u8 calculate_note(s16 pitch) {
@@ -580,137 +569,137 @@ static u8 calculate_note(s16 pitch) {
     return (u8)note;
 }
 
-static void op_EX_NOTE_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_NOTE_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 pitch = cs_pop(cs);
     u16 velocity = cs_pop(cs);
     u8 note = calculate_note(pitch);
 
-    send2(0x56, note);
-    send4(0x54, note, (u16)pitch >> 8, pitch);
-    send4(0x55, note, velocity >> 8, velocity);
+    send2(ss, 0x56, note);
+    send4(ss, 0x54, note, (u16)pitch >> 8, pitch);
+    send4(ss, 0x55, note, velocity >> 8, velocity);
 }
 
-static void op_EX_NOTE_O_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_NOTE_O_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 pitch = cs_pop(cs);
     u8 note = calculate_note(pitch);
 
-    send2(0x56, note);
+    send2(ss, 0x56, note);
 }
 
-static void op_EX_ALLOFF_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
-    send1(0x57);
+void op_EX_ALLOFF_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+    send1(ss, 0x57);
 }
 
-static void op_EX_T_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_T_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 voice = cs_pop(cs) - 1;
     if (voice < 0) return;
 
     u16 velocity = 8192;
-    send4(0x52, voice, velocity >> 8, velocity);
+    send4(ss, 0x52, voice, velocity >> 8, velocity);
 }
 
-static void op_EX_TV_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_TV_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 voice = cs_pop(cs) - 1;
     u16 velocity = cs_pop(cs);
     if (voice < 0) return;
 
-    send4(0x52, voice, velocity >> 8, velocity);
+    send4(ss, 0x52, voice, velocity >> 8, velocity);
 }
 
-static void op_EX_LP_REC_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_LP_REC_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 loop = cs_pop(cs);
     if (loop < 1 || loop > 4) return;
 
-    send4(0x46, 7, 0, loop);
-    send4(0x46, 56, 0, 0);
-    send4(0x46, 56, 0, 1);
-    send4(0x46, 56, 0, 0);
+    send4(ss, 0x46, 7, 0, loop);
+    send4(ss, 0x46, 56, 0, 0);
+    send4(ss, 0x46, 56, 0, 1);
+    send4(ss, 0x46, 56, 0, 0);
 }
 
-static void op_EX_LP_PLAY_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_LP_PLAY_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 loop = cs_pop(cs);
     if (loop < 1 || loop > 4) return;
 
-    send4(0x46, 7, 0, loop);
-    send4(0x46, 57, 0, 0);
-    send4(0x46, 57, 0, 1);
-    send4(0x46, 57, 0, 0);
+    send4(ss, 0x46, 7, 0, loop);
+    send4(ss, 0x46, 57, 0, 0);
+    send4(ss, 0x46, 57, 0, 1);
+    send4(ss, 0x46, 57, 0, 0);
 }
 
-static void op_EX_LP_REV_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_LP_REV_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 loop = cs_pop(cs);
     if (loop < 1 || loop > 4) return;
 
-    send4(0x46, 7, 0, loop);
-    send4(0x46, 58, 0, 0);
-    send4(0x46, 58, 0, 1);
-    send4(0x46, 58, 0, 0);
+    send4(ss, 0x46, 7, 0, loop);
+    send4(ss, 0x46, 58, 0, 0);
+    send4(ss, 0x46, 58, 0, 1);
+    send4(ss, 0x46, 58, 0, 0);
 }
 
-static void op_EX_LP_DOWN_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_LP_DOWN_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 loop = cs_pop(cs);
     if (loop < 1 || loop > 4) return;
 
-    send4(0x46, 7, 0, loop);
-    send4(0x46, 62, 0, 0);
-    send4(0x46, 62, 0, 1);
-    send4(0x46, 62, 0, 0);
+    send4(ss, 0x46, 7, 0, loop);
+    send4(ss, 0x46, 62, 0, 0);
+    send4(ss, 0x46, 62, 0, 1);
+    send4(ss, 0x46, 62, 0, 0);
 }
 
-static void op_EX_LP_CLR_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_LP_CLR_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 loop = cs_pop(cs);
     if (loop < 1 || loop > 4) return;
 
-    send4(0x46, 7, 0, loop);
-    send1(0x58);
+    send4(ss, 0x46, 7, 0, loop);
+    send1(ss, 0x58);
 }
 
-static u8 get_looper_state(u8 loop) {
-    send2(0x59, loop);
-    data[0] = 0;
-    tele_ii_rx(DISTING_EX_1 + unit, data, 1);
-    return data[0];
+static u8 get_looper_state(scene_state_t *ss, u8 loop) {
+    send2(ss, 0x59, loop);
+    u8 r[1] = { 0 };
+    tele_ii_rx(DISTING_EX_1 + ss->i2c.disting, r, 1);
+    return r[0];
 }
 
-static void op_EX_LP_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_LP_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 loop = cs_pop(cs) - 1;
     if (loop < 0 || loop > 3) {
         cs_push(cs, -1);
         return;
     }
 
-    cs_push(cs, get_looper_state(loop) & 0xb1111);
+    cs_push(cs, get_looper_state(ss, loop) & 0xb1111);
 }
 
-static void op_EX_LP_REVQ_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_LP_REVQ_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 loop = cs_pop(cs) - 1;
     if (loop < 0 || loop > 3) {
         cs_push(cs, 0);
         return;
     }
 
-    cs_push(cs, get_looper_state(loop) & 0b10000 ? 1 : 0);
+    cs_push(cs, get_looper_state(ss, loop) & 0b10000 ? 1 : 0);
 }
 
-static void op_EX_LP_DOWNQ_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_EX_LP_DOWNQ_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 loop = cs_pop(cs) - 1;
     if (loop < 0 || loop > 3) {
         cs_push(cs, 0);
         return;
     }
 
-    cs_push(cs, get_looper_state(loop) & 0b100000 ? 1 : 0);
+    cs_push(cs, get_looper_state(ss, loop) & 0b100000 ? 1 : 0);
 }
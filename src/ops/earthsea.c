@@ -4,8 +4,8 @@
 #include "ii.h"
 #include "teletype_io.h"
 
-static void op_ES_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
+void op_ES_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
 
 const tele_op_t op_ES_PRESET = MAKE_SIMPLE_I2C_OP(ES.PRESET, ES_PRESET);
 const tele_op_t op_ES_MODE = MAKE_SIMPLE_I2C_OP(ES.MODE, ES_MODE);
@@ -18,8 +18,8 @@ const tele_op_t op_ES_TRIPLE = MAKE_SIMPLE_I2C_OP(ES.TRIPLE, ES_TRIPLE);
 const tele_op_t op_ES_MAGIC = MAKE_SIMPLE_I2C_OP(ES.MAGIC, ES_MAGIC);
 const tele_op_t op_ES_CV = MAKE_GET_OP(ES.CV, op_ES_CV_get, 1, true);
 
-static void op_ES_CV_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_ES_CV_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     a--;
     uint8_t d[] = { ES_CV | II_GET, a & 0x3 };
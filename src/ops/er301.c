@@ -6,25 +6,25 @@
 #include "teletype_io.h"
 #include "telex.h"
 
-static void op_SC_TR_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_SC_TR_TOG_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_SC_TR_PULSE_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_SC_TR_TIME_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_SC_TR_POL_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
+void op_SC_TR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_SC_TR_TOG_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_SC_TR_PULSE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_SC_TR_TIME_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_SC_TR_POL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
 
-static void op_SC_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_SC_CV_SLEW_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_SC_CV_SET_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_SC_CV_OFF_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
+void op_SC_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_SC_CV_SLEW_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_SC_CV_SET_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_SC_CV_OFF_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
 
 const tele_op_t op_SC_TR = MAKE_GET_OP(SC.TR, op_SC_TR_get, 2, false);
 const tele_op_t op_SC_TR_TOG =
@@ -70,40 +70,40 @@ void ERCommand(uint8_t command, uint16_t output) {
 }
 
 
-static void op_SC_TR_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SC_TR_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     ERSet(TO_TR, cs);
 }
-static void op_SC_TR_TOG_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SC_TR_TOG_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     ERCommand(TO_TR_TOG, cs_pop(cs));
 }
-static void op_SC_TR_PULSE_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SC_TR_PULSE_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     ERCommand(TO_TR_PULSE, cs_pop(cs));
 }
-static void op_SC_TR_TIME_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SC_TR_TIME_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     ERSet(TO_TR_TIME, cs);
 }
-static void op_SC_TR_POL_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SC_TR_POL_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     ERSet(TO_TR_POL, cs);
 }
 
-static void op_SC_CV_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SC_CV_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     ERSet(TO_CV, cs);
 }
-static void op_SC_CV_SLEW_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SC_CV_SLEW_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     ERSet(TO_CV_SLEW, cs);
 }
-static void op_SC_CV_SET_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SC_CV_SET_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     ERSet(TO_CV_SET, cs);
 }
-static void op_SC_CV_OFF_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SC_CV_OFF_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     ERSet(TO_CV_OFF, cs);
 }
\ No newline at end of file
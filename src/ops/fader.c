@@ -7,20 +7,20 @@
 #include "telex.h"
 
 
-static void op_FADER_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
+void op_FADER_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
 
-static void op_FADER_SCALE_set(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
+void op_FADER_SCALE_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
 
-static void op_FADER_CAL_MIN_set(const void *data, scene_state_t *ss,
-                                 exec_state_t *es, command_state_t *cs);
+void op_FADER_CAL_MIN_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                          command_state_t *cs);
 
-static void op_FADER_CAL_MAX_set(const void *data, scene_state_t *ss,
-                                 exec_state_t *es, command_state_t *cs);
+void op_FADER_CAL_MAX_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                          command_state_t *cs);
 
-static void op_FADER_CAL_RESET_set(const void *data, scene_state_t *ss,
-                                   exec_state_t *es, command_state_t *cs);
+void op_FADER_CAL_RESET_set(const void *data, scene_state_t *ss,
+                            exec_state_t *es, command_state_t *cs);
 
 const tele_op_t op_FADER = MAKE_GET_OP(FADER, op_FADER_get, 1, true);
 const tele_op_t op_FADER_SCALE =
@@ -51,8 +51,8 @@ static int16_t receive_fader(int16_t input) {
     return value;
 }
 
-static void op_FADER_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_FADER_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint16_t input = cs_pop(cs);
     // zero-index the input
     input -= 1;
@@ -65,8 +65,8 @@ static void op_FADER_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, scale_get(ss->variables.fader_scales[input], value));
 }
 
-static void op_FADER_SCALE_set(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_FADER_SCALE_set(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t fader = cs_pop(cs);
     int16_t min = cs_pop(cs);
     int16_t max = cs_pop(cs);
@@ -75,9 +75,8 @@ static void op_FADER_SCALE_set(const void *NOTUSED(data), scene_state_t *ss,
     ss_set_fader_scale(ss, fader, min, max);
 }
 
-static void op_FADER_CAL_MIN_set(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs) {
+void op_FADER_CAL_MIN_set(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint16_t input = cs_pop(cs);
     // zero-index the input
     input -= 1;
@@ -91,9 +90,8 @@ static void op_FADER_CAL_MIN_set(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, value);
 }
 
-static void op_FADER_CAL_MAX_set(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs) {
+void op_FADER_CAL_MAX_set(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint16_t input = cs_pop(cs);
     // zero-index the input
     input -= 1;
@@ -107,9 +105,8 @@ static void op_FADER_CAL_MAX_set(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, value);
 }
 
-static void op_FADER_CAL_RESET_set(const void *NOTUSED(data), scene_state_t *ss,
-                                   exec_state_t *NOTUSED(es),
-                                   command_state_t *cs) {
+void op_FADER_CAL_RESET_set(const void *NOTUSED(data), scene_state_t *ss,
+                            exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint16_t fader = cs_pop(cs);
     // zero-index the input
     fader -= 1;
@@ -54,100 +54,100 @@ static void grid_init_fader(scene_state_t *ss, s16 group, s16 i, s16 x, s16 y, s
 static s16 grid_fader_max_value(scene_state_t *ss, u16 i);
 static s16 grid_fader_clamp_level(s16 level, s16 type, s16 w, s16 h);
 
-static void op_G_RST_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_CLR_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_ROTATE_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_DIM_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_KEY_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-
-static void op_G_GRP_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GRP_set    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GRP_EN_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GRP_EN_set (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GRP_RST_get(const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GRP_SW_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GRP_SC_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GRP_SC_set (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GRPI_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-
-static void op_G_LED_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_LED_set    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_LED_C_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_REC_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_RCT_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-
-static void op_G_BTN_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTX_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GBT_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GBX_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTN_EN_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTN_EN_set (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTN_V_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTN_V_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTN_L_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTN_L_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTN_X_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTN_X_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTN_Y_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTN_Y_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTNI_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTNV_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTNV_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTNL_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTNL_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTNX_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTNX_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTNY_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTNY_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTN_SW_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_BTN_PR_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GBTN_V_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GBTN_L_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GBTN_C_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GBTN_I_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GBTN_W_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GBTN_H_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GBTN_X1_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GBTN_X2_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GBTN_Y1_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GBTN_Y2_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-
-static void op_G_FDR_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDX_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GFD_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GFX_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDR_EN_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDR_EN_set (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDR_V_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDR_V_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDR_N_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDR_N_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDR_L_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDR_L_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDR_X_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDR_X_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDR_Y_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDR_Y_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDRI_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDRV_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDRV_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDRN_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDRN_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDRL_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDRL_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDRX_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDRX_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDRY_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDRY_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_FDR_PR_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GFDR_V_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GFDR_N_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GFDR_L_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_GFDR_RN_get(const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-
-static void op_G_XYP_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_XYP_X_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
-static void op_G_XYP_Y_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_RST_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_CLR_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_ROTATE_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_DIM_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_KEY_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+
+void op_G_GRP_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GRP_set    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GRP_EN_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GRP_EN_set (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GRP_RST_get(const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GRP_SW_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GRP_SC_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GRP_SC_set (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GRPI_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+
+void op_G_LED_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_LED_set    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_LED_C_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_REC_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_RCT_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+
+void op_G_BTN_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTX_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GBT_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GBX_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTN_EN_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTN_EN_set (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTN_V_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTN_V_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTN_L_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTN_L_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTN_X_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTN_X_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTN_Y_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTN_Y_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTNI_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTNV_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTNV_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTNL_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTNL_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTNX_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTNX_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTNY_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTNY_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTN_SW_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_BTN_PR_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GBTN_V_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GBTN_L_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GBTN_C_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GBTN_I_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GBTN_W_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GBTN_H_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GBTN_X1_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GBTN_X2_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GBTN_Y1_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GBTN_Y2_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+
+void op_G_FDR_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDX_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GFD_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GFX_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDR_EN_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDR_EN_set (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDR_V_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDR_V_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDR_N_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDR_N_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDR_L_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDR_L_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDR_X_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDR_X_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDR_Y_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDR_Y_set  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDRI_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDRV_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDRV_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDRN_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDRN_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDRL_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDRL_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDRX_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDRX_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDRY_get   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDRY_set   (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_FDR_PR_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GFDR_V_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GFDR_N_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GFDR_L_get (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_GFDR_RN_get(const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+
+void op_G_XYP_get    (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_XYP_X_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
+void op_G_XYP_Y_get  (const void *data, scene_state_t *ss, exec_state_t *es,  command_state_t *cs);
 
 const tele_op_t op_G_RST     = MAKE_GET_OP(G.RST, op_G_RST_get, 0, false);
 const tele_op_t op_G_ROTATE  = MAKE_GET_OP(G.ROTATE, op_G_ROTATE_get, 1, false);
@@ -222,9 +222,8 @@ const tele_op_t op_G_XYP_Y   = MAKE_GET_OP(G.XYP.Y, op_G_XYP_Y_get, 1, true);
 
 // clang-format on
 
-static void op_G_RST_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es),
-                         command_state_t *NOTUSED(cs)) {
+void op_G_RST_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *NOTUSED(cs)) {
     SG.rotate = 0;
     SG.dim = 0;
 
@@ -265,30 +264,29 @@ static void op_G_RST_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_CLR_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es),
-                         command_state_t *NOTUSED(cs)) {
+void op_G_CLR_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *NOTUSED(cs)) {
     for (u8 i = 0; i < GRID_MAX_DIMENSION; i++)
         for (u8 j = 0; j < GRID_MAX_DIMENSION; j++) SG.leds[i][j] = LED_OFF;
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_ROTATE_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_ROTATE_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 rotate = cs_pop(cs);
     SG.rotate = rotate != 0;
     SG.scr_dirty = SG.grid_dirty = SG.clear_held = 1;
 }
 
-static void op_G_DIM_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_DIM_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     GET_AND_CLAMP(dim, 0, 14);
     SG.dim = dim;
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_KEY_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs) {
+void op_G_KEY_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs) {
     s16 x = cs_pop(cs);
     s16 y = cs_pop(cs);
     s16 action = cs_pop(cs);
@@ -297,29 +295,29 @@ static void op_G_KEY_get(const void *data, scene_state_t *ss, exec_state_t *es,
     grid_key_press(x, y, action != 0);
 }
 
-static void op_G_GRP_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GRP_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, SG.current_group);
 }
 
-static void op_G_GRP_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GRP_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     if (group < (s16)0 || group >= (s16)GRID_GROUP_COUNT) return;
     SG.current_group = group;
     SG.scr_dirty = 1;
 }
 
-static void op_G_GRP_EN_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GRP_EN_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     cs_push(cs, group < (s16)0 || group >= (s16)GRID_GROUP_COUNT
                     ? 0
                     : SG.group[group].enabled);
 }
 
-static void op_G_GRP_EN_set(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GRP_EN_set(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     s16 en = cs_pop(cs);
     if (group < (s16)0 || group >= (s16)GRID_GROUP_COUNT) return;
@@ -327,8 +325,8 @@ static void op_G_GRP_EN_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_GRP_RST_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GRP_RST_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     if (group < (s16)0 || group >= (s16)GRID_GROUP_COUNT) return;
 
@@ -362,8 +360,8 @@ static void op_G_GRP_RST_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_GRP_SW_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GRP_SW_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     if (group < (s16)0 || group >= (s16)GRID_GROUP_COUNT) return;
 
@@ -373,16 +371,16 @@ static void op_G_GRP_SW_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_GRP_SC_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GRP_SC_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     cs_push(cs, group < (s16)0 || group >= (s16)GRID_GROUP_COUNT
                     ? -1
                     : SG.group[group].script + 1);
 }
 
-static void op_G_GRP_SC_set(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GRP_SC_set(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     s16 script = cs_pop(cs) - 1;
 
@@ -392,13 +390,13 @@ static void op_G_GRP_SC_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.group[group].script = script;
 }
 
-static void op_G_GRPI_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GRPI_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, SG.latest_group);
 }
 
-static void op_G_LED_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_LED_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 x = cs_pop(cs);
     s16 y = cs_pop(cs);
 
@@ -410,8 +408,8 @@ static void op_G_LED_get(const void *NOTUSED(data), scene_state_t *ss,
         cs_push(cs, SG.leds[x][y]);
 }
 
-static void op_G_LED_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_LED_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 x = cs_pop(cs);
     s16 y = cs_pop(cs);
     GET_LEVEL(level);
@@ -423,8 +421,8 @@ static void op_G_LED_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_LED_C_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_LED_C_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 x = cs_pop(cs);
     s16 y = cs_pop(cs);
 
@@ -435,8 +433,8 @@ static void op_G_LED_C_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_REC_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_REC_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 x = cs_pop(cs);
     s16 y = cs_pop(cs);
     s16 w = cs_pop(cs);
@@ -446,8 +444,8 @@ static void op_G_REC_get(const void *NOTUSED(data), scene_state_t *ss,
     grid_rectangle(ss, x, y, w, h, fill, border);
 }
 
-static void op_G_RCT_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_RCT_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 x1 = cs_pop(cs);
     s16 y1 = cs_pop(cs);
     s16 x2 = cs_pop(cs);
@@ -457,8 +455,8 @@ static void op_G_RCT_get(const void *NOTUSED(data), scene_state_t *ss,
     grid_rectangle(ss, x1, y1, x2 - x1 + 1, y2 - y1 + 1, fill, border);
 }
 
-static void op_G_BTN_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTN_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     s16 x = cs_pop(cs);
     s16 y = cs_pop(cs);
@@ -471,8 +469,8 @@ static void op_G_BTN_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_GBT_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GBT_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     s16 i = cs_pop(cs);
     s16 x = cs_pop(cs);
@@ -486,8 +484,8 @@ static void op_G_GBT_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_BTX_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTX_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 id = cs_pop(cs);
     s16 _x = cs_pop(cs);
     s16 _y = cs_pop(cs);
@@ -520,8 +518,8 @@ static void op_G_BTX_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_GBX_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GBX_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     s16 id = cs_pop(cs);
     s16 _x = cs_pop(cs);
@@ -554,14 +552,14 @@ static void op_G_GBX_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_BTN_EN_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTN_EN_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     cs_push(cs, i < (s16)0 || i >= (s16)GRID_BUTTON_COUNT ? 0 : GBC.enabled);
 }
 
-static void op_G_BTN_EN_set(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTN_EN_set(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     s16 en = cs_pop(cs);
 
@@ -570,14 +568,14 @@ static void op_G_BTN_EN_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_BTN_V_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTN_V_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     cs_push(cs, i < (s16)0 || i >= (s16)GRID_BUTTON_COUNT ? 0 : GB.state);
 }
 
-static void op_G_BTN_V_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTN_V_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     s16 value = cs_pop(cs);
     if (i < (s16)0 || i >= (s16)GRID_BUTTON_COUNT) return;
@@ -585,14 +583,14 @@ static void op_G_BTN_V_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_BTN_L_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTN_L_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     cs_push(cs, i < (s16)0 || i >= (s16)GRID_BUTTON_COUNT ? 0 : GBC.level);
 }
 
-static void op_G_BTN_L_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTN_L_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     GET_LEVEL(level);
     if (i < (s16)0 || i >= (s16)GRID_BUTTON_COUNT) return;
@@ -600,14 +598,14 @@ static void op_G_BTN_L_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_BTN_X_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTN_X_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     cs_push(cs, i < (s16)0 || i >= (s16)GRID_BUTTON_COUNT ? 0 : GBC.x);
 }
 
-static void op_G_BTN_X_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTN_X_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     s16 x = cs_pop(cs);
 
@@ -624,14 +622,14 @@ static void op_G_BTN_X_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_BTN_Y_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTN_Y_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     cs_push(cs, i < (s16)0 || i >= (s16)GRID_BUTTON_COUNT ? 0 : GBC.y);
 }
 
-static void op_G_BTN_Y_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTN_Y_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     s16 y = cs_pop(cs);
 
@@ -648,42 +646,42 @@ static void op_G_BTN_Y_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_BTNI_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTNI_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, SG.latest_button);
 }
 
-static void op_G_BTNV_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTNV_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, SG.button[SG.latest_button].state);
 }
 
-static void op_G_BTNV_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTNV_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 value = cs_pop(cs);
     SG.button[SG.latest_button].state = value != 0;
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_BTNL_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTNL_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, SG.button[SG.latest_button].common.level);
 }
 
-static void op_G_BTNL_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTNL_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     GET_LEVEL(level);
     SG.button[SG.latest_button].common.level = level;
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_BTNX_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTNX_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, SG.button[SG.latest_button].common.x);
 }
 
-static void op_G_BTNX_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTNX_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 x = cs_pop(cs);
     u16 i = SG.latest_button;
 
@@ -699,13 +697,13 @@ static void op_G_BTNX_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_BTNY_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTNY_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, SG.button[SG.latest_button].common.y);
 }
 
-static void op_G_BTNY_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTNY_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 y = cs_pop(cs);
     u16 i = SG.latest_button;
 
@@ -721,8 +719,8 @@ static void op_G_BTNY_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_BTN_SW_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_BTN_SW_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 id = cs_pop(cs);
     if (id < (s16)0 || id >= (s16)GRID_BUTTON_COUNT) return;
 
@@ -733,8 +731,8 @@ static void op_G_BTN_SW_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_BTN_PR_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs) {
+void op_G_BTN_PR_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *es, command_state_t *cs) {
     s16 i = cs_pop(cs);
     s16 action = cs_pop(cs);
 
@@ -760,8 +758,8 @@ static void op_G_BTN_PR_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_GBTN_V_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GBTN_V_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     s16 value = cs_pop(cs);
 
@@ -773,8 +771,8 @@ static void op_G_GBTN_V_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_GBTN_L_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GBTN_L_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     GET_LEVEL(odd);
     GET_LEVEL(even);
@@ -790,8 +788,8 @@ static void op_G_GBTN_L_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_GBTN_C_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GBTN_C_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     if (group < (s16)0 || group > (s16)GRID_GROUP_COUNT) {
         cs_push(cs, 0);
@@ -804,8 +802,8 @@ static void op_G_GBTN_C_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, count);
 }
 
-static void op_G_GBTN_I_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GBTN_I_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     s16 index = cs_pop(cs);
     if (group < (s16)0 || group > (s16)GRID_GROUP_COUNT) {
@@ -826,8 +824,8 @@ static void op_G_GBTN_I_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, id);
 }
 
-static void op_G_GBTN_W_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GBTN_W_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     if (group < (s16)0 || group > (s16)GRID_GROUP_COUNT) {
         cs_push(cs, 0);
@@ -847,8 +845,8 @@ static void op_G_GBTN_W_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, atleastone ? x2 - x1 + 1 : 0);
 }
 
-static void op_G_GBTN_H_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GBTN_H_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     if (group < (s16)0 || group > (s16)GRID_GROUP_COUNT) {
         cs_push(cs, 0);
@@ -868,8 +866,8 @@ static void op_G_GBTN_H_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, atleastone ? y2 - y1 + 1 : 0);
 }
 
-static void op_G_GBTN_X1_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GBTN_X1_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     if (group < (s16)0 || group > (s16)GRID_GROUP_COUNT) {
         cs_push(cs, -1);
@@ -888,8 +886,8 @@ static void op_G_GBTN_X1_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, atleastone ? x1 : -1);
 }
 
-static void op_G_GBTN_X2_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GBTN_X2_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     if (group < (s16)0 || group > (s16)GRID_GROUP_COUNT) {
         cs_push(cs, -1);
@@ -908,8 +906,8 @@ static void op_G_GBTN_X2_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, atleastone ? x2 : -1);
 }
 
-static void op_G_GBTN_Y1_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GBTN_Y1_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     if (group < (s16)0 || group > (s16)GRID_GROUP_COUNT) {
         cs_push(cs, -1);
@@ -928,8 +926,8 @@ static void op_G_GBTN_Y1_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, atleastone ? y1 : -1);
 }
 
-static void op_G_GBTN_Y2_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GBTN_Y2_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     if (group < (s16)0 || group > (s16)GRID_GROUP_COUNT) {
         cs_push(cs, -1);
@@ -948,8 +946,8 @@ static void op_G_GBTN_Y2_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, atleastone ? y2 : -1);
 }
 
-static void op_G_FDR_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDR_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     s16 x = cs_pop(cs);
     s16 y = cs_pop(cs);
@@ -962,8 +960,8 @@ static void op_G_FDR_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_GFD_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GFD_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     s16 i = cs_pop(cs);
     s16 x = cs_pop(cs);
@@ -977,8 +975,8 @@ static void op_G_GFD_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_FDX_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDX_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 id = cs_pop(cs);
     s16 x = cs_pop(cs);
     s16 y = cs_pop(cs);
@@ -1003,8 +1001,8 @@ static void op_G_FDX_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_GFX_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GFX_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     s16 id = cs_pop(cs);
     s16 x = cs_pop(cs);
@@ -1030,14 +1028,14 @@ static void op_G_GFX_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_FDR_EN_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDR_EN_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     cs_push(cs, i < (s16)0 || i >= (s16)GRID_FADER_COUNT ? 0 : GFC.enabled);
 }
 
-static void op_G_FDR_EN_set(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDR_EN_set(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     s16 en = cs_pop(cs);
 
@@ -1046,8 +1044,8 @@ static void op_G_FDR_EN_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_FDR_V_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDR_V_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     if (i < (s16)0 || i >= (s16)GRID_FADER_COUNT) {
         cs_push(cs, 0);
@@ -1060,8 +1058,8 @@ static void op_G_FDR_V_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, value);
 }
 
-static void op_G_FDR_V_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDR_V_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     s16 value = cs_pop(cs);
 
@@ -1077,14 +1075,14 @@ static void op_G_FDR_V_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_FDR_N_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDR_N_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     cs_push(cs, i < (s16)0 || i >= (s16)GRID_FADER_COUNT ? 0 : GF.value);
 }
 
-static void op_G_FDR_N_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDR_N_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     s16 value = cs_pop(cs);
 
@@ -1100,14 +1098,14 @@ static void op_G_FDR_N_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_FDR_L_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDR_L_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     cs_push(cs, i < (s16)0 || i >= (s16)GRID_FADER_COUNT ? 0 : GFC.level);
 }
 
-static void op_G_FDR_L_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDR_L_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     s16 level = cs_pop(cs);
     if (i < (s16)0 || i >= (s16)GRID_FADER_COUNT) return;
@@ -1119,14 +1117,14 @@ static void op_G_FDR_L_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_FDR_X_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDR_X_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     cs_push(cs, i < (s16)0 || i >= (s16)GRID_FADER_COUNT ? 0 : GFC.x);
 }
 
-static void op_G_FDR_X_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDR_X_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     s16 x = cs_pop(cs);
 
@@ -1143,14 +1141,14 @@ static void op_G_FDR_X_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_FDR_Y_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDR_Y_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     cs_push(cs, i < (s16)0 || i >= (s16)GRID_FADER_COUNT ? 0 : GFC.y);
 }
 
-static void op_G_FDR_Y_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDR_Y_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     s16 y = cs_pop(cs);
 
@@ -1167,13 +1165,13 @@ static void op_G_FDR_Y_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_FDRI_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDRI_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, SG.latest_fader);
 }
 
-static void op_G_FDRV_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDRV_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     u8 i = SG.latest_fader;
     s16 value =
         scale(0, grid_fader_max_value(ss, i), SG.group[GFC.group].fader_min,
@@ -1181,8 +1179,8 @@ static void op_G_FDRV_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, value);
 }
 
-static void op_G_FDRV_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDRV_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 value = cs_pop(cs);
     s16 i = SG.latest_fader;
 
@@ -1197,13 +1195,13 @@ static void op_G_FDRV_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_FDRN_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDRN_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, SG.fader[SG.latest_fader].value);
 }
 
-static void op_G_FDRN_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDRN_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 value = cs_pop(cs);
     s16 i = SG.latest_fader;
 
@@ -1217,13 +1215,13 @@ static void op_G_FDRN_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_FDRL_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDRL_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, SG.fader[SG.latest_fader].common.level);
 }
 
-static void op_G_FDRL_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDRL_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 level = cs_pop(cs);
     u16 i = SG.latest_fader;
 
@@ -1235,13 +1233,13 @@ static void op_G_FDRL_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_FDRX_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDRX_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, SG.fader[SG.latest_fader].common.x);
 }
 
-static void op_G_FDRX_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDRX_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 x = cs_pop(cs);
     s16 i = SG.latest_fader;
 
@@ -1257,13 +1255,13 @@ static void op_G_FDRX_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_FDRY_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDRY_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, SG.fader[SG.latest_fader].common.y);
 }
 
-static void op_G_FDRY_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_FDRY_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 y = cs_pop(cs);
     s16 i = SG.latest_fader;
 
@@ -1279,8 +1277,8 @@ static void op_G_FDRY_set(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_FDR_PR_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs) {
+void op_G_FDR_PR_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *es, command_state_t *cs) {
     s16 i = cs_pop(cs);
     s16 value = cs_pop(cs) - 1;
 
@@ -1312,8 +1310,8 @@ static void op_G_FDR_PR_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_GFDR_V_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GFDR_V_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     s16 value = cs_pop(cs);
 
@@ -1332,8 +1330,8 @@ static void op_G_GFDR_V_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_GFDR_N_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GFDR_N_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     s16 value = cs_pop(cs);
 
@@ -1346,8 +1344,8 @@ static void op_G_GFDR_N_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_GFDR_L_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GFDR_L_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     s16 odd = cs_pop(cs);
     s16 even = cs_pop(cs);
@@ -1368,8 +1366,8 @@ static void op_G_GFDR_L_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_GFDR_RN_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_GFDR_RN_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 group = cs_pop(cs);
     s16 min = cs_pop(cs);
     s16 max = cs_pop(cs);
@@ -1379,8 +1377,8 @@ static void op_G_GFDR_RN_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.group[group].fader_max = max;
 }
 
-static void op_G_XYP_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_XYP_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     s16 x = cs_pop(cs);
     s16 y = cs_pop(cs);
@@ -1407,14 +1405,14 @@ static void op_G_XYP_get(const void *NOTUSED(data), scene_state_t *ss,
     SG.scr_dirty = SG.grid_dirty = 1;
 }
 
-static void op_G_XYP_X_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_XYP_X_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     cs_push(cs, i < (s16)0 || i >= (s16)GRID_XYPAD_COUNT ? 0 : GXY.value_x);
 }
 
-static void op_G_XYP_Y_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_G_XYP_Y_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 i = cs_pop(cs);
     cs_push(cs, i < (s16)0 || i >= (s16)GRID_XYPAD_COUNT ? 0 : GXY.value_y);
 }
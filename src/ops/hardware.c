@@ -2,81 +2,83 @@
 
 #include "helpers.h"
 #include "ii.h"
+#include "profiler.h"
 #include "teletype_io.h"
 
-static void op_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+               command_state_t *cs);
+void op_CV_set(const void *data, scene_state_t *ss, exec_state_t *es,
+               command_state_t *cs);
+void op_CV_SLEW_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_CV_SLEW_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_CV_OFF_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_CV_OFF_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_IN_get(const void *NOTUSED(data), scene_state_t *ss,
+               exec_state_t *NOTUSED(es), command_state_t *cs);
+void op_IN_SCALE_set(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs);
+void op_IN_CAL_MIN_set(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs);
+void op_IN_CAL_MAX_set(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs);
+void op_IN_CAL_RESET_set(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs);
+void op_PARAM_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs);
+void op_PARAM_SCALE_set(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs);
+void op_PARAM_CAL_MIN_set(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs);
+void op_PARAM_CAL_MAX_set(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs);
+void op_PARAM_CAL_RESET_set(const void *NOTUSED(data), scene_state_t *ss,
+                            exec_state_t *NOTUSED(es), command_state_t *cs);
+void op_TR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+               command_state_t *cs);
+void op_TR_set(const void *data, scene_state_t *ss, exec_state_t *es,
+               command_state_t *cs);
+void op_TR_POL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_TR_POL_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_TR_TIME_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_TR_TIME_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_TR_TOG_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_TR_PULSE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_CV_SET_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_MUTE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_MUTE_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_STATE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_DEVICE_FLIP_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_LIVE_OFF_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_LIVE_DASH_get(const void *data, scene_state_t *ss, exec_state_t *es,
                       command_state_t *cs);
-static void op_CV_set(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_LIVE_GRID_get(const void *data, scene_state_t *ss, exec_state_t *es,
                       command_state_t *cs);
-static void op_CV_SLEW_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_CV_SLEW_set(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_CV_OFF_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_CV_OFF_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_IN_get(const void *NOTUSED(data), scene_state_t *ss,
-                      exec_state_t *NOTUSED(es), command_state_t *cs);
-static void op_IN_SCALE_set(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs);
-static void op_IN_CAL_MIN_set(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs);
-static void op_IN_CAL_MAX_set(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs);
-static void op_IN_CAL_RESET_set(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es), command_state_t *cs);
-static void op_PARAM_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs);
-static void op_PARAM_SCALE_set(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs);
-static void op_PARAM_CAL_MIN_set(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs);
-static void op_PARAM_CAL_MAX_set(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs);
-static void op_PARAM_CAL_RESET_set(const void *NOTUSED(data), scene_state_t *ss,
-                                   exec_state_t *NOTUSED(es),
-                                   command_state_t *cs);
-static void op_TR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_LIVE_VARS_get(const void *data, scene_state_t *ss, exec_state_t *es,
                       command_state_t *cs);
-static void op_TR_set(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_PRINT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_PRINT_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_PROF_DUMP_get(const void *data, scene_state_t *ss, exec_state_t *es,
                       command_state_t *cs);
-static void op_TR_POL_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_TR_POL_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_TR_TIME_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_TR_TIME_set(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_TR_TOG_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_TR_PULSE_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_CV_SET_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_MUTE_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_MUTE_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_STATE_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_DEVICE_FLIP_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_LIVE_OFF_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_LIVE_DASH_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_LIVE_GRID_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_LIVE_VARS_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_PRINT_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_PRINT_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
+void op_PROF_CLR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
 
 
 // clang-format off
@@ -114,10 +116,12 @@ const tele_op_t op_LIVE_VARS     = MAKE_GET_OP (LIVE.VARS, op_LIVE_VARS_get, 0,
 const tele_op_t op_LIVE_V        = MAKE_ALIAS_OP (LIVE.V, op_LIVE_VARS_get, NULL, 0, false);
 const tele_op_t op_PRINT         = MAKE_GET_SET_OP (PRINT, op_PRINT_get, op_PRINT_set, 1, true);
 const tele_op_t op_PRT           = MAKE_ALIAS_OP (PRT, op_PRINT_get, op_PRINT_set, 1, true);
+const tele_op_t op_PROF_DUMP     = MAKE_GET_OP (PROF.DUMP, op_PROF_DUMP_get, 0, false);
+const tele_op_t op_PROF_CLR      = MAKE_GET_OP (PROF.CLR, op_PROF_CLR_get, 0, false);
 // clang-format on
 
-static void op_CV_get(const void *NOTUSED(data), scene_state_t *ss,
-                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_CV_get(const void *NOTUSED(data), scene_state_t *ss,
+               exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     a--;
     if (a < 0)
@@ -137,10 +141,14 @@ static void op_CV_get(const void *NOTUSED(data), scene_state_t *ss,
         cs_push(cs, 0);
 }
 
-static void op_CV_set(const void *NOTUSED(data), scene_state_t *ss,
-                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_CV_set(const void *NOTUSED(data), scene_state_t *ss,
+               exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
+    cv_set(ss, a, b);
+}
+
+void cv_set(scene_state_t *ss, int16_t a, int16_t b) {
     b = normalise_value(0, 16383, 0, b);
     a--;
     if (a < 0)
@@ -157,8 +165,8 @@ static void op_CV_set(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_CV_SLEW_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_CV_SLEW_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     a--;
     if (a < 0)
@@ -178,8 +186,8 @@ static void op_CV_SLEW_get(const void *NOTUSED(data), scene_state_t *ss,
         cs_push(cs, 0);
 }
 
-static void op_CV_SLEW_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_CV_SLEW_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     b = normalise_value(1, 32767, 0, b);  // min slew = 1
@@ -197,8 +205,8 @@ static void op_CV_SLEW_set(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_CV_OFF_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_CV_OFF_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     a--;
     if (a < 0)
@@ -218,8 +226,8 @@ static void op_CV_OFF_get(const void *NOTUSED(data), scene_state_t *ss,
         cs_push(cs, 0);
 }
 
-static void op_CV_OFF_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_CV_OFF_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     ss->variables.cv_off[a] = b;
@@ -238,73 +246,70 @@ static void op_CV_OFF_set(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_IN_get(const void *NOTUSED(data), scene_state_t *ss,
-                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IN_get(const void *NOTUSED(data), scene_state_t *ss,
+               exec_state_t *NOTUSED(es), command_state_t *cs) {
     tele_update_adc(0);
     cs_push(cs, ss_get_in(ss));
 }
 
-static void op_IN_SCALE_set(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IN_SCALE_set(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t min = cs_pop(cs);
     int16_t max = cs_pop(cs);
     ss_set_in_scale(ss, min, max);
 }
 
-static void op_IN_CAL_MIN_set(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IN_CAL_MIN_set(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     ss_set_in_min(ss, ss->variables.in);
     cs_push(cs, ss->variables.in);
 }
 
-static void op_IN_CAL_MAX_set(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IN_CAL_MAX_set(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     ss_set_in_max(ss, ss->variables.in);
     cs_push(cs, ss->variables.in);
 }
 
-static void op_IN_CAL_RESET_set(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *NOTUSED(cs)) {
+void op_IN_CAL_RESET_set(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es),
+                         command_state_t *NOTUSED(cs)) {
     ss_reset_in_cal(ss);
 }
 
 
-static void op_PARAM_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PARAM_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     tele_update_adc(0);
     cs_push(cs, ss_get_param(ss));
 }
 
-static void op_PARAM_SCALE_set(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PARAM_SCALE_set(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t min = cs_pop(cs);
     int16_t max = cs_pop(cs);
     ss_set_param_scale(ss, min, max);
 }
 
-static void op_PARAM_CAL_MIN_set(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs) {
+void op_PARAM_CAL_MIN_set(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs) {
     ss_set_param_min(ss, ss->variables.param);
     cs_push(cs, ss->variables.param);
 }
 
-static void op_PARAM_CAL_MAX_set(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs) {
+void op_PARAM_CAL_MAX_set(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs) {
     ss_set_param_max(ss, ss->variables.param);
     cs_push(cs, ss->variables.param);
 }
 
-static void op_PARAM_CAL_RESET_set(const void *NOTUSED(data), scene_state_t *ss,
-                                   exec_state_t *NOTUSED(es),
-                                   command_state_t *cs) {
+void op_PARAM_CAL_RESET_set(const void *NOTUSED(data), scene_state_t *ss,
+                            exec_state_t *NOTUSED(es), command_state_t *cs) {
     ss_reset_param_cal(ss);
 }
 
-static void op_TR_get(const void *NOTUSED(data), scene_state_t *ss,
-                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TR_get(const void *NOTUSED(data), scene_state_t *ss,
+               exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     a--;
     if (a < 0)
@@ -323,8 +328,8 @@ static void op_TR_get(const void *NOTUSED(data), scene_state_t *ss,
         cs_push(cs, 0);
 }
 
-static void op_TR_set(const void *NOTUSED(data), scene_state_t *ss,
-                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TR_set(const void *NOTUSED(data), scene_state_t *ss,
+               exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     a--;
@@ -341,8 +346,8 @@ static void op_TR_set(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_TR_POL_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TR_POL_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     a--;
     if (a < 0)
@@ -361,8 +366,8 @@ static void op_TR_POL_get(const void *NOTUSED(data), scene_state_t *ss,
         cs_push(cs, 0);
 }
 
-static void op_TR_POL_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TR_POL_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     a--;
@@ -378,8 +383,8 @@ static void op_TR_POL_set(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_TR_TIME_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TR_TIME_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     a--;
     if (a < 0)
@@ -399,8 +404,8 @@ static void op_TR_TIME_get(const void *NOTUSED(data), scene_state_t *ss,
         cs_push(cs, 0);
 }
 
-static void op_TR_TIME_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TR_TIME_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     if (b < 0) b = 0;
@@ -409,6 +414,11 @@ static void op_TR_TIME_set(const void *NOTUSED(data), scene_state_t *ss,
         return;
     else if (a < 4) {
         ss->variables.tr_time[a] = b;
+        // a shorter time also shortens a pulse that is already running
+        uint32_t now = tele_get_ticks();
+        if (ss->tr_pulse_active[a] &&
+            (int32_t)(ss->tr_pulse_deadline[a] - now) > b)
+            ss->tr_pulse_deadline[a] = now + b;
     }
     else if (a < 20) {
         uint8_t d[] = { II_ANSIBLE_TR_TIME, a & 0x3, b >> 8, b & 0xff };
@@ -417,8 +427,8 @@ static void op_TR_TIME_set(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_TR_TOG_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TR_TOG_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     a--;
     if (a < 0)
@@ -437,9 +447,12 @@ static void op_TR_TOG_get(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_TR_PULSE_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
-    int16_t a = cs_pop(cs);
+void op_TR_PULSE_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
+    tr_pulse(ss, cs_pop(cs));
+}
+
+void tr_pulse(scene_state_t *ss, int16_t a) {
     a--;
     if (a < 0)
         return;
@@ -447,7 +460,8 @@ static void op_TR_PULSE_get(const void *NOTUSED(data), scene_state_t *ss,
         int16_t time = ss->variables.tr_time[a];  // pulse time
         if (time <= 0) return;  // if time <= 0 don't do anything
         ss->variables.tr[a] = ss->variables.tr_pol[a];
-        ss->tr_pulse_timer[a] = time;  // set time
+        ss->tr_pulse_deadline[a] = tele_get_ticks() + time;  // set time
+        ss->tr_pulse_active[a] = true;
         tele_tr(a, ss->variables.tr[a]);
     }
     else if (a < 20) {
@@ -457,8 +471,8 @@ static void op_TR_PULSE_get(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_CV_SET_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_CV_SET_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
 
@@ -481,8 +495,8 @@ static void op_CV_SET_get(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_MUTE_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MUTE_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs) - 1;
     if (a >= 0 && a < TRIGGER_INPUTS) { cs_push(cs, ss_get_mute(ss, a)); }
     else {
@@ -490,15 +504,15 @@ static void op_MUTE_get(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_MUTE_set(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MUTE_set(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs) - 1;
     bool b = cs_pop(cs) > 0;
     if (a >= 0 && a < TRIGGER_INPUTS) { ss_set_mute(ss, a, b); }
 }
 
-static void op_STATE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_STATE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     a--;
     if (a < 0)
@@ -517,45 +531,59 @@ static void op_STATE_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
         cs_push(cs, 0);
 }
 
-static void op_DEVICE_FLIP_get(const void *NOTUSED(data),
-                               scene_state_t *NOTUSED(ss),
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_DEVICE_FLIP_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     device_flip();
 }
 
-static void op_LIVE_OFF_get(const void *NOTUSED(data),
-                            scene_state_t *NOTUSED(ss),
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_LIVE_OFF_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     set_live_submode(SUB_MODE_OFF);
 }
 
-static void op_LIVE_DASH_get(const void *NOTUSED(data),
-                             scene_state_t *NOTUSED(ss),
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_LIVE_DASH_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     select_dash_screen(cs_pop(cs) - 1);
 }
 
-static void op_LIVE_GRID_get(const void *NOTUSED(data),
-                             scene_state_t *NOTUSED(ss),
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_LIVE_GRID_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     set_live_submode(SUB_MODE_GRID);
 }
 
-static void op_LIVE_VARS_get(const void *NOTUSED(data),
-                             scene_state_t *NOTUSED(ss),
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_LIVE_VARS_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     set_live_submode(SUB_MODE_VARS);
 }
 
-static void op_PRINT_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PRINT_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t index = cs_pop(cs);
     cs_push(cs, get_dashboard_value(index - 1));
 }
 
-static void op_PRINT_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PRINT_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t index = cs_pop(cs);
     int16_t value = cs_pop(cs);
     print_dashboard_value(index - 1, value);
 }
+
+// only TELETYPE_PROFILE builds keep the counts, the ops stay in every build
+// so that scenes using them load in any, PROF.DUMP says when there's nothing
+void op_PROF_DUMP_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                      exec_state_t *NOTUSED(es), command_state_t *NOTUSED(cs)) {
+#ifdef TELETYPE_PROFILE
+    profiler_dump(tele_profile_print);
+    profiler_dump_ops(tele_profile_print);
+#else
+    tele_profile_print("profiling is off, build with TELETYPE_PROFILE");
+#endif
+}
+
+void op_PROF_CLR_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+                     exec_state_t *NOTUSED(es), command_state_t *NOTUSED(cs)) {
+#ifdef TELETYPE_PROFILE
+    profiler_reset();
+#endif
+}
@@ -37,5 +37,11 @@ extern const tele_op_t op_LIVE_VARS;
 extern const tele_op_t op_LIVE_V;
 extern const tele_op_t op_PRINT;
 extern const tele_op_t op_PRT;
+extern const tele_op_t op_PROF_DUMP;
+extern const tele_op_t op_PROF_CLR;
+
+// shared with the fused commands (see fuse.h), a is the 1 based output
+void cv_set(scene_state_t *ss, int16_t a, int16_t b);
+void tr_pulse(scene_state_t *ss, int16_t a);
 
 #endif
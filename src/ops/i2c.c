@@ -5,52 +5,52 @@
 #include "helpers.h"
 #include "teletype_io.h"
 
-static void op_IIA_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                       command_state_t *cs);
-static void op_IIA_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                       command_state_t *cs);
-static void op_IIS_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                       command_state_t *cs);
-static void op_IIS1_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_IIS2_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_IIS3_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_IISB1_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_IISB2_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_IISB3_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_IIQ_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                       command_state_t *cs);
-static void op_IIQ1_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_IIQ2_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_IIQ3_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_IIQB1_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_IIQB2_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_IIQB3_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_IIB_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                       command_state_t *cs);
-static void op_IIB1_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_IIB2_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_IIB3_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_IIBB1_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_IIBB2_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_IIBB3_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
+void op_IIA_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                command_state_t *cs);
+void op_IIA_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                command_state_t *cs);
+void op_IIS_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                command_state_t *cs);
+void op_IIS1_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_IIS2_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_IIS3_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_IISB1_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_IISB2_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_IISB3_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_IIQ_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                command_state_t *cs);
+void op_IIQ1_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_IIQ2_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_IIQ3_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_IIQB1_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_IIQB2_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_IIQB3_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_IIB_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                command_state_t *cs);
+void op_IIB1_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_IIB2_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_IIB3_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_IIBB1_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_IIBB2_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_IIBB3_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
 
 const tele_op_t op_IIA = MAKE_GET_SET_OP(IIA, op_IIA_get, op_IIA_set, 0, true);
 const tele_op_t op_IIS = MAKE_GET_OP(IIS, op_IIS_get, 1, false);
@@ -134,132 +134,132 @@ static void query_byte(scene_state_t *ss, command_state_t *cs) {
     cs_push(cs, value);
 }
 
-static void op_IIA_get(const void *NOTUSED(data), scene_state_t *ss,
-                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIA_get(const void *NOTUSED(data), scene_state_t *ss,
+                exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->i2c_op_address);
 }
 
-static void op_IIA_set(const void *NOTUSED(data), scene_state_t *ss,
-                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIA_set(const void *NOTUSED(data), scene_state_t *ss,
+                exec_state_t *NOTUSED(es), command_state_t *cs) {
     u16 address = cs_pop(cs);
     ss->i2c_op_address = address > 0x7f ? -1 : address;
 }
 
-static void op_IIS_get(const void *NOTUSED(data), scene_state_t *ss,
-                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIS_get(const void *NOTUSED(data), scene_state_t *ss,
+                exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_words(ss, cs, 0);
 }
 
-static void op_IIS1_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIS1_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_words(ss, cs, 1);
 }
 
-static void op_IIS2_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIS2_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_words(ss, cs, 2);
 }
 
-static void op_IIS3_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIS3_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_words(ss, cs, 3);
 }
 
-static void op_IISB1_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IISB1_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_bytes(ss, cs, 1);
 }
 
-static void op_IISB2_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IISB2_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_bytes(ss, cs, 2);
 }
 
-static void op_IISB3_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IISB3_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_bytes(ss, cs, 3);
 }
 
-static void op_IIQ_get(const void *NOTUSED(data), scene_state_t *ss,
-                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIQ_get(const void *NOTUSED(data), scene_state_t *ss,
+                exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_words(ss, cs, 0);
     query_word(ss, cs);
 }
 
-static void op_IIQ1_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIQ1_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_words(ss, cs, 1);
     query_word(ss, cs);
 }
 
-static void op_IIQ2_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIQ2_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_words(ss, cs, 2);
     query_word(ss, cs);
 }
 
-static void op_IIQ3_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIQ3_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_words(ss, cs, 3);
     query_word(ss, cs);
 }
 
-static void op_IIQB1_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIQB1_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_bytes(ss, cs, 1);
     query_word(ss, cs);
 }
 
-static void op_IIQB2_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIQB2_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_bytes(ss, cs, 2);
     query_word(ss, cs);
 }
 
-static void op_IIQB3_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIQB3_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_bytes(ss, cs, 3);
     query_word(ss, cs);
 }
 
-static void op_IIB_get(const void *NOTUSED(data), scene_state_t *ss,
-                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIB_get(const void *NOTUSED(data), scene_state_t *ss,
+                exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_words(ss, cs, 0);
     query_byte(ss, cs);
 }
 
-static void op_IIB1_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIB1_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_words(ss, cs, 1);
     query_byte(ss, cs);
 }
 
-static void op_IIB2_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIB2_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_words(ss, cs, 2);
     query_byte(ss, cs);
 }
 
-static void op_IIB3_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIB3_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_words(ss, cs, 3);
     query_byte(ss, cs);
 }
 
-static void op_IIBB1_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIBB1_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_bytes(ss, cs, 1);
     query_byte(ss, cs);
 }
 
-static void op_IIBB2_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIBB2_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_bytes(ss, cs, 2);
     query_byte(ss, cs);
 }
 
-static void op_IIBB3_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_IIBB3_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     send_bytes(ss, cs, 3);
     query_byte(ss, cs);
 }
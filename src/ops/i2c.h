@@ -37,10 +37,10 @@ extern void i2c_write_32(command_state_t *cs, uint8_t addr, uint8_t cmd);
 extern void i2c_recv_16(command_state_t *cs, uint8_t addr, uint8_t cmd);
 extern void i2c_recv_8(command_state_t *cs, uint8_t addr, uint8_t cmd);
 
-#define I2C_WRITE(name, addr, cmd, fn)                                      \
-    static void name(const void *NOTUSED(data), scene_state_t *NOTUSED(ss), \
-                     exec_state_t *NOTUSED(es), command_state_t *cs) {      \
-        fn(cs, addr, cmd);                                                  \
+#define I2C_WRITE(name, addr, cmd, fn)                               \
+    void name(const void *NOTUSED(data), scene_state_t *NOTUSED(ss), \
+              exec_state_t *NOTUSED(es), command_state_t *cs) {      \
+        fn(cs, addr, cmd);                                           \
     }
 
 #define I2C_WRITE_0(name, addr, cmd) I2C_WRITE(name, addr, cmd, i2c_write_0)
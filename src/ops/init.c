@@ -6,30 +6,30 @@
 #include "teletype.h"
 #include "teletype_io.h"
 
-static void op_INIT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_INIT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_INIT_SCENE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_INIT_SCRIPT_get(const void *data, scene_state_t *ss, exec_state_t *es,
                         command_state_t *cs);
-static void op_INIT_SCENE_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_INIT_SCRIPT_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_INIT_SCRIPT_ALL_get(const void *data, scene_state_t *ss,
-                                   exec_state_t *es, command_state_t *cs);
-static void op_INIT_P_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_INIT_P_ALL_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_INIT_CV_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_INIT_CV_ALL_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_INIT_TR_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_INIT_TR_ALL_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_INIT_DATA_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_INIT_TIME_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
+void op_INIT_SCRIPT_ALL_get(const void *data, scene_state_t *ss,
+                            exec_state_t *es, command_state_t *cs);
+void op_INIT_P_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_INIT_P_ALL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_INIT_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_INIT_CV_ALL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_INIT_TR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_INIT_TR_ALL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_INIT_DATA_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_INIT_TIME_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
 
 const tele_op_t op_INIT = MAKE_GET_OP(INIT, op_INIT_get, 0, false);
 const tele_op_t op_INIT_SCENE =
@@ -54,9 +54,8 @@ const tele_op_t op_INIT_TIME =
 
 
 // identical with below, for now.
-static void op_INIT_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es),
-                        command_state_t *NOTUSED(cs)) {
+void op_INIT_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *NOTUSED(cs)) {
     // Because we can't see the flash from this context, we cache calibration
     cal_data_t caldata = ss->cal;
     // At boot, all data is zeroed
@@ -73,9 +72,9 @@ static void op_INIT_get(const void *NOTUSED(data), scene_state_t *ss,
     tele_metro_updated();
 }
 
-static void op_INIT_SCENE_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es),
-                              command_state_t *NOTUSED(cs)) {
+void op_INIT_SCENE_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es),
+                       command_state_t *NOTUSED(cs)) {
     cal_data_t caldata = ss->cal;
     memset(ss, 0, sizeof(scene_state_t));
     ss_init(ss);
@@ -87,20 +86,20 @@ static void op_INIT_SCENE_get(const void *NOTUSED(data), scene_state_t *ss,
     tele_metro_updated();
 }
 
-static void op_INIT_SCRIPT_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_INIT_SCRIPT_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t v = cs_pop(cs) - 1;
     if (v >= 0 && v < TEMP_SCRIPT) ss_clear_script(ss, (size_t)v);
 }
 
-static void op_INIT_SCRIPT_ALL_get(const void *NOTUSED(data), scene_state_t *ss,
-                                   exec_state_t *NOTUSED(es),
-                                   command_state_t *NOTUSED(cs)) {
+void op_INIT_SCRIPT_ALL_get(const void *NOTUSED(data), scene_state_t *ss,
+                            exec_state_t *NOTUSED(es),
+                            command_state_t *NOTUSED(cs)) {
     for (size_t i = 0; i < TEMP_SCRIPT; i++) ss_clear_script(ss, i);
 }
 
-static void op_INIT_P_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_INIT_P_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t v = cs_pop(cs);
     if (v >= 0 && v < 4) {
         ss_pattern_init(ss, v);
@@ -108,15 +107,15 @@ static void op_INIT_P_get(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_INIT_P_ALL_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es),
-                              command_state_t *NOTUSED(cs)) {
+void op_INIT_P_ALL_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es),
+                       command_state_t *NOTUSED(cs)) {
     ss_patterns_init(ss);
     tele_pattern_updated();
 }
 
-static void op_INIT_CV_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_INIT_CV_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t v = cs_pop(cs) - 1;
     if (v >= 0 && v < TR_COUNT) {
         ss->variables.cv[v] = 0;
@@ -126,9 +125,9 @@ static void op_INIT_CV_get(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_INIT_CV_ALL_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es),
-                               command_state_t *NOTUSED(cs)) {
+void op_INIT_CV_ALL_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es),
+                        command_state_t *NOTUSED(cs)) {
     for (size_t i = 0; i < TR_COUNT; i++) {
         ss->variables.cv[i] = 0;
         ss->variables.cv_off[i] = 0;
@@ -137,41 +136,39 @@ static void op_INIT_CV_ALL_get(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_INIT_TR_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_INIT_TR_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t v = cs_pop(cs) - 1;
     if (v >= 0 && v < TR_COUNT) {
         ss->variables.tr[v] = 0;
         ss->variables.tr_pol[v] = 1;
         ss->variables.tr_time[v] = 100;
-        ss->tr_pulse_timer[v] = 0;
+        ss->tr_pulse_active[v] = false;
         tele_tr(v, 0);
     }
 }
 
-static void op_INIT_TR_ALL_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es),
-                               command_state_t *NOTUSED(cs)) {
+void op_INIT_TR_ALL_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es),
+                        command_state_t *NOTUSED(cs)) {
     for (size_t i = 0; i < TR_COUNT; i++) {
         ss->variables.tr[i] = 0;
         ss->variables.tr_pol[i] = 1;
         ss->variables.tr_time[i] = 100;
-        ss->tr_pulse_timer[i] = 0;
+        ss->tr_pulse_active[i] = false;
         tele_tr(i, 0);
     }
 }
 
-static void op_INIT_DATA_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es),
-                             command_state_t *NOTUSED(cs)) {
+void op_INIT_DATA_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *NOTUSED(cs)) {
     ss_variables_init(ss);
     tele_vars_updated();
     tele_metro_updated();
 }
 
-static void op_INIT_TIME_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es),
-                             command_state_t *NOTUSED(cs)) {
+void op_INIT_TIME_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *NOTUSED(cs)) {
     clear_delays(ss);
     ss->variables.time = 0;
     uint32_t ticks = tele_get_ticks();
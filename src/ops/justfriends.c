@@ -7,61 +7,61 @@
 
 static void mod_JF0_func(scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs,
-                         const tele_command_t *post_command);
+                         const tele_command_view_t *post_command);
 static void mod_JF1_func(scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs,
-                         const tele_command_t *post_command);
+                         const tele_command_view_t *post_command);
 static void mod_JF2_func(scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs,
-                         const tele_command_t *post_command);
-static void op_JF_TR_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_JF_RMODE_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_JF_RUN_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         const tele_command_view_t *post_command);
+void op_JF_TR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_JF_RMODE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_JF_RUN_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_JF_SHIFT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_JF_VTR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_JF_MODE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_JF_TICK_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_JF_VOX_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_JF_NOTE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_JF_GOD_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_JF_TUNE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_JF_QT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_JF_ADDR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_JF_SEL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_JF_POLY_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_JF_POLY_RESET_get(const void *data, scene_state_t *ss, exec_state_t *es,
                           command_state_t *cs);
-static void op_JF_SHIFT_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_JF_VTR_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_JF_MODE_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_JF_TICK_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_JF_VOX_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_JF_NOTE_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_JF_GOD_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_JF_TUNE_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_JF_QT_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_JF_ADDR_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_JF_SEL_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_JF_POLY_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_JF_POLY_RESET_get(const void *data, scene_state_t *ss,
-                                 exec_state_t *es, command_state_t *cs);
-static void op_JF_PITCH_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_JF_SPEED_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_JF_TSC_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_JF_RAMP_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_JF_CURVE_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_JF_FM_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_JF_TIME_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_JF_INTONE_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
+void op_JF_PITCH_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_JF_SPEED_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_JF_TSC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_JF_RAMP_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_JF_CURVE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_JF_FM_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_JF_TIME_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_JF_INTONE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
 
 // clang-format off
 const tele_mod_t mod_JF0          = MAKE_MOD(JF0, mod_JF0_func, 0);
@@ -93,47 +93,44 @@ const tele_op_t op_JF_TIME        = MAKE_GET_OP(JF.TIME      , op_JF_TIME_get
 const tele_op_t op_JF_INTONE      = MAKE_GET_OP(JF.INTONE    , op_JF_INTONE_get    , 0, true);
 // clang-format on
 
-static u8 unit = JF_ADDR;
-static u8 note_count = 1;
-
 static void mod_JF0_func(scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs,
-                         const tele_command_t *post_command) {
-    u8 u = unit;
+                         const tele_command_view_t *post_command) {
+    u8 u = ss->i2c.jf;
     process_command(ss, es, post_command);
-    unit = (u == JF_ADDR) ? JF_ADDR_2 : JF_ADDR;
+    ss->i2c.jf = (u == JF_ADDR) ? JF_ADDR_2 : JF_ADDR;
     process_command(ss, es, post_command);
-    unit = u;
+    ss->i2c.jf = u;
 }
 
 static void mod_JF1_func(scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs,
-                         const tele_command_t *post_command) {
-    u8 u = unit;
-    unit = JF_ADDR;
+                         const tele_command_view_t *post_command) {
+    u8 u = ss->i2c.jf;
+    ss->i2c.jf = JF_ADDR;
     process_command(ss, es, post_command);
-    unit = u;
+    ss->i2c.jf = u;
 }
 
 static void mod_JF2_func(scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs,
-                         const tele_command_t *post_command) {
-    u8 u = unit;
-    unit = JF_ADDR_2;
+                         const tele_command_view_t *post_command) {
+    u8 u = ss->i2c.jf;
+    ss->i2c.jf = JF_ADDR_2;
     process_command(ss, es, post_command);
-    unit = u;
+    ss->i2c.jf = u;
 }
 
-static void op_JF_SEL_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
-    if (cs_pop(cs) == 2) { unit = JF_ADDR_2; }
+void op_JF_SEL_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
+    if (cs_pop(cs) == 2) { ss->i2c.jf = JF_ADDR_2; }
     else {
-        unit = JF_ADDR;
+        ss->i2c.jf = JF_ADDR;
     }
 }
 
-static void op_JF_TR_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_TR_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     if (a == -1) {
@@ -144,42 +141,40 @@ static void op_JF_TR_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     else if (a >= 7) {
         a = a - 6;
         uint8_t d[] = { JF_TR, a, b };
-        if (unit == JF_ADDR) { tele_ii_tx(JF_ADDR_2, d, 3); }
+        if (ss->i2c.jf == JF_ADDR) { tele_ii_tx(JF_ADDR_2, d, 3); }
         else {
             tele_ii_tx(JF_ADDR, d, 3);
         }
     }
     else {
         uint8_t d[] = { JF_TR, a, b };
-        tele_ii_tx(unit, d, 3);
+        tele_ii_tx(ss->i2c.jf, d, 3);
     }
 }
 
-static void op_JF_RMODE_get(const void *NOTUSED(data),
-                            scene_state_t *NOTUSED(ss),
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_RMODE_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { JF_RMODE, a };
-    tele_ii_tx(unit, d, 2);
+    tele_ii_tx(ss->i2c.jf, d, 2);
 }
 
-static void op_JF_RUN_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_RUN_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { JF_RUN, a >> 8, a & 0xff };
-    tele_ii_tx(unit, d, 3);
+    tele_ii_tx(ss->i2c.jf, d, 3);
 }
 
-static void op_JF_SHIFT_get(const void *NOTUSED(data),
-                            scene_state_t *NOTUSED(ss),
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_SHIFT_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { JF_SHIFT, a >> 8, a & 0xff };
-    tele_ii_tx(unit, d, 3);
+    tele_ii_tx(ss->i2c.jf, d, 3);
 }
 
-static void op_JF_VTR_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_VTR_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     if (a == -1) {
@@ -190,35 +185,33 @@ static void op_JF_VTR_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     else if (a >= 7) {
         a = a - 6;
         uint8_t d[] = { JF_VTR, a, b >> 8, b & 0xff };
-        if (unit == JF_ADDR) { tele_ii_tx(JF_ADDR_2, d, 4); }
+        if (ss->i2c.jf == JF_ADDR) { tele_ii_tx(JF_ADDR_2, d, 4); }
         else {
             tele_ii_tx(JF_ADDR, d, 4);
         }
     }
     else {
         uint8_t d[] = { JF_VTR, a, b >> 8, b & 0xff };
-        tele_ii_tx(unit, d, 4);
+        tele_ii_tx(ss->i2c.jf, d, 4);
     }
 }
 
-static void op_JF_MODE_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_MODE_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { JF_MODE, a };
-    tele_ii_tx(unit, d, 2);
+    tele_ii_tx(ss->i2c.jf, d, 2);
 }
 
-static void op_JF_TICK_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_TICK_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { JF_TICK, a };
-    tele_ii_tx(unit, d, 2);
+    tele_ii_tx(ss->i2c.jf, d, 2);
 }
 
-static void op_JF_VOX_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_VOX_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     int16_t c = cs_pop(cs);
@@ -230,63 +223,59 @@ static void op_JF_VOX_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
     else if (a >= 7) {
         a = a - 6;
         uint8_t d[] = { JF_VOX, a, b >> 8, b & 0xff, c >> 8, c & 0xff };
-        if (unit == JF_ADDR) { tele_ii_tx(JF_ADDR_2, d, 6); }
+        if (ss->i2c.jf == JF_ADDR) { tele_ii_tx(JF_ADDR_2, d, 6); }
         else {
             tele_ii_tx(JF_ADDR, d, 6);
         }
     }
     else {
         uint8_t d[] = { JF_VOX, a, b >> 8, b & 0xff, c >> 8, c & 0xff };
-        tele_ii_tx(unit, d, 6);
+        tele_ii_tx(ss->i2c.jf, d, 6);
     }
 }
 
-static void op_JF_NOTE_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_NOTE_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     uint8_t d[] = { JF_NOTE, a >> 8, a & 0xff, b >> 8, b & 0xff };
-    tele_ii_tx(unit, d, 5);
+    tele_ii_tx(ss->i2c.jf, d, 5);
 }
 
-static void op_JF_POLY_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_POLY_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     uint8_t d[] = { JF_NOTE, a >> 8, a & 0xff, b >> 8, b & 0xff };
-    if (note_count < 7) {
-        tele_ii_tx(unit, d, 5);
-        note_count++;
+    if (ss->i2c.jf_note_count < 7) {
+        tele_ii_tx(ss->i2c.jf, d, 5);
+        ss->i2c.jf_note_count++;
     }
     else {
-        if (unit == JF_ADDR) { tele_ii_tx(JF_ADDR_2, d, 5); }
+        if (ss->i2c.jf == JF_ADDR) { tele_ii_tx(JF_ADDR_2, d, 5); }
         else {
             tele_ii_tx(JF_ADDR, d, 5);
         }
-        note_count++;
-        if (note_count > 12) { note_count = 1; }
+        ss->i2c.jf_note_count++;
+        if (ss->i2c.jf_note_count > 12) { ss->i2c.jf_note_count = 1; }
     }
 }
 
-static void op_JF_POLY_RESET_get(const void *NOTUSED(data),
-                                 scene_state_t *NOTUSED(ss),
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *NOTUSED(cs)) {
-    note_count = 1;
+void op_JF_POLY_RESET_get(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es),
+                          command_state_t *NOTUSED(cs)) {
+    ss->i2c.jf_note_count = 1;
 }
 
-static void op_JF_GOD_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_GOD_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { JF_GOD, a };
-    tele_ii_tx(unit, d, 2);
+    tele_ii_tx(ss->i2c.jf, d, 2);
 }
 
-static void op_JF_TUNE_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_TUNE_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     int16_t c = cs_pop(cs);
@@ -298,35 +287,33 @@ static void op_JF_TUNE_get(const void *NOTUSED(data),
     else if (a >= 7) {
         a = a - 6;
         uint8_t d[] = { JF_TUNE, a, b, c };
-        if (unit == JF_ADDR) { tele_ii_tx(JF_ADDR_2, d, 4); }
+        if (ss->i2c.jf == JF_ADDR) { tele_ii_tx(JF_ADDR_2, d, 4); }
         else {
             tele_ii_tx(JF_ADDR, d, 4);
         }
     }
     else {
         uint8_t d[] = { JF_TUNE, a, b, c };
-        tele_ii_tx(unit, d, 4);
+        tele_ii_tx(ss->i2c.jf, d, 4);
     }
 }
 
-static void op_JF_QT_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_QT_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { JF_QT, a };
-    tele_ii_tx(unit, d, 2);
+    tele_ii_tx(ss->i2c.jf, d, 2);
 }
 
-static void op_JF_ADDR_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_ADDR_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     uint8_t d[] = { JF_ADDRESS, a };
-    tele_ii_tx(unit, d, 2);
+    tele_ii_tx(ss->i2c.jf, d, 2);
 }
 
-static void op_JF_PITCH_get(const void *NOTUSED(data),
-                            scene_state_t *NOTUSED(ss),
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_PITCH_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     if (a == -1) {
@@ -337,81 +324,76 @@ static void op_JF_PITCH_get(const void *NOTUSED(data),
     else if (a >= 7) {
         a = a - 6;
         uint8_t d[] = { JF_PITCH, a, b >> 8, b & 0xff };
-        if (unit == JF_ADDR) { tele_ii_tx(JF_ADDR_2, d, 6); }
+        if (ss->i2c.jf == JF_ADDR) { tele_ii_tx(JF_ADDR_2, d, 6); }
         else {
             tele_ii_tx(JF_ADDR, d, 6);
         }
     }
     else {
         uint8_t d[] = { JF_PITCH, a, b >> 8, b & 0xff };
-        tele_ii_tx(unit, d, 6);
+        tele_ii_tx(ss->i2c.jf, d, 6);
     }
 }
 
-static void op_JF_SPEED_get(const void *NOTUSED(data),
-                            scene_state_t *NOTUSED(ss),
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_SPEED_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t d[] = { JF_SPEED | II_GET };
-    tele_ii_tx(unit, d, 1);
+    tele_ii_tx(ss->i2c.jf, d, 1);
     d[0] = 0;
-    tele_ii_rx(unit, d, 1);
+    tele_ii_rx(ss->i2c.jf, d, 1);
     cs_push(cs, d[0]);
 }
 
-static void op_JF_TSC_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_JF_TSC_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t d[] = { JF_TSC | II_GET };
-    tele_ii_tx(unit, d, 1);
+    tele_ii_tx(ss->i2c.jf, d, 1);
     d[0] = 0;
-    tele_ii_rx(unit, d, 1);
+    tele_ii_rx(ss->i2c.jf, d, 1);
     cs_push(cs, d[0]);
 }
 
-static void op_JF_RAMP_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
-    uint8_t d[] = { JF_RAMP | II_GET };
-    tele_ii_tx(unit, d, 1);
+void op_JF_RAMP_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
+    uint8_t d[] = { JF_RAMP | II_GET, 0 };
+    tele_ii_tx(ss->i2c.jf, d, 1);
     d[0] = 0;
-    tele_ii_rx(unit, d, 2);
+    tele_ii_rx(ss->i2c.jf, d, 2);
     cs_push(cs, (d[0] << 8) + d[1]);
 }
 
-static void op_JF_CURVE_get(const void *NOTUSED(data),
-                            scene_state_t *NOTUSED(ss),
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
-    uint8_t d[] = { JF_CURVE | II_GET };
-    tele_ii_tx(unit, d, 1);
+void op_JF_CURVE_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
+    uint8_t d[] = { JF_CURVE | II_GET, 0 };
+    tele_ii_tx(ss->i2c.jf, d, 1);
     d[0] = 0;
-    tele_ii_rx(unit, d, 2);
+    tele_ii_rx(ss->i2c.jf, d, 2);
     cs_push(cs, (d[0] << 8) + d[1]);
 }
 
-static void op_JF_FM_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
-    uint8_t d[] = { JF_FM | II_GET };
-    tele_ii_tx(unit, d, 1);
+void op_JF_FM_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
+    uint8_t d[] = { JF_FM | II_GET, 0 };
+    tele_ii_tx(ss->i2c.jf, d, 1);
     d[0] = 0;
-    tele_ii_rx(unit, d, 2);
+    tele_ii_rx(ss->i2c.jf, d, 2);
     cs_push(cs, (d[0] << 8) + d[1]);
 }
 
-static void op_JF_TIME_get(const void *NOTUSED(data),
-                           scene_state_t *NOTUSED(ss),
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
-    uint8_t d[] = { JF_TIME | II_GET };
-    tele_ii_tx(unit, d, 1);
+void op_JF_TIME_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
+    uint8_t d[] = { JF_TIME | II_GET, 0 };
+    tele_ii_tx(ss->i2c.jf, d, 1);
     d[0] = 0;
-    tele_ii_rx(unit, d, 2);
+    tele_ii_rx(ss->i2c.jf, d, 2);
     cs_push(cs, (d[0] << 8) + d[1]);
 }
 
-static void op_JF_INTONE_get(const void *NOTUSED(data),
-                             scene_state_t *NOTUSED(ss),
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
-    uint8_t d[] = { JF_INTONE | II_GET };
-    tele_ii_tx(unit, d, 1);
+void op_JF_INTONE_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+    uint8_t d[] = { JF_INTONE | II_GET, 0 };
+    tele_ii_tx(ss->i2c.jf, d, 1);
     d[0] = 0;
-    tele_ii_rx(unit, d, 2);
+    tele_ii_rx(ss->i2c.jf, d, 2);
     cs_push(cs, (d[0] << 8) + d[1]);
 }
\ No newline at end of file
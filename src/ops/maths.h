@@ -112,4 +112,64 @@ extern const tele_op_t op_SYM_PIPE_x3;          // ||| alias OR3
 extern const tele_op_t op_SYM_AMPERSAND_x4;     // &&&& alias AND4
 extern const tele_op_t op_SYM_PIPE_x4;          // |||| alias OR4
 
+// shared with the fused commands (see fuse.h)
+int16_t note_number_to_volts(int16_t note_in);
+int16_t wrap_value(int16_t i, int16_t a, int16_t b);
+
+// The values of OPs, shared with the scenes the simulator compiles (see
+// simulator/aot.h and simulator/lanes.c). a is the first param, as it's the
+// first off the stack. These are inline as the compiled scenes call them for
+// every word.
+
+static inline int16_t mul_value(int16_t a, int16_t b) {
+    int32_t r = (int32_t)a * b;
+    if (r > INT16_MAX) r = INT16_MAX;
+    if (r < INT16_MIN) r = INT16_MIN;
+    return r;
+}
+
+static inline int16_t div_value(int16_t a, int16_t b) {
+    return b != 0 ? a / b : 0;
+}
+
+static inline int16_t mod_value(int16_t a, int16_t b) {
+    return b != 0 ? a % b : 0;
+}
+
+static inline int16_t min_value(int16_t a, int16_t b) {
+    return b > a ? a : b;
+}
+
+static inline int16_t max_value(int16_t a, int16_t b) {
+    return a > b ? a : b;
+}
+
+static inline int16_t lim_value(int16_t i, int16_t a, int16_t b) {
+    if (i < a) return a;
+    if (i > b) return b;
+    return i;
+}
+
+static inline int16_t avg_value(int16_t a, int16_t b) {
+    int32_t r = ((int32_t)a * 2 + (int32_t)b * 2) / 2;
+    if (r % 2) r += 1;
+    return r / 2;
+}
+
+static inline int16_t abs_value(int16_t a) {
+    return a < 0 ? -a : a;
+}
+
+static inline int16_t sgn_value(int16_t a) {
+    return a > 0 ? 1 : a < 0 ? -1 : 0;
+}
+
+static inline int16_t toss_value(random_state_t *r) {
+    return random_next(r) & 1;
+}
+
+// RAND and RRAND, r is the RAND random state
+int16_t rand_value(random_state_t *r, int16_t a);
+int16_t rrand_value(random_state_t *r, int16_t a, int16_t b);
+
 #endif
@@ -4,64 +4,64 @@
 #include "table.h"
 #include "teletype_io.h"
 
-static void op_MI_SYM_DOLLAR_get(const void *data, scene_state_t *ss,
-                                 exec_state_t *es, command_state_t *cs);
-static void op_MI_SYM_DOLLAR_set(const void *data, scene_state_t *ss,
-                                 exec_state_t *es, command_state_t *cs);
-static void op_MI_LE_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_MI_LN_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_MI_LNV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_MI_SYM_DOLLAR_get(const void *data, scene_state_t *ss, exec_state_t *es,
                           command_state_t *cs);
-static void op_MI_LV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_MI_LVV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_MI_SYM_DOLLAR_set(const void *data, scene_state_t *ss, exec_state_t *es,
                           command_state_t *cs);
-static void op_MI_LO_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_MI_LC_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_MI_LCC_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_MI_LCCV_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_MI_NL_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_MI_N_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_MI_NV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_MI_V_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_MI_VV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_MI_OL_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_MI_O_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_MI_CL_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_MI_C_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_MI_CC_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_MI_CCV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_MI_LCH_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_MI_NCH_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_MI_OCH_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_MI_CCH_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
-static void op_MI_CLKD_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_MI_CLKD_set(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_MI_CLKR_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
+void op_MI_LE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_MI_LN_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_MI_LNV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_MI_LV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_MI_LVV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_MI_LO_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_MI_LC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_MI_LCC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_MI_LCCV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_MI_NL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_MI_N_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_MI_NV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_MI_V_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_MI_VV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_MI_OL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_MI_O_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_MI_CL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_MI_C_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_MI_CC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_MI_CCV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_MI_LCH_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_MI_NCH_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_MI_OCH_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_MI_CCH_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_MI_CLKD_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_MI_CLKD_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_MI_CLKR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
 
 // clang-format off
 
@@ -95,9 +95,8 @@ const tele_op_t op_MI_CLKD = MAKE_GET_SET_OP(MI.CLKD, op_MI_CLKD_get, op_MI_CLKD
 
 // clang-format on
 
-static void op_MI_SYM_DOLLAR_get(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs) {
+void op_MI_SYM_DOLLAR_get(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint16_t event = cs_pop(cs);
     int16_t script = -1;
 
@@ -124,9 +123,8 @@ static void op_MI_SYM_DOLLAR_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, script == -1 ? script : script + 1);
 }
 
-static void op_MI_SYM_DOLLAR_set(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs) {
+void op_MI_SYM_DOLLAR_set(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint16_t event = cs_pop(cs);
     s16 script = cs_pop(cs) - 1;
     if (script < 0 || script > INIT_SCRIPT) script = -1;
@@ -164,158 +162,158 @@ static void op_MI_SYM_DOLLAR_set(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_MI_LE_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MI_LE_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->midi.last_event_type);
 }
 
-static void op_MI_LN_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MI_LN_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->midi.last_note);
 }
 
-static void op_MI_LNV_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MI_LNV_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, table_n[ss->midi.last_note]);
 }
 
-static void op_MI_LV_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MI_LV_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->midi.last_velocity);
 }
 
-static void op_MI_LVV_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MI_LVV_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->midi.last_velocity * 129);
 }
 
-static void op_MI_LO_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MI_LO_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->midi.last_note);
 }
 
-static void op_MI_LC_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MI_LC_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->midi.last_controller);
 }
 
-static void op_MI_LCC_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MI_LCC_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->midi.last_cc);
 }
 
-static void op_MI_LCCV_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MI_LCCV_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->midi.last_cc * 129);
 }
 
-static void op_MI_NL_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MI_NL_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->midi.on_count);
 }
 
-static void op_MI_N_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *es, command_state_t *cs) {
+void op_MI_N_get(const void *NOTUSED(data), scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs) {
     s16 i = es_variables(es)->i;
     cs_push(cs, i < 1 || i > ss->midi.on_count ? 0 : ss->midi.note_on[i - 1]);
 }
 
-static void op_MI_NV_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *es, command_state_t *cs) {
+void op_MI_NV_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *es, command_state_t *cs) {
     s16 i = es_variables(es)->i;
     cs_push(cs, i < 1 || i > ss->midi.on_count
                     ? 0
                     : table_n[ss->midi.note_on[i - 1]]);
 }
 
-static void op_MI_V_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *es, command_state_t *cs) {
+void op_MI_V_get(const void *NOTUSED(data), scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs) {
     s16 i = es_variables(es)->i;
     cs_push(cs, i < 1 || i > ss->midi.on_count ? 0 : ss->midi.note_vel[i - 1]);
 }
 
-static void op_MI_VV_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *es, command_state_t *cs) {
+void op_MI_VV_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *es, command_state_t *cs) {
     s16 i = es_variables(es)->i;
     cs_push(cs, i < 1 || i > ss->midi.on_count
                     ? 0
                     : ss->midi.note_vel[i - 1] * 129);
 }
 
-static void op_MI_OL_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MI_OL_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->midi.off_count);
 }
 
-static void op_MI_O_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *es, command_state_t *cs) {
+void op_MI_O_get(const void *NOTUSED(data), scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs) {
     s16 i = es_variables(es)->i;
     cs_push(cs, i < 1 || i > ss->midi.off_count ? 0 : ss->midi.note_off[i - 1]);
 }
 
-static void op_MI_CL_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MI_CL_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->midi.cc_count);
 }
 
-static void op_MI_C_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *es, command_state_t *cs) {
+void op_MI_C_get(const void *NOTUSED(data), scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs) {
     s16 i = es_variables(es)->i;
     cs_push(cs, i < 1 || i > ss->midi.cc_count ? 0 : ss->midi.cn[i - 1]);
 }
 
-static void op_MI_CC_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *es, command_state_t *cs) {
+void op_MI_CC_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *es, command_state_t *cs) {
     s16 i = es_variables(es)->i;
     cs_push(cs, i < 1 || i > ss->midi.cc_count ? 0 : ss->midi.cc[i - 1]);
 }
 
-static void op_MI_CCV_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *es, command_state_t *cs) {
+void op_MI_CCV_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *es, command_state_t *cs) {
     s16 i = es_variables(es)->i;
     cs_push(cs, i < 1 || i > ss->midi.cc_count ? 0 : ss->midi.cc[i - 1] * 129);
 }
 
-static void op_MI_LCH_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MI_LCH_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->midi.last_channel);
 }
 
-static void op_MI_NCH_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *es, command_state_t *cs) {
+void op_MI_NCH_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *es, command_state_t *cs) {
     s16 i = es_variables(es)->i;
     cs_push(cs,
             i < 1 || i > ss->midi.on_count ? 0 : ss->midi.on_channel[i - 1]);
 }
 
-static void op_MI_OCH_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *es, command_state_t *cs) {
+void op_MI_OCH_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *es, command_state_t *cs) {
     s16 i = es_variables(es)->i;
     cs_push(cs,
             i < 1 || i > ss->midi.off_count ? 0 : ss->midi.off_channel[i - 1]);
 }
 
-static void op_MI_CCH_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *es, command_state_t *cs) {
+void op_MI_CCH_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *es, command_state_t *cs) {
     s16 i = es_variables(es)->i;
     cs_push(cs,
             i < 1 || i > ss->midi.cc_count ? 0 : ss->midi.cc_channel[i - 1]);
 }
 
-static void op_MI_CLKD_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MI_CLKD_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->midi.clock_div);
 }
 
-static void op_MI_CLKD_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MI_CLKD_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     s16 clock_div = cs_pop(cs);
     if (clock_div < 1 || clock_div > 24) return;
     ss->midi.clock_div = clock_div;
     reset_midi_counter();
 }
 
-static void op_MI_CLKR_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_MI_CLKR_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     reset_midi_counter();
 }
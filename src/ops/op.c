@@ -3,6 +3,7 @@
 #include <stddef.h>  // offsetof
 
 #include "helpers.h"
+#include "ii.h"
 #include "ops/ansible.h"
 #include "ops/controlflow.h"
 #include "ops/crow.h"
@@ -40,7 +41,8 @@
 // OPS //////////////////////////////////////////////////////////
 
 // If you edit this array, you need to run 'utils/op_enums.py' to update the
-// values in 'op_enum.h' so that the order matches.
+// values in 'op_enum.h' so that the order matches, and the tables in
+// 'op_table.h'.
 const tele_op_t *tele_ops[E_OP__LENGTH] = {
     // variables
     &op_A, &op_B, &op_C, &op_D, &op_DRUNK, &op_DRUNK_MAX, &op_DRUNK_MIN,
@@ -84,7 +86,7 @@ const tele_op_t *tele_ops[E_OP__LENGTH] = {
     &op_TR_POL, &op_TR_TIME, &op_TR_TOG, &op_TR_PULSE, &op_TR_P, &op_CV_SET,
     &op_MUTE, &op_STATE, &op_DEVICE_FLIP, &op_LIVE_OFF, &op_LIVE_O,
     &op_LIVE_DASH, &op_LIVE_D, &op_LIVE_GRID, &op_LIVE_G, &op_LIVE_VARS,
-    &op_LIVE_V, &op_PRINT, &op_PRT,
+    &op_LIVE_V, &op_PRINT, &op_PRT, &op_PROF_DUMP, &op_PROF_CLR,
 
     // maths
     &op_ADD, &op_SUB, &op_MUL, &op_DIV, &op_MOD, &op_RAND, &op_RND, &op_RRAND,
@@ -113,7 +115,10 @@ const tele_op_t *tele_ops[E_OP__LENGTH] = {
     &op_S_ALL, &op_S_POP, &op_S_CLR, &op_S_L,
 
     // controlflow
-    &op_SCRIPT, &op_SYM_DOLLAR, &op_SCRIPT_POL, &op_SYM_DOLLAR_POL, &op_KILL,
+    &op_SCRIPT, &op_SYM_DOLLAR, &op_SCRIPT_POL, &op_SYM_DOLLAR_POL,
+    &op_SCRIPT_SLICE, &op_SYM_DOLLAR_SLICE, &op_SCRIPT_Q, &op_SYM_DOLLAR_Q,
+    &op_SCRIPT_QP, &op_SYM_DOLLAR_QP, &op_SCRIPT_DROP, &op_SYM_DOLLAR_DROP,
+    &op_SCRIPT_OVER, &op_SYM_DOLLAR_OVER, &op_KILL,
     &op_SCENE, &op_SCENE_G, &op_SCENE_P, &op_BREAK, &op_BRK, &op_SYNC,
 
     // delay
@@ -287,6 +292,8 @@ const tele_op_t *tele_ops[E_OP__LENGTH] = {
     &op_MI_CLKD, &op_MI_CLKR
 };
 
+#include "ops/op_table.h"
+
 /////////////////////////////////////////////////////////////////
 // MODS /////////////////////////////////////////////////////////
 
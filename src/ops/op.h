@@ -8,6 +8,17 @@
 #include "op_enum.h"
 #include "state.h"
 
+// What the get fn of an OP depends on, the set fn always has side effects.
+// Ops that don't say are taken to have side effects.
+typedef enum {
+    OP_SIDE_EFFECTS = 0,  // e.g. sets an output, or RAND
+    OP_READS_STATE,       // reads the scene or exec state, changes nothing
+    OP_PURE               // only depends on its params, never reads ss or es
+} tele_op_purity_t;
+
+typedef void (*tele_op_fn_t)(const void *data, scene_state_t *ss,
+                             exec_state_t *es, command_state_t *cs);
+
 typedef struct {
     const char *name;
     void (*const get)(const void *data, scene_state_t *ss, exec_state_t *es,
@@ -17,18 +28,68 @@ typedef struct {
     const uint8_t params;
     const bool returns;
     const void *data;
+    const tele_op_purity_t purity;
 } tele_op_t;
 
 typedef struct {
     const char *name;
     void (*const func)(scene_state_t *ss, exec_state_t *es, command_state_t *cs,
-                       const tele_command_t *post_command);
+                       const tele_command_view_t *post_command);
     const uint8_t params;
 } tele_mod_t;
 
 extern const tele_op_t *tele_ops[E_OP__LENGTH];
 extern const tele_mod_t *tele_mods[E_MOD__LENGTH];
 
+// The same descriptors as tele_ops, as parallel tables indexed by E_OP_* so
+// that validating and running commands reads them without following a pointer
+// per OP. They are generated by 'utils/op_enums.py' (in 'op_table.h').
+//
+// tele_op_info packs params, returns, whether there's a set fn and the purity
+// of each OP in to a byte.
+#define OP_INFO_PARAMS 0x0F
+#define OP_INFO_RETURNS 0x10
+#define OP_INFO_SET 0x20
+#define OP_INFO_PURITY_SHIFT 6
+
+// NULL for an OP that doesn't have one
+extern const tele_op_fn_t tele_op_get[E_OP__LENGTH];
+extern const tele_op_fn_t tele_op_set[E_OP__LENGTH];
+extern const uint8_t tele_op_info[E_OP__LENGTH];
+extern const void *const tele_op_data[E_OP__LENGTH];
+extern const char *const tele_op_names[E_OP__LENGTH];  // cold
+
+#ifdef SIM
+// the C names of the descriptors, e.g. "op_CV" and "mod_IF", for generating C
+// that uses them (see simulator/ttc.c)
+extern const char *const tele_op_symbols[E_OP__LENGTH];
+extern const char *const tele_mod_symbols[E_MOD__LENGTH];
+#endif
+
+static inline uint8_t op_params(tele_op_idx_t op) {
+    return tele_op_info[op] & OP_INFO_PARAMS;
+}
+
+static inline bool op_returns(tele_op_idx_t op) {
+    return tele_op_info[op] & OP_INFO_RETURNS;
+}
+
+static inline bool op_has_set(tele_op_idx_t op) {
+    return tele_op_info[op] & OP_INFO_SET;
+}
+
+static inline tele_op_purity_t op_purity(tele_op_idx_t op) {
+    return tele_op_info[op] >> OP_INFO_PURITY_SHIFT;
+}
+
+// the fn that the OP word at idx of a compiled command runs
+static inline tele_op_fn_t op_compiled_fn(const tele_command_t *c,
+                                          const compiled_command_t *cc,
+                                          uint8_t idx) {
+    const int16_t op = td_value(&c->data[idx]);
+    return cc->set_words & (1 << idx) ? tele_op_set[op] : tele_op_get[op];
+}
+
 // Get only ops
 #define MAKE_GET_OP(n, g, p, r)                                       \
     {                                                                 \
@@ -37,6 +98,15 @@ extern const tele_mod_t *tele_mods[E_MOD__LENGTH];
     }
 
 
+// Get only ops that only depend on their params, commands will evaluate them
+// when they are compiled if all their params are constants
+#define MAKE_PURE_OP(n, g, p, r)                                      \
+    {                                                                 \
+        .name = #n, .get = g, .set = NULL, .params = p, .returns = r, \
+        .data = NULL, .purity = OP_PURE                               \
+    }
+
+
 // Get & set ops
 #define MAKE_GET_SET_OP(n, g, s, p, r) \
     { .name = #n, .get = g, .set = s, .params = p, .returns = r, .data = NULL }
@@ -46,7 +116,8 @@ extern const tele_mod_t *tele_mods[E_MOD__LENGTH];
 #define MAKE_SIMPLE_VARIABLE_OP(n, v)                                    \
     {                                                                    \
         .name = #n, .get = op_peek_i16, .set = op_poke_i16, .params = 0, \
-        .returns = 1, .data = (void *)offsetof(scene_state_t, v)         \
+        .returns = 1, .data = (void *)offsetof(scene_state_t, v),        \
+        .purity = OP_READS_STATE                                         \
     }
 
 void op_peek_i16(const void *data, scene_state_t *ss, exec_state_t *es,
@@ -59,6 +130,12 @@ void op_poke_i16(const void *data, scene_state_t *ss, exec_state_t *es,
 #define MAKE_ALIAS_OP(n, g, s, p, r) \
     { .name = #n, .get = g, .set = s, .params = p, .returns = r, .data = NULL }
 
+#define MAKE_PURE_ALIAS_OP(n, g, p, r)                                \
+    {                                                                 \
+        .name = #n, .get = g, .set = NULL, .params = p, .returns = r, \
+        .data = NULL, .purity = OP_PURE                               \
+    }
+
 
 // Simple I2C op (to support the original Trilogy modules)
 #define MAKE_SIMPLE_I2C_OP(n, v)                                    \
@@ -164,6 +164,8 @@ typedef enum {
     E_OP_LIVE_V,
     E_OP_PRINT,
     E_OP_PRT,
+    E_OP_PROF_DUMP,
+    E_OP_PROF_CLR,
     E_OP_ADD,
     E_OP_SUB,
     E_OP_MUL,
@@ -277,6 +279,16 @@ typedef enum {
     E_OP_SYM_DOLLAR,
     E_OP_SCRIPT_POL,
     E_OP_SYM_DOLLAR_POL,
+    E_OP_SCRIPT_SLICE,
+    E_OP_SYM_DOLLAR_SLICE,
+    E_OP_SCRIPT_Q,
+    E_OP_SYM_DOLLAR_Q,
+    E_OP_SCRIPT_QP,
+    E_OP_SYM_DOLLAR_QP,
+    E_OP_SCRIPT_DROP,
+    E_OP_SYM_DOLLAR_DROP,
+    E_OP_SCRIPT_OVER,
+    E_OP_SYM_DOLLAR_OVER,
     E_OP_KILL,
     E_OP_SCENE,
     E_OP_SCENE_G,
@@ -0,0 +1,187 @@
+// clang-format off
+
+#ifndef _OP_HASH_H_
+#define _OP_HASH_H_
+
+// This file has been autogenerated by 'utils/op_enums.py'
+//
+// A perfect hash of the OP and MOD names, only to be included by
+// src/match_token.c, which has the hash functions that match these tables.
+//
+// A name's FNV-1a hash picks a bucket with its top bits, and the hash mixed
+// with that bucket's displacement picks its slot. Slots hold an OP index, a
+// MOD index plus E_OP__LENGTH, or OP_HASH_EMPTY.
+
+#include <stdint.h>
+
+#define OP_HASH_BUCKET_BITS 8
+#define OP_HASH_SLOT_COUNT 1024
+#define OP_HASH_EMPTY 65535
+
+static const uint16_t op_hash_displacements[256] = {
+        3,     0,     7,     2,    14,     7,     4,     0,
+        1,     0,     0,     2,    30,    14,    11,    12,
+        0,     8,    39,     0,     9,    32,    10,     0,
+        9,     0,     5,     4,     0,     0,    12,     2,
+        8,     1,     0,     0,     5,     8,     1,     3,
+        0,     0,     4,    35,     7,     0,     0,     4,
+        3,    34,    10,     9,     0,     5,    15,     0,
+        4,     1,     2,     1,     7,     5,     4,     3,
+       26,     0,     1,    25,    11,     0,     1,     1,
+        0,    17,     4,     6,     6,     2,     1,     2,
+       27,     7,     9,     5,     2,    11,     1,     0,
+        4,     0,     2,    23,     2,     4,     1,     0,
+        8,     0,     2,     6,    20,     5,    26,    21,
+       14,     2,     2,     3,    10,    51,     7,     7,
+        8,    20,    32,     9,     5,     1,     8,     4,
+        2,     4,     0,    15,     3,     3,     2,     0,
+        7,     0,     1,     5,     3,     0,     2,    19,
+        3,    10,    10,     3,     1,    20,    17,     1,
+       40,     1,     7,     0,    21,    37,     7,     0,
+        2,     4,    21,     7,     3,    33,     8,     6,
+       10,     0,    14,    16,    15,     0,    11,     1,
+       31,    16,    44,     2,    20,     7,    29,    29,
+        3,     5,     8,    10,    73,    12,     8,    16,
+        3,     0,    21,     9,     4,     0,     1,     9,
+        2,     3,     0,     0,     3,    28,    19,     4,
+        0,     0,     2,     1,     1,     0,     8,     3,
+        3,     0,     7,     0,     1,     0,    22,     0,
+       11,    17,     7,     2,     0,     8,     1,     5,
+        6,     4,     9,    34,     0,     0,   106,     7,
+        9,     0,    10,     4,     4,     5,     2,     5,
+        6,     2,     1,    29,     7,     5,     1,     6,
+       27,    13,     8,     9,     1,    26,    20,    15,
+};
+
+static const uint16_t op_hash_slots[1024] = {
+      286,    88,   755,   127,   372,   716,   120,   603,
+      655,   481,    46,   121,   210,    69,   678, 65535,
+      654,   750,    53,   164,   477,   172,   258,   638,
+      729,   720,   591, 65535,   605,   281,    10, 65535,
+    65535,   293, 65535,   175, 65535,   379,   161,   807,
+       21,   595,   570,   580,   251,   578, 65535,   277,
+      784, 65535,   188, 65535,   266,   550,   786,   581,
+      323, 65535,   706,   648,   244,   533,   150, 65535,
+      357,   611,   742,   760,   782,    11,   195, 65535,
+      642,   352,   815,   803,   193,   208,   749,   714,
+      301,   222,    61,   171,   733,   446, 65535,    86,
+    65535,   691,   308,   789,   649,   625,   524,   460,
+    65535,   365,   470,   250,   165,   788, 65535,   214,
+      382,   285,    16,   348,   400, 65535, 65535,   562,
+    65535,   374,   828,    75,   345,   176,   177, 65535,
+    65535,   173, 65535,   829,   679,   310,   622, 65535,
+    65535, 65535,   207,   395,   563, 65535,   741,   331,
+      598, 65535,   405,   453,   123,    13,   148,   464,
+      143,   139, 65535,   549, 65535,   291,   103, 65535,
+      473,    52,   263,   137, 65535,   247,   757, 65535,
+      325,   152,   763, 65535,    58,   419,   302,   292,
+    65535,   592,   425,   284,   248,   463,   427,   713,
+      699,   827,   619,   785,   267,   225,   527,   756,
+    65535,   110,   567,   151,   270, 65535,   766,   484,
+      707,   424,   351, 65535,   448,   394, 65535,    68,
+      383,   224, 65535,    31, 65535,   708,   290,     4,
+      469,   162,   571,   515, 65535,   583,   776,    42,
+      408,   306,   726,   128,   825, 65535,   450,   682,
+      279,   440,   523,   319,   781,   468,   347, 65535,
+      501,   174,   566,   544,    72,   410,   810,   734,
+    65535,   231,   692,   508,   317,   104,   406, 65535,
+      111,   693,   287,   288,   363,   674,   792,   652,
+      661, 65535,   608, 65535,   739, 65535,   474,   683,
+    65535, 65535, 65535,   546,   492,   102,   276,   615,
+       22,   336,   680, 65535,   675,   169,   413, 65535,
+       59, 65535,    90,   667,   409,   360,    91,   343,
+        3,    64,   538,   264,   226,   114,   260,   135,
+      402,   568,   388,   141,   715,   438,   670, 65535,
+      635, 65535, 65535,    80,   787, 65535,   497, 65535,
+    65535,   181,   283, 65535,    81,   669,   647,   296,
+      506,   601,   449,   371, 65535,   452, 65535,   681,
+      765,   353, 65535,   239,   694, 65535,   278,   418,
+      441,   200,   397,   791,   609,   198,   130,    24,
+      556, 65535,   493,   341,   722, 65535,   727,   227,
+    65535,   676,   465,   108,   606,   478,   539,   445,
+      577,    71, 65535,   154, 65535,   645,    63, 65535,
+       97,   377,   282,    49,   594,    15,   451,   305,
+      496,   189,   599, 65535, 65535,   294, 65535,   779,
+      166,   259,   588,   136,   597,   234, 65535,   744,
+      322, 65535,    41,   355,   507,   686,   724, 65535,
+      434,   366,    37,   737, 65535,   663, 65535,   311,
+      444,   534,   275,   458, 65535,   257, 65535,   167,
+      298, 65535,   559,   443,   100,   624,     0, 65535,
+      620,   182,   375,    44,    57,   229,    40,   552,
+       73, 65535,   802, 65535,   236,   389,   153,   718,
+      797,   249,   237,   500,   403, 65535,   358,    19,
+      517,   604,   256,   349,   122,   541,   754,   235,
+      197,   618,   719,    26,   344,   553,   798,   740,
+      704,    84,   758,   790,    76,   138,   471,    95,
+    65535,   621, 65535,   428,   564, 65535,    28,   705,
+       36,   836,   385, 65535,   223,   116,   489,   514,
+      401,   529,   380,   821,    25, 65535,   274, 65535,
+      466,   168,   701,   650,   687, 65535,   505,   623,
+    65535, 65535,   112,   723,   106,    65,   495, 65535,
+      221, 65535,   780, 65535, 65535, 65535, 65535,   205,
+      439,   479,   579,   616,   735,   126,   490,   746,
+       89,   320,    85,   398,   280,   486, 65535,   390,
+      253,   684,   759,   586,   113,   330, 65535, 65535,
+      315,   834, 65535,   373, 65535,    96,   399,   381,
+      832,   155, 65535,   636,     8,   404,   271,   423,
+      557, 65535,   191, 65535,   752,   304,    98,   117,
+       30,    78,   391,   218,   435,   593,   426,   157,
+    65535,   558,    39, 65535, 65535,   456,   242,   140,
+      644,   753,   107,   551,   313,   710,   134,   628,
+      491, 65535,   712, 65535,   673,   233,   548, 65535,
+      179,   455,   658,    33, 65535,   811,   677,   696,
+      328,   429,    55, 65535,   454,   199,   299,   202,
+      211,    38,   163,   359,   240,   822,   220,   518,
+    65535, 65535, 65535,   774,   432, 65535, 65535,   324,
+      837,    94, 65535,   641,   342, 65535,    54,   118,
+      386,   183,   801,   643,   187,   573,   273, 65535,
+      503,   528,   555,   709,   487,   238,   206, 65535,
+      613,   651, 65535, 65535, 65535,     9,   697, 65535,
+       48, 65535,    87, 65535,   321, 65535,   370,   764,
+    65535,   213,   572,   146,   672, 65535, 65535, 65535,
+      602,   314,   688,   761,   485,     5,   447,   542,
+      526,   634,   799,   476,   178,   728,   131,   119,
+      504,   535,   519,   262,   808,   777, 65535,   767,
+      748,   289, 65535, 65535,   771, 65535,   770,   510,
+      459,   407,   467,   569,   738,   612,    20,   219,
+      393,   333,   203,   627, 65535,   433,   442,   565,
+      830,    70,   520,   629,   312,   576,   522,    77,
+    65535,   252,   700,   230,   809,   369,   412,   326,
+      804, 65535,   617, 65535,   671,   156, 65535,   656,
+      818,    51, 65535,   216, 65535,    67,   585,    82,
+      437,   513,   215,   587,   512,    23,   511,   775,
+       29,   747,   823, 65535, 65535,   531,     6,   530,
+       27,   537,   149,   329,   335,   415,   431,   532,
+      295, 65535,   378,   626, 65535,   833,    35, 65535,
+      376,   356,   132,   318,   472,   368,   574,    45,
+       93, 65535,   327,    17,   717,   814,   480,   817,
+    65535,   340,   762,   254,   461,   778,   769,     1,
+    65535,   246,   732,    18,   806, 65535,   159,   185,
+      772,    92,   639,   475,   364,   387,   554,   498,
+      192,   751,   411, 65535,   584,   392,   265,   147,
+      685, 65535,   819,   666,    83,   525, 65535,   711,
+      420, 65535,   483,   142, 65535,   653,   689,   332,
+      362, 65535,    79,   813,   838,    47,   783,   745,
+      245,   630, 65535,   350,   436,   494,   194,   614,
+      547,   144,    12,   637,   662,   416,    43,    34,
+      307, 65535,   261,   702,   805, 65535,    99,   204,
+    65535,   217, 65535,   640,   232,   743,   184,   725,
+      367,   730,    60,   158,   794, 65535,     2,   516,
+      417,   582,   824,   600,   521, 65535,   255,   633,
+      145,   105,   133, 65535,   482,   297,   414,   560,
+      826,   695,   186,    50,    66, 65535,   170,   101,
+      272,   488,   812,   129,   536,   816,   243,   334,
+      125,   124, 65535,   800,   160,   690,   820,   201,
+      545,   657, 65535,   115,   561,   361,   180,   659,
+      241,   384,   835,   422,   540, 65535, 65535,   499,
+      502,   831,   646,   665,   109,   269,   660,   196,
+    65535,   228,   354, 65535,   457,   698,   430,   721,
+       62,   212,   338,   795,   768,   610,   736,   590,
+    65535, 65535, 65535, 65535,   309,   575,    32,   303,
+    65535,   396,   421,   773,   664,   631,   632,   268,
+      300, 65535,   796,    56,   339,    74,   731,   462,
+      346, 65535,   190,   668,    14,   543,   337,   596,
+      793,   316,   209,   607,   703,   509,     7,   589,
+};
+
+#endif
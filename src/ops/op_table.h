@@ -0,0 +1,5069 @@
+// clang-format off
+
+#ifndef _OP_TABLE_H_
+#define _OP_TABLE_H_
+
+// This file has been autogenerated by 'utils/op_enums.py'
+//
+// The descriptors of the OPs as parallel tables indexed by E_OP_* (see op.h),
+// read from their MAKE_*_OP definitions, only to be included by src/ops/op.c.
+// The get and set fns are declared here, the op modules don't make them
+// static. Host builds also get the C name of each OP and MOD descriptor.
+
+#define OP_FN(f)                                                  \
+    void f(const void *data, scene_state_t *ss, exec_state_t *es, \
+           command_state_t *cs)
+OP_FN(op_ABS_get);
+OP_FN(op_ADD_get);
+OP_FN(op_AND3_get);
+OP_FN(op_AND4_get);
+OP_FN(op_AND_get);
+OP_FN(op_ANS_APP_get);
+OP_FN(op_ANS_APP_set);
+OP_FN(op_ANS_A_LED_get);
+OP_FN(op_ANS_A_get);
+OP_FN(op_ANS_G_LED_get);
+OP_FN(op_ANS_G_P_get);
+OP_FN(op_ANS_G_get);
+OP_FN(op_ANS_G_set);
+OP_FN(op_ARP_DIV_get);
+OP_FN(op_ARP_ER_get);
+OP_FN(op_ARP_FIL_get);
+OP_FN(op_ARP_GT_get);
+OP_FN(op_ARP_HLD_get);
+OP_FN(op_ARP_RES_get);
+OP_FN(op_ARP_ROT_get);
+OP_FN(op_ARP_RPT_get);
+OP_FN(op_ARP_SHIFT_get);
+OP_FN(op_ARP_SLEW_get);
+OP_FN(op_ARP_STY_get);
+OP_FN(op_AVG_get);
+OP_FN(op_BCLR_get);
+OP_FN(op_BGET_get);
+OP_FN(op_BIT_AND_get);
+OP_FN(op_BIT_NOT_get);
+OP_FN(op_BIT_OR_get);
+OP_FN(op_BIT_XOR_get);
+OP_FN(op_BPM_get);
+OP_FN(op_BREAK_get);
+OP_FN(op_BREV_get);
+OP_FN(op_BSET_get);
+OP_FN(op_BTOG_get);
+OP_FN(op_CHAOS_ALG_get);
+OP_FN(op_CHAOS_ALG_set);
+OP_FN(op_CHAOS_R_get);
+OP_FN(op_CHAOS_R_set);
+OP_FN(op_CHAOS_get);
+OP_FN(op_CHAOS_set);
+OP_FN(op_CROW_AR_get);
+OP_FN(op_CROW_CALL1_get);
+OP_FN(op_CROW_CALL2_get);
+OP_FN(op_CROW_CALL3_get);
+OP_FN(op_CROW_CALL4_get);
+OP_FN(op_CROW_IN_get);
+OP_FN(op_CROW_LFO_get);
+OP_FN(op_CROW_OUT_get);
+OP_FN(op_CROW_PULSE_get);
+OP_FN(op_CROW_Q0_get);
+OP_FN(op_CROW_Q1_get);
+OP_FN(op_CROW_Q2_get);
+OP_FN(op_CROW_Q3_get);
+OP_FN(op_CROW_RESET_get);
+OP_FN(op_CROW_SEL_get);
+OP_FN(op_CROW_SLEW_get);
+OP_FN(op_CROW_V_get);
+OP_FN(op_CV_OFF_get);
+OP_FN(op_CV_OFF_set);
+OP_FN(op_CV_SET_get);
+OP_FN(op_CV_SLEW_get);
+OP_FN(op_CV_SLEW_set);
+OP_FN(op_CV_get);
+OP_FN(op_CV_set);
+OP_FN(op_CY_CV_get);
+OP_FN(op_CY_POS_get);
+OP_FN(op_CY_POS_set);
+OP_FN(op_CY_PRE_get);
+OP_FN(op_CY_PRE_set);
+OP_FN(op_CY_RES_get);
+OP_FN(op_CY_REV_get);
+OP_FN(op_DEL_CLR_get);
+OP_FN(op_DEVICE_FLIP_get);
+OP_FN(op_DIV_get);
+OP_FN(op_DRUNK_get);
+OP_FN(op_DRUNK_set);
+OP_FN(op_EQ_get);
+OP_FN(op_ER_get);
+OP_FN(op_ES_CV_get);
+OP_FN(op_EXP_get);
+OP_FN(op_EX_ALG_get);
+OP_FN(op_EX_ALG_set);
+OP_FN(op_EX_ALLOFF_get);
+OP_FN(op_EX_AL_CLK_get);
+OP_FN(op_EX_AL_P_get);
+OP_FN(op_EX_CTRL_get);
+OP_FN(op_EX_LP_CLR_get);
+OP_FN(op_EX_LP_DOWNQ_get);
+OP_FN(op_EX_LP_DOWN_get);
+OP_FN(op_EX_LP_PLAY_get);
+OP_FN(op_EX_LP_REC_get);
+OP_FN(op_EX_LP_REVQ_get);
+OP_FN(op_EX_LP_REV_get);
+OP_FN(op_EX_LP_get);
+OP_FN(op_EX_MAX_get);
+OP_FN(op_EX_MIN_get);
+OP_FN(op_EX_M_CC_get);
+OP_FN(op_EX_M_CH_get);
+OP_FN(op_EX_M_CH_set);
+OP_FN(op_EX_M_CLK_get);
+OP_FN(op_EX_M_CONT_get);
+OP_FN(op_EX_M_NO_get);
+OP_FN(op_EX_M_N_get);
+OP_FN(op_EX_M_PB_get);
+OP_FN(op_EX_M_PRG_get);
+OP_FN(op_EX_M_START_get);
+OP_FN(op_EX_M_STOP_get);
+OP_FN(op_EX_NOTE_O_get);
+OP_FN(op_EX_NOTE_get);
+OP_FN(op_EX_PARAM_get);
+OP_FN(op_EX_PARAM_set);
+OP_FN(op_EX_PLAY_get);
+OP_FN(op_EX_PRESET_get);
+OP_FN(op_EX_PRESET_set);
+OP_FN(op_EX_PV_get);
+OP_FN(op_EX_REC_get);
+OP_FN(op_EX_RESET_get);
+OP_FN(op_EX_SAVE_get);
+OP_FN(op_EX_SB_CC_get);
+OP_FN(op_EX_SB_CH_get);
+OP_FN(op_EX_SB_CH_set);
+OP_FN(op_EX_SB_CLK_get);
+OP_FN(op_EX_SB_CONT_get);
+OP_FN(op_EX_SB_NO_get);
+OP_FN(op_EX_SB_N_get);
+OP_FN(op_EX_SB_PB_get);
+OP_FN(op_EX_SB_PRG_get);
+OP_FN(op_EX_SB_START_get);
+OP_FN(op_EX_SB_STOP_get);
+OP_FN(op_EX_TV_get);
+OP_FN(op_EX_T_get);
+OP_FN(op_EX_VOX_O_get);
+OP_FN(op_EX_VOX_P_get);
+OP_FN(op_EX_VOX_get);
+OP_FN(op_EX_get);
+OP_FN(op_EX_set);
+OP_FN(op_EZ_get);
+OP_FN(op_FADER_CAL_MAX_set);
+OP_FN(op_FADER_CAL_MIN_set);
+OP_FN(op_FADER_CAL_RESET_set);
+OP_FN(op_FADER_SCALE_set);
+OP_FN(op_FADER_get);
+OP_FN(op_FLIP_get);
+OP_FN(op_FLIP_set);
+OP_FN(op_GTE_get);
+OP_FN(op_GT_get);
+OP_FN(op_G_BTNI_get);
+OP_FN(op_G_BTNL_get);
+OP_FN(op_G_BTNL_set);
+OP_FN(op_G_BTNV_get);
+OP_FN(op_G_BTNV_set);
+OP_FN(op_G_BTNX_get);
+OP_FN(op_G_BTNX_set);
+OP_FN(op_G_BTNY_get);
+OP_FN(op_G_BTNY_set);
+OP_FN(op_G_BTN_EN_get);
+OP_FN(op_G_BTN_EN_set);
+OP_FN(op_G_BTN_L_get);
+OP_FN(op_G_BTN_L_set);
+OP_FN(op_G_BTN_PR_get);
+OP_FN(op_G_BTN_SW_get);
+OP_FN(op_G_BTN_V_get);
+OP_FN(op_G_BTN_V_set);
+OP_FN(op_G_BTN_X_get);
+OP_FN(op_G_BTN_X_set);
+OP_FN(op_G_BTN_Y_get);
+OP_FN(op_G_BTN_Y_set);
+OP_FN(op_G_BTN_get);
+OP_FN(op_G_BTX_get);
+OP_FN(op_G_CLR_get);
+OP_FN(op_G_DIM_get);
+OP_FN(op_G_FDRI_get);
+OP_FN(op_G_FDRL_get);
+OP_FN(op_G_FDRL_set);
+OP_FN(op_G_FDRN_get);
+OP_FN(op_G_FDRN_set);
+OP_FN(op_G_FDRV_get);
+OP_FN(op_G_FDRV_set);
+OP_FN(op_G_FDRX_get);
+OP_FN(op_G_FDRX_set);
+OP_FN(op_G_FDRY_get);
+OP_FN(op_G_FDRY_set);
+OP_FN(op_G_FDR_EN_get);
+OP_FN(op_G_FDR_EN_set);
+OP_FN(op_G_FDR_L_get);
+OP_FN(op_G_FDR_L_set);
+OP_FN(op_G_FDR_N_get);
+OP_FN(op_G_FDR_N_set);
+OP_FN(op_G_FDR_PR_get);
+OP_FN(op_G_FDR_V_get);
+OP_FN(op_G_FDR_V_set);
+OP_FN(op_G_FDR_X_get);
+OP_FN(op_G_FDR_X_set);
+OP_FN(op_G_FDR_Y_get);
+OP_FN(op_G_FDR_Y_set);
+OP_FN(op_G_FDR_get);
+OP_FN(op_G_FDX_get);
+OP_FN(op_G_GBTN_C_get);
+OP_FN(op_G_GBTN_H_get);
+OP_FN(op_G_GBTN_I_get);
+OP_FN(op_G_GBTN_L_get);
+OP_FN(op_G_GBTN_V_get);
+OP_FN(op_G_GBTN_W_get);
+OP_FN(op_G_GBTN_X1_get);
+OP_FN(op_G_GBTN_X2_get);
+OP_FN(op_G_GBTN_Y1_get);
+OP_FN(op_G_GBTN_Y2_get);
+OP_FN(op_G_GBT_get);
+OP_FN(op_G_GBX_get);
+OP_FN(op_G_GFDR_L_get);
+OP_FN(op_G_GFDR_N_get);
+OP_FN(op_G_GFDR_RN_get);
+OP_FN(op_G_GFDR_V_get);
+OP_FN(op_G_GFD_get);
+OP_FN(op_G_GFX_get);
+OP_FN(op_G_GRPI_get);
+OP_FN(op_G_GRP_EN_get);
+OP_FN(op_G_GRP_EN_set);
+OP_FN(op_G_GRP_RST_get);
+OP_FN(op_G_GRP_SC_get);
+OP_FN(op_G_GRP_SC_set);
+OP_FN(op_G_GRP_SW_get);
+OP_FN(op_G_GRP_get);
+OP_FN(op_G_GRP_set);
+OP_FN(op_G_KEY_get);
+OP_FN(op_G_LED_C_get);
+OP_FN(op_G_LED_get);
+OP_FN(op_G_LED_set);
+OP_FN(op_G_RCT_get);
+OP_FN(op_G_REC_get);
+OP_FN(op_G_ROTATE_get);
+OP_FN(op_G_RST_get);
+OP_FN(op_G_XYP_X_get);
+OP_FN(op_G_XYP_Y_get);
+OP_FN(op_G_XYP_get);
+OP_FN(op_HZ_get);
+OP_FN(op_IIA_get);
+OP_FN(op_IIA_set);
+OP_FN(op_IIB1_get);
+OP_FN(op_IIB2_get);
+OP_FN(op_IIB3_get);
+OP_FN(op_IIBB1_get);
+OP_FN(op_IIBB2_get);
+OP_FN(op_IIBB3_get);
+OP_FN(op_IIB_get);
+OP_FN(op_IIQ1_get);
+OP_FN(op_IIQ2_get);
+OP_FN(op_IIQ3_get);
+OP_FN(op_IIQB1_get);
+OP_FN(op_IIQB2_get);
+OP_FN(op_IIQB3_get);
+OP_FN(op_IIQ_get);
+OP_FN(op_IIS1_get);
+OP_FN(op_IIS2_get);
+OP_FN(op_IIS3_get);
+OP_FN(op_IISB1_get);
+OP_FN(op_IISB2_get);
+OP_FN(op_IISB3_get);
+OP_FN(op_IIS_get);
+OP_FN(op_INIT_CV_ALL_get);
+OP_FN(op_INIT_CV_get);
+OP_FN(op_INIT_DATA_get);
+OP_FN(op_INIT_P_ALL_get);
+OP_FN(op_INIT_P_get);
+OP_FN(op_INIT_SCENE_get);
+OP_FN(op_INIT_SCRIPT_ALL_get);
+OP_FN(op_INIT_SCRIPT_get);
+OP_FN(op_INIT_TIME_get);
+OP_FN(op_INIT_TR_ALL_get);
+OP_FN(op_INIT_TR_get);
+OP_FN(op_INIT_get);
+OP_FN(op_INRI_get);
+OP_FN(op_INR_get);
+OP_FN(op_IN_CAL_MAX_set);
+OP_FN(op_IN_CAL_MIN_set);
+OP_FN(op_IN_CAL_RESET_set);
+OP_FN(op_IN_SCALE_set);
+OP_FN(op_IN_get);
+OP_FN(op_I_get);
+OP_FN(op_I_set);
+OP_FN(op_JF_ADDR_get);
+OP_FN(op_JF_CURVE_get);
+OP_FN(op_JF_FM_get);
+OP_FN(op_JF_GOD_get);
+OP_FN(op_JF_INTONE_get);
+OP_FN(op_JF_MODE_get);
+OP_FN(op_JF_NOTE_get);
+OP_FN(op_JF_PITCH_get);
+OP_FN(op_JF_POLY_RESET_get);
+OP_FN(op_JF_POLY_get);
+OP_FN(op_JF_QT_get);
+OP_FN(op_JF_RAMP_get);
+OP_FN(op_JF_RMODE_get);
+OP_FN(op_JF_RUN_get);
+OP_FN(op_JF_SEL_get);
+OP_FN(op_JF_SHIFT_get);
+OP_FN(op_JF_SPEED_get);
+OP_FN(op_JF_TICK_get);
+OP_FN(op_JF_TIME_get);
+OP_FN(op_JF_TR_get);
+OP_FN(op_JF_TSC_get);
+OP_FN(op_JF_TUNE_get);
+OP_FN(op_JF_VOX_get);
+OP_FN(op_JF_VTR_get);
+OP_FN(op_JI_get);
+OP_FN(op_J_get);
+OP_FN(op_J_set);
+OP_FN(op_KILL_get);
+OP_FN(op_KR_CLK_get);
+OP_FN(op_KR_CUE_get);
+OP_FN(op_KR_CUE_set);
+OP_FN(op_KR_CV_get);
+OP_FN(op_KR_DIR_get);
+OP_FN(op_KR_DIR_set);
+OP_FN(op_KR_DUR_get);
+OP_FN(op_KR_L_LEN_get);
+OP_FN(op_KR_L_LEN_set);
+OP_FN(op_KR_L_ST_get);
+OP_FN(op_KR_L_ST_set);
+OP_FN(op_KR_MUTE_get);
+OP_FN(op_KR_MUTE_set);
+OP_FN(op_KR_PAT_get);
+OP_FN(op_KR_PAT_set);
+OP_FN(op_KR_PERIOD_get);
+OP_FN(op_KR_PERIOD_set);
+OP_FN(op_KR_PG_get);
+OP_FN(op_KR_PG_set);
+OP_FN(op_KR_POS_get);
+OP_FN(op_KR_POS_set);
+OP_FN(op_KR_PRE_get);
+OP_FN(op_KR_PRE_set);
+OP_FN(op_KR_RES_get);
+OP_FN(op_KR_SCALE_get);
+OP_FN(op_KR_SCALE_set);
+OP_FN(op_KR_TMUTE_get);
+OP_FN(op_K_get);
+OP_FN(op_K_set);
+OP_FN(op_LAST_get);
+OP_FN(op_LIM_get);
+OP_FN(op_LIVE_DASH_get);
+OP_FN(op_LIVE_GRID_get);
+OP_FN(op_LIVE_OFF_get);
+OP_FN(op_LIVE_VARS_get);
+OP_FN(op_LROT_get);
+OP_FN(op_LSH_get);
+OP_FN(op_LTE_get);
+OP_FN(op_LT_get);
+OP_FN(op_LV_CV_get);
+OP_FN(op_LV_L_DIR_get);
+OP_FN(op_LV_L_DIR_set);
+OP_FN(op_LV_L_LEN_get);
+OP_FN(op_LV_L_LEN_set);
+OP_FN(op_LV_L_ST_get);
+OP_FN(op_LV_L_ST_set);
+OP_FN(op_LV_POS_get);
+OP_FN(op_LV_POS_set);
+OP_FN(op_LV_PRE_get);
+OP_FN(op_LV_PRE_set);
+OP_FN(op_LV_RES_get);
+OP_FN(op_MAX_get);
+OP_FN(op_MA_CLR_get);
+OP_FN(op_MA_COL_get);
+OP_FN(op_MA_COL_set);
+OP_FN(op_MA_OFF_get);
+OP_FN(op_MA_ON_get);
+OP_FN(op_MA_PCLR_get);
+OP_FN(op_MA_PCOL_get);
+OP_FN(op_MA_PCOL_set);
+OP_FN(op_MA_PGM_get);
+OP_FN(op_MA_POFF_get);
+OP_FN(op_MA_PON_get);
+OP_FN(op_MA_PROW_get);
+OP_FN(op_MA_PROW_set);
+OP_FN(op_MA_PSET_get);
+OP_FN(op_MA_RESET_get);
+OP_FN(op_MA_ROW_get);
+OP_FN(op_MA_ROW_set);
+OP_FN(op_MA_SELECT_get);
+OP_FN(op_MA_SELECT_set);
+OP_FN(op_MA_SET_get);
+OP_FN(op_MA_STEP_get);
+OP_FN(op_ME_CV_get);
+OP_FN(op_ME_PERIOD_get);
+OP_FN(op_ME_PERIOD_set);
+OP_FN(op_ME_PRE_get);
+OP_FN(op_ME_PRE_set);
+OP_FN(op_ME_RES_get);
+OP_FN(op_ME_SCALE_get);
+OP_FN(op_ME_SCALE_set);
+OP_FN(op_ME_STOP_get);
+OP_FN(op_MID_SHIFT_get);
+OP_FN(op_MID_SLEW_get);
+OP_FN(op_MIN_get);
+OP_FN(op_MI_CCH_get);
+OP_FN(op_MI_CCV_get);
+OP_FN(op_MI_CC_get);
+OP_FN(op_MI_CLKD_get);
+OP_FN(op_MI_CLKD_set);
+OP_FN(op_MI_CLKR_get);
+OP_FN(op_MI_CL_get);
+OP_FN(op_MI_C_get);
+OP_FN(op_MI_LCCV_get);
+OP_FN(op_MI_LCC_get);
+OP_FN(op_MI_LCH_get);
+OP_FN(op_MI_LC_get);
+OP_FN(op_MI_LE_get);
+OP_FN(op_MI_LNV_get);
+OP_FN(op_MI_LN_get);
+OP_FN(op_MI_LO_get);
+OP_FN(op_MI_LVV_get);
+OP_FN(op_MI_LV_get);
+OP_FN(op_MI_NCH_get);
+OP_FN(op_MI_NL_get);
+OP_FN(op_MI_NV_get);
+OP_FN(op_MI_N_get);
+OP_FN(op_MI_OCH_get);
+OP_FN(op_MI_OL_get);
+OP_FN(op_MI_O_get);
+OP_FN(op_MI_SYM_DOLLAR_get);
+OP_FN(op_MI_SYM_DOLLAR_set);
+OP_FN(op_MI_VV_get);
+OP_FN(op_MI_V_get);
+OP_FN(op_MOD_get);
+OP_FN(op_MUL_get);
+OP_FN(op_MUTE_get);
+OP_FN(op_MUTE_set);
+OP_FN(op_M_ACT_get);
+OP_FN(op_M_ACT_set);
+OP_FN(op_M_RESET_get);
+OP_FN(op_M_SYM_EXCLAMATION_get);
+OP_FN(op_M_SYM_EXCLAMATION_set);
+OP_FN(op_M_get);
+OP_FN(op_M_set);
+OP_FN(op_NE_get);
+OP_FN(op_NR_get);
+OP_FN(op_NZ_get);
+OP_FN(op_N_BX_get);
+OP_FN(op_N_BX_set);
+OP_FN(op_N_B_get);
+OP_FN(op_N_B_set);
+OP_FN(op_N_CS_get);
+OP_FN(op_N_C_get);
+OP_FN(op_N_S_get);
+OP_FN(op_N_get);
+OP_FN(op_OR3_get);
+OP_FN(op_OR4_get);
+OP_FN(op_OR_get);
+OP_FN(op_OUTRI_get);
+OP_FN(op_OUTR_get);
+OP_FN(op_O_get);
+OP_FN(op_O_set);
+OP_FN(op_PARAM_CAL_MAX_set);
+OP_FN(op_PARAM_CAL_MIN_set);
+OP_FN(op_PARAM_CAL_RESET_set);
+OP_FN(op_PARAM_SCALE_set);
+OP_FN(op_PARAM_get);
+OP_FN(op_PN_ADDW_get);
+OP_FN(op_PN_ADD_get);
+OP_FN(op_PN_END_get);
+OP_FN(op_PN_END_set);
+OP_FN(op_PN_HERE_get);
+OP_FN(op_PN_HERE_set);
+OP_FN(op_PN_INS_get);
+OP_FN(op_PN_I_get);
+OP_FN(op_PN_I_set);
+OP_FN(op_PN_L_get);
+OP_FN(op_PN_L_set);
+OP_FN(op_PN_MAX_get);
+OP_FN(op_PN_MIN_get);
+OP_FN(op_PN_NEXT_get);
+OP_FN(op_PN_NEXT_set);
+OP_FN(op_PN_POP_get);
+OP_FN(op_PN_PREV_get);
+OP_FN(op_PN_PREV_set);
+OP_FN(op_PN_PUSH_get);
+OP_FN(op_PN_REV_get);
+OP_FN(op_PN_RM_get);
+OP_FN(op_PN_RND_get);
+OP_FN(op_PN_ROT_get);
+OP_FN(op_PN_SHUF_get);
+OP_FN(op_PN_START_get);
+OP_FN(op_PN_START_set);
+OP_FN(op_PN_SUBW_get);
+OP_FN(op_PN_SUB_get);
+OP_FN(op_PN_WRAP_get);
+OP_FN(op_PN_WRAP_set);
+OP_FN(op_PN_get);
+OP_FN(op_PN_set);
+OP_FN(op_PRINT_get);
+OP_FN(op_PRINT_set);
+OP_FN(op_PROF_CLR_get);
+OP_FN(op_PROF_DUMP_get);
+OP_FN(op_P_ADDW_get);
+OP_FN(op_P_ADD_get);
+OP_FN(op_P_END_get);
+OP_FN(op_P_END_set);
+OP_FN(op_P_HERE_get);
+OP_FN(op_P_HERE_set);
+OP_FN(op_P_INS_get);
+OP_FN(op_P_I_get);
+OP_FN(op_P_I_set);
+OP_FN(op_P_L_get);
+OP_FN(op_P_L_set);
+OP_FN(op_P_MAX_get);
+OP_FN(op_P_MIN_get);
+OP_FN(op_P_NEXT_get);
+OP_FN(op_P_NEXT_set);
+OP_FN(op_P_N_get);
+OP_FN(op_P_N_set);
+OP_FN(op_P_POP_get);
+OP_FN(op_P_PREV_get);
+OP_FN(op_P_PREV_set);
+OP_FN(op_P_PUSH_get);
+OP_FN(op_P_REV_get);
+OP_FN(op_P_RM_get);
+OP_FN(op_P_RND_get);
+OP_FN(op_P_ROT_get);
+OP_FN(op_P_SHUF_get);
+OP_FN(op_P_START_get);
+OP_FN(op_P_START_set);
+OP_FN(op_P_SUBW_get);
+OP_FN(op_P_SUB_get);
+OP_FN(op_P_WRAP_get);
+OP_FN(op_P_WRAP_set);
+OP_FN(op_P_get);
+OP_FN(op_P_set);
+OP_FN(op_QT_BX_get);
+OP_FN(op_QT_B_get);
+OP_FN(op_QT_CS_get);
+OP_FN(op_QT_S_get);
+OP_FN(op_QT_get);
+OP_FN(op_Q_2P_get);
+OP_FN(op_Q_2P_set);
+OP_FN(op_Q_ADD_get);
+OP_FN(op_Q_ADD_set);
+OP_FN(op_Q_AVG_get);
+OP_FN(op_Q_AVG_set);
+OP_FN(op_Q_CLR_get);
+OP_FN(op_Q_CLR_set);
+OP_FN(op_Q_DIV_get);
+OP_FN(op_Q_DIV_set);
+OP_FN(op_Q_GRW_get);
+OP_FN(op_Q_GRW_set);
+OP_FN(op_Q_I_get);
+OP_FN(op_Q_I_set);
+OP_FN(op_Q_MAX_get);
+OP_FN(op_Q_MAX_set);
+OP_FN(op_Q_MIN_get);
+OP_FN(op_Q_MIN_set);
+OP_FN(op_Q_MOD_get);
+OP_FN(op_Q_MOD_set);
+OP_FN(op_Q_MUL_get);
+OP_FN(op_Q_MUL_set);
+OP_FN(op_Q_N_get);
+OP_FN(op_Q_N_set);
+OP_FN(op_Q_P2_get);
+OP_FN(op_Q_P2_set);
+OP_FN(op_Q_REV_get);
+OP_FN(op_Q_RND_get);
+OP_FN(op_Q_RND_set);
+OP_FN(op_Q_SH_get);
+OP_FN(op_Q_SH_set);
+OP_FN(op_Q_SRT_get);
+OP_FN(op_Q_SRT_set);
+OP_FN(op_Q_SUB_get);
+OP_FN(op_Q_SUB_set);
+OP_FN(op_Q_SUM_get);
+OP_FN(op_Q_get);
+OP_FN(op_Q_set);
+OP_FN(op_RAND_get);
+OP_FN(op_RRAND_get);
+OP_FN(op_RROT_get);
+OP_FN(op_RSH_get);
+OP_FN(op_R_MAX_get);
+OP_FN(op_R_MAX_set);
+OP_FN(op_R_MIN_get);
+OP_FN(op_R_MIN_set);
+OP_FN(op_R_get);
+OP_FN(op_R_set);
+OP_FN(op_SCALE_get);
+OP_FN(op_SCENE_G_get);
+OP_FN(op_SCENE_P_get);
+OP_FN(op_SCENE_get);
+OP_FN(op_SCENE_set);
+OP_FN(op_SCRIPT_DROP_get);
+OP_FN(op_SCRIPT_DROP_set);
+OP_FN(op_SCRIPT_OVER_get);
+OP_FN(op_SCRIPT_OVER_set);
+OP_FN(op_SCRIPT_POL_get);
+OP_FN(op_SCRIPT_POL_set);
+OP_FN(op_SCRIPT_QP_get);
+OP_FN(op_SCRIPT_QP_set);
+OP_FN(op_SCRIPT_Q_get);
+OP_FN(op_SCRIPT_Q_set);
+OP_FN(op_SCRIPT_SLICE_get);
+OP_FN(op_SCRIPT_SLICE_set);
+OP_FN(op_SCRIPT_get);
+OP_FN(op_SCRIPT_set);
+OP_FN(op_SC_CV_OFF_get);
+OP_FN(op_SC_CV_SET_get);
+OP_FN(op_SC_CV_SLEW_get);
+OP_FN(op_SC_CV_get);
+OP_FN(op_SC_TR_POL_get);
+OP_FN(op_SC_TR_PULSE_get);
+OP_FN(op_SC_TR_TIME_get);
+OP_FN(op_SC_TR_TOG_get);
+OP_FN(op_SC_TR_get);
+OP_FN(op_SEED_get);
+OP_FN(op_SEED_set);
+OP_FN(op_SGN_get);
+OP_FN(op_STATE_get);
+OP_FN(op_SUB_get);
+OP_FN(op_SYNC_get);
+OP_FN(op_S_ALL_get);
+OP_FN(op_S_CLR_get);
+OP_FN(op_S_L_get);
+OP_FN(op_S_POP_get);
+OP_FN(op_TIF_get);
+OP_FN(op_TIME_ACT_get);
+OP_FN(op_TIME_ACT_set);
+OP_FN(op_TIME_get);
+OP_FN(op_TIME_set);
+OP_FN(op_TI_INIT_get);
+OP_FN(op_TI_IN_CALIB_get);
+OP_FN(op_TI_IN_INIT_get);
+OP_FN(op_TI_IN_MAP_get);
+OP_FN(op_TI_IN_N_get);
+OP_FN(op_TI_IN_QT_get);
+OP_FN(op_TI_IN_SCALE_get);
+OP_FN(op_TI_IN_get);
+OP_FN(op_TI_PARAM_CALIB_get);
+OP_FN(op_TI_PARAM_INIT_get);
+OP_FN(op_TI_PARAM_MAP_get);
+OP_FN(op_TI_PARAM_N_get);
+OP_FN(op_TI_PARAM_QT_get);
+OP_FN(op_TI_PARAM_SCALE_get);
+OP_FN(op_TI_PARAM_get);
+OP_FN(op_TI_RESET_get);
+OP_FN(op_TI_STORE_get);
+OP_FN(op_TOSS_get);
+OP_FN(op_TO_CV_CALIB_get);
+OP_FN(op_TO_CV_INIT_get);
+OP_FN(op_TO_CV_LOG_get);
+OP_FN(op_TO_CV_N_SET_get);
+OP_FN(op_TO_CV_N_get);
+OP_FN(op_TO_CV_OFF_get);
+OP_FN(op_TO_CV_QT_SET_get);
+OP_FN(op_TO_CV_QT_get);
+OP_FN(op_TO_CV_RESET_get);
+OP_FN(op_TO_CV_SCALE_get);
+OP_FN(op_TO_CV_SET_get);
+OP_FN(op_TO_CV_SLEW_M_get);
+OP_FN(op_TO_CV_SLEW_S_get);
+OP_FN(op_TO_CV_SLEW_get);
+OP_FN(op_TO_CV_get);
+OP_FN(op_TO_ENV_ACT_get);
+OP_FN(op_TO_ENV_ATT_M_get);
+OP_FN(op_TO_ENV_ATT_S_get);
+OP_FN(op_TO_ENV_ATT_get);
+OP_FN(op_TO_ENV_DEC_M_get);
+OP_FN(op_TO_ENV_DEC_S_get);
+OP_FN(op_TO_ENV_DEC_get);
+OP_FN(op_TO_ENV_EOC_get);
+OP_FN(op_TO_ENV_EOR_get);
+OP_FN(op_TO_ENV_LOOP_get);
+OP_FN(op_TO_ENV_TRIG_get);
+OP_FN(op_TO_ENV_get);
+OP_FN(op_TO_INIT_get);
+OP_FN(op_TO_KILL_get);
+OP_FN(op_TO_M_ACT_get);
+OP_FN(op_TO_M_BPM_get);
+OP_FN(op_TO_M_COUNT_get);
+OP_FN(op_TO_M_M_get);
+OP_FN(op_TO_M_SYNC_get);
+OP_FN(op_TO_M_S_get);
+OP_FN(op_TO_M_get);
+OP_FN(op_TO_OSC_CTR_get);
+OP_FN(op_TO_OSC_CYC_M_SET_get);
+OP_FN(op_TO_OSC_CYC_M_get);
+OP_FN(op_TO_OSC_CYC_SET_get);
+OP_FN(op_TO_OSC_CYC_S_SET_get);
+OP_FN(op_TO_OSC_CYC_S_get);
+OP_FN(op_TO_OSC_CYC_get);
+OP_FN(op_TO_OSC_FQ_SET_get);
+OP_FN(op_TO_OSC_FQ_get);
+OP_FN(op_TO_OSC_LFO_SET_get);
+OP_FN(op_TO_OSC_LFO_get);
+OP_FN(op_TO_OSC_N_SET_get);
+OP_FN(op_TO_OSC_N_get);
+OP_FN(op_TO_OSC_PHASE_get);
+OP_FN(op_TO_OSC_QT_SET_get);
+OP_FN(op_TO_OSC_QT_get);
+OP_FN(op_TO_OSC_RECT_get);
+OP_FN(op_TO_OSC_SCALE_get);
+OP_FN(op_TO_OSC_SET_get);
+OP_FN(op_TO_OSC_SLEW_M_get);
+OP_FN(op_TO_OSC_SLEW_S_get);
+OP_FN(op_TO_OSC_SLEW_get);
+OP_FN(op_TO_OSC_SYNC_get);
+OP_FN(op_TO_OSC_WAVE_get);
+OP_FN(op_TO_OSC_WIDTH_get);
+OP_FN(op_TO_OSC_get);
+OP_FN(op_TO_TR_INIT_get);
+OP_FN(op_TO_TR_M_ACT_get);
+OP_FN(op_TO_TR_M_BPM_get);
+OP_FN(op_TO_TR_M_COUNT_get);
+OP_FN(op_TO_TR_M_MUL_get);
+OP_FN(op_TO_TR_M_M_get);
+OP_FN(op_TO_TR_M_SYNC_get);
+OP_FN(op_TO_TR_M_S_get);
+OP_FN(op_TO_TR_M_get);
+OP_FN(op_TO_TR_POL_get);
+OP_FN(op_TO_TR_PULSE_DIV_get);
+OP_FN(op_TO_TR_PULSE_MUTE_get);
+OP_FN(op_TO_TR_PULSE_get);
+OP_FN(op_TO_TR_TIME_M_get);
+OP_FN(op_TO_TR_TIME_S_get);
+OP_FN(op_TO_TR_TIME_get);
+OP_FN(op_TO_TR_TOG_get);
+OP_FN(op_TO_TR_WIDTH_get);
+OP_FN(op_TO_TR_get);
+OP_FN(op_TR_POL_get);
+OP_FN(op_TR_POL_set);
+OP_FN(op_TR_PULSE_get);
+OP_FN(op_TR_TIME_get);
+OP_FN(op_TR_TIME_set);
+OP_FN(op_TR_TOG_get);
+OP_FN(op_TR_get);
+OP_FN(op_TR_set);
+OP_FN(op_TURTLE_BOUNCE_get);
+OP_FN(op_TURTLE_BOUNCE_set);
+OP_FN(op_TURTLE_BUMP_get);
+OP_FN(op_TURTLE_BUMP_set);
+OP_FN(op_TURTLE_DIR_get);
+OP_FN(op_TURTLE_DIR_set);
+OP_FN(op_TURTLE_FX1_get);
+OP_FN(op_TURTLE_FX1_set);
+OP_FN(op_TURTLE_FX2_get);
+OP_FN(op_TURTLE_FX2_set);
+OP_FN(op_TURTLE_FY1_get);
+OP_FN(op_TURTLE_FY1_set);
+OP_FN(op_TURTLE_FY2_get);
+OP_FN(op_TURTLE_FY2_set);
+OP_FN(op_TURTLE_F_get);
+OP_FN(op_TURTLE_MOVE_get);
+OP_FN(op_TURTLE_SCRIPT_get);
+OP_FN(op_TURTLE_SCRIPT_set);
+OP_FN(op_TURTLE_SHOW_get);
+OP_FN(op_TURTLE_SHOW_set);
+OP_FN(op_TURTLE_SPEED_get);
+OP_FN(op_TURTLE_SPEED_set);
+OP_FN(op_TURTLE_STEP_get);
+OP_FN(op_TURTLE_WRAP_get);
+OP_FN(op_TURTLE_WRAP_set);
+OP_FN(op_TURTLE_X_get);
+OP_FN(op_TURTLE_X_set);
+OP_FN(op_TURTLE_Y_get);
+OP_FN(op_TURTLE_Y_set);
+OP_FN(op_TURTLE_get);
+OP_FN(op_TURTLE_set);
+OP_FN(op_VN_get);
+OP_FN(op_VV_get);
+OP_FN(op_V_get);
+OP_FN(op_WRAP_get);
+OP_FN(op_WS_CUE_get);
+OP_FN(op_WS_CUE_set);
+OP_FN(op_WS_D_CLK_RATIO_write);
+OP_FN(op_WS_D_CLK_write);
+OP_FN(op_WS_D_CUT_write);
+OP_FN(op_WS_D_FEEDBACK_recv);
+OP_FN(op_WS_D_FEEDBACK_write);
+OP_FN(op_WS_D_FREEZE_recv);
+OP_FN(op_WS_D_FREEZE_write);
+OP_FN(op_WS_D_FREQ_RANGE_write);
+OP_FN(op_WS_D_FREQ_recv);
+OP_FN(op_WS_D_FREQ_write);
+OP_FN(op_WS_D_LENGTH_write);
+OP_FN(op_WS_D_LOWPASS_recv);
+OP_FN(op_WS_D_LOWPASS_write);
+OP_FN(op_WS_D_MIX_recv);
+OP_FN(op_WS_D_MIX_write);
+OP_FN(op_WS_D_MOD_AMOUNT_recv);
+OP_FN(op_WS_D_MOD_AMOUNT_write);
+OP_FN(op_WS_D_MOD_RATE_recv);
+OP_FN(op_WS_D_MOD_RATE_write);
+OP_FN(op_WS_D_PLUCK_write);
+OP_FN(op_WS_D_POSITION_write);
+OP_FN(op_WS_D_RATE_recv);
+OP_FN(op_WS_D_RATE_write);
+OP_FN(op_WS_D_TIME_recv);
+OP_FN(op_WS_D_TIME_write);
+OP_FN(op_WS_LOOP_get);
+OP_FN(op_WS_LOOP_set);
+OP_FN(op_WS_PLAY_get);
+OP_FN(op_WS_PLAY_set);
+OP_FN(op_WS_REC_get);
+OP_FN(op_WS_REC_set);
+OP_FN(op_WS_S_AR_MODE_recv);
+OP_FN(op_WS_S_AR_MODE_write);
+OP_FN(op_WS_S_CURVE_recv);
+OP_FN(op_WS_S_CURVE_write);
+OP_FN(op_WS_S_FM_ENV_recv);
+OP_FN(op_WS_S_FM_ENV_write);
+OP_FN(op_WS_S_FM_INDEX_recv);
+OP_FN(op_WS_S_FM_INDEX_write);
+OP_FN(op_WS_S_FM_RATIO_write);
+OP_FN(op_WS_S_LPG_SYMMETRY_recv);
+OP_FN(op_WS_S_LPG_SYMMETRY_write);
+OP_FN(op_WS_S_LPG_TIME_recv);
+OP_FN(op_WS_S_LPG_TIME_write);
+OP_FN(op_WS_S_NOTE_write);
+OP_FN(op_WS_S_PATCH_write);
+OP_FN(op_WS_S_PITCH_write);
+OP_FN(op_WS_S_RAMP_recv);
+OP_FN(op_WS_S_RAMP_write);
+OP_FN(op_WS_S_VEL_write);
+OP_FN(op_WS_S_VOICES_recv);
+OP_FN(op_WS_S_VOICES_write);
+OP_FN(op_WS_S_VOX_write);
+OP_FN(op_WS_T_CLEARTAPE_write);
+OP_FN(op_WS_T_FREQ_recv);
+OP_FN(op_WS_T_FREQ_write);
+OP_FN(op_WS_T_HEAD_ORDER_recv);
+OP_FN(op_WS_T_HEAD_ORDER_write);
+OP_FN(op_WS_T_LOOP_ACTIVE_write);
+OP_FN(op_WS_T_LOOP_END_write);
+OP_FN(op_WS_T_LOOP_NEXT_write);
+OP_FN(op_WS_T_LOOP_SCALE_recv);
+OP_FN(op_WS_T_LOOP_SCALE_write);
+OP_FN(op_WS_T_LOOP_START_write);
+OP_FN(op_WS_T_MONITOR_LEVEL_recv);
+OP_FN(op_WS_T_MONITOR_LEVEL_write);
+OP_FN(op_WS_T_PLAY_recv);
+OP_FN(op_WS_T_PLAY_write);
+OP_FN(op_WS_T_PRE_LEVEL_recv);
+OP_FN(op_WS_T_PRE_LEVEL_write);
+OP_FN(op_WS_T_RECORD_recv);
+OP_FN(op_WS_T_RECORD_write);
+OP_FN(op_WS_T_REC_LEVEL_recv);
+OP_FN(op_WS_T_REC_LEVEL_write);
+OP_FN(op_WS_T_REV_write);
+OP_FN(op_WS_T_SEEK_write);
+OP_FN(op_WS_T_SPEED_write);
+OP_FN(op_WS_T_TIMESTAMP_write);
+OP_FN(op_peek_i16);
+OP_FN(op_peek_seed_i16);
+OP_FN(op_poke_i16);
+OP_FN(op_poke_seed_i16);
+OP_FN(op_simple_i2c);
+#undef OP_FN
+
+const tele_op_fn_t tele_op_get[E_OP__LENGTH] = {
+    op_peek_i16,  // A
+    op_peek_i16,  // B
+    op_peek_i16,  // C
+    op_peek_i16,  // D
+    op_DRUNK_get,  // DRUNK
+    op_peek_i16,  // DRUNK_MAX
+    op_peek_i16,  // DRUNK_MIN
+    op_peek_i16,  // DRUNK_WRAP
+    op_FLIP_get,  // FLIP
+    op_I_get,  // I
+    op_O_get,  // O
+    op_peek_i16,  // O_INC
+    op_peek_i16,  // O_MAX
+    op_peek_i16,  // O_MIN
+    op_peek_i16,  // O_WRAP
+    op_peek_i16,  // T
+    op_TIME_get,  // TIME
+    op_TIME_ACT_get,  // TIME_ACT
+    op_LAST_get,  // LAST
+    op_peek_i16,  // X
+    op_peek_i16,  // Y
+    op_peek_i16,  // Z
+    op_J_get,  // J
+    op_K_get,  // K
+    op_INIT_get,  // INIT
+    op_INIT_SCENE_get,  // INIT_SCENE
+    op_INIT_SCRIPT_get,  // INIT_SCRIPT
+    op_INIT_SCRIPT_ALL_get,  // INIT_SCRIPT_ALL
+    op_INIT_P_get,  // INIT_P
+    op_INIT_P_ALL_get,  // INIT_P_ALL
+    op_INIT_CV_get,  // INIT_CV
+    op_INIT_CV_ALL_get,  // INIT_CV_ALL
+    op_INIT_TR_get,  // INIT_TR
+    op_INIT_TR_ALL_get,  // INIT_TR_ALL
+    op_INIT_DATA_get,  // INIT_DATA
+    op_INIT_TIME_get,  // INIT_TIME
+    op_TURTLE_get,  // TURTLE
+    op_TURTLE_X_get,  // TURTLE_X
+    op_TURTLE_Y_get,  // TURTLE_Y
+    op_TURTLE_MOVE_get,  // TURTLE_MOVE
+    op_TURTLE_F_get,  // TURTLE_F
+    op_TURTLE_FX1_get,  // TURTLE_FX1
+    op_TURTLE_FY1_get,  // TURTLE_FY1
+    op_TURTLE_FX2_get,  // TURTLE_FX2
+    op_TURTLE_FY2_get,  // TURTLE_FY2
+    op_TURTLE_SPEED_get,  // TURTLE_SPEED
+    op_TURTLE_DIR_get,  // TURTLE_DIR
+    op_TURTLE_STEP_get,  // TURTLE_STEP
+    op_TURTLE_BUMP_get,  // TURTLE_BUMP
+    op_TURTLE_WRAP_get,  // TURTLE_WRAP
+    op_TURTLE_BOUNCE_get,  // TURTLE_BOUNCE
+    op_TURTLE_SCRIPT_get,  // TURTLE_SCRIPT
+    op_TURTLE_SHOW_get,  // TURTLE_SHOW
+    op_M_get,  // M
+    op_M_SYM_EXCLAMATION_get,  // M_SYM_EXCLAMATION
+    op_M_ACT_get,  // M_ACT
+    op_M_RESET_get,  // M_RESET
+    op_P_N_get,  // P_N
+    op_P_get,  // P
+    op_PN_get,  // PN
+    op_P_L_get,  // P_L
+    op_PN_L_get,  // PN_L
+    op_P_WRAP_get,  // P_WRAP
+    op_PN_WRAP_get,  // PN_WRAP
+    op_P_START_get,  // P_START
+    op_PN_START_get,  // PN_START
+    op_P_END_get,  // P_END
+    op_PN_END_get,  // PN_END
+    op_P_I_get,  // P_I
+    op_PN_I_get,  // PN_I
+    op_P_HERE_get,  // P_HERE
+    op_PN_HERE_get,  // PN_HERE
+    op_P_NEXT_get,  // P_NEXT
+    op_PN_NEXT_get,  // PN_NEXT
+    op_P_PREV_get,  // P_PREV
+    op_PN_PREV_get,  // PN_PREV
+    op_P_INS_get,  // P_INS
+    op_PN_INS_get,  // PN_INS
+    op_P_RM_get,  // P_RM
+    op_PN_RM_get,  // PN_RM
+    op_P_PUSH_get,  // P_PUSH
+    op_PN_PUSH_get,  // PN_PUSH
+    op_P_POP_get,  // P_POP
+    op_PN_POP_get,  // PN_POP
+    op_P_MIN_get,  // P_MIN
+    op_PN_MIN_get,  // PN_MIN
+    op_P_MAX_get,  // P_MAX
+    op_PN_MAX_get,  // PN_MAX
+    op_P_SHUF_get,  // P_SHUF
+    op_PN_SHUF_get,  // PN_SHUF
+    op_P_REV_get,  // P_REV
+    op_PN_REV_get,  // PN_REV
+    op_P_ROT_get,  // P_ROT
+    op_PN_ROT_get,  // PN_ROT
+    op_P_RND_get,  // P_RND
+    op_PN_RND_get,  // PN_RND
+    op_P_ADD_get,  // P_ADD
+    op_PN_ADD_get,  // PN_ADD
+    op_P_SUB_get,  // P_SUB
+    op_PN_SUB_get,  // PN_SUB
+    op_P_ADDW_get,  // P_ADDW
+    op_PN_ADDW_get,  // PN_ADDW
+    op_P_SUBW_get,  // P_SUBW
+    op_PN_SUBW_get,  // PN_SUBW
+    op_Q_get,  // Q
+    op_Q_AVG_get,  // Q_AVG
+    op_Q_N_get,  // Q_N
+    op_Q_CLR_get,  // Q_CLR
+    op_Q_GRW_get,  // Q_GRW
+    op_Q_SUM_get,  // Q_SUM
+    op_Q_MIN_get,  // Q_MIN
+    op_Q_MAX_get,  // Q_MAX
+    op_Q_RND_get,  // Q_RND
+    op_Q_SRT_get,  // Q_SRT
+    op_Q_REV_get,  // Q_REV
+    op_Q_SH_get,  // Q_SH
+    op_Q_ADD_get,  // Q_ADD
+    op_Q_SUB_get,  // Q_SUB
+    op_Q_MUL_get,  // Q_MUL
+    op_Q_DIV_get,  // Q_DIV
+    op_Q_MOD_get,  // Q_MOD
+    op_Q_I_get,  // Q_I
+    op_Q_2P_get,  // Q_2P
+    op_Q_P2_get,  // Q_P2
+    op_CV_get,  // CV
+    op_CV_OFF_get,  // CV_OFF
+    op_CV_SLEW_get,  // CV_SLEW
+    op_IN_get,  // IN
+    op_IN_SCALE_set,  // IN_SCALE
+    op_PARAM_get,  // PARAM
+    op_PARAM_SCALE_set,  // PARAM_SCALE
+    op_IN_CAL_MIN_set,  // IN_CAL_MIN
+    op_IN_CAL_MAX_set,  // IN_CAL_MAX
+    op_IN_CAL_RESET_set,  // IN_CAL_RESET
+    op_PARAM_CAL_MIN_set,  // PARAM_CAL_MIN
+    op_PARAM_CAL_MAX_set,  // PARAM_CAL_MAX
+    op_PARAM_CAL_RESET_set,  // PARAM_CAL_RESET
+    op_PARAM_get,  // PRM
+    op_TR_get,  // TR
+    op_TR_POL_get,  // TR_POL
+    op_TR_TIME_get,  // TR_TIME
+    op_TR_TOG_get,  // TR_TOG
+    op_TR_PULSE_get,  // TR_PULSE
+    op_TR_PULSE_get,  // TR_P
+    op_CV_SET_get,  // CV_SET
+    op_MUTE_get,  // MUTE
+    op_STATE_get,  // STATE
+    op_DEVICE_FLIP_get,  // DEVICE_FLIP
+    op_LIVE_OFF_get,  // LIVE_OFF
+    op_LIVE_OFF_get,  // LIVE_O
+    op_LIVE_DASH_get,  // LIVE_DASH
+    op_LIVE_DASH_get,  // LIVE_D
+    op_LIVE_GRID_get,  // LIVE_GRID
+    op_LIVE_GRID_get,  // LIVE_G
+    op_LIVE_VARS_get,  // LIVE_VARS
+    op_LIVE_VARS_get,  // LIVE_V
+    op_PRINT_get,  // PRINT
+    op_PRINT_get,  // PRT
+    op_PROF_DUMP_get,  // PROF_DUMP
+    op_PROF_CLR_get,  // PROF_CLR
+    op_ADD_get,  // ADD
+    op_SUB_get,  // SUB
+    op_MUL_get,  // MUL
+    op_DIV_get,  // DIV
+    op_MOD_get,  // MOD
+    op_RAND_get,  // RAND
+    op_RAND_get,  // RND
+    op_RRAND_get,  // RRAND
+    op_RRAND_get,  // RRND
+    op_R_get,  // R
+    op_R_MIN_get,  // R_MIN
+    op_R_MAX_get,  // R_MAX
+    op_TOSS_get,  // TOSS
+    op_MIN_get,  // MIN
+    op_MAX_get,  // MAX
+    op_LIM_get,  // LIM
+    op_WRAP_get,  // WRAP
+    op_WRAP_get,  // WRP
+    op_QT_get,  // QT
+    op_QT_S_get,  // QT_S
+    op_QT_CS_get,  // QT_CS
+    op_QT_B_get,  // QT_B
+    op_QT_BX_get,  // QT_BX
+    op_AVG_get,  // AVG
+    op_EQ_get,  // EQ
+    op_NE_get,  // NE
+    op_LT_get,  // LT
+    op_GT_get,  // GT
+    op_LTE_get,  // LTE
+    op_GTE_get,  // GTE
+    op_INR_get,  // INR
+    op_OUTR_get,  // OUTR
+    op_INRI_get,  // INRI
+    op_OUTRI_get,  // OUTRI
+    op_NZ_get,  // NZ
+    op_EZ_get,  // EZ
+    op_RSH_get,  // RSH
+    op_LSH_get,  // LSH
+    op_LROT_get,  // LROT
+    op_RROT_get,  // RROT
+    op_EXP_get,  // EXP
+    op_ABS_get,  // ABS
+    op_SGN_get,  // SGN
+    op_AND_get,  // AND
+    op_OR_get,  // OR
+    op_AND3_get,  // AND3
+    op_OR3_get,  // OR3
+    op_AND4_get,  // AND4
+    op_OR4_get,  // OR4
+    op_JI_get,  // JI
+    op_SCALE_get,  // SCALE
+    op_SCALE_get,  // SCL
+    op_N_get,  // N
+    op_VN_get,  // VN
+    op_HZ_get,  // HZ
+    op_N_S_get,  // N_S
+    op_N_C_get,  // N_C
+    op_N_CS_get,  // N_CS
+    op_N_B_get,  // N_B
+    op_N_BX_get,  // N_BX
+    op_V_get,  // V
+    op_VV_get,  // VV
+    op_ER_get,  // ER
+    op_NR_get,  // NR
+    op_BPM_get,  // BPM
+    op_BIT_OR_get,  // BIT_OR
+    op_BIT_AND_get,  // BIT_AND
+    op_BIT_NOT_get,  // BIT_NOT
+    op_BIT_XOR_get,  // BIT_XOR
+    op_BSET_get,  // BSET
+    op_BGET_get,  // BGET
+    op_BCLR_get,  // BCLR
+    op_BTOG_get,  // BTOG
+    op_BREV_get,  // BREV
+    op_NE_get,  // XOR
+    op_CHAOS_get,  // CHAOS
+    op_CHAOS_R_get,  // CHAOS_R
+    op_CHAOS_ALG_get,  // CHAOS_ALG
+    op_ADD_get,  // SYM_PLUS
+    op_SUB_get,  // SYM_DASH
+    op_MUL_get,  // SYM_STAR
+    op_DIV_get,  // SYM_FORWARD_SLASH
+    op_MOD_get,  // SYM_PERCENTAGE
+    op_EQ_get,  // SYM_EQUAL_x2
+    op_NE_get,  // SYM_EXCLAMATION_EQUAL
+    op_LT_get,  // SYM_LEFT_ANGLED
+    op_GT_get,  // SYM_RIGHT_ANGLED
+    op_LTE_get,  // SYM_LEFT_ANGLED_EQUAL
+    op_GTE_get,  // SYM_RIGHT_ANGLED_EQUAL
+    op_INR_get,  // SYM_RIGHT_ANGLED_LEFT_ANGLED
+    op_OUTR_get,  // SYM_LEFT_ANGLED_RIGHT_ANGLED
+    op_INRI_get,  // SYM_RIGHT_ANGLED_EQUAL_LEFT_ANGLED
+    op_OUTRI_get,  // SYM_LEFT_ANGLED_EQUAL_RIGHT_ANGLED
+    op_EZ_get,  // SYM_EXCLAMATION
+    op_LSH_get,  // SYM_LEFT_ANGLED_x2
+    op_RSH_get,  // SYM_RIGHT_ANGLED_x2
+    op_LROT_get,  // SYM_LEFT_ANGLED_x3
+    op_RROT_get,  // SYM_RIGHT_ANGLED_x3
+    op_AND_get,  // SYM_AMPERSAND_x2
+    op_OR_get,  // SYM_PIPE_x2
+    op_AND3_get,  // SYM_AMPERSAND_x3
+    op_OR3_get,  // SYM_PIPE_x3
+    op_AND4_get,  // SYM_AMPERSAND_x4
+    op_OR4_get,  // SYM_PIPE_x4
+    op_TIF_get,  // TIF
+    op_S_ALL_get,  // S_ALL
+    op_S_POP_get,  // S_POP
+    op_S_CLR_get,  // S_CLR
+    op_S_L_get,  // S_L
+    op_SCRIPT_get,  // SCRIPT
+    op_SCRIPT_get,  // SYM_DOLLAR
+    op_SCRIPT_POL_get,  // SCRIPT_POL
+    op_SCRIPT_POL_get,  // SYM_DOLLAR_POL
+    op_SCRIPT_SLICE_get,  // SCRIPT_SLICE
+    op_SCRIPT_SLICE_get,  // SYM_DOLLAR_SLICE
+    op_SCRIPT_Q_get,  // SCRIPT_Q
+    op_SCRIPT_Q_get,  // SYM_DOLLAR_Q
+    op_SCRIPT_QP_get,  // SCRIPT_QP
+    op_SCRIPT_QP_get,  // SYM_DOLLAR_QP
+    op_SCRIPT_DROP_get,  // SCRIPT_DROP
+    op_SCRIPT_DROP_get,  // SYM_DOLLAR_DROP
+    op_SCRIPT_OVER_get,  // SCRIPT_OVER
+    op_SCRIPT_OVER_get,  // SYM_DOLLAR_OVER
+    op_KILL_get,  // KILL
+    op_SCENE_get,  // SCENE
+    op_SCENE_G_get,  // SCENE_G
+    op_SCENE_P_get,  // SCENE_P
+    op_BREAK_get,  // BREAK
+    op_BREAK_get,  // BRK
+    op_SYNC_get,  // SYNC
+    op_DEL_CLR_get,  // DEL_CLR
+    op_IIA_get,  // IIA
+    op_IIS_get,  // IIS
+    op_IIS1_get,  // IIS1
+    op_IIS2_get,  // IIS2
+    op_IIS3_get,  // IIS3
+    op_IISB1_get,  // IISB1
+    op_IISB2_get,  // IISB2
+    op_IISB3_get,  // IISB3
+    op_IIQ_get,  // IIQ
+    op_IIQ1_get,  // IIQ1
+    op_IIQ2_get,  // IIQ2
+    op_IIQ3_get,  // IIQ3
+    op_IIQB1_get,  // IIQB1
+    op_IIQB2_get,  // IIQB2
+    op_IIQB3_get,  // IIQB3
+    op_IIB_get,  // IIB
+    op_IIB1_get,  // IIB1
+    op_IIB2_get,  // IIB2
+    op_IIB3_get,  // IIB3
+    op_IIBB1_get,  // IIBB1
+    op_IIBB2_get,  // IIBB2
+    op_IIBB3_get,  // IIBB3
+    op_simple_i2c,  // WW_PRESET
+    op_simple_i2c,  // WW_POS
+    op_simple_i2c,  // WW_SYNC
+    op_simple_i2c,  // WW_START
+    op_simple_i2c,  // WW_END
+    op_simple_i2c,  // WW_PMODE
+    op_simple_i2c,  // WW_PATTERN
+    op_simple_i2c,  // WW_QPATTERN
+    op_simple_i2c,  // WW_MUTE1
+    op_simple_i2c,  // WW_MUTE2
+    op_simple_i2c,  // WW_MUTE3
+    op_simple_i2c,  // WW_MUTE4
+    op_simple_i2c,  // WW_MUTEA
+    op_simple_i2c,  // WW_MUTEB
+    op_simple_i2c,  // MP_PRESET
+    op_simple_i2c,  // MP_RESET
+    op_simple_i2c,  // MP_STOP
+    op_simple_i2c,  // ES_PRESET
+    op_simple_i2c,  // ES_MODE
+    op_simple_i2c,  // ES_CLOCK
+    op_simple_i2c,  // ES_RESET
+    op_simple_i2c,  // ES_PATTERN
+    op_simple_i2c,  // ES_TRANS
+    op_simple_i2c,  // ES_STOP
+    op_simple_i2c,  // ES_TRIPLE
+    op_simple_i2c,  // ES_MAGIC
+    op_ES_CV_get,  // ES_CV
+    op_simple_i2c,  // OR_TRK
+    op_simple_i2c,  // OR_CLK
+    op_simple_i2c,  // OR_DIV
+    op_simple_i2c,  // OR_PHASE
+    op_simple_i2c,  // OR_RST
+    op_simple_i2c,  // OR_WGT
+    op_simple_i2c,  // OR_MUTE
+    op_simple_i2c,  // OR_SCALE
+    op_simple_i2c,  // OR_BANK
+    op_simple_i2c,  // OR_PRESET
+    op_simple_i2c,  // OR_RELOAD
+    op_simple_i2c,  // OR_ROTS
+    op_simple_i2c,  // OR_ROTW
+    op_simple_i2c,  // OR_GRST
+    op_simple_i2c,  // OR_CVA
+    op_simple_i2c,  // OR_CVB
+    op_ANS_G_LED_get,  // ANS_G_LED
+    op_ANS_G_get,  // ANS_G
+    op_ANS_G_P_get,  // ANS_G_P
+    op_ANS_A_LED_get,  // ANS_A_LED
+    op_ANS_A_get,  // ANS_A
+    op_ANS_APP_get,  // ANS_APP
+    op_KR_PRE_get,  // KR_PRE
+    op_KR_PAT_get,  // KR_PAT
+    op_KR_SCALE_get,  // KR_SCALE
+    op_KR_PERIOD_get,  // KR_PERIOD
+    op_KR_POS_get,  // KR_POS
+    op_KR_L_ST_get,  // KR_L_ST
+    op_KR_L_LEN_get,  // KR_L_LEN
+    op_KR_RES_get,  // KR_RES
+    op_KR_CV_get,  // KR_CV
+    op_KR_MUTE_get,  // KR_MUTE
+    op_KR_TMUTE_get,  // KR_TMUTE
+    op_KR_CLK_get,  // KR_CLK
+    op_KR_PG_get,  // KR_PG
+    op_KR_CUE_get,  // KR_CUE
+    op_KR_DIR_get,  // KR_DIR
+    op_KR_DUR_get,  // KR_DUR
+    op_ME_PRE_get,  // ME_PRE
+    op_ME_RES_get,  // ME_RES
+    op_ME_STOP_get,  // ME_STOP
+    op_ME_SCALE_get,  // ME_SCALE
+    op_ME_PERIOD_get,  // ME_PERIOD
+    op_ME_CV_get,  // ME_CV
+    op_LV_PRE_get,  // LV_PRE
+    op_LV_RES_get,  // LV_RES
+    op_LV_POS_get,  // LV_POS
+    op_LV_L_ST_get,  // LV_L_ST
+    op_LV_L_LEN_get,  // LV_L_LEN
+    op_LV_L_DIR_get,  // LV_L_DIR
+    op_LV_CV_get,  // LV_CV
+    op_CY_PRE_get,  // CY_PRE
+    op_CY_RES_get,  // CY_RES
+    op_CY_POS_get,  // CY_POS
+    op_CY_REV_get,  // CY_REV
+    op_CY_CV_get,  // CY_CV
+    op_MID_SHIFT_get,  // MID_SHIFT
+    op_MID_SLEW_get,  // MID_SLEW
+    op_ARP_STY_get,  // ARP_STY
+    op_ARP_HLD_get,  // ARP_HLD
+    op_ARP_RPT_get,  // ARP_RPT
+    op_ARP_GT_get,  // ARP_GT
+    op_ARP_DIV_get,  // ARP_DIV
+    op_ARP_RES_get,  // ARP_RES
+    op_ARP_SHIFT_get,  // ARP_SHIFT
+    op_ARP_SLEW_get,  // ARP_SLEW
+    op_ARP_FIL_get,  // ARP_FIL
+    op_ARP_ROT_get,  // ARP_ROT
+    op_ARP_ER_get,  // ARP_ER
+    op_JF_TR_get,  // JF_TR
+    op_JF_RMODE_get,  // JF_RMODE
+    op_JF_RUN_get,  // JF_RUN
+    op_JF_SHIFT_get,  // JF_SHIFT
+    op_JF_VTR_get,  // JF_VTR
+    op_JF_MODE_get,  // JF_MODE
+    op_JF_TICK_get,  // JF_TICK
+    op_JF_VOX_get,  // JF_VOX
+    op_JF_NOTE_get,  // JF_NOTE
+    op_JF_GOD_get,  // JF_GOD
+    op_JF_TUNE_get,  // JF_TUNE
+    op_JF_QT_get,  // JF_QT
+    op_JF_PITCH_get,  // JF_PITCH
+    op_JF_ADDR_get,  // JF_ADDR
+    op_JF_SPEED_get,  // JF_SPEED
+    op_JF_TSC_get,  // JF_TSC
+    op_JF_RAMP_get,  // JF_RAMP
+    op_JF_CURVE_get,  // JF_CURVE
+    op_JF_FM_get,  // JF_FM
+    op_JF_TIME_get,  // JF_TIME
+    op_JF_INTONE_get,  // JF_INTONE
+    op_JF_POLY_get,  // JF_POLY
+    op_JF_POLY_RESET_get,  // JF_POLY_RESET
+    op_JF_SEL_get,  // JF_SEL
+    op_WS_PLAY_get,  // WS_PLAY
+    op_WS_REC_get,  // WS_REC
+    op_WS_CUE_get,  // WS_CUE
+    op_WS_LOOP_get,  // WS_LOOP
+    op_WS_S_PITCH_write,  // WS_S_PITCH
+    op_WS_S_VEL_write,  // WS_S_VEL
+    op_WS_S_VOX_write,  // WS_S_VOX
+    op_WS_S_NOTE_write,  // WS_S_NOTE
+    op_WS_S_AR_MODE_recv,  // WS_S_AR_MODE
+    op_WS_S_LPG_TIME_recv,  // WS_S_LPG_TIME
+    op_WS_S_LPG_SYMMETRY_recv,  // WS_S_LPG_SYMMETRY
+    op_WS_S_CURVE_recv,  // WS_S_CURVE
+    op_WS_S_RAMP_recv,  // WS_S_RAMP
+    op_WS_S_FM_INDEX_recv,  // WS_S_FM_INDEX
+    op_WS_S_FM_RATIO_write,  // WS_S_FM_RATIO
+    op_WS_S_FM_ENV_recv,  // WS_S_FM_ENV
+    op_WS_S_VOICES_recv,  // WS_S_VOICES
+    op_WS_S_PATCH_write,  // WS_S_PATCH
+    op_WS_D_FEEDBACK_recv,  // WS_D_FEEDBACK
+    op_WS_D_MIX_recv,  // WS_D_MIX
+    op_WS_D_LOWPASS_recv,  // WS_D_LOWPASS
+    op_WS_D_FREEZE_recv,  // WS_D_FREEZE
+    op_WS_D_TIME_recv,  // WS_D_TIME
+    op_WS_D_LENGTH_write,  // WS_D_LENGTH
+    op_WS_D_POSITION_write,  // WS_D_POSITION
+    op_WS_D_CUT_write,  // WS_D_CUT
+    op_WS_D_FREQ_RANGE_write,  // WS_D_FREQ_RANGE
+    op_WS_D_RATE_recv,  // WS_D_RATE
+    op_WS_D_FREQ_recv,  // WS_D_FREQ
+    op_WS_D_CLK_write,  // WS_D_CLK
+    op_WS_D_CLK_RATIO_write,  // WS_D_CLK_RATIO
+    op_WS_D_PLUCK_write,  // WS_D_PLUCK
+    op_WS_D_MOD_RATE_recv,  // WS_D_MOD_RATE
+    op_WS_D_MOD_AMOUNT_recv,  // WS_D_MOD_AMOUNT
+    op_WS_T_RECORD_recv,  // WS_T_RECORD
+    op_WS_T_PLAY_recv,  // WS_T_PLAY
+    op_WS_T_REV_write,  // WS_T_REV
+    op_WS_T_SPEED_write,  // WS_T_SPEED
+    op_WS_T_FREQ_recv,  // WS_T_FREQ
+    op_WS_T_PRE_LEVEL_recv,  // WS_T_PRE_LEVEL
+    op_WS_T_MONITOR_LEVEL_recv,  // WS_T_MONITOR_LEVEL
+    op_WS_T_REC_LEVEL_recv,  // WS_T_REC_LEVEL
+    op_WS_T_HEAD_ORDER_recv,  // WS_T_HEAD_ORDER
+    op_WS_T_LOOP_START_write,  // WS_T_LOOP_START
+    op_WS_T_LOOP_END_write,  // WS_T_LOOP_END
+    op_WS_T_LOOP_ACTIVE_write,  // WS_T_LOOP_ACTIVE
+    op_WS_T_LOOP_SCALE_recv,  // WS_T_LOOP_SCALE
+    op_WS_T_LOOP_NEXT_write,  // WS_T_LOOP_NEXT
+    op_WS_T_TIMESTAMP_write,  // WS_T_TIMESTAMP
+    op_WS_T_SEEK_write,  // WS_T_SEEK
+    op_WS_T_CLEARTAPE_write,  // WS_T_CLEARTAPE
+    op_CROW_SEL_get,  // CROW_SEL
+    op_CROW_V_get,  // CROW_V
+    op_CROW_SLEW_get,  // CROW_SLEW
+    op_CROW_CALL1_get,  // CROW_C1
+    op_CROW_CALL2_get,  // CROW_C2
+    op_CROW_CALL3_get,  // CROW_C3
+    op_CROW_CALL4_get,  // CROW_C4
+    op_CROW_RESET_get,  // CROW_RST
+    op_CROW_PULSE_get,  // CROW_PULSE
+    op_CROW_AR_get,  // CROW_AR
+    op_CROW_LFO_get,  // CROW_LFO
+    op_CROW_IN_get,  // CROW_IN
+    op_CROW_OUT_get,  // CROW_OUT
+    op_CROW_Q0_get,  // CROW_Q0
+    op_CROW_Q1_get,  // CROW_Q1
+    op_CROW_Q2_get,  // CROW_Q2
+    op_CROW_Q3_get,  // CROW_Q3
+    op_TO_TR_get,  // TO_TR
+    op_TO_TR_TOG_get,  // TO_TR_TOG
+    op_TO_TR_PULSE_get,  // TO_TR_PULSE
+    op_TO_TR_TIME_get,  // TO_TR_TIME
+    op_TO_TR_TIME_S_get,  // TO_TR_TIME_S
+    op_TO_TR_TIME_M_get,  // TO_TR_TIME_M
+    op_TO_TR_POL_get,  // TO_TR_POL
+    op_TO_KILL_get,  // TO_KILL
+    op_TO_TR_PULSE_DIV_get,  // TO_TR_PULSE_DIV
+    op_TO_TR_PULSE_MUTE_get,  // TO_TR_PULSE_MUTE
+    op_TO_TR_M_MUL_get,  // TO_TR_M_MUL
+    op_TO_M_get,  // TO_M
+    op_TO_M_S_get,  // TO_M_S
+    op_TO_M_M_get,  // TO_M_M
+    op_TO_M_BPM_get,  // TO_M_BPM
+    op_TO_M_ACT_get,  // TO_M_ACT
+    op_TO_M_SYNC_get,  // TO_M_SYNC
+    op_TO_M_COUNT_get,  // TO_M_COUNT
+    op_TO_TR_M_get,  // TO_TR_M
+    op_TO_TR_M_S_get,  // TO_TR_M_S
+    op_TO_TR_M_M_get,  // TO_TR_M_M
+    op_TO_TR_M_BPM_get,  // TO_TR_M_BPM
+    op_TO_TR_M_ACT_get,  // TO_TR_M_ACT
+    op_TO_TR_M_SYNC_get,  // TO_TR_M_SYNC
+    op_TO_TR_WIDTH_get,  // TO_TR_WIDTH
+    op_TO_TR_M_COUNT_get,  // TO_TR_M_COUNT
+    op_TO_CV_get,  // TO_CV
+    op_TO_CV_SLEW_get,  // TO_CV_SLEW
+    op_TO_CV_SLEW_S_get,  // TO_CV_SLEW_S
+    op_TO_CV_SLEW_M_get,  // TO_CV_SLEW_M
+    op_TO_CV_SET_get,  // TO_CV_SET
+    op_TO_CV_OFF_get,  // TO_CV_OFF
+    op_TO_CV_QT_get,  // TO_CV_QT
+    op_TO_CV_QT_SET_get,  // TO_CV_QT_SET
+    op_TO_CV_N_get,  // TO_CV_N
+    op_TO_CV_N_SET_get,  // TO_CV_N_SET
+    op_TO_CV_SCALE_get,  // TO_CV_SCALE
+    op_TO_CV_LOG_get,  // TO_CV_LOG
+    op_TO_CV_INIT_get,  // TO_CV_INIT
+    op_TO_TR_INIT_get,  // TO_TR_INIT
+    op_TO_INIT_get,  // TO_INIT
+    op_TO_TR_PULSE_get,  // TO_TR_P
+    op_TO_TR_PULSE_DIV_get,  // TO_TR_P_DIV
+    op_TO_TR_PULSE_MUTE_get,  // TO_TR_P_MUTE
+    op_TO_OSC_get,  // TO_OSC
+    op_TO_OSC_SET_get,  // TO_OSC_SET
+    op_TO_OSC_QT_get,  // TO_OSC_QT
+    op_TO_OSC_QT_SET_get,  // TO_OSC_QT_SET
+    op_TO_OSC_FQ_get,  // TO_OSC_FQ
+    op_TO_OSC_FQ_SET_get,  // TO_OSC_FQ_SET
+    op_TO_OSC_N_get,  // TO_OSC_N
+    op_TO_OSC_N_SET_get,  // TO_OSC_N_SET
+    op_TO_OSC_LFO_get,  // TO_OSC_LFO
+    op_TO_OSC_LFO_SET_get,  // TO_OSC_LFO_SET
+    op_TO_OSC_WAVE_get,  // TO_OSC_WAVE
+    op_TO_OSC_SYNC_get,  // TO_OSC_SYNC
+    op_TO_OSC_PHASE_get,  // TO_OSC_PHASE
+    op_TO_OSC_WIDTH_get,  // TO_OSC_WIDTH
+    op_TO_OSC_RECT_get,  // TO_OSC_RECT
+    op_TO_OSC_SLEW_get,  // TO_OSC_SLEW
+    op_TO_OSC_SLEW_S_get,  // TO_OSC_SLEW_S
+    op_TO_OSC_SLEW_M_get,  // TO_OSC_SLEW_M
+    op_TO_OSC_SCALE_get,  // TO_OSC_SCALE
+    op_TO_OSC_CYC_get,  // TO_OSC_CYC
+    op_TO_OSC_CYC_S_get,  // TO_OSC_CYC_S
+    op_TO_OSC_CYC_M_get,  // TO_OSC_CYC_M
+    op_TO_OSC_CYC_SET_get,  // TO_OSC_CYC_SET
+    op_TO_OSC_CYC_S_SET_get,  // TO_OSC_CYC_S_SET
+    op_TO_OSC_CYC_M_SET_get,  // TO_OSC_CYC_M_SET
+    op_TO_OSC_CTR_get,  // TO_OSC_CTR
+    op_TO_ENV_ACT_get,  // TO_ENV_ACT
+    op_TO_ENV_ATT_get,  // TO_ENV_ATT
+    op_TO_ENV_ATT_S_get,  // TO_ENV_ATT_S
+    op_TO_ENV_ATT_M_get,  // TO_ENV_ATT_M
+    op_TO_ENV_DEC_get,  // TO_ENV_DEC
+    op_TO_ENV_DEC_S_get,  // TO_ENV_DEC_S
+    op_TO_ENV_DEC_M_get,  // TO_ENV_DEC_M
+    op_TO_ENV_TRIG_get,  // TO_ENV_TRIG
+    op_TO_ENV_EOR_get,  // TO_ENV_EOR
+    op_TO_ENV_EOC_get,  // TO_ENV_EOC
+    op_TO_ENV_LOOP_get,  // TO_ENV_LOOP
+    op_TO_ENV_get,  // TO_ENV
+    op_TO_CV_CALIB_get,  // TO_CV_CALIB
+    op_TO_CV_RESET_get,  // TO_CV_RESET
+    op_TI_PARAM_get,  // TI_PARAM
+    op_TI_PARAM_QT_get,  // TI_PARAM_QT
+    op_TI_PARAM_N_get,  // TI_PARAM_N
+    op_TI_PARAM_SCALE_get,  // TI_PARAM_SCALE
+    op_TI_PARAM_MAP_get,  // TI_PARAM_MAP
+    op_TI_IN_get,  // TI_IN
+    op_TI_IN_QT_get,  // TI_IN_QT
+    op_TI_IN_N_get,  // TI_IN_N
+    op_TI_IN_SCALE_get,  // TI_IN_SCALE
+    op_TI_IN_MAP_get,  // TI_IN_MAP
+    op_TI_PARAM_CALIB_get,  // TI_PARAM_CALIB
+    op_TI_IN_CALIB_get,  // TI_IN_CALIB
+    op_TI_STORE_get,  // TI_STORE
+    op_TI_RESET_get,  // TI_RESET
+    op_TI_PARAM_INIT_get,  // TI_PARAM_INIT
+    op_TI_IN_INIT_get,  // TI_IN_INIT
+    op_TI_INIT_get,  // TI_INIT
+    op_TI_PARAM_get,  // TI_PRM
+    op_TI_PARAM_QT_get,  // TI_PRM_QT
+    op_TI_PARAM_N_get,  // TI_PRM_N
+    op_TI_PARAM_SCALE_get,  // TI_PRM_SCALE
+    op_TI_PARAM_MAP_get,  // TI_PRM_MAP
+    op_TI_PARAM_CALIB_get,  // TI_PRM_CALIB
+    op_TI_PARAM_INIT_get,  // TI_PRM_INIT
+    op_FADER_get,  // FADER
+    op_FADER_SCALE_set,  // FADER_SCALE
+    op_FADER_CAL_MIN_set,  // FADER_CAL_MIN
+    op_FADER_CAL_MAX_set,  // FADER_CAL_MAX
+    op_FADER_CAL_RESET_set,  // FADER_CAL_RESET
+    op_FADER_get,  // FB
+    op_FADER_SCALE_set,  // FB_S
+    op_FADER_CAL_MIN_set,  // FB_C_MIN
+    op_FADER_CAL_MAX_set,  // FB_C_MAX
+    op_FADER_CAL_RESET_set,  // FB_C_R
+    op_SC_TR_get,  // SC_TR
+    op_SC_TR_TOG_get,  // SC_TR_TOG
+    op_SC_TR_PULSE_get,  // SC_TR_PULSE
+    op_SC_TR_TIME_get,  // SC_TR_TIME
+    op_SC_TR_POL_get,  // SC_TR_POL
+    op_SC_CV_get,  // SC_CV
+    op_SC_CV_SLEW_get,  // SC_CV_SLEW
+    op_SC_CV_SET_get,  // SC_CV_SET
+    op_SC_CV_OFF_get,  // SC_CV_OFF
+    op_SC_TR_PULSE_get,  // SC_TR_P
+    op_G_RST_get,  // G_RST
+    op_G_CLR_get,  // G_CLR
+    op_G_ROTATE_get,  // G_ROTATE
+    op_G_DIM_get,  // G_DIM
+    op_G_KEY_get,  // G_KEY
+    op_G_GRP_get,  // G_GRP
+    op_G_GRP_EN_get,  // G_GRP_EN
+    op_G_GRP_RST_get,  // G_GRP_RST
+    op_G_GRP_SW_get,  // G_GRP_SW
+    op_G_GRP_SC_get,  // G_GRP_SC
+    op_G_GRPI_get,  // G_GRPI
+    op_G_LED_get,  // G_LED
+    op_G_LED_C_get,  // G_LED_C
+    op_G_REC_get,  // G_REC
+    op_G_RCT_get,  // G_RCT
+    op_G_BTN_get,  // G_BTN
+    op_G_BTX_get,  // G_BTX
+    op_G_GBT_get,  // G_GBT
+    op_G_GBX_get,  // G_GBX
+    op_G_BTN_EN_get,  // G_BTN_EN
+    op_G_BTN_V_get,  // G_BTN_V
+    op_G_BTN_L_get,  // G_BTN_L
+    op_G_BTN_X_get,  // G_BTN_X
+    op_G_BTN_Y_get,  // G_BTN_Y
+    op_G_BTNI_get,  // G_BTNI
+    op_G_BTNV_get,  // G_BTNV
+    op_G_BTNL_get,  // G_BTNL
+    op_G_BTNX_get,  // G_BTNX
+    op_G_BTNY_get,  // G_BTNY
+    op_G_BTN_SW_get,  // G_BTN_SW
+    op_G_BTN_PR_get,  // G_BTN_PR
+    op_G_GBTN_V_get,  // G_GBTN_V
+    op_G_GBTN_L_get,  // G_GBTN_L
+    op_G_FDR_get,  // G_FDR
+    op_G_FDX_get,  // G_FDX
+    op_G_GFD_get,  // G_GFD
+    op_G_GFX_get,  // G_GFX
+    op_G_FDR_EN_get,  // G_FDR_EN
+    op_G_FDR_V_get,  // G_FDR_V
+    op_G_FDR_N_get,  // G_FDR_N
+    op_G_FDR_L_get,  // G_FDR_L
+    op_G_FDR_X_get,  // G_FDR_X
+    op_G_FDR_Y_get,  // G_FDR_Y
+    op_G_FDRI_get,  // G_FDRI
+    op_G_FDRV_get,  // G_FDRV
+    op_G_FDRN_get,  // G_FDRN
+    op_G_FDRL_get,  // G_FDRL
+    op_G_FDRX_get,  // G_FDRX
+    op_G_FDRY_get,  // G_FDRY
+    op_G_FDR_PR_get,  // G_FDR_PR
+    op_G_GFDR_V_get,  // G_GFDR_V
+    op_G_GFDR_N_get,  // G_GFDR_N
+    op_G_GFDR_L_get,  // G_GFDR_L
+    op_G_GFDR_RN_get,  // G_GFDR_RN
+    op_G_XYP_get,  // G_XYP
+    op_G_XYP_X_get,  // G_XYP_X
+    op_G_XYP_Y_get,  // G_XYP_Y
+    op_G_GBTN_C_get,  // G_GBTN_C
+    op_G_GBTN_I_get,  // G_GBTN_I
+    op_G_GBTN_W_get,  // G_GBTN_W
+    op_G_GBTN_H_get,  // G_GBTN_H
+    op_G_GBTN_X1_get,  // G_GBTN_X1
+    op_G_GBTN_X2_get,  // G_GBTN_X2
+    op_G_GBTN_Y1_get,  // G_GBTN_Y1
+    op_G_GBTN_Y2_get,  // G_GBTN_Y2
+    op_MA_SELECT_get,  // MA_SELECT
+    op_MA_STEP_get,  // MA_STEP
+    op_MA_RESET_get,  // MA_RESET
+    op_MA_PGM_get,  // MA_PGM
+    op_MA_ON_get,  // MA_ON
+    op_MA_PON_get,  // MA_PON
+    op_MA_OFF_get,  // MA_OFF
+    op_MA_POFF_get,  // MA_POFF
+    op_MA_SET_get,  // MA_SET
+    op_MA_PSET_get,  // MA_PSET
+    op_MA_COL_get,  // MA_COL
+    op_MA_PCOL_get,  // MA_PCOL
+    op_MA_ROW_get,  // MA_ROW
+    op_MA_PROW_get,  // MA_PROW
+    op_MA_CLR_get,  // MA_CLR
+    op_MA_PCLR_get,  // MA_PCLR
+    op_EX_get,  // EX
+    op_EX_PRESET_get,  // EX_PRESET
+    op_EX_PRESET_get,  // EX_PRE
+    op_EX_SAVE_get,  // EX_SAVE
+    op_EX_RESET_get,  // EX_RESET
+    op_EX_ALG_get,  // EX_ALG
+    op_EX_ALG_get,  // EX_A
+    op_EX_CTRL_get,  // EX_CTRL
+    op_EX_CTRL_get,  // EX_C
+    op_EX_PARAM_get,  // EX_PARAM
+    op_EX_PARAM_get,  // EX_P
+    op_EX_PV_get,  // EX_PV
+    op_EX_MIN_get,  // EX_MIN
+    op_EX_MAX_get,  // EX_MAX
+    op_EX_REC_get,  // EX_REC
+    op_EX_PLAY_get,  // EX_PLAY
+    op_EX_AL_P_get,  // EX_AL_P
+    op_EX_AL_CLK_get,  // EX_AL_CLK
+    op_EX_M_CH_get,  // EX_M_CH
+    op_EX_M_N_get,  // EX_M_N
+    op_EX_M_NO_get,  // EX_M_NO
+    op_EX_M_PB_get,  // EX_M_PB
+    op_EX_M_CC_get,  // EX_M_CC
+    op_EX_M_PRG_get,  // EX_M_PRG
+    op_EX_M_CLK_get,  // EX_M_CLK
+    op_EX_M_START_get,  // EX_M_START
+    op_EX_M_STOP_get,  // EX_M_STOP
+    op_EX_M_CONT_get,  // EX_M_CONT
+    op_EX_SB_CH_get,  // EX_SB_CH
+    op_EX_SB_N_get,  // EX_SB_N
+    op_EX_SB_NO_get,  // EX_SB_NO
+    op_EX_SB_PB_get,  // EX_SB_PB
+    op_EX_SB_CC_get,  // EX_SB_CC
+    op_EX_SB_PRG_get,  // EX_SB_PRG
+    op_EX_SB_CLK_get,  // EX_SB_CLK
+    op_EX_SB_START_get,  // EX_SB_START
+    op_EX_SB_STOP_get,  // EX_SB_STOP
+    op_EX_SB_CONT_get,  // EX_SB_CONT
+    op_EX_VOX_P_get,  // EX_VOX_P
+    op_EX_VOX_P_get,  // EX_VP
+    op_EX_VOX_get,  // EX_VOX
+    op_EX_VOX_get,  // EX_V
+    op_EX_VOX_O_get,  // EX_VOX_O
+    op_EX_VOX_O_get,  // EX_VO
+    op_EX_NOTE_get,  // EX_NOTE
+    op_EX_NOTE_get,  // EX_N
+    op_EX_NOTE_O_get,  // EX_NOTE_O
+    op_EX_NOTE_O_get,  // EX_NO
+    op_EX_ALLOFF_get,  // EX_ALLOFF
+    op_EX_ALLOFF_get,  // EX_AO
+    op_EX_T_get,  // EX_T
+    op_EX_TV_get,  // EX_TV
+    op_EX_LP_REC_get,  // EX_LP_REC
+    op_EX_LP_PLAY_get,  // EX_LP_PLAY
+    op_EX_LP_REV_get,  // EX_LP_REV
+    op_EX_LP_DOWN_get,  // EX_LP_DOWN
+    op_EX_LP_CLR_get,  // EX_LP_CLR
+    op_EX_LP_get,  // EX_LP
+    op_EX_LP_DOWNQ_get,  // EX_LP_DOWNQ
+    op_EX_LP_REVQ_get,  // EX_LP_REVQ
+    op_SEED_get,  // SEED
+    op_peek_seed_i16,  // RAND_SEED
+    op_peek_seed_i16,  // SYM_RAND_SD
+    op_peek_seed_i16,  // SYM_R_SD
+    op_peek_seed_i16,  // TOSS_SEED
+    op_peek_seed_i16,  // SYM_TOSS_SD
+    op_peek_seed_i16,  // PROB_SEED
+    op_peek_seed_i16,  // SYM_PROB_SD
+    op_peek_seed_i16,  // DRUNK_SEED
+    op_peek_seed_i16,  // SYM_DRUNK_SD
+    op_peek_seed_i16,  // P_SEED
+    op_peek_seed_i16,  // SYM_P_SD
+    op_MI_SYM_DOLLAR_get,  // MI_SYM_DOLLAR
+    op_MI_LN_get,  // MI_LN
+    op_MI_LNV_get,  // MI_LNV
+    op_MI_LV_get,  // MI_LV
+    op_MI_LVV_get,  // MI_LVV
+    op_MI_LO_get,  // MI_LO
+    op_MI_LC_get,  // MI_LC
+    op_MI_LCC_get,  // MI_LCC
+    op_MI_LCCV_get,  // MI_LCCV
+    op_MI_NL_get,  // MI_NL
+    op_MI_N_get,  // MI_N
+    op_MI_NV_get,  // MI_NV
+    op_MI_V_get,  // MI_V
+    op_MI_VV_get,  // MI_VV
+    op_MI_OL_get,  // MI_OL
+    op_MI_O_get,  // MI_O
+    op_MI_CL_get,  // MI_CL
+    op_MI_C_get,  // MI_C
+    op_MI_CC_get,  // MI_CC
+    op_MI_CCV_get,  // MI_CCV
+    op_MI_LCH_get,  // MI_LCH
+    op_MI_NCH_get,  // MI_NCH
+    op_MI_OCH_get,  // MI_OCH
+    op_MI_CCH_get,  // MI_CCH
+    op_MI_LE_get,  // MI_LE
+    op_MI_CLKD_get,  // MI_CLKD
+    op_MI_CLKR_get,  // MI_CLKR
+};
+
+const tele_op_fn_t tele_op_set[E_OP__LENGTH] = {
+    op_poke_i16,  // A
+    op_poke_i16,  // B
+    op_poke_i16,  // C
+    op_poke_i16,  // D
+    op_DRUNK_set,  // DRUNK
+    op_poke_i16,  // DRUNK_MAX
+    op_poke_i16,  // DRUNK_MIN
+    op_poke_i16,  // DRUNK_WRAP
+    op_FLIP_set,  // FLIP
+    op_I_set,  // I
+    op_O_set,  // O
+    op_poke_i16,  // O_INC
+    op_poke_i16,  // O_MAX
+    op_poke_i16,  // O_MIN
+    op_poke_i16,  // O_WRAP
+    op_poke_i16,  // T
+    op_TIME_set,  // TIME
+    op_TIME_ACT_set,  // TIME_ACT
+    NULL,  // LAST
+    op_poke_i16,  // X
+    op_poke_i16,  // Y
+    op_poke_i16,  // Z
+    op_J_set,  // J
+    op_K_set,  // K
+    NULL,  // INIT
+    NULL,  // INIT_SCENE
+    NULL,  // INIT_SCRIPT
+    NULL,  // INIT_SCRIPT_ALL
+    NULL,  // INIT_P
+    NULL,  // INIT_P_ALL
+    NULL,  // INIT_CV
+    NULL,  // INIT_CV_ALL
+    NULL,  // INIT_TR
+    NULL,  // INIT_TR_ALL
+    NULL,  // INIT_DATA
+    NULL,  // INIT_TIME
+    op_TURTLE_set,  // TURTLE
+    op_TURTLE_X_set,  // TURTLE_X
+    op_TURTLE_Y_set,  // TURTLE_Y
+    NULL,  // TURTLE_MOVE
+    NULL,  // TURTLE_F
+    op_TURTLE_FX1_set,  // TURTLE_FX1
+    op_TURTLE_FY1_set,  // TURTLE_FY1
+    op_TURTLE_FX2_set,  // TURTLE_FX2
+    op_TURTLE_FY2_set,  // TURTLE_FY2
+    op_TURTLE_SPEED_set,  // TURTLE_SPEED
+    op_TURTLE_DIR_set,  // TURTLE_DIR
+    NULL,  // TURTLE_STEP
+    op_TURTLE_BUMP_set,  // TURTLE_BUMP
+    op_TURTLE_WRAP_set,  // TURTLE_WRAP
+    op_TURTLE_BOUNCE_set,  // TURTLE_BOUNCE
+    op_TURTLE_SCRIPT_set,  // TURTLE_SCRIPT
+    op_TURTLE_SHOW_set,  // TURTLE_SHOW
+    op_M_set,  // M
+    op_M_SYM_EXCLAMATION_set,  // M_SYM_EXCLAMATION
+    op_M_ACT_set,  // M_ACT
+    NULL,  // M_RESET
+    op_P_N_set,  // P_N
+    op_P_set,  // P
+    op_PN_set,  // PN
+    op_P_L_set,  // P_L
+    op_PN_L_set,  // PN_L
+    op_P_WRAP_set,  // P_WRAP
+    op_PN_WRAP_set,  // PN_WRAP
+    op_P_START_set,  // P_START
+    op_PN_START_set,  // PN_START
+    op_P_END_set,  // P_END
+    op_PN_END_set,  // PN_END
+    op_P_I_set,  // P_I
+    op_PN_I_set,  // PN_I
+    op_P_HERE_set,  // P_HERE
+    op_PN_HERE_set,  // PN_HERE
+    op_P_NEXT_set,  // P_NEXT
+    op_PN_NEXT_set,  // PN_NEXT
+    op_P_PREV_set,  // P_PREV
+    op_PN_PREV_set,  // PN_PREV
+    NULL,  // P_INS
+    NULL,  // PN_INS
+    NULL,  // P_RM
+    NULL,  // PN_RM
+    NULL,  // P_PUSH
+    NULL,  // PN_PUSH
+    NULL,  // P_POP
+    NULL,  // PN_POP
+    NULL,  // P_MIN
+    NULL,  // PN_MIN
+    NULL,  // P_MAX
+    NULL,  // PN_MAX
+    NULL,  // P_SHUF
+    NULL,  // PN_SHUF
+    NULL,  // P_REV
+    NULL,  // PN_REV
+    NULL,  // P_ROT
+    NULL,  // PN_ROT
+    NULL,  // P_RND
+    NULL,  // PN_RND
+    NULL,  // P_ADD
+    NULL,  // PN_ADD
+    NULL,  // P_SUB
+    NULL,  // PN_SUB
+    NULL,  // P_ADDW
+    NULL,  // PN_ADDW
+    NULL,  // P_SUBW
+    NULL,  // PN_SUBW
+    op_Q_set,  // Q
+    op_Q_AVG_set,  // Q_AVG
+    op_Q_N_set,  // Q_N
+    op_Q_CLR_set,  // Q_CLR
+    op_Q_GRW_set,  // Q_GRW
+    NULL,  // Q_SUM
+    op_Q_MIN_set,  // Q_MIN
+    op_Q_MAX_set,  // Q_MAX
+    op_Q_RND_set,  // Q_RND
+    op_Q_SRT_set,  // Q_SRT
+    NULL,  // Q_REV
+    op_Q_SH_set,  // Q_SH
+    op_Q_ADD_set,  // Q_ADD
+    op_Q_SUB_set,  // Q_SUB
+    op_Q_MUL_set,  // Q_MUL
+    op_Q_DIV_set,  // Q_DIV
+    op_Q_MOD_set,  // Q_MOD
+    op_Q_I_set,  // Q_I
+    op_Q_2P_set,  // Q_2P
+    op_Q_P2_set,  // Q_P2
+    op_CV_set,  // CV
+    op_CV_OFF_set,  // CV_OFF
+    op_CV_SLEW_set,  // CV_SLEW
+    NULL,  // IN
+    NULL,  // IN_SCALE
+    NULL,  // PARAM
+    NULL,  // PARAM_SCALE
+    NULL,  // IN_CAL_MIN
+    NULL,  // IN_CAL_MAX
+    NULL,  // IN_CAL_RESET
+    NULL,  // PARAM_CAL_MIN
+    NULL,  // PARAM_CAL_MAX
+    NULL,  // PARAM_CAL_RESET
+    NULL,  // PRM
+    op_TR_set,  // TR
+    op_TR_POL_set,  // TR_POL
+    op_TR_TIME_set,  // TR_TIME
+    NULL,  // TR_TOG
+    NULL,  // TR_PULSE
+    NULL,  // TR_P
+    NULL,  // CV_SET
+    op_MUTE_set,  // MUTE
+    NULL,  // STATE
+    NULL,  // DEVICE_FLIP
+    NULL,  // LIVE_OFF
+    NULL,  // LIVE_O
+    NULL,  // LIVE_DASH
+    NULL,  // LIVE_D
+    NULL,  // LIVE_GRID
+    NULL,  // LIVE_G
+    NULL,  // LIVE_VARS
+    NULL,  // LIVE_V
+    op_PRINT_set,  // PRINT
+    op_PRINT_set,  // PRT
+    NULL,  // PROF_DUMP
+    NULL,  // PROF_CLR
+    NULL,  // ADD
+    NULL,  // SUB
+    NULL,  // MUL
+    NULL,  // DIV
+    NULL,  // MOD
+    NULL,  // RAND
+    NULL,  // RND
+    NULL,  // RRAND
+    NULL,  // RRND
+    op_R_set,  // R
+    op_R_MIN_set,  // R_MIN
+    op_R_MAX_set,  // R_MAX
+    NULL,  // TOSS
+    NULL,  // MIN
+    NULL,  // MAX
+    NULL,  // LIM
+    NULL,  // WRAP
+    NULL,  // WRP
+    NULL,  // QT
+    NULL,  // QT_S
+    NULL,  // QT_CS
+    NULL,  // QT_B
+    NULL,  // QT_BX
+    NULL,  // AVG
+    NULL,  // EQ
+    NULL,  // NE
+    NULL,  // LT
+    NULL,  // GT
+    NULL,  // LTE
+    NULL,  // GTE
+    NULL,  // INR
+    NULL,  // OUTR
+    NULL,  // INRI
+    NULL,  // OUTRI
+    NULL,  // NZ
+    NULL,  // EZ
+    NULL,  // RSH
+    NULL,  // LSH
+    NULL,  // LROT
+    NULL,  // RROT
+    NULL,  // EXP
+    NULL,  // ABS
+    NULL,  // SGN
+    NULL,  // AND
+    NULL,  // OR
+    NULL,  // AND3
+    NULL,  // OR3
+    NULL,  // AND4
+    NULL,  // OR4
+    NULL,  // JI
+    NULL,  // SCALE
+    NULL,  // SCL
+    NULL,  // N
+    NULL,  // VN
+    NULL,  // HZ
+    NULL,  // N_S
+    NULL,  // N_C
+    NULL,  // N_CS
+    op_N_B_set,  // N_B
+    op_N_BX_set,  // N_BX
+    NULL,  // V
+    NULL,  // VV
+    NULL,  // ER
+    NULL,  // NR
+    NULL,  // BPM
+    NULL,  // BIT_OR
+    NULL,  // BIT_AND
+    NULL,  // BIT_NOT
+    NULL,  // BIT_XOR
+    NULL,  // BSET
+    NULL,  // BGET
+    NULL,  // BCLR
+    NULL,  // BTOG
+    NULL,  // BREV
+    NULL,  // XOR
+    op_CHAOS_set,  // CHAOS
+    op_CHAOS_R_set,  // CHAOS_R
+    op_CHAOS_ALG_set,  // CHAOS_ALG
+    NULL,  // SYM_PLUS
+    NULL,  // SYM_DASH
+    NULL,  // SYM_STAR
+    NULL,  // SYM_FORWARD_SLASH
+    NULL,  // SYM_PERCENTAGE
+    NULL,  // SYM_EQUAL_x2
+    NULL,  // SYM_EXCLAMATION_EQUAL
+    NULL,  // SYM_LEFT_ANGLED
+    NULL,  // SYM_RIGHT_ANGLED
+    NULL,  // SYM_LEFT_ANGLED_EQUAL
+    NULL,  // SYM_RIGHT_ANGLED_EQUAL
+    NULL,  // SYM_RIGHT_ANGLED_LEFT_ANGLED
+    NULL,  // SYM_LEFT_ANGLED_RIGHT_ANGLED
+    NULL,  // SYM_RIGHT_ANGLED_EQUAL_LEFT_ANGLED
+    NULL,  // SYM_LEFT_ANGLED_EQUAL_RIGHT_ANGLED
+    NULL,  // SYM_EXCLAMATION
+    NULL,  // SYM_LEFT_ANGLED_x2
+    NULL,  // SYM_RIGHT_ANGLED_x2
+    NULL,  // SYM_LEFT_ANGLED_x3
+    NULL,  // SYM_RIGHT_ANGLED_x3
+    NULL,  // SYM_AMPERSAND_x2
+    NULL,  // SYM_PIPE_x2
+    NULL,  // SYM_AMPERSAND_x3
+    NULL,  // SYM_PIPE_x3
+    NULL,  // SYM_AMPERSAND_x4
+    NULL,  // SYM_PIPE_x4
+    NULL,  // TIF
+    NULL,  // S_ALL
+    NULL,  // S_POP
+    NULL,  // S_CLR
+    NULL,  // S_L
+    op_SCRIPT_set,  // SCRIPT
+    op_SCRIPT_set,  // SYM_DOLLAR
+    op_SCRIPT_POL_set,  // SCRIPT_POL
+    op_SCRIPT_POL_set,  // SYM_DOLLAR_POL
+    op_SCRIPT_SLICE_set,  // SCRIPT_SLICE
+    op_SCRIPT_SLICE_set,  // SYM_DOLLAR_SLICE
+    op_SCRIPT_Q_set,  // SCRIPT_Q
+    op_SCRIPT_Q_set,  // SYM_DOLLAR_Q
+    op_SCRIPT_QP_set,  // SCRIPT_QP
+    op_SCRIPT_QP_set,  // SYM_DOLLAR_QP
+    op_SCRIPT_DROP_set,  // SCRIPT_DROP
+    op_SCRIPT_DROP_set,  // SYM_DOLLAR_DROP
+    op_SCRIPT_OVER_set,  // SCRIPT_OVER
+    op_SCRIPT_OVER_set,  // SYM_DOLLAR_OVER
+    NULL,  // KILL
+    op_SCENE_set,  // SCENE
+    NULL,  // SCENE_G
+    NULL,  // SCENE_P
+    NULL,  // BREAK
+    NULL,  // BRK
+    NULL,  // SYNC
+    NULL,  // DEL_CLR
+    op_IIA_set,  // IIA
+    NULL,  // IIS
+    NULL,  // IIS1
+    NULL,  // IIS2
+    NULL,  // IIS3
+    NULL,  // IISB1
+    NULL,  // IISB2
+    NULL,  // IISB3
+    NULL,  // IIQ
+    NULL,  // IIQ1
+    NULL,  // IIQ2
+    NULL,  // IIQ3
+    NULL,  // IIQB1
+    NULL,  // IIQB2
+    NULL,  // IIQB3
+    NULL,  // IIB
+    NULL,  // IIB1
+    NULL,  // IIB2
+    NULL,  // IIB3
+    NULL,  // IIBB1
+    NULL,  // IIBB2
+    NULL,  // IIBB3
+    NULL,  // WW_PRESET
+    NULL,  // WW_POS
+    NULL,  // WW_SYNC
+    NULL,  // WW_START
+    NULL,  // WW_END
+    NULL,  // WW_PMODE
+    NULL,  // WW_PATTERN
+    NULL,  // WW_QPATTERN
+    NULL,  // WW_MUTE1
+    NULL,  // WW_MUTE2
+    NULL,  // WW_MUTE3
+    NULL,  // WW_MUTE4
+    NULL,  // WW_MUTEA
+    NULL,  // WW_MUTEB
+    NULL,  // MP_PRESET
+    NULL,  // MP_RESET
+    NULL,  // MP_STOP
+    NULL,  // ES_PRESET
+    NULL,  // ES_MODE
+    NULL,  // ES_CLOCK
+    NULL,  // ES_RESET
+    NULL,  // ES_PATTERN
+    NULL,  // ES_TRANS
+    NULL,  // ES_STOP
+    NULL,  // ES_TRIPLE
+    NULL,  // ES_MAGIC
+    NULL,  // ES_CV
+    NULL,  // OR_TRK
+    NULL,  // OR_CLK
+    NULL,  // OR_DIV
+    NULL,  // OR_PHASE
+    NULL,  // OR_RST
+    NULL,  // OR_WGT
+    NULL,  // OR_MUTE
+    NULL,  // OR_SCALE
+    NULL,  // OR_BANK
+    NULL,  // OR_PRESET
+    NULL,  // OR_RELOAD
+    NULL,  // OR_ROTS
+    NULL,  // OR_ROTW
+    NULL,  // OR_GRST
+    NULL,  // OR_CVA
+    NULL,  // OR_CVB
+    NULL,  // ANS_G_LED
+    op_ANS_G_set,  // ANS_G
+    NULL,  // ANS_G_P
+    NULL,  // ANS_A_LED
+    NULL,  // ANS_A
+    op_ANS_APP_set,  // ANS_APP
+    op_KR_PRE_set,  // KR_PRE
+    op_KR_PAT_set,  // KR_PAT
+    op_KR_SCALE_set,  // KR_SCALE
+    op_KR_PERIOD_set,  // KR_PERIOD
+    op_KR_POS_set,  // KR_POS
+    op_KR_L_ST_set,  // KR_L_ST
+    op_KR_L_LEN_set,  // KR_L_LEN
+    NULL,  // KR_RES
+    NULL,  // KR_CV
+    op_KR_MUTE_set,  // KR_MUTE
+    NULL,  // KR_TMUTE
+    NULL,  // KR_CLK
+    op_KR_PG_set,  // KR_PG
+    op_KR_CUE_set,  // KR_CUE
+    op_KR_DIR_set,  // KR_DIR
+    NULL,  // KR_DUR
+    op_ME_PRE_set,  // ME_PRE
+    NULL,  // ME_RES
+    NULL,  // ME_STOP
+    op_ME_SCALE_set,  // ME_SCALE
+    op_ME_PERIOD_set,  // ME_PERIOD
+    NULL,  // ME_CV
+    op_LV_PRE_set,  // LV_PRE
+    NULL,  // LV_RES
+    op_LV_POS_set,  // LV_POS
+    op_LV_L_ST_set,  // LV_L_ST
+    op_LV_L_LEN_set,  // LV_L_LEN
+    op_LV_L_DIR_set,  // LV_L_DIR
+    NULL,  // LV_CV
+    op_CY_PRE_set,  // CY_PRE
+    NULL,  // CY_RES
+    op_CY_POS_set,  // CY_POS
+    NULL,  // CY_REV
+    NULL,  // CY_CV
+    NULL,  // MID_SHIFT
+    NULL,  // MID_SLEW
+    NULL,  // ARP_STY
+    NULL,  // ARP_HLD
+    NULL,  // ARP_RPT
+    NULL,  // ARP_GT
+    NULL,  // ARP_DIV
+    NULL,  // ARP_RES
+    NULL,  // ARP_SHIFT
+    NULL,  // ARP_SLEW
+    NULL,  // ARP_FIL
+    NULL,  // ARP_ROT
+    NULL,  // ARP_ER
+    NULL,  // JF_TR
+    NULL,  // JF_RMODE
+    NULL,  // JF_RUN
+    NULL,  // JF_SHIFT
+    NULL,  // JF_VTR
+    NULL,  // JF_MODE
+    NULL,  // JF_TICK
+    NULL,  // JF_VOX
+    NULL,  // JF_NOTE
+    NULL,  // JF_GOD
+    NULL,  // JF_TUNE
+    NULL,  // JF_QT
+    NULL,  // JF_PITCH
+    NULL,  // JF_ADDR
+    NULL,  // JF_SPEED
+    NULL,  // JF_TSC
+    NULL,  // JF_RAMP
+    NULL,  // JF_CURVE
+    NULL,  // JF_FM
+    NULL,  // JF_TIME
+    NULL,  // JF_INTONE
+    NULL,  // JF_POLY
+    NULL,  // JF_POLY_RESET
+    NULL,  // JF_SEL
+    op_WS_PLAY_set,  // WS_PLAY
+    op_WS_REC_set,  // WS_REC
+    op_WS_CUE_set,  // WS_CUE
+    op_WS_LOOP_set,  // WS_LOOP
+    NULL,  // WS_S_PITCH
+    NULL,  // WS_S_VEL
+    NULL,  // WS_S_VOX
+    NULL,  // WS_S_NOTE
+    op_WS_S_AR_MODE_write,  // WS_S_AR_MODE
+    op_WS_S_LPG_TIME_write,  // WS_S_LPG_TIME
+    op_WS_S_LPG_SYMMETRY_write,  // WS_S_LPG_SYMMETRY
+    op_WS_S_CURVE_write,  // WS_S_CURVE
+    op_WS_S_RAMP_write,  // WS_S_RAMP
+    op_WS_S_FM_INDEX_write,  // WS_S_FM_INDEX
+    NULL,  // WS_S_FM_RATIO
+    op_WS_S_FM_ENV_write,  // WS_S_FM_ENV
+    op_WS_S_VOICES_write,  // WS_S_VOICES
+    NULL,  // WS_S_PATCH
+    op_WS_D_FEEDBACK_write,  // WS_D_FEEDBACK
+    op_WS_D_MIX_write,  // WS_D_MIX
+    op_WS_D_LOWPASS_write,  // WS_D_LOWPASS
+    op_WS_D_FREEZE_write,  // WS_D_FREEZE
+    op_WS_D_TIME_write,  // WS_D_TIME
+    NULL,  // WS_D_LENGTH
+    NULL,  // WS_D_POSITION
+    NULL,  // WS_D_CUT
+    NULL,  // WS_D_FREQ_RANGE
+    op_WS_D_RATE_write,  // WS_D_RATE
+    op_WS_D_FREQ_write,  // WS_D_FREQ
+    NULL,  // WS_D_CLK
+    NULL,  // WS_D_CLK_RATIO
+    NULL,  // WS_D_PLUCK
+    op_WS_D_MOD_RATE_write,  // WS_D_MOD_RATE
+    op_WS_D_MOD_AMOUNT_write,  // WS_D_MOD_AMOUNT
+    op_WS_T_RECORD_write,  // WS_T_RECORD
+    op_WS_T_PLAY_write,  // WS_T_PLAY
+    NULL,  // WS_T_REV
+    NULL,  // WS_T_SPEED
+    op_WS_T_FREQ_write,  // WS_T_FREQ
+    op_WS_T_PRE_LEVEL_write,  // WS_T_PRE_LEVEL
+    op_WS_T_MONITOR_LEVEL_write,  // WS_T_MONITOR_LEVEL
+    op_WS_T_REC_LEVEL_write,  // WS_T_REC_LEVEL
+    op_WS_T_HEAD_ORDER_write,  // WS_T_HEAD_ORDER
+    NULL,  // WS_T_LOOP_START
+    NULL,  // WS_T_LOOP_END
+    NULL,  // WS_T_LOOP_ACTIVE
+    op_WS_T_LOOP_SCALE_write,  // WS_T_LOOP_SCALE
+    NULL,  // WS_T_LOOP_NEXT
+    NULL,  // WS_T_TIMESTAMP
+    NULL,  // WS_T_SEEK
+    NULL,  // WS_T_CLEARTAPE
+    NULL,  // CROW_SEL
+    NULL,  // CROW_V
+    NULL,  // CROW_SLEW
+    NULL,  // CROW_C1
+    NULL,  // CROW_C2
+    NULL,  // CROW_C3
+    NULL,  // CROW_C4
+    NULL,  // CROW_RST
+    NULL,  // CROW_PULSE
+    NULL,  // CROW_AR
+    NULL,  // CROW_LFO
+    NULL,  // CROW_IN
+    NULL,  // CROW_OUT
+    NULL,  // CROW_Q0
+    NULL,  // CROW_Q1
+    NULL,  // CROW_Q2
+    NULL,  // CROW_Q3
+    NULL,  // TO_TR
+    NULL,  // TO_TR_TOG
+    NULL,  // TO_TR_PULSE
+    NULL,  // TO_TR_TIME
+    NULL,  // TO_TR_TIME_S
+    NULL,  // TO_TR_TIME_M
+    NULL,  // TO_TR_POL
+    NULL,  // TO_KILL
+    NULL,  // TO_TR_PULSE_DIV
+    NULL,  // TO_TR_PULSE_MUTE
+    NULL,  // TO_TR_M_MUL
+    NULL,  // TO_M
+    NULL,  // TO_M_S
+    NULL,  // TO_M_M
+    NULL,  // TO_M_BPM
+    NULL,  // TO_M_ACT
+    NULL,  // TO_M_SYNC
+    NULL,  // TO_M_COUNT
+    NULL,  // TO_TR_M
+    NULL,  // TO_TR_M_S
+    NULL,  // TO_TR_M_M
+    NULL,  // TO_TR_M_BPM
+    NULL,  // TO_TR_M_ACT
+    NULL,  // TO_TR_M_SYNC
+    NULL,  // TO_TR_WIDTH
+    NULL,  // TO_TR_M_COUNT
+    NULL,  // TO_CV
+    NULL,  // TO_CV_SLEW
+    NULL,  // TO_CV_SLEW_S
+    NULL,  // TO_CV_SLEW_M
+    NULL,  // TO_CV_SET
+    NULL,  // TO_CV_OFF
+    NULL,  // TO_CV_QT
+    NULL,  // TO_CV_QT_SET
+    NULL,  // TO_CV_N
+    NULL,  // TO_CV_N_SET
+    NULL,  // TO_CV_SCALE
+    NULL,  // TO_CV_LOG
+    NULL,  // TO_CV_INIT
+    NULL,  // TO_TR_INIT
+    NULL,  // TO_INIT
+    NULL,  // TO_TR_P
+    NULL,  // TO_TR_P_DIV
+    NULL,  // TO_TR_P_MUTE
+    NULL,  // TO_OSC
+    NULL,  // TO_OSC_SET
+    NULL,  // TO_OSC_QT
+    NULL,  // TO_OSC_QT_SET
+    NULL,  // TO_OSC_FQ
+    NULL,  // TO_OSC_FQ_SET
+    NULL,  // TO_OSC_N
+    NULL,  // TO_OSC_N_SET
+    NULL,  // TO_OSC_LFO
+    NULL,  // TO_OSC_LFO_SET
+    NULL,  // TO_OSC_WAVE
+    NULL,  // TO_OSC_SYNC
+    NULL,  // TO_OSC_PHASE
+    NULL,  // TO_OSC_WIDTH
+    NULL,  // TO_OSC_RECT
+    NULL,  // TO_OSC_SLEW
+    NULL,  // TO_OSC_SLEW_S
+    NULL,  // TO_OSC_SLEW_M
+    NULL,  // TO_OSC_SCALE
+    NULL,  // TO_OSC_CYC
+    NULL,  // TO_OSC_CYC_S
+    NULL,  // TO_OSC_CYC_M
+    NULL,  // TO_OSC_CYC_SET
+    NULL,  // TO_OSC_CYC_S_SET
+    NULL,  // TO_OSC_CYC_M_SET
+    NULL,  // TO_OSC_CTR
+    NULL,  // TO_ENV_ACT
+    NULL,  // TO_ENV_ATT
+    NULL,  // TO_ENV_ATT_S
+    NULL,  // TO_ENV_ATT_M
+    NULL,  // TO_ENV_DEC
+    NULL,  // TO_ENV_DEC_S
+    NULL,  // TO_ENV_DEC_M
+    NULL,  // TO_ENV_TRIG
+    NULL,  // TO_ENV_EOR
+    NULL,  // TO_ENV_EOC
+    NULL,  // TO_ENV_LOOP
+    NULL,  // TO_ENV
+    NULL,  // TO_CV_CALIB
+    NULL,  // TO_CV_RESET
+    NULL,  // TI_PARAM
+    NULL,  // TI_PARAM_QT
+    NULL,  // TI_PARAM_N
+    NULL,  // TI_PARAM_SCALE
+    NULL,  // TI_PARAM_MAP
+    NULL,  // TI_IN
+    NULL,  // TI_IN_QT
+    NULL,  // TI_IN_N
+    NULL,  // TI_IN_SCALE
+    NULL,  // TI_IN_MAP
+    NULL,  // TI_PARAM_CALIB
+    NULL,  // TI_IN_CALIB
+    NULL,  // TI_STORE
+    NULL,  // TI_RESET
+    NULL,  // TI_PARAM_INIT
+    NULL,  // TI_IN_INIT
+    NULL,  // TI_INIT
+    NULL,  // TI_PRM
+    NULL,  // TI_PRM_QT
+    NULL,  // TI_PRM_N
+    NULL,  // TI_PRM_SCALE
+    NULL,  // TI_PRM_MAP
+    NULL,  // TI_PRM_CALIB
+    NULL,  // TI_PRM_INIT
+    NULL,  // FADER
+    NULL,  // FADER_SCALE
+    NULL,  // FADER_CAL_MIN
+    NULL,  // FADER_CAL_MAX
+    NULL,  // FADER_CAL_RESET
+    NULL,  // FB
+    NULL,  // FB_S
+    NULL,  // FB_C_MIN
+    NULL,  // FB_C_MAX
+    NULL,  // FB_C_R
+    NULL,  // SC_TR
+    NULL,  // SC_TR_TOG
+    NULL,  // SC_TR_PULSE
+    NULL,  // SC_TR_TIME
+    NULL,  // SC_TR_POL
+    NULL,  // SC_CV
+    NULL,  // SC_CV_SLEW
+    NULL,  // SC_CV_SET
+    NULL,  // SC_CV_OFF
+    NULL,  // SC_TR_P
+    NULL,  // G_RST
+    NULL,  // G_CLR
+    NULL,  // G_ROTATE
+    NULL,  // G_DIM
+    NULL,  // G_KEY
+    op_G_GRP_set,  // G_GRP
+    op_G_GRP_EN_set,  // G_GRP_EN
+    NULL,  // G_GRP_RST
+    NULL,  // G_GRP_SW
+    op_G_GRP_SC_set,  // G_GRP_SC
+    NULL,  // G_GRPI
+    op_G_LED_set,  // G_LED
+    NULL,  // G_LED_C
+    NULL,  // G_REC
+    NULL,  // G_RCT
+    NULL,  // G_BTN
+    NULL,  // G_BTX
+    NULL,  // G_GBT
+    NULL,  // G_GBX
+    op_G_BTN_EN_set,  // G_BTN_EN
+    op_G_BTN_V_set,  // G_BTN_V
+    op_G_BTN_L_set,  // G_BTN_L
+    op_G_BTN_X_set,  // G_BTN_X
+    op_G_BTN_Y_set,  // G_BTN_Y
+    NULL,  // G_BTNI
+    op_G_BTNV_set,  // G_BTNV
+    op_G_BTNL_set,  // G_BTNL
+    op_G_BTNX_set,  // G_BTNX
+    op_G_BTNY_set,  // G_BTNY
+    NULL,  // G_BTN_SW
+    NULL,  // G_BTN_PR
+    NULL,  // G_GBTN_V
+    NULL,  // G_GBTN_L
+    NULL,  // G_FDR
+    NULL,  // G_FDX
+    NULL,  // G_GFD
+    NULL,  // G_GFX
+    op_G_FDR_EN_set,  // G_FDR_EN
+    op_G_FDR_V_set,  // G_FDR_V
+    op_G_FDR_N_set,  // G_FDR_N
+    op_G_FDR_L_set,  // G_FDR_L
+    op_G_FDR_X_set,  // G_FDR_X
+    op_G_FDR_Y_set,  // G_FDR_Y
+    NULL,  // G_FDRI
+    op_G_FDRV_set,  // G_FDRV
+    op_G_FDRN_set,  // G_FDRN
+    op_G_FDRL_set,  // G_FDRL
+    op_G_FDRX_set,  // G_FDRX
+    op_G_FDRY_set,  // G_FDRY
+    NULL,  // G_FDR_PR
+    NULL,  // G_GFDR_V
+    NULL,  // G_GFDR_N
+    NULL,  // G_GFDR_L
+    NULL,  // G_GFDR_RN
+    NULL,  // G_XYP
+    NULL,  // G_XYP_X
+    NULL,  // G_XYP_Y
+    NULL,  // G_GBTN_C
+    NULL,  // G_GBTN_I
+    NULL,  // G_GBTN_W
+    NULL,  // G_GBTN_H
+    NULL,  // G_GBTN_X1
+    NULL,  // G_GBTN_X2
+    NULL,  // G_GBTN_Y1
+    NULL,  // G_GBTN_Y2
+    op_MA_SELECT_set,  // MA_SELECT
+    NULL,  // MA_STEP
+    NULL,  // MA_RESET
+    NULL,  // MA_PGM
+    NULL,  // MA_ON
+    NULL,  // MA_PON
+    NULL,  // MA_OFF
+    NULL,  // MA_POFF
+    NULL,  // MA_SET
+    NULL,  // MA_PSET
+    op_MA_COL_set,  // MA_COL
+    op_MA_PCOL_set,  // MA_PCOL
+    op_MA_ROW_set,  // MA_ROW
+    op_MA_PROW_set,  // MA_PROW
+    NULL,  // MA_CLR
+    NULL,  // MA_PCLR
+    op_EX_set,  // EX
+    op_EX_PRESET_set,  // EX_PRESET
+    op_EX_PRESET_set,  // EX_PRE
+    NULL,  // EX_SAVE
+    NULL,  // EX_RESET
+    op_EX_ALG_set,  // EX_ALG
+    op_EX_ALG_set,  // EX_A
+    NULL,  // EX_CTRL
+    NULL,  // EX_C
+    op_EX_PARAM_set,  // EX_PARAM
+    op_EX_PARAM_set,  // EX_P
+    NULL,  // EX_PV
+    NULL,  // EX_MIN
+    NULL,  // EX_MAX
+    NULL,  // EX_REC
+    NULL,  // EX_PLAY
+    NULL,  // EX_AL_P
+    NULL,  // EX_AL_CLK
+    op_EX_M_CH_set,  // EX_M_CH
+    NULL,  // EX_M_N
+    NULL,  // EX_M_NO
+    NULL,  // EX_M_PB
+    NULL,  // EX_M_CC
+    NULL,  // EX_M_PRG
+    NULL,  // EX_M_CLK
+    NULL,  // EX_M_START
+    NULL,  // EX_M_STOP
+    NULL,  // EX_M_CONT
+    op_EX_SB_CH_set,  // EX_SB_CH
+    NULL,  // EX_SB_N
+    NULL,  // EX_SB_NO
+    NULL,  // EX_SB_PB
+    NULL,  // EX_SB_CC
+    NULL,  // EX_SB_PRG
+    NULL,  // EX_SB_CLK
+    NULL,  // EX_SB_START
+    NULL,  // EX_SB_STOP
+    NULL,  // EX_SB_CONT
+    NULL,  // EX_VOX_P
+    NULL,  // EX_VP
+    NULL,  // EX_VOX
+    NULL,  // EX_V
+    NULL,  // EX_VOX_O
+    NULL,  // EX_VO
+    NULL,  // EX_NOTE
+    NULL,  // EX_N
+    NULL,  // EX_NOTE_O
+    NULL,  // EX_NO
+    NULL,  // EX_ALLOFF
+    NULL,  // EX_AO
+    NULL,  // EX_T
+    NULL,  // EX_TV
+    NULL,  // EX_LP_REC
+    NULL,  // EX_LP_PLAY
+    NULL,  // EX_LP_REV
+    NULL,  // EX_LP_DOWN
+    NULL,  // EX_LP_CLR
+    NULL,  // EX_LP
+    NULL,  // EX_LP_DOWNQ
+    NULL,  // EX_LP_REVQ
+    op_SEED_set,  // SEED
+    op_poke_seed_i16,  // RAND_SEED
+    op_poke_seed_i16,  // SYM_RAND_SD
+    op_poke_seed_i16,  // SYM_R_SD
+    op_poke_seed_i16,  // TOSS_SEED
+    op_poke_seed_i16,  // SYM_TOSS_SD
+    op_poke_seed_i16,  // PROB_SEED
+    op_poke_seed_i16,  // SYM_PROB_SD
+    op_poke_seed_i16,  // DRUNK_SEED
+    op_poke_seed_i16,  // SYM_DRUNK_SD
+    op_poke_seed_i16,  // P_SEED
+    op_poke_seed_i16,  // SYM_P_SD
+    op_MI_SYM_DOLLAR_set,  // MI_SYM_DOLLAR
+    NULL,  // MI_LN
+    NULL,  // MI_LNV
+    NULL,  // MI_LV
+    NULL,  // MI_LVV
+    NULL,  // MI_LO
+    NULL,  // MI_LC
+    NULL,  // MI_LCC
+    NULL,  // MI_LCCV
+    NULL,  // MI_NL
+    NULL,  // MI_N
+    NULL,  // MI_NV
+    NULL,  // MI_V
+    NULL,  // MI_VV
+    NULL,  // MI_OL
+    NULL,  // MI_O
+    NULL,  // MI_CL
+    NULL,  // MI_C
+    NULL,  // MI_CC
+    NULL,  // MI_CCV
+    NULL,  // MI_LCH
+    NULL,  // MI_NCH
+    NULL,  // MI_OCH
+    NULL,  // MI_CCH
+    NULL,  // MI_LE
+    op_MI_CLKD_set,  // MI_CLKD
+    NULL,  // MI_CLKR
+};
+
+const uint8_t tele_op_info[E_OP__LENGTH] = {
+    0x70, 0x70, 0x70, 0x70, 0x30, 0x70, 0x70, 0x70,
+    0x30, 0x30, 0x30, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x30, 0x30, 0x11, 0x70, 0x70, 0x70, 0x30, 0x30,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x02,
+    0x04, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x00, 0x30, 0x31, 0x32, 0x30, 0x31, 0x30, 0x31,
+    0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+    0x30, 0x31, 0x30, 0x31, 0x02, 0x03, 0x11, 0x12,
+    0x01, 0x02, 0x10, 0x11, 0x10, 0x11, 0x10, 0x11,
+    0x00, 0x01, 0x00, 0x01, 0x01, 0x02, 0x10, 0x11,
+    0x02, 0x03, 0x02, 0x03, 0x04, 0x05, 0x04, 0x05,
+    0x30, 0x30, 0x30, 0x20, 0x30, 0x10, 0x30, 0x30,
+    0x30, 0x20, 0x00, 0x20, 0x21, 0x21, 0x21, 0x21,
+    0x21, 0x31, 0x20, 0x20, 0x31, 0x31, 0x31, 0x10,
+    0x02, 0x10, 0x02, 0x10, 0x10, 0x00, 0x10, 0x10,
+    0x00, 0x10, 0x31, 0x31, 0x31, 0x01, 0x01, 0x01,
+    0x02, 0x31, 0x11, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x31, 0x31, 0x00, 0x00,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x11, 0x11, 0x12,
+    0x12, 0x30, 0x30, 0x30, 0x10, 0x92, 0x92, 0x93,
+    0x93, 0x93, 0x92, 0x13, 0x95, 0x11, 0x12, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x93, 0x93,
+    0x93, 0x93, 0x91, 0x91, 0x92, 0x92, 0x92, 0x92,
+    0x91, 0x91, 0x91, 0x92, 0x92, 0x93, 0x93, 0x94,
+    0x94, 0x92, 0x95, 0x95, 0x91, 0x91, 0x91, 0x93,
+    0x93, 0x94, 0x31, 0x32, 0x91, 0x91, 0x93, 0x94,
+    0x91, 0x92, 0x92, 0x91, 0x92, 0x92, 0x92, 0x92,
+    0x92, 0x91, 0x92, 0x30, 0x30, 0x30, 0x92, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0x92, 0x93, 0x93, 0x93, 0x93, 0x91, 0x92, 0x92,
+    0x92, 0x92, 0x92, 0x92, 0x93, 0x93, 0x94, 0x94,
+    0x93, 0x00, 0x00, 0x00, 0x10, 0x30, 0x30, 0x31,
+    0x31, 0x30, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31,
+    0x31, 0x31, 0x31, 0x00, 0x30, 0x01, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x30, 0x01, 0x02, 0x03, 0x04,
+    0x02, 0x03, 0x04, 0x11, 0x12, 0x13, 0x14, 0x12,
+    0x13, 0x14, 0x11, 0x12, 0x13, 0x14, 0x12, 0x13,
+    0x14, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x11, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x12, 0x32, 0x02, 0x12,
+    0x02, 0x30, 0x30, 0x30, 0x30, 0x30, 0x32, 0x32,
+    0x32, 0x02, 0x11, 0x31, 0x01, 0x01, 0x30, 0x30,
+    0x31, 0x11, 0x30, 0x01, 0x01, 0x30, 0x30, 0x11,
+    0x30, 0x01, 0x30, 0x30, 0x30, 0x30, 0x11, 0x30,
+    0x01, 0x31, 0x01, 0x11, 0x01, 0x01, 0x01, 0x01,
+    0x03, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x04, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+    0x03, 0x02, 0x01, 0x03, 0x01, 0x02, 0x01, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x02, 0x00,
+    0x01, 0x30, 0x30, 0x30, 0x30, 0x02, 0x02, 0x03,
+    0x02, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x02,
+    0x30, 0x30, 0x02, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x02, 0x02, 0x02, 0x01, 0x30, 0x30, 0x00, 0x02,
+    0x01, 0x30, 0x30, 0x30, 0x30, 0x00, 0x02, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x01, 0x30,
+    0x01, 0x02, 0x02, 0x00, 0x01, 0x02, 0x02, 0x01,
+    0x02, 0x03, 0x04, 0x00, 0x04, 0x04, 0x04, 0x11,
+    0x11, 0x10, 0x11, 0x12, 0x13, 0x02, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01,
+    0x01, 0x11, 0x11, 0x11, 0x02, 0x03, 0x11, 0x11,
+    0x11, 0x02, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x11, 0x11, 0x11, 0x02, 0x03, 0x02,
+    0x01, 0x11, 0x03, 0x11, 0x11, 0x01, 0x11, 0x03,
+    0x11, 0x11, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x01,
+    0x01, 0x03, 0x30, 0x31, 0x01, 0x01, 0x31, 0x10,
+    0x32, 0x02, 0x06, 0x06, 0x08, 0x0A, 0x09, 0x0B,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x10, 0x30, 0x30,
+    0x30, 0x30, 0x01, 0x02, 0x02, 0x03, 0x08, 0x0A,
+    0x09, 0x0B, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+    0x10, 0x30, 0x30, 0x30, 0x30, 0x30, 0x02, 0x02,
+    0x02, 0x03, 0x03, 0x07, 0x11, 0x11, 0x11, 0x12,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00,
+    0x00, 0x01, 0x02, 0x03, 0x02, 0x03, 0x03, 0x04,
+    0x31, 0x32, 0x31, 0x32, 0x00, 0x01, 0x30, 0x30,
+    0x30, 0x01, 0x00, 0x30, 0x30, 0x02, 0x02, 0x31,
+    0x31, 0x02, 0x11, 0x11, 0x01, 0x01, 0x01, 0x00,
+    0x30, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x02, 0x01, 0x01, 0x02, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x03,
+    0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00,
+    0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11,
+    0x11, 0x11, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x30,
+    0x00,
+};
+
+const void *const tele_op_data[E_OP__LENGTH] = {
+    (const void *)offsetof(scene_state_t, variables.a),  // A
+    (const void *)offsetof(scene_state_t, variables.b),  // B
+    (const void *)offsetof(scene_state_t, variables.c),  // C
+    (const void *)offsetof(scene_state_t, variables.d),  // D
+    NULL,  // DRUNK
+    (const void *)offsetof(scene_state_t, variables.drunk_max),  // DRUNK_MAX
+    (const void *)offsetof(scene_state_t, variables.drunk_min),  // DRUNK_MIN
+    (const void *)offsetof(scene_state_t, variables.drunk_wrap),  // DRUNK_WRAP
+    NULL,  // FLIP
+    NULL,  // I
+    NULL,  // O
+    (const void *)offsetof(scene_state_t, variables.o_inc),  // O_INC
+    (const void *)offsetof(scene_state_t, variables.o_max),  // O_MAX
+    (const void *)offsetof(scene_state_t, variables.o_min),  // O_MIN
+    (const void *)offsetof(scene_state_t, variables.o_wrap),  // O_WRAP
+    (const void *)offsetof(scene_state_t, variables.t),  // T
+    NULL,  // TIME
+    NULL,  // TIME_ACT
+    NULL,  // LAST
+    (const void *)offsetof(scene_state_t, variables.x),  // X
+    (const void *)offsetof(scene_state_t, variables.y),  // Y
+    (const void *)offsetof(scene_state_t, variables.z),  // Z
+    NULL,  // J
+    NULL,  // K
+    NULL,  // INIT
+    NULL,  // INIT_SCENE
+    NULL,  // INIT_SCRIPT
+    NULL,  // INIT_SCRIPT_ALL
+    NULL,  // INIT_P
+    NULL,  // INIT_P_ALL
+    NULL,  // INIT_CV
+    NULL,  // INIT_CV_ALL
+    NULL,  // INIT_TR
+    NULL,  // INIT_TR_ALL
+    NULL,  // INIT_DATA
+    NULL,  // INIT_TIME
+    NULL,  // TURTLE
+    NULL,  // TURTLE_X
+    NULL,  // TURTLE_Y
+    NULL,  // TURTLE_MOVE
+    NULL,  // TURTLE_F
+    NULL,  // TURTLE_FX1
+    NULL,  // TURTLE_FY1
+    NULL,  // TURTLE_FX2
+    NULL,  // TURTLE_FY2
+    NULL,  // TURTLE_SPEED
+    NULL,  // TURTLE_DIR
+    NULL,  // TURTLE_STEP
+    NULL,  // TURTLE_BUMP
+    NULL,  // TURTLE_WRAP
+    NULL,  // TURTLE_BOUNCE
+    NULL,  // TURTLE_SCRIPT
+    NULL,  // TURTLE_SHOW
+    NULL,  // M
+    NULL,  // M_SYM_EXCLAMATION
+    NULL,  // M_ACT
+    NULL,  // M_RESET
+    NULL,  // P_N
+    NULL,  // P
+    NULL,  // PN
+    NULL,  // P_L
+    NULL,  // PN_L
+    NULL,  // P_WRAP
+    NULL,  // PN_WRAP
+    NULL,  // P_START
+    NULL,  // PN_START
+    NULL,  // P_END
+    NULL,  // PN_END
+    NULL,  // P_I
+    NULL,  // PN_I
+    NULL,  // P_HERE
+    NULL,  // PN_HERE
+    NULL,  // P_NEXT
+    NULL,  // PN_NEXT
+    NULL,  // P_PREV
+    NULL,  // PN_PREV
+    NULL,  // P_INS
+    NULL,  // PN_INS
+    NULL,  // P_RM
+    NULL,  // PN_RM
+    NULL,  // P_PUSH
+    NULL,  // PN_PUSH
+    NULL,  // P_POP
+    NULL,  // PN_POP
+    NULL,  // P_MIN
+    NULL,  // PN_MIN
+    NULL,  // P_MAX
+    NULL,  // PN_MAX
+    NULL,  // P_SHUF
+    NULL,  // PN_SHUF
+    NULL,  // P_REV
+    NULL,  // PN_REV
+    NULL,  // P_ROT
+    NULL,  // PN_ROT
+    NULL,  // P_RND
+    NULL,  // PN_RND
+    NULL,  // P_ADD
+    NULL,  // PN_ADD
+    NULL,  // P_SUB
+    NULL,  // PN_SUB
+    NULL,  // P_ADDW
+    NULL,  // PN_ADDW
+    NULL,  // P_SUBW
+    NULL,  // PN_SUBW
+    NULL,  // Q
+    NULL,  // Q_AVG
+    NULL,  // Q_N
+    NULL,  // Q_CLR
+    NULL,  // Q_GRW
+    NULL,  // Q_SUM
+    NULL,  // Q_MIN
+    NULL,  // Q_MAX
+    NULL,  // Q_RND
+    NULL,  // Q_SRT
+    NULL,  // Q_REV
+    NULL,  // Q_SH
+    NULL,  // Q_ADD
+    NULL,  // Q_SUB
+    NULL,  // Q_MUL
+    NULL,  // Q_DIV
+    NULL,  // Q_MOD
+    NULL,  // Q_I
+    NULL,  // Q_2P
+    NULL,  // Q_P2
+    NULL,  // CV
+    NULL,  // CV_OFF
+    NULL,  // CV_SLEW
+    NULL,  // IN
+    NULL,  // IN_SCALE
+    NULL,  // PARAM
+    NULL,  // PARAM_SCALE
+    NULL,  // IN_CAL_MIN
+    NULL,  // IN_CAL_MAX
+    NULL,  // IN_CAL_RESET
+    NULL,  // PARAM_CAL_MIN
+    NULL,  // PARAM_CAL_MAX
+    NULL,  // PARAM_CAL_RESET
+    NULL,  // PRM
+    NULL,  // TR
+    NULL,  // TR_POL
+    NULL,  // TR_TIME
+    NULL,  // TR_TOG
+    NULL,  // TR_PULSE
+    NULL,  // TR_P
+    NULL,  // CV_SET
+    NULL,  // MUTE
+    NULL,  // STATE
+    NULL,  // DEVICE_FLIP
+    NULL,  // LIVE_OFF
+    NULL,  // LIVE_O
+    NULL,  // LIVE_DASH
+    NULL,  // LIVE_D
+    NULL,  // LIVE_GRID
+    NULL,  // LIVE_G
+    NULL,  // LIVE_VARS
+    NULL,  // LIVE_V
+    NULL,  // PRINT
+    NULL,  // PRT
+    NULL,  // PROF_DUMP
+    NULL,  // PROF_CLR
+    NULL,  // ADD
+    NULL,  // SUB
+    NULL,  // MUL
+    NULL,  // DIV
+    NULL,  // MOD
+    NULL,  // RAND
+    NULL,  // RND
+    NULL,  // RRAND
+    NULL,  // RRND
+    NULL,  // R
+    NULL,  // R_MIN
+    NULL,  // R_MAX
+    NULL,  // TOSS
+    NULL,  // MIN
+    NULL,  // MAX
+    NULL,  // LIM
+    NULL,  // WRAP
+    NULL,  // WRP
+    NULL,  // QT
+    NULL,  // QT_S
+    NULL,  // QT_CS
+    NULL,  // QT_B
+    NULL,  // QT_BX
+    NULL,  // AVG
+    NULL,  // EQ
+    NULL,  // NE
+    NULL,  // LT
+    NULL,  // GT
+    NULL,  // LTE
+    NULL,  // GTE
+    NULL,  // INR
+    NULL,  // OUTR
+    NULL,  // INRI
+    NULL,  // OUTRI
+    NULL,  // NZ
+    NULL,  // EZ
+    NULL,  // RSH
+    NULL,  // LSH
+    NULL,  // LROT
+    NULL,  // RROT
+    NULL,  // EXP
+    NULL,  // ABS
+    NULL,  // SGN
+    NULL,  // AND
+    NULL,  // OR
+    NULL,  // AND3
+    NULL,  // OR3
+    NULL,  // AND4
+    NULL,  // OR4
+    NULL,  // JI
+    NULL,  // SCALE
+    NULL,  // SCL
+    NULL,  // N
+    NULL,  // VN
+    NULL,  // HZ
+    NULL,  // N_S
+    NULL,  // N_C
+    NULL,  // N_CS
+    NULL,  // N_B
+    NULL,  // N_BX
+    NULL,  // V
+    NULL,  // VV
+    NULL,  // ER
+    NULL,  // NR
+    NULL,  // BPM
+    NULL,  // BIT_OR
+    NULL,  // BIT_AND
+    NULL,  // BIT_NOT
+    NULL,  // BIT_XOR
+    NULL,  // BSET
+    NULL,  // BGET
+    NULL,  // BCLR
+    NULL,  // BTOG
+    NULL,  // BREV
+    NULL,  // XOR
+    NULL,  // CHAOS
+    NULL,  // CHAOS_R
+    NULL,  // CHAOS_ALG
+    NULL,  // SYM_PLUS
+    NULL,  // SYM_DASH
+    NULL,  // SYM_STAR
+    NULL,  // SYM_FORWARD_SLASH
+    NULL,  // SYM_PERCENTAGE
+    NULL,  // SYM_EQUAL_x2
+    NULL,  // SYM_EXCLAMATION_EQUAL
+    NULL,  // SYM_LEFT_ANGLED
+    NULL,  // SYM_RIGHT_ANGLED
+    NULL,  // SYM_LEFT_ANGLED_EQUAL
+    NULL,  // SYM_RIGHT_ANGLED_EQUAL
+    NULL,  // SYM_RIGHT_ANGLED_LEFT_ANGLED
+    NULL,  // SYM_LEFT_ANGLED_RIGHT_ANGLED
+    NULL,  // SYM_RIGHT_ANGLED_EQUAL_LEFT_ANGLED
+    NULL,  // SYM_LEFT_ANGLED_EQUAL_RIGHT_ANGLED
+    NULL,  // SYM_EXCLAMATION
+    NULL,  // SYM_LEFT_ANGLED_x2
+    NULL,  // SYM_RIGHT_ANGLED_x2
+    NULL,  // SYM_LEFT_ANGLED_x3
+    NULL,  // SYM_RIGHT_ANGLED_x3
+    NULL,  // SYM_AMPERSAND_x2
+    NULL,  // SYM_PIPE_x2
+    NULL,  // SYM_AMPERSAND_x3
+    NULL,  // SYM_PIPE_x3
+    NULL,  // SYM_AMPERSAND_x4
+    NULL,  // SYM_PIPE_x4
+    NULL,  // TIF
+    NULL,  // S_ALL
+    NULL,  // S_POP
+    NULL,  // S_CLR
+    NULL,  // S_L
+    NULL,  // SCRIPT
+    NULL,  // SYM_DOLLAR
+    NULL,  // SCRIPT_POL
+    NULL,  // SYM_DOLLAR_POL
+    NULL,  // SCRIPT_SLICE
+    NULL,  // SYM_DOLLAR_SLICE
+    NULL,  // SCRIPT_Q
+    NULL,  // SYM_DOLLAR_Q
+    NULL,  // SCRIPT_QP
+    NULL,  // SYM_DOLLAR_QP
+    NULL,  // SCRIPT_DROP
+    NULL,  // SYM_DOLLAR_DROP
+    NULL,  // SCRIPT_OVER
+    NULL,  // SYM_DOLLAR_OVER
+    NULL,  // KILL
+    NULL,  // SCENE
+    NULL,  // SCENE_G
+    NULL,  // SCENE_P
+    NULL,  // BREAK
+    NULL,  // BRK
+    NULL,  // SYNC
+    NULL,  // DEL_CLR
+    NULL,  // IIA
+    NULL,  // IIS
+    NULL,  // IIS1
+    NULL,  // IIS2
+    NULL,  // IIS3
+    NULL,  // IISB1
+    NULL,  // IISB2
+    NULL,  // IISB3
+    NULL,  // IIQ
+    NULL,  // IIQ1
+    NULL,  // IIQ2
+    NULL,  // IIQ3
+    NULL,  // IIQB1
+    NULL,  // IIQB2
+    NULL,  // IIQB3
+    NULL,  // IIB
+    NULL,  // IIB1
+    NULL,  // IIB2
+    NULL,  // IIB3
+    NULL,  // IIBB1
+    NULL,  // IIBB2
+    NULL,  // IIBB3
+    (const void *)WW_PRESET,  // WW_PRESET
+    (const void *)WW_POS,  // WW_POS
+    (const void *)WW_SYNC,  // WW_SYNC
+    (const void *)WW_START,  // WW_START
+    (const void *)WW_END,  // WW_END
+    (const void *)WW_PMODE,  // WW_PMODE
+    (const void *)WW_PATTERN,  // WW_PATTERN
+    (const void *)WW_QPATTERN,  // WW_QPATTERN
+    (const void *)WW_MUTE1,  // WW_MUTE1
+    (const void *)WW_MUTE2,  // WW_MUTE2
+    (const void *)WW_MUTE3,  // WW_MUTE3
+    (const void *)WW_MUTE4,  // WW_MUTE4
+    (const void *)WW_MUTEA,  // WW_MUTEA
+    (const void *)WW_MUTEB,  // WW_MUTEB
+    (const void *)MP_PRESET,  // MP_PRESET
+    (const void *)MP_RESET,  // MP_RESET
+    (const void *)MP_STOP,  // MP_STOP
+    (const void *)ES_PRESET,  // ES_PRESET
+    (const void *)ES_MODE,  // ES_MODE
+    (const void *)ES_CLOCK,  // ES_CLOCK
+    (const void *)ES_RESET,  // ES_RESET
+    (const void *)ES_PATTERN,  // ES_PATTERN
+    (const void *)ES_TRANS,  // ES_TRANS
+    (const void *)ES_STOP,  // ES_STOP
+    (const void *)ES_TRIPLE,  // ES_TRIPLE
+    (const void *)ES_MAGIC,  // ES_MAGIC
+    NULL,  // ES_CV
+    (const void *)ORCA_TRACK,  // OR_TRK
+    (const void *)ORCA_CLOCK,  // OR_CLK
+    (const void *)ORCA_DIVISOR,  // OR_DIV
+    (const void *)ORCA_PHASE,  // OR_PHASE
+    (const void *)ORCA_RESET,  // OR_RST
+    (const void *)ORCA_WEIGHT,  // OR_WGT
+    (const void *)ORCA_MUTE,  // OR_MUTE
+    (const void *)ORCA_SCALE,  // OR_SCALE
+    (const void *)ORCA_BANK,  // OR_BANK
+    (const void *)ORCA_PRESET,  // OR_PRESET
+    (const void *)ORCA_RELOAD,  // OR_RELOAD
+    (const void *)ORCA_ROTATES,  // OR_ROTS
+    (const void *)ORCA_ROTATEW,  // OR_ROTW
+    (const void *)ORCA_GRESET,  // OR_GRST
+    (const void *)ORCA_CVA,  // OR_CVA
+    (const void *)ORCA_CVB,  // OR_CVB
+    NULL,  // ANS_G_LED
+    NULL,  // ANS_G
+    NULL,  // ANS_G_P
+    NULL,  // ANS_A_LED
+    NULL,  // ANS_A
+    NULL,  // ANS_APP
+    NULL,  // KR_PRE
+    NULL,  // KR_PAT
+    NULL,  // KR_SCALE
+    NULL,  // KR_PERIOD
+    NULL,  // KR_POS
+    NULL,  // KR_L_ST
+    NULL,  // KR_L_LEN
+    NULL,  // KR_RES
+    NULL,  // KR_CV
+    NULL,  // KR_MUTE
+    NULL,  // KR_TMUTE
+    NULL,  // KR_CLK
+    NULL,  // KR_PG
+    NULL,  // KR_CUE
+    NULL,  // KR_DIR
+    NULL,  // KR_DUR
+    NULL,  // ME_PRE
+    NULL,  // ME_RES
+    NULL,  // ME_STOP
+    NULL,  // ME_SCALE
+    NULL,  // ME_PERIOD
+    NULL,  // ME_CV
+    NULL,  // LV_PRE
+    NULL,  // LV_RES
+    NULL,  // LV_POS
+    NULL,  // LV_L_ST
+    NULL,  // LV_L_LEN
+    NULL,  // LV_L_DIR
+    NULL,  // LV_CV
+    NULL,  // CY_PRE
+    NULL,  // CY_RES
+    NULL,  // CY_POS
+    NULL,  // CY_REV
+    NULL,  // CY_CV
+    NULL,  // MID_SHIFT
+    NULL,  // MID_SLEW
+    NULL,  // ARP_STY
+    NULL,  // ARP_HLD
+    NULL,  // ARP_RPT
+    NULL,  // ARP_GT
+    NULL,  // ARP_DIV
+    NULL,  // ARP_RES
+    NULL,  // ARP_SHIFT
+    NULL,  // ARP_SLEW
+    NULL,  // ARP_FIL
+    NULL,  // ARP_ROT
+    NULL,  // ARP_ER
+    NULL,  // JF_TR
+    NULL,  // JF_RMODE
+    NULL,  // JF_RUN
+    NULL,  // JF_SHIFT
+    NULL,  // JF_VTR
+    NULL,  // JF_MODE
+    NULL,  // JF_TICK
+    NULL,  // JF_VOX
+    NULL,  // JF_NOTE
+    NULL,  // JF_GOD
+    NULL,  // JF_TUNE
+    NULL,  // JF_QT
+    NULL,  // JF_PITCH
+    NULL,  // JF_ADDR
+    NULL,  // JF_SPEED
+    NULL,  // JF_TSC
+    NULL,  // JF_RAMP
+    NULL,  // JF_CURVE
+    NULL,  // JF_FM
+    NULL,  // JF_TIME
+    NULL,  // JF_INTONE
+    NULL,  // JF_POLY
+    NULL,  // JF_POLY_RESET
+    NULL,  // JF_SEL
+    NULL,  // WS_PLAY
+    NULL,  // WS_REC
+    NULL,  // WS_CUE
+    NULL,  // WS_LOOP
+    NULL,  // WS_S_PITCH
+    NULL,  // WS_S_VEL
+    NULL,  // WS_S_VOX
+    NULL,  // WS_S_NOTE
+    NULL,  // WS_S_AR_MODE
+    NULL,  // WS_S_LPG_TIME
+    NULL,  // WS_S_LPG_SYMMETRY
+    NULL,  // WS_S_CURVE
+    NULL,  // WS_S_RAMP
+    NULL,  // WS_S_FM_INDEX
+    NULL,  // WS_S_FM_RATIO
+    NULL,  // WS_S_FM_ENV
+    NULL,  // WS_S_VOICES
+    NULL,  // WS_S_PATCH
+    NULL,  // WS_D_FEEDBACK
+    NULL,  // WS_D_MIX
+    NULL,  // WS_D_LOWPASS
+    NULL,  // WS_D_FREEZE
+    NULL,  // WS_D_TIME
+    NULL,  // WS_D_LENGTH
+    NULL,  // WS_D_POSITION
+    NULL,  // WS_D_CUT
+    NULL,  // WS_D_FREQ_RANGE
+    NULL,  // WS_D_RATE
+    NULL,  // WS_D_FREQ
+    NULL,  // WS_D_CLK
+    NULL,  // WS_D_CLK_RATIO
+    NULL,  // WS_D_PLUCK
+    NULL,  // WS_D_MOD_RATE
+    NULL,  // WS_D_MOD_AMOUNT
+    NULL,  // WS_T_RECORD
+    NULL,  // WS_T_PLAY
+    NULL,  // WS_T_REV
+    NULL,  // WS_T_SPEED
+    NULL,  // WS_T_FREQ
+    NULL,  // WS_T_PRE_LEVEL
+    NULL,  // WS_T_MONITOR_LEVEL
+    NULL,  // WS_T_REC_LEVEL
+    NULL,  // WS_T_HEAD_ORDER
+    NULL,  // WS_T_LOOP_START
+    NULL,  // WS_T_LOOP_END
+    NULL,  // WS_T_LOOP_ACTIVE
+    NULL,  // WS_T_LOOP_SCALE
+    NULL,  // WS_T_LOOP_NEXT
+    NULL,  // WS_T_TIMESTAMP
+    NULL,  // WS_T_SEEK
+    NULL,  // WS_T_CLEARTAPE
+    NULL,  // CROW_SEL
+    NULL,  // CROW_V
+    NULL,  // CROW_SLEW
+    NULL,  // CROW_C1
+    NULL,  // CROW_C2
+    NULL,  // CROW_C3
+    NULL,  // CROW_C4
+    NULL,  // CROW_RST
+    NULL,  // CROW_PULSE
+    NULL,  // CROW_AR
+    NULL,  // CROW_LFO
+    NULL,  // CROW_IN
+    NULL,  // CROW_OUT
+    NULL,  // CROW_Q0
+    NULL,  // CROW_Q1
+    NULL,  // CROW_Q2
+    NULL,  // CROW_Q3
+    NULL,  // TO_TR
+    NULL,  // TO_TR_TOG
+    NULL,  // TO_TR_PULSE
+    NULL,  // TO_TR_TIME
+    NULL,  // TO_TR_TIME_S
+    NULL,  // TO_TR_TIME_M
+    NULL,  // TO_TR_POL
+    NULL,  // TO_KILL
+    NULL,  // TO_TR_PULSE_DIV
+    NULL,  // TO_TR_PULSE_MUTE
+    NULL,  // TO_TR_M_MUL
+    NULL,  // TO_M
+    NULL,  // TO_M_S
+    NULL,  // TO_M_M
+    NULL,  // TO_M_BPM
+    NULL,  // TO_M_ACT
+    NULL,  // TO_M_SYNC
+    NULL,  // TO_M_COUNT
+    NULL,  // TO_TR_M
+    NULL,  // TO_TR_M_S
+    NULL,  // TO_TR_M_M
+    NULL,  // TO_TR_M_BPM
+    NULL,  // TO_TR_M_ACT
+    NULL,  // TO_TR_M_SYNC
+    NULL,  // TO_TR_WIDTH
+    NULL,  // TO_TR_M_COUNT
+    NULL,  // TO_CV
+    NULL,  // TO_CV_SLEW
+    NULL,  // TO_CV_SLEW_S
+    NULL,  // TO_CV_SLEW_M
+    NULL,  // TO_CV_SET
+    NULL,  // TO_CV_OFF
+    NULL,  // TO_CV_QT
+    NULL,  // TO_CV_QT_SET
+    NULL,  // TO_CV_N
+    NULL,  // TO_CV_N_SET
+    NULL,  // TO_CV_SCALE
+    NULL,  // TO_CV_LOG
+    NULL,  // TO_CV_INIT
+    NULL,  // TO_TR_INIT
+    NULL,  // TO_INIT
+    NULL,  // TO_TR_P
+    NULL,  // TO_TR_P_DIV
+    NULL,  // TO_TR_P_MUTE
+    NULL,  // TO_OSC
+    NULL,  // TO_OSC_SET
+    NULL,  // TO_OSC_QT
+    NULL,  // TO_OSC_QT_SET
+    NULL,  // TO_OSC_FQ
+    NULL,  // TO_OSC_FQ_SET
+    NULL,  // TO_OSC_N
+    NULL,  // TO_OSC_N_SET
+    NULL,  // TO_OSC_LFO
+    NULL,  // TO_OSC_LFO_SET
+    NULL,  // TO_OSC_WAVE
+    NULL,  // TO_OSC_SYNC
+    NULL,  // TO_OSC_PHASE
+    NULL,  // TO_OSC_WIDTH
+    NULL,  // TO_OSC_RECT
+    NULL,  // TO_OSC_SLEW
+    NULL,  // TO_OSC_SLEW_S
+    NULL,  // TO_OSC_SLEW_M
+    NULL,  // TO_OSC_SCALE
+    NULL,  // TO_OSC_CYC
+    NULL,  // TO_OSC_CYC_S
+    NULL,  // TO_OSC_CYC_M
+    NULL,  // TO_OSC_CYC_SET
+    NULL,  // TO_OSC_CYC_S_SET
+    NULL,  // TO_OSC_CYC_M_SET
+    NULL,  // TO_OSC_CTR
+    NULL,  // TO_ENV_ACT
+    NULL,  // TO_ENV_ATT
+    NULL,  // TO_ENV_ATT_S
+    NULL,  // TO_ENV_ATT_M
+    NULL,  // TO_ENV_DEC
+    NULL,  // TO_ENV_DEC_S
+    NULL,  // TO_ENV_DEC_M
+    NULL,  // TO_ENV_TRIG
+    NULL,  // TO_ENV_EOR
+    NULL,  // TO_ENV_EOC
+    NULL,  // TO_ENV_LOOP
+    NULL,  // TO_ENV
+    NULL,  // TO_CV_CALIB
+    NULL,  // TO_CV_RESET
+    NULL,  // TI_PARAM
+    NULL,  // TI_PARAM_QT
+    NULL,  // TI_PARAM_N
+    NULL,  // TI_PARAM_SCALE
+    NULL,  // TI_PARAM_MAP
+    NULL,  // TI_IN
+    NULL,  // TI_IN_QT
+    NULL,  // TI_IN_N
+    NULL,  // TI_IN_SCALE
+    NULL,  // TI_IN_MAP
+    NULL,  // TI_PARAM_CALIB
+    NULL,  // TI_IN_CALIB
+    NULL,  // TI_STORE
+    NULL,  // TI_RESET
+    NULL,  // TI_PARAM_INIT
+    NULL,  // TI_IN_INIT
+    NULL,  // TI_INIT
+    NULL,  // TI_PRM
+    NULL,  // TI_PRM_QT
+    NULL,  // TI_PRM_N
+    NULL,  // TI_PRM_SCALE
+    NULL,  // TI_PRM_MAP
+    NULL,  // TI_PRM_CALIB
+    NULL,  // TI_PRM_INIT
+    NULL,  // FADER
+    NULL,  // FADER_SCALE
+    NULL,  // FADER_CAL_MIN
+    NULL,  // FADER_CAL_MAX
+    NULL,  // FADER_CAL_RESET
+    NULL,  // FB
+    NULL,  // FB_S
+    NULL,  // FB_C_MIN
+    NULL,  // FB_C_MAX
+    NULL,  // FB_C_R
+    NULL,  // SC_TR
+    NULL,  // SC_TR_TOG
+    NULL,  // SC_TR_PULSE
+    NULL,  // SC_TR_TIME
+    NULL,  // SC_TR_POL
+    NULL,  // SC_CV
+    NULL,  // SC_CV_SLEW
+    NULL,  // SC_CV_SET
+    NULL,  // SC_CV_OFF
+    NULL,  // SC_TR_P
+    NULL,  // G_RST
+    NULL,  // G_CLR
+    NULL,  // G_ROTATE
+    NULL,  // G_DIM
+    NULL,  // G_KEY
+    NULL,  // G_GRP
+    NULL,  // G_GRP_EN
+    NULL,  // G_GRP_RST
+    NULL,  // G_GRP_SW
+    NULL,  // G_GRP_SC
+    NULL,  // G_GRPI
+    NULL,  // G_LED
+    NULL,  // G_LED_C
+    NULL,  // G_REC
+    NULL,  // G_RCT
+    NULL,  // G_BTN
+    NULL,  // G_BTX
+    NULL,  // G_GBT
+    NULL,  // G_GBX
+    NULL,  // G_BTN_EN
+    NULL,  // G_BTN_V
+    NULL,  // G_BTN_L
+    NULL,  // G_BTN_X
+    NULL,  // G_BTN_Y
+    NULL,  // G_BTNI
+    NULL,  // G_BTNV
+    NULL,  // G_BTNL
+    NULL,  // G_BTNX
+    NULL,  // G_BTNY
+    NULL,  // G_BTN_SW
+    NULL,  // G_BTN_PR
+    NULL,  // G_GBTN_V
+    NULL,  // G_GBTN_L
+    NULL,  // G_FDR
+    NULL,  // G_FDX
+    NULL,  // G_GFD
+    NULL,  // G_GFX
+    NULL,  // G_FDR_EN
+    NULL,  // G_FDR_V
+    NULL,  // G_FDR_N
+    NULL,  // G_FDR_L
+    NULL,  // G_FDR_X
+    NULL,  // G_FDR_Y
+    NULL,  // G_FDRI
+    NULL,  // G_FDRV
+    NULL,  // G_FDRN
+    NULL,  // G_FDRL
+    NULL,  // G_FDRX
+    NULL,  // G_FDRY
+    NULL,  // G_FDR_PR
+    NULL,  // G_GFDR_V
+    NULL,  // G_GFDR_N
+    NULL,  // G_GFDR_L
+    NULL,  // G_GFDR_RN
+    NULL,  // G_XYP
+    NULL,  // G_XYP_X
+    NULL,  // G_XYP_Y
+    NULL,  // G_GBTN_C
+    NULL,  // G_GBTN_I
+    NULL,  // G_GBTN_W
+    NULL,  // G_GBTN_H
+    NULL,  // G_GBTN_X1
+    NULL,  // G_GBTN_X2
+    NULL,  // G_GBTN_Y1
+    NULL,  // G_GBTN_Y2
+    NULL,  // MA_SELECT
+    NULL,  // MA_STEP
+    NULL,  // MA_RESET
+    NULL,  // MA_PGM
+    NULL,  // MA_ON
+    NULL,  // MA_PON
+    NULL,  // MA_OFF
+    NULL,  // MA_POFF
+    NULL,  // MA_SET
+    NULL,  // MA_PSET
+    NULL,  // MA_COL
+    NULL,  // MA_PCOL
+    NULL,  // MA_ROW
+    NULL,  // MA_PROW
+    NULL,  // MA_CLR
+    NULL,  // MA_PCLR
+    NULL,  // EX
+    NULL,  // EX_PRESET
+    NULL,  // EX_PRE
+    NULL,  // EX_SAVE
+    NULL,  // EX_RESET
+    NULL,  // EX_ALG
+    NULL,  // EX_A
+    NULL,  // EX_CTRL
+    NULL,  // EX_C
+    NULL,  // EX_PARAM
+    NULL,  // EX_P
+    NULL,  // EX_PV
+    NULL,  // EX_MIN
+    NULL,  // EX_MAX
+    NULL,  // EX_REC
+    NULL,  // EX_PLAY
+    NULL,  // EX_AL_P
+    NULL,  // EX_AL_CLK
+    NULL,  // EX_M_CH
+    NULL,  // EX_M_N
+    NULL,  // EX_M_NO
+    NULL,  // EX_M_PB
+    NULL,  // EX_M_CC
+    NULL,  // EX_M_PRG
+    NULL,  // EX_M_CLK
+    NULL,  // EX_M_START
+    NULL,  // EX_M_STOP
+    NULL,  // EX_M_CONT
+    NULL,  // EX_SB_CH
+    NULL,  // EX_SB_N
+    NULL,  // EX_SB_NO
+    NULL,  // EX_SB_PB
+    NULL,  // EX_SB_CC
+    NULL,  // EX_SB_PRG
+    NULL,  // EX_SB_CLK
+    NULL,  // EX_SB_START
+    NULL,  // EX_SB_STOP
+    NULL,  // EX_SB_CONT
+    NULL,  // EX_VOX_P
+    NULL,  // EX_VP
+    NULL,  // EX_VOX
+    NULL,  // EX_V
+    NULL,  // EX_VOX_O
+    NULL,  // EX_VO
+    NULL,  // EX_NOTE
+    NULL,  // EX_N
+    NULL,  // EX_NOTE_O
+    NULL,  // EX_NO
+    NULL,  // EX_ALLOFF
+    NULL,  // EX_AO
+    NULL,  // EX_T
+    NULL,  // EX_TV
+    NULL,  // EX_LP_REC
+    NULL,  // EX_LP_PLAY
+    NULL,  // EX_LP_REV
+    NULL,  // EX_LP_DOWN
+    NULL,  // EX_LP_CLR
+    NULL,  // EX_LP
+    NULL,  // EX_LP_DOWNQ
+    NULL,  // EX_LP_REVQ
+    NULL,  // SEED
+    (const void *)offsetof(scene_state_t, rand_states.s.rand),  // RAND_SEED
+    (const void *)offsetof(scene_state_t, rand_states.s.rand),  // SYM_RAND_SD
+    (const void *)offsetof(scene_state_t, rand_states.s.rand),  // SYM_R_SD
+    (const void *)offsetof(scene_state_t, rand_states.s.toss),  // TOSS_SEED
+    (const void *)offsetof(scene_state_t, rand_states.s.toss),  // SYM_TOSS_SD
+    (const void *)offsetof(scene_state_t, rand_states.s.prob),  // PROB_SEED
+    (const void *)offsetof(scene_state_t, rand_states.s.prob),  // SYM_PROB_SD
+    (const void *)offsetof(scene_state_t, rand_states.s.drunk),  // DRUNK_SEED
+    (const void *)offsetof(scene_state_t, rand_states.s.drunk),  // SYM_DRUNK_SD
+    (const void *)offsetof(scene_state_t, rand_states.s.pattern),  // P_SEED
+    (const void *)offsetof(scene_state_t, rand_states.s.pattern),  // SYM_P_SD
+    NULL,  // MI_SYM_DOLLAR
+    NULL,  // MI_LN
+    NULL,  // MI_LNV
+    NULL,  // MI_LV
+    NULL,  // MI_LVV
+    NULL,  // MI_LO
+    NULL,  // MI_LC
+    NULL,  // MI_LCC
+    NULL,  // MI_LCCV
+    NULL,  // MI_NL
+    NULL,  // MI_N
+    NULL,  // MI_NV
+    NULL,  // MI_V
+    NULL,  // MI_VV
+    NULL,  // MI_OL
+    NULL,  // MI_O
+    NULL,  // MI_CL
+    NULL,  // MI_C
+    NULL,  // MI_CC
+    NULL,  // MI_CCV
+    NULL,  // MI_LCH
+    NULL,  // MI_NCH
+    NULL,  // MI_OCH
+    NULL,  // MI_CCH
+    NULL,  // MI_LE
+    NULL,  // MI_CLKD
+    NULL,  // MI_CLKR
+};
+
+const char *const tele_op_names[E_OP__LENGTH] = {
+    "A",
+    "B",
+    "C",
+    "D",
+    "DRUNK",
+    "DRUNK.MAX",
+    "DRUNK.MIN",
+    "DRUNK.WRAP",
+    "FLIP",
+    "I",
+    "O",
+    "O.INC",
+    "O.MAX",
+    "O.MIN",
+    "O.WRAP",
+    "T",
+    "TIME",
+    "TIME.ACT",
+    "LAST",
+    "X",
+    "Y",
+    "Z",
+    "J",
+    "K",
+    "INIT",
+    "INIT.SCENE",
+    "INIT.SCRIPT",
+    "INIT.SCRIPT.ALL",
+    "INIT.P",
+    "INIT.P.ALL",
+    "INIT.CV",
+    "INIT.CV.ALL",
+    "INIT.TR",
+    "INIT.TR.ALL",
+    "INIT.DATA",
+    "INIT.TIME",
+    "@",
+    "@X",
+    "@Y",
+    "@MOVE",
+    "@F",
+    "@FX1",
+    "@FY1",
+    "@FX2",
+    "@FY2",
+    "@SPEED",
+    "@DIR",
+    "@STEP",
+    "@BUMP",
+    "@WRAP",
+    "@BOUNCE",
+    "@SCRIPT",
+    "@SHOW",
+    "M",
+    "M!",
+    "M.ACT",
+    "M.RESET",
+    "P.N",
+    "P",
+    "PN",
+    "P.L",
+    "PN.L",
+    "P.WRAP",
+    "PN.WRAP",
+    "P.START",
+    "PN.START",
+    "P.END",
+    "PN.END",
+    "P.I",
+    "PN.I",
+    "P.HERE",
+    "PN.HERE",
+    "P.NEXT",
+    "PN.NEXT",
+    "P.PREV",
+    "PN.PREV",
+    "P.INS",
+    "PN.INS",
+    "P.RM",
+    "PN.RM",
+    "P.PUSH",
+    "PN.PUSH",
+    "P.POP",
+    "PN.POP",
+    "P.MIN",
+    "PN.MIN",
+    "P.MAX",
+    "PN.MAX",
+    "P.SHUF",
+    "PN.SHUF",
+    "P.REV",
+    "PN.REV",
+    "P.ROT",
+    "PN.ROT",
+    "P.RND",
+    "PN.RND",
+    "P.+",
+    "PN.+",
+    "P.-",
+    "PN.-",
+    "P.+W",
+    "PN.+W",
+    "P.-W",
+    "PN.-W",
+    "Q",
+    "Q.AVG",
+    "Q.N",
+    "Q.CLR",
+    "Q.GRW",
+    "Q.SUM",
+    "Q.MIN",
+    "Q.MAX",
+    "Q.RND",
+    "Q.SRT",
+    "Q.REV",
+    "Q.SH",
+    "Q.ADD",
+    "Q.SUB",
+    "Q.MUL",
+    "Q.DIV",
+    "Q.MOD",
+    "Q.I",
+    "Q.2P",
+    "Q.P2",
+    "CV",
+    "CV.OFF",
+    "CV.SLEW",
+    "IN",
+    "IN.SCALE",
+    "PARAM",
+    "PARAM.SCALE",
+    "IN.CAL.MIN",
+    "IN.CAL.MAX",
+    "IN.CAL.RESET",
+    "PARAM.CAL.MIN",
+    "PARAM.CAL.MAX",
+    "PARAM.CAL.RESET",
+    "PRM",
+    "TR",
+    "TR.POL",
+    "TR.TIME",
+    "TR.TOG",
+    "TR.PULSE",
+    "TR.P",
+    "CV.SET",
+    "MUTE",
+    "STATE",
+    "DEVICE.FLIP",
+    "LIVE.OFF",
+    "LIVE.O",
+    "LIVE.DASH",
+    "LIVE.D",
+    "LIVE.GRID",
+    "LIVE.G",
+    "LIVE.VARS",
+    "LIVE.V",
+    "PRINT",
+    "PRT",
+    "PROF.DUMP",
+    "PROF.CLR",
+    "ADD",
+    "SUB",
+    "MUL",
+    "DIV",
+    "MOD",
+    "RAND",
+    "RND",
+    "RRAND",
+    "RRND",
+    "R",
+    "R.MIN",
+    "R.MAX",
+    "TOSS",
+    "MIN",
+    "MAX",
+    "LIM",
+    "WRAP",
+    "WRP",
+    "QT",
+    "QT.S",
+    "QT.CS",
+    "QT.B",
+    "QT.BX",
+    "AVG",
+    "EQ",
+    "NE",
+    "LT",
+    "GT",
+    "LTE",
+    "GTE",
+    "INR",
+    "OUTR",
+    "INRI",
+    "OUTRI",
+    "NZ",
+    "EZ",
+    "RSH",
+    "LSH",
+    "LROT",
+    "RROT",
+    "EXP",
+    "ABS",
+    "SGN",
+    "AND",
+    "OR",
+    "AND3",
+    "OR3",
+    "AND4",
+    "OR4",
+    "JI",
+    "SCALE",
+    "SCL",
+    "N",
+    "VN",
+    "HZ",
+    "N.S",
+    "N.C",
+    "N.CS",
+    "N.B",
+    "N.BX",
+    "V",
+    "VV",
+    "ER",
+    "NR",
+    "BPM",
+    "|",
+    "&",
+    "~",
+    "^",
+    "BSET",
+    "BGET",
+    "BCLR",
+    "BTOG",
+    "BREV",
+    "XOR",
+    "CHAOS",
+    "CHAOS.R",
+    "CHAOS.ALG",
+    "+",
+    "-",
+    "*",
+    "/",
+    "%",
+    "==",
+    "!=",
+    "<",
+    ">",
+    "<=",
+    ">=",
+    "><",
+    "<>",
+    ">=<",
+    "<=>",
+    "!",
+    "<<",
+    ">>",
+    "<<<",
+    ">>>",
+    "&&",
+    "||",
+    "&&&",
+    "|||",
+    "&&&&",
+    "||||",
+    "?",
+    "S.ALL",
+    "S.POP",
+    "S.CLR",
+    "S.L",
+    "SCRIPT",
+    "$",
+    "SCRIPT.POL",
+    "$.POL",
+    "SCRIPT.SLICE",
+    "$.SLICE",
+    "SCRIPT.Q",
+    "$.Q",
+    "SCRIPT.QP",
+    "$.QP",
+    "SCRIPT.DROP",
+    "$.DROP",
+    "SCRIPT.OVER",
+    "$.OVER",
+    "KILL",
+    "SCENE",
+    "SCENE.G",
+    "SCENE.P",
+    "BREAK",
+    "BRK",
+    "SYNC",
+    "DEL.CLR",
+    "IIA",
+    "IIS",
+    "IIS1",
+    "IIS2",
+    "IIS3",
+    "IISB1",
+    "IISB2",
+    "IISB3",
+    "IIQ",
+    "IIQ1",
+    "IIQ2",
+    "IIQ3",
+    "IIQB1",
+    "IIQB2",
+    "IIQB3",
+    "IIB",
+    "IIB1",
+    "IIB2",
+    "IIB3",
+    "IIBB1",
+    "IIBB2",
+    "IIBB3",
+    "WW.PRESET",
+    "WW.POS",
+    "WW.SYNC",
+    "WW.START",
+    "WW.END",
+    "WW.PMODE",
+    "WW.PATTERN",
+    "WW.QPATTERN",
+    "WW.MUTE1",
+    "WW.MUTE2",
+    "WW.MUTE3",
+    "WW.MUTE4",
+    "WW.MUTEA",
+    "WW.MUTEB",
+    "MP.PRESET",
+    "MP.RESET",
+    "MP.STOP",
+    "ES.PRESET",
+    "ES.MODE",
+    "ES.CLOCK",
+    "ES.RESET",
+    "ES.PATTERN",
+    "ES.TRANS",
+    "ES.STOP",
+    "ES.TRIPLE",
+    "ES.MAGIC",
+    "ES.CV",
+    "OR.TRK",
+    "OR.CLK",
+    "OR.DIV",
+    "OR.PHASE",
+    "OR.RST",
+    "OR.WGT",
+    "OR.MUTE",
+    "OR.SCALE",
+    "OR.BANK",
+    "OR.PRESET",
+    "OR.RELOAD",
+    "OR.ROTS",
+    "OR.ROTW",
+    "OR.GRST",
+    "OR.CVA",
+    "OR.CVB",
+    "ANS.G.LED",
+    "ANS.G",
+    "ANS.G.P",
+    "ANS.A.LED",
+    "ANS.A",
+    "ANS.APP",
+    "KR.PRE",
+    "KR.PAT",
+    "KR.SCALE",
+    "KR.PERIOD",
+    "KR.POS",
+    "KR.L.ST",
+    "KR.L.LEN",
+    "KR.RES",
+    "KR.CV",
+    "KR.MUTE",
+    "KR.TMUTE",
+    "KR.CLK",
+    "KR.PG",
+    "KR.CUE",
+    "KR.DIR",
+    "KR.DUR",
+    "ME.PRE",
+    "ME.RES",
+    "ME.STOP",
+    "ME.SCALE",
+    "ME.PERIOD",
+    "ME.CV",
+    "LV.PRE",
+    "LV.RES",
+    "LV.POS",
+    "LV.L.ST",
+    "LV.L.LEN",
+    "LV.L.DIR",
+    "LV.CV",
+    "CY.PRE",
+    "CY.RES",
+    "CY.POS",
+    "CY.REV",
+    "CY.CV",
+    "MID.SHIFT",
+    "MID.SLEW",
+    "ARP.STY",
+    "ARP.HLD",
+    "ARP.RPT",
+    "ARP.GT",
+    "ARP.DIV",
+    "ARP.RES",
+    "ARP.SHIFT",
+    "ARP.SLEW",
+    "ARP.FIL",
+    "ARP.ROT",
+    "ARP.ER",
+    "JF.TR",
+    "JF.RMODE",
+    "JF.RUN",
+    "JF.SHIFT",
+    "JF.VTR",
+    "JF.MODE",
+    "JF.TICK",
+    "JF.VOX",
+    "JF.NOTE",
+    "JF.GOD",
+    "JF.TUNE",
+    "JF.QT",
+    "JF.PITCH",
+    "JF.ADDR",
+    "JF.SPEED",
+    "JF.TSC",
+    "JF.RAMP",
+    "JF.CURVE",
+    "JF.FM",
+    "JF.TIME",
+    "JF.INTONE",
+    "JF.POLY",
+    "JF.POLY.RESET",
+    "JF.SEL",
+    "WS.PLAY",
+    "WS.REC",
+    "WS.CUE",
+    "WS.LOOP",
+    "W/S.PITCH",
+    "W/S.VEL",
+    "W/S.VOX",
+    "W/S.NOTE",
+    "W/S.AR.MODE",
+    "W/S.LPG.TIME",
+    "W/S.LPG.SYM",
+    "W/S.CURVE",
+    "W/S.RAMP",
+    "W/S.FM.INDEX",
+    "W/S.FM.RATIO",
+    "W/S.FM.ENV",
+    "W/S.VOICES",
+    "W/S.PATCH",
+    "W/D.FBK",
+    "W/D.MIX",
+    "W/D.FILT",
+    "W/D.FREEZE",
+    "W/D.TIME",
+    "W/D.LEN",
+    "W/D.POS",
+    "W/D.CUT",
+    "W/D.FREQ.RNG",
+    "W/D.RATE",
+    "W/D.FREQ",
+    "W/D.CLK",
+    "W/D.CLK.RATIO",
+    "W/D.PLUCK",
+    "W/D.MOD.RATE",
+    "W/D.MOD.AMT",
+    "W/T.REC",
+    "W/T.PLAY",
+    "W/T.REV",
+    "W/T.SPEED",
+    "W/T.FREQ",
+    "W/T.ERASE.LVL",
+    "W/T.MONITOR.LVL",
+    "W/T.REC.LVL",
+    "W/T.ECHOMODE",
+    "W/T.LOOP.START",
+    "W/T.LOOP.END",
+    "W/T.LOOP.ACTIVE",
+    "W/T.LOOP.SCALE",
+    "W/T.LOOP.NEXT",
+    "W/T.TIME",
+    "W/T.SEEK",
+    "W/T.CLEARTAPE",
+    "CROW.SEL",
+    "CROW.V",
+    "CROW.SLEW",
+    "CROW.C1",
+    "CROW.C2",
+    "CROW.C3",
+    "CROW.C4",
+    "CROW.RST",
+    "CROW.PULSE",
+    "CROW.AR",
+    "CROW.LFO",
+    "CROW.IN",
+    "CROW.OUT",
+    "CROW.Q0",
+    "CROW.Q1",
+    "CROW.Q2",
+    "CROW.Q3",
+    "TO.TR",
+    "TO.TR.TOG",
+    "TO.TR.PULSE",
+    "TO.TR.TIME",
+    "TO.TR.TIME.S",
+    "TO.TR.TIME.M",
+    "TO.TR.POL",
+    "TO.KILL",
+    "TO.TR.PULSE.DIV",
+    "TO.TR.PULSE.MUTE",
+    "TO.TR.M.MUL",
+    "TO.M",
+    "TO.M.S",
+    "TO.M.M",
+    "TO.M.BPM",
+    "TO.M.ACT",
+    "TO.M.SYNC",
+    "TO.M.COUNT",
+    "TO.TR.M",
+    "TO.TR.M.S",
+    "TO.TR.M.M",
+    "TO.TR.M.BPM",
+    "TO.TR.M.ACT",
+    "TO.TR.M.SYNC",
+    "TO.TR.WIDTH",
+    "TO.TR.M.COUNT",
+    "TO.CV",
+    "TO.CV.SLEW",
+    "TO.CV.SLEW.S",
+    "TO.CV.SLEW.M",
+    "TO.CV.SET",
+    "TO.CV.OFF",
+    "TO.CV.QT",
+    "TO.CV.QT.SET",
+    "TO.CV.N",
+    "TO.CV.N.SET",
+    "TO.CV.SCALE",
+    "TO.CV.LOG",
+    "TO.CV.INIT",
+    "TO.TR.INIT",
+    "TO.INIT",
+    "TO.TR.P",
+    "TO.TR.P.DIV",
+    "TO.TR.P.MUTE",
+    "TO.OSC",
+    "TO.OSC.SET",
+    "TO.OSC.QT",
+    "TO.OSC.QT.SET",
+    "TO.OSC.FQ",
+    "TO.OSC.FQ.SET",
+    "TO.OSC.N",
+    "TO.OSC.N.SET",
+    "TO.OSC.LFO",
+    "TO.OSC.LFO.SET",
+    "TO.OSC.WAVE",
+    "TO.OSC.SYNC",
+    "TO.OSC.PHASE",
+    "TO.OSC.WIDTH",
+    "TO.OSC.RECT",
+    "TO.OSC.SLEW",
+    "TO.OSC.SLEW.S",
+    "TO.OSC.SLEW.M",
+    "TO.OSC.SCALE",
+    "TO.OSC.CYC",
+    "TO.OSC.CYC.S",
+    "TO.OSC.CYC.M",
+    "TO.OSC.CYC.SET",
+    "TO.OSC.CYC.S.SET",
+    "TO.OSC.CYC.M.SET",
+    "TO.OSC.CTR",
+    "TO.ENV.ACT",
+    "TO.ENV.ATT",
+    "TO.ENV.ATT.S",
+    "TO.ENV.ATT.M",
+    "TO.ENV.DEC",
+    "TO.ENV.DEC.S",
+    "TO.ENV.DEC.M",
+    "TO.ENV.TRIG",
+    "TO.ENV.EOR",
+    "TO.ENV.EOC",
+    "TO.ENV.LOOP",
+    "TO.ENV",
+    "TO.CV.CALIB",
+    "TO.CV.RESET",
+    "TI.PARAM",
+    "TI.PARAM.QT",
+    "TI.PARAM.N",
+    "TI.PARAM.SCALE",
+    "TI.PARAM.MAP",
+    "TI.IN",
+    "TI.IN.QT",
+    "TI.IN.N",
+    "TI.IN.SCALE",
+    "TI.IN.MAP",
+    "TI.PARAM.CALIB",
+    "TI.IN.CALIB",
+    "TI.STORE",
+    "TI.RESET",
+    "TI.PARAM.INIT",
+    "TI.IN.INIT",
+    "TI.INIT",
+    "TI.PRM",
+    "TI.PRM.QT",
+    "TI.PRM.N",
+    "TI.PRM.SCALE",
+    "TI.PRM.MAP",
+    "TI.PRM.CALIB",
+    "TI.PRM.INIT",
+    "FADER",
+    "FADER.SCALE",
+    "FADER.CAL.MIN",
+    "FADER.CAL.MAX",
+    "FADER.CAL.RESET",
+    "FB",
+    "FB.S",
+    "FB.C.MIN",
+    "FB.C.MAX",
+    "FB.C.R",
+    "SC.TR",
+    "SC.TR.TOG",
+    "SC.TR.PULSE",
+    "SC.TR.TIME",
+    "SC.TR.POL",
+    "SC.CV",
+    "SC.CV.SLEW",
+    "SC.CV.SET",
+    "SC.CV.OFF",
+    "SC.TR.P",
+    "G.RST",
+    "G.CLR",
+    "G.ROTATE",
+    "G.DIM",
+    "G.KEY",
+    "G.GRP",
+    "G.GRP.EN",
+    "G.GRP.RST",
+    "G.GRP.SW",
+    "G.GRP.SC",
+    "G.GRPI",
+    "G.LED",
+    "G.LED.C",
+    "G.REC",
+    "G.RCT",
+    "G.BTN",
+    "G.BTX",
+    "G.GBT",
+    "G.GBX",
+    "G.BTN.EN",
+    "G.BTN.V",
+    "G.BTN.L",
+    "G.BTN.X",
+    "G.BTN.Y",
+    "G.BTNI",
+    "G.BTNV",
+    "G.BTNL",
+    "G.BTNX",
+    "G.BTNY",
+    "G.BTN.SW",
+    "G.BTN.PR",
+    "G.GBTN.V",
+    "G.GBTN.L",
+    "G.FDR",
+    "G.FDX",
+    "G.GFD",
+    "G.GFX",
+    "G.FDR.EN",
+    "G.FDR.V",
+    "G.FDR.N",
+    "G.FDR.L",
+    "G.FDR.X",
+    "G.FDR.Y",
+    "G.FDRI",
+    "G.FDRV",
+    "G.FDRN",
+    "G.FDRL",
+    "G.FDRX",
+    "G.FDRY",
+    "G.FDR.PR",
+    "G.GFDR.V",
+    "G.GFDR.N",
+    "G.GFDR.L",
+    "G.GFDR.RN",
+    "G.XYP",
+    "G.XYP.X",
+    "G.XYP.Y",
+    "G.GBTN.C",
+    "G.GBTN.I",
+    "G.GBTN.W",
+    "G.GBTN.H",
+    "G.GBTN.X1",
+    "G.GBTN.X2",
+    "G.GBTN.Y1",
+    "G.GBTN.Y2",
+    "MA.SELECT",
+    "MA.STEP",
+    "MA.RESET",
+    "MA.PGM",
+    "MA.ON",
+    "MA.PON",
+    "MA.OFF",
+    "MA.POFF",
+    "MA.SET",
+    "MA.PSET",
+    "MA.COL",
+    "MA.PCOL",
+    "MA.ROW",
+    "MA.PROW",
+    "MA.CLR",
+    "MA.PCLR",
+    "EX",
+    "EX.PRESET",
+    "EX.PRE",
+    "EX.SAVE",
+    "EX.RESET",
+    "EX.ALG",
+    "EX.A",
+    "EX.CTRL",
+    "EX.C",
+    "EX.PARAM",
+    "EX.P",
+    "EX.PV",
+    "EX.MIN",
+    "EX.MAX",
+    "EX.REC",
+    "EX.PLAY",
+    "EX.AL.P",
+    "EX.AL.CLK",
+    "EX.M.CH",
+    "EX.M.N",
+    "EX.M.NO",
+    "EX.M.PB",
+    "EX.M.CC",
+    "EX.M.PRG",
+    "EX.M.CLK",
+    "EX.M.START",
+    "EX.M.STOP",
+    "EX.M.CONT",
+    "EX.SB.CH",
+    "EX.SB.N",
+    "EX.SB.NO",
+    "EX.SB.PB",
+    "EX.SB.CC",
+    "EX.SB.PRG",
+    "EX.SB.CLK",
+    "EX.SB.START",
+    "EX.SB.STOP",
+    "EX.SB.CONT",
+    "EX.VOX.P",
+    "EX.VP",
+    "EX.VOX",
+    "EX.V",
+    "EX.VOX.O",
+    "EX.VO",
+    "EX.NOTE",
+    "EX.N",
+    "EX.NOTE.O",
+    "EX.NO",
+    "EX.ALLOFF",
+    "EX.AO",
+    "EX.T",
+    "EX.TV",
+    "EX.LP.REC",
+    "EX.LP.PLAY",
+    "EX.LP.REV",
+    "EX.LP.DOWN",
+    "EX.LP.CLR",
+    "EX.LP",
+    "EX.LP.DOWN?",
+    "EX.LP.REV?",
+    "SEED",
+    "RAND.SEED",
+    "RAND.SD",
+    "R.SD",
+    "TOSS.SEED",
+    "TOSS.SD",
+    "PROB.SEED",
+    "PROB.SD",
+    "DRUNK.SEED",
+    "DRUNK.SD",
+    "P.SEED",
+    "P.SD",
+    "MI.$",
+    "MI.LN",
+    "MI.LNV",
+    "MI.LV",
+    "MI.LVV",
+    "MI.LO",
+    "MI.LC",
+    "MI.LCC",
+    "MI.LCCV",
+    "MI.NL",
+    "MI.N",
+    "MI.NV",
+    "MI.V",
+    "MI.VV",
+    "MI.OL",
+    "MI.O",
+    "MI.CL",
+    "MI.C",
+    "MI.CC",
+    "MI.CCV",
+    "MI.LCH",
+    "MI.NCH",
+    "MI.OCH",
+    "MI.CCH",
+    "MI.LE",
+    "MI.CLKD",
+    "MI.CLKR",
+};
+
+#ifdef SIM
+const char *const tele_op_symbols[E_OP__LENGTH] = {
+    "op_A",
+    "op_B",
+    "op_C",
+    "op_D",
+    "op_DRUNK",
+    "op_DRUNK_MAX",
+    "op_DRUNK_MIN",
+    "op_DRUNK_WRAP",
+    "op_FLIP",
+    "op_I",
+    "op_O",
+    "op_O_INC",
+    "op_O_MAX",
+    "op_O_MIN",
+    "op_O_WRAP",
+    "op_T",
+    "op_TIME",
+    "op_TIME_ACT",
+    "op_LAST",
+    "op_X",
+    "op_Y",
+    "op_Z",
+    "op_J",
+    "op_K",
+    "op_INIT",
+    "op_INIT_SCENE",
+    "op_INIT_SCRIPT",
+    "op_INIT_SCRIPT_ALL",
+    "op_INIT_P",
+    "op_INIT_P_ALL",
+    "op_INIT_CV",
+    "op_INIT_CV_ALL",
+    "op_INIT_TR",
+    "op_INIT_TR_ALL",
+    "op_INIT_DATA",
+    "op_INIT_TIME",
+    "op_TURTLE",
+    "op_TURTLE_X",
+    "op_TURTLE_Y",
+    "op_TURTLE_MOVE",
+    "op_TURTLE_F",
+    "op_TURTLE_FX1",
+    "op_TURTLE_FY1",
+    "op_TURTLE_FX2",
+    "op_TURTLE_FY2",
+    "op_TURTLE_SPEED",
+    "op_TURTLE_DIR",
+    "op_TURTLE_STEP",
+    "op_TURTLE_BUMP",
+    "op_TURTLE_WRAP",
+    "op_TURTLE_BOUNCE",
+    "op_TURTLE_SCRIPT",
+    "op_TURTLE_SHOW",
+    "op_M",
+    "op_M_SYM_EXCLAMATION",
+    "op_M_ACT",
+    "op_M_RESET",
+    "op_P_N",
+    "op_P",
+    "op_PN",
+    "op_P_L",
+    "op_PN_L",
+    "op_P_WRAP",
+    "op_PN_WRAP",
+    "op_P_START",
+    "op_PN_START",
+    "op_P_END",
+    "op_PN_END",
+    "op_P_I",
+    "op_PN_I",
+    "op_P_HERE",
+    "op_PN_HERE",
+    "op_P_NEXT",
+    "op_PN_NEXT",
+    "op_P_PREV",
+    "op_PN_PREV",
+    "op_P_INS",
+    "op_PN_INS",
+    "op_P_RM",
+    "op_PN_RM",
+    "op_P_PUSH",
+    "op_PN_PUSH",
+    "op_P_POP",
+    "op_PN_POP",
+    "op_P_MIN",
+    "op_PN_MIN",
+    "op_P_MAX",
+    "op_PN_MAX",
+    "op_P_SHUF",
+    "op_PN_SHUF",
+    "op_P_REV",
+    "op_PN_REV",
+    "op_P_ROT",
+    "op_PN_ROT",
+    "op_P_RND",
+    "op_PN_RND",
+    "op_P_ADD",
+    "op_PN_ADD",
+    "op_P_SUB",
+    "op_PN_SUB",
+    "op_P_ADDW",
+    "op_PN_ADDW",
+    "op_P_SUBW",
+    "op_PN_SUBW",
+    "op_Q",
+    "op_Q_AVG",
+    "op_Q_N",
+    "op_Q_CLR",
+    "op_Q_GRW",
+    "op_Q_SUM",
+    "op_Q_MIN",
+    "op_Q_MAX",
+    "op_Q_RND",
+    "op_Q_SRT",
+    "op_Q_REV",
+    "op_Q_SH",
+    "op_Q_ADD",
+    "op_Q_SUB",
+    "op_Q_MUL",
+    "op_Q_DIV",
+    "op_Q_MOD",
+    "op_Q_I",
+    "op_Q_2P",
+    "op_Q_P2",
+    "op_CV",
+    "op_CV_OFF",
+    "op_CV_SLEW",
+    "op_IN",
+    "op_IN_SCALE",
+    "op_PARAM",
+    "op_PARAM_SCALE",
+    "op_IN_CAL_MIN",
+    "op_IN_CAL_MAX",
+    "op_IN_CAL_RESET",
+    "op_PARAM_CAL_MIN",
+    "op_PARAM_CAL_MAX",
+    "op_PARAM_CAL_RESET",
+    "op_PRM",
+    "op_TR",
+    "op_TR_POL",
+    "op_TR_TIME",
+    "op_TR_TOG",
+    "op_TR_PULSE",
+    "op_TR_P",
+    "op_CV_SET",
+    "op_MUTE",
+    "op_STATE",
+    "op_DEVICE_FLIP",
+    "op_LIVE_OFF",
+    "op_LIVE_O",
+    "op_LIVE_DASH",
+    "op_LIVE_D",
+    "op_LIVE_GRID",
+    "op_LIVE_G",
+    "op_LIVE_VARS",
+    "op_LIVE_V",
+    "op_PRINT",
+    "op_PRT",
+    "op_PROF_DUMP",
+    "op_PROF_CLR",
+    "op_ADD",
+    "op_SUB",
+    "op_MUL",
+    "op_DIV",
+    "op_MOD",
+    "op_RAND",
+    "op_RND",
+    "op_RRAND",
+    "op_RRND",
+    "op_R",
+    "op_R_MIN",
+    "op_R_MAX",
+    "op_TOSS",
+    "op_MIN",
+    "op_MAX",
+    "op_LIM",
+    "op_WRAP",
+    "op_WRP",
+    "op_QT",
+    "op_QT_S",
+    "op_QT_CS",
+    "op_QT_B",
+    "op_QT_BX",
+    "op_AVG",
+    "op_EQ",
+    "op_NE",
+    "op_LT",
+    "op_GT",
+    "op_LTE",
+    "op_GTE",
+    "op_INR",
+    "op_OUTR",
+    "op_INRI",
+    "op_OUTRI",
+    "op_NZ",
+    "op_EZ",
+    "op_RSH",
+    "op_LSH",
+    "op_LROT",
+    "op_RROT",
+    "op_EXP",
+    "op_ABS",
+    "op_SGN",
+    "op_AND",
+    "op_OR",
+    "op_AND3",
+    "op_OR3",
+    "op_AND4",
+    "op_OR4",
+    "op_JI",
+    "op_SCALE",
+    "op_SCL",
+    "op_N",
+    "op_VN",
+    "op_HZ",
+    "op_N_S",
+    "op_N_C",
+    "op_N_CS",
+    "op_N_B",
+    "op_N_BX",
+    "op_V",
+    "op_VV",
+    "op_ER",
+    "op_NR",
+    "op_BPM",
+    "op_BIT_OR",
+    "op_BIT_AND",
+    "op_BIT_NOT",
+    "op_BIT_XOR",
+    "op_BSET",
+    "op_BGET",
+    "op_BCLR",
+    "op_BTOG",
+    "op_BREV",
+    "op_XOR",
+    "op_CHAOS",
+    "op_CHAOS_R",
+    "op_CHAOS_ALG",
+    "op_SYM_PLUS",
+    "op_SYM_DASH",
+    "op_SYM_STAR",
+    "op_SYM_FORWARD_SLASH",
+    "op_SYM_PERCENTAGE",
+    "op_SYM_EQUAL_x2",
+    "op_SYM_EXCLAMATION_EQUAL",
+    "op_SYM_LEFT_ANGLED",
+    "op_SYM_RIGHT_ANGLED",
+    "op_SYM_LEFT_ANGLED_EQUAL",
+    "op_SYM_RIGHT_ANGLED_EQUAL",
+    "op_SYM_RIGHT_ANGLED_LEFT_ANGLED",
+    "op_SYM_LEFT_ANGLED_RIGHT_ANGLED",
+    "op_SYM_RIGHT_ANGLED_EQUAL_LEFT_ANGLED",
+    "op_SYM_LEFT_ANGLED_EQUAL_RIGHT_ANGLED",
+    "op_SYM_EXCLAMATION",
+    "op_SYM_LEFT_ANGLED_x2",
+    "op_SYM_RIGHT_ANGLED_x2",
+    "op_SYM_LEFT_ANGLED_x3",
+    "op_SYM_RIGHT_ANGLED_x3",
+    "op_SYM_AMPERSAND_x2",
+    "op_SYM_PIPE_x2",
+    "op_SYM_AMPERSAND_x3",
+    "op_SYM_PIPE_x3",
+    "op_SYM_AMPERSAND_x4",
+    "op_SYM_PIPE_x4",
+    "op_TIF",
+    "op_S_ALL",
+    "op_S_POP",
+    "op_S_CLR",
+    "op_S_L",
+    "op_SCRIPT",
+    "op_SYM_DOLLAR",
+    "op_SCRIPT_POL",
+    "op_SYM_DOLLAR_POL",
+    "op_SCRIPT_SLICE",
+    "op_SYM_DOLLAR_SLICE",
+    "op_SCRIPT_Q",
+    "op_SYM_DOLLAR_Q",
+    "op_SCRIPT_QP",
+    "op_SYM_DOLLAR_QP",
+    "op_SCRIPT_DROP",
+    "op_SYM_DOLLAR_DROP",
+    "op_SCRIPT_OVER",
+    "op_SYM_DOLLAR_OVER",
+    "op_KILL",
+    "op_SCENE",
+    "op_SCENE_G",
+    "op_SCENE_P",
+    "op_BREAK",
+    "op_BRK",
+    "op_SYNC",
+    "op_DEL_CLR",
+    "op_IIA",
+    "op_IIS",
+    "op_IIS1",
+    "op_IIS2",
+    "op_IIS3",
+    "op_IISB1",
+    "op_IISB2",
+    "op_IISB3",
+    "op_IIQ",
+    "op_IIQ1",
+    "op_IIQ2",
+    "op_IIQ3",
+    "op_IIQB1",
+    "op_IIQB2",
+    "op_IIQB3",
+    "op_IIB",
+    "op_IIB1",
+    "op_IIB2",
+    "op_IIB3",
+    "op_IIBB1",
+    "op_IIBB2",
+    "op_IIBB3",
+    "op_WW_PRESET",
+    "op_WW_POS",
+    "op_WW_SYNC",
+    "op_WW_START",
+    "op_WW_END",
+    "op_WW_PMODE",
+    "op_WW_PATTERN",
+    "op_WW_QPATTERN",
+    "op_WW_MUTE1",
+    "op_WW_MUTE2",
+    "op_WW_MUTE3",
+    "op_WW_MUTE4",
+    "op_WW_MUTEA",
+    "op_WW_MUTEB",
+    "op_MP_PRESET",
+    "op_MP_RESET",
+    "op_MP_STOP",
+    "op_ES_PRESET",
+    "op_ES_MODE",
+    "op_ES_CLOCK",
+    "op_ES_RESET",
+    "op_ES_PATTERN",
+    "op_ES_TRANS",
+    "op_ES_STOP",
+    "op_ES_TRIPLE",
+    "op_ES_MAGIC",
+    "op_ES_CV",
+    "op_OR_TRK",
+    "op_OR_CLK",
+    "op_OR_DIV",
+    "op_OR_PHASE",
+    "op_OR_RST",
+    "op_OR_WGT",
+    "op_OR_MUTE",
+    "op_OR_SCALE",
+    "op_OR_BANK",
+    "op_OR_PRESET",
+    "op_OR_RELOAD",
+    "op_OR_ROTS",
+    "op_OR_ROTW",
+    "op_OR_GRST",
+    "op_OR_CVA",
+    "op_OR_CVB",
+    "op_ANS_G_LED",
+    "op_ANS_G",
+    "op_ANS_G_P",
+    "op_ANS_A_LED",
+    "op_ANS_A",
+    "op_ANS_APP",
+    "op_KR_PRE",
+    "op_KR_PAT",
+    "op_KR_SCALE",
+    "op_KR_PERIOD",
+    "op_KR_POS",
+    "op_KR_L_ST",
+    "op_KR_L_LEN",
+    "op_KR_RES",
+    "op_KR_CV",
+    "op_KR_MUTE",
+    "op_KR_TMUTE",
+    "op_KR_CLK",
+    "op_KR_PG",
+    "op_KR_CUE",
+    "op_KR_DIR",
+    "op_KR_DUR",
+    "op_ME_PRE",
+    "op_ME_RES",
+    "op_ME_STOP",
+    "op_ME_SCALE",
+    "op_ME_PERIOD",
+    "op_ME_CV",
+    "op_LV_PRE",
+    "op_LV_RES",
+    "op_LV_POS",
+    "op_LV_L_ST",
+    "op_LV_L_LEN",
+    "op_LV_L_DIR",
+    "op_LV_CV",
+    "op_CY_PRE",
+    "op_CY_RES",
+    "op_CY_POS",
+    "op_CY_REV",
+    "op_CY_CV",
+    "op_MID_SHIFT",
+    "op_MID_SLEW",
+    "op_ARP_STY",
+    "op_ARP_HLD",
+    "op_ARP_RPT",
+    "op_ARP_GT",
+    "op_ARP_DIV",
+    "op_ARP_RES",
+    "op_ARP_SHIFT",
+    "op_ARP_SLEW",
+    "op_ARP_FIL",
+    "op_ARP_ROT",
+    "op_ARP_ER",
+    "op_JF_TR",
+    "op_JF_RMODE",
+    "op_JF_RUN",
+    "op_JF_SHIFT",
+    "op_JF_VTR",
+    "op_JF_MODE",
+    "op_JF_TICK",
+    "op_JF_VOX",
+    "op_JF_NOTE",
+    "op_JF_GOD",
+    "op_JF_TUNE",
+    "op_JF_QT",
+    "op_JF_PITCH",
+    "op_JF_ADDR",
+    "op_JF_SPEED",
+    "op_JF_TSC",
+    "op_JF_RAMP",
+    "op_JF_CURVE",
+    "op_JF_FM",
+    "op_JF_TIME",
+    "op_JF_INTONE",
+    "op_JF_POLY",
+    "op_JF_POLY_RESET",
+    "op_JF_SEL",
+    "op_WS_PLAY",
+    "op_WS_REC",
+    "op_WS_CUE",
+    "op_WS_LOOP",
+    "op_WS_S_PITCH",
+    "op_WS_S_VEL",
+    "op_WS_S_VOX",
+    "op_WS_S_NOTE",
+    "op_WS_S_AR_MODE",
+    "op_WS_S_LPG_TIME",
+    "op_WS_S_LPG_SYMMETRY",
+    "op_WS_S_CURVE",
+    "op_WS_S_RAMP",
+    "op_WS_S_FM_INDEX",
+    "op_WS_S_FM_RATIO",
+    "op_WS_S_FM_ENV",
+    "op_WS_S_VOICES",
+    "op_WS_S_PATCH",
+    "op_WS_D_FEEDBACK",
+    "op_WS_D_MIX",
+    "op_WS_D_LOWPASS",
+    "op_WS_D_FREEZE",
+    "op_WS_D_TIME",
+    "op_WS_D_LENGTH",
+    "op_WS_D_POSITION",
+    "op_WS_D_CUT",
+    "op_WS_D_FREQ_RANGE",
+    "op_WS_D_RATE",
+    "op_WS_D_FREQ",
+    "op_WS_D_CLK",
+    "op_WS_D_CLK_RATIO",
+    "op_WS_D_PLUCK",
+    "op_WS_D_MOD_RATE",
+    "op_WS_D_MOD_AMOUNT",
+    "op_WS_T_RECORD",
+    "op_WS_T_PLAY",
+    "op_WS_T_REV",
+    "op_WS_T_SPEED",
+    "op_WS_T_FREQ",
+    "op_WS_T_PRE_LEVEL",
+    "op_WS_T_MONITOR_LEVEL",
+    "op_WS_T_REC_LEVEL",
+    "op_WS_T_HEAD_ORDER",
+    "op_WS_T_LOOP_START",
+    "op_WS_T_LOOP_END",
+    "op_WS_T_LOOP_ACTIVE",
+    "op_WS_T_LOOP_SCALE",
+    "op_WS_T_LOOP_NEXT",
+    "op_WS_T_TIMESTAMP",
+    "op_WS_T_SEEK",
+    "op_WS_T_CLEARTAPE",
+    "op_CROW_SEL",
+    "op_CROW_V",
+    "op_CROW_SLEW",
+    "op_CROW_C1",
+    "op_CROW_C2",
+    "op_CROW_C3",
+    "op_CROW_C4",
+    "op_CROW_RST",
+    "op_CROW_PULSE",
+    "op_CROW_AR",
+    "op_CROW_LFO",
+    "op_CROW_IN",
+    "op_CROW_OUT",
+    "op_CROW_Q0",
+    "op_CROW_Q1",
+    "op_CROW_Q2",
+    "op_CROW_Q3",
+    "op_TO_TR",
+    "op_TO_TR_TOG",
+    "op_TO_TR_PULSE",
+    "op_TO_TR_TIME",
+    "op_TO_TR_TIME_S",
+    "op_TO_TR_TIME_M",
+    "op_TO_TR_POL",
+    "op_TO_KILL",
+    "op_TO_TR_PULSE_DIV",
+    "op_TO_TR_PULSE_MUTE",
+    "op_TO_TR_M_MUL",
+    "op_TO_M",
+    "op_TO_M_S",
+    "op_TO_M_M",
+    "op_TO_M_BPM",
+    "op_TO_M_ACT",
+    "op_TO_M_SYNC",
+    "op_TO_M_COUNT",
+    "op_TO_TR_M",
+    "op_TO_TR_M_S",
+    "op_TO_TR_M_M",
+    "op_TO_TR_M_BPM",
+    "op_TO_TR_M_ACT",
+    "op_TO_TR_M_SYNC",
+    "op_TO_TR_WIDTH",
+    "op_TO_TR_M_COUNT",
+    "op_TO_CV",
+    "op_TO_CV_SLEW",
+    "op_TO_CV_SLEW_S",
+    "op_TO_CV_SLEW_M",
+    "op_TO_CV_SET",
+    "op_TO_CV_OFF",
+    "op_TO_CV_QT",
+    "op_TO_CV_QT_SET",
+    "op_TO_CV_N",
+    "op_TO_CV_N_SET",
+    "op_TO_CV_SCALE",
+    "op_TO_CV_LOG",
+    "op_TO_CV_INIT",
+    "op_TO_TR_INIT",
+    "op_TO_INIT",
+    "op_TO_TR_P",
+    "op_TO_TR_P_DIV",
+    "op_TO_TR_P_MUTE",
+    "op_TO_OSC",
+    "op_TO_OSC_SET",
+    "op_TO_OSC_QT",
+    "op_TO_OSC_QT_SET",
+    "op_TO_OSC_FQ",
+    "op_TO_OSC_FQ_SET",
+    "op_TO_OSC_N",
+    "op_TO_OSC_N_SET",
+    "op_TO_OSC_LFO",
+    "op_TO_OSC_LFO_SET",
+    "op_TO_OSC_WAVE",
+    "op_TO_OSC_SYNC",
+    "op_TO_OSC_PHASE",
+    "op_TO_OSC_WIDTH",
+    "op_TO_OSC_RECT",
+    "op_TO_OSC_SLEW",
+    "op_TO_OSC_SLEW_S",
+    "op_TO_OSC_SLEW_M",
+    "op_TO_OSC_SCALE",
+    "op_TO_OSC_CYC",
+    "op_TO_OSC_CYC_S",
+    "op_TO_OSC_CYC_M",
+    "op_TO_OSC_CYC_SET",
+    "op_TO_OSC_CYC_S_SET",
+    "op_TO_OSC_CYC_M_SET",
+    "op_TO_OSC_CTR",
+    "op_TO_ENV_ACT",
+    "op_TO_ENV_ATT",
+    "op_TO_ENV_ATT_S",
+    "op_TO_ENV_ATT_M",
+    "op_TO_ENV_DEC",
+    "op_TO_ENV_DEC_S",
+    "op_TO_ENV_DEC_M",
+    "op_TO_ENV_TRIG",
+    "op_TO_ENV_EOR",
+    "op_TO_ENV_EOC",
+    "op_TO_ENV_LOOP",
+    "op_TO_ENV",
+    "op_TO_CV_CALIB",
+    "op_TO_CV_RESET",
+    "op_TI_PARAM",
+    "op_TI_PARAM_QT",
+    "op_TI_PARAM_N",
+    "op_TI_PARAM_SCALE",
+    "op_TI_PARAM_MAP",
+    "op_TI_IN",
+    "op_TI_IN_QT",
+    "op_TI_IN_N",
+    "op_TI_IN_SCALE",
+    "op_TI_IN_MAP",
+    "op_TI_PARAM_CALIB",
+    "op_TI_IN_CALIB",
+    "op_TI_STORE",
+    "op_TI_RESET",
+    "op_TI_PARAM_INIT",
+    "op_TI_IN_INIT",
+    "op_TI_INIT",
+    "op_TI_PRM",
+    "op_TI_PRM_QT",
+    "op_TI_PRM_N",
+    "op_TI_PRM_SCALE",
+    "op_TI_PRM_MAP",
+    "op_TI_PRM_CALIB",
+    "op_TI_PRM_INIT",
+    "op_FADER",
+    "op_FADER_SCALE",
+    "op_FADER_CAL_MIN",
+    "op_FADER_CAL_MAX",
+    "op_FADER_CAL_RESET",
+    "op_FB",
+    "op_FB_S",
+    "op_FB_C_MIN",
+    "op_FB_C_MAX",
+    "op_FB_C_R",
+    "op_SC_TR",
+    "op_SC_TR_TOG",
+    "op_SC_TR_PULSE",
+    "op_SC_TR_TIME",
+    "op_SC_TR_POL",
+    "op_SC_CV",
+    "op_SC_CV_SLEW",
+    "op_SC_CV_SET",
+    "op_SC_CV_OFF",
+    "op_SC_TR_P",
+    "op_G_RST",
+    "op_G_CLR",
+    "op_G_ROTATE",
+    "op_G_DIM",
+    "op_G_KEY",
+    "op_G_GRP",
+    "op_G_GRP_EN",
+    "op_G_GRP_RST",
+    "op_G_GRP_SW",
+    "op_G_GRP_SC",
+    "op_G_GRPI",
+    "op_G_LED",
+    "op_G_LED_C",
+    "op_G_REC",
+    "op_G_RCT",
+    "op_G_BTN",
+    "op_G_BTX",
+    "op_G_GBT",
+    "op_G_GBX",
+    "op_G_BTN_EN",
+    "op_G_BTN_V",
+    "op_G_BTN_L",
+    "op_G_BTN_X",
+    "op_G_BTN_Y",
+    "op_G_BTNI",
+    "op_G_BTNV",
+    "op_G_BTNL",
+    "op_G_BTNX",
+    "op_G_BTNY",
+    "op_G_BTN_SW",
+    "op_G_BTN_PR",
+    "op_G_GBTN_V",
+    "op_G_GBTN_L",
+    "op_G_FDR",
+    "op_G_FDX",
+    "op_G_GFD",
+    "op_G_GFX",
+    "op_G_FDR_EN",
+    "op_G_FDR_V",
+    "op_G_FDR_N",
+    "op_G_FDR_L",
+    "op_G_FDR_X",
+    "op_G_FDR_Y",
+    "op_G_FDRI",
+    "op_G_FDRV",
+    "op_G_FDRN",
+    "op_G_FDRL",
+    "op_G_FDRX",
+    "op_G_FDRY",
+    "op_G_FDR_PR",
+    "op_G_GFDR_V",
+    "op_G_GFDR_N",
+    "op_G_GFDR_L",
+    "op_G_GFDR_RN",
+    "op_G_XYP",
+    "op_G_XYP_X",
+    "op_G_XYP_Y",
+    "op_G_GBTN_C",
+    "op_G_GBTN_I",
+    "op_G_GBTN_W",
+    "op_G_GBTN_H",
+    "op_G_GBTN_X1",
+    "op_G_GBTN_X2",
+    "op_G_GBTN_Y1",
+    "op_G_GBTN_Y2",
+    "op_MA_SELECT",
+    "op_MA_STEP",
+    "op_MA_RESET",
+    "op_MA_PGM",
+    "op_MA_ON",
+    "op_MA_PON",
+    "op_MA_OFF",
+    "op_MA_POFF",
+    "op_MA_SET",
+    "op_MA_PSET",
+    "op_MA_COL",
+    "op_MA_PCOL",
+    "op_MA_ROW",
+    "op_MA_PROW",
+    "op_MA_CLR",
+    "op_MA_PCLR",
+    "op_EX",
+    "op_EX_PRESET",
+    "op_EX_PRE",
+    "op_EX_SAVE",
+    "op_EX_RESET",
+    "op_EX_ALG",
+    "op_EX_A",
+    "op_EX_CTRL",
+    "op_EX_C",
+    "op_EX_PARAM",
+    "op_EX_P",
+    "op_EX_PV",
+    "op_EX_MIN",
+    "op_EX_MAX",
+    "op_EX_REC",
+    "op_EX_PLAY",
+    "op_EX_AL_P",
+    "op_EX_AL_CLK",
+    "op_EX_M_CH",
+    "op_EX_M_N",
+    "op_EX_M_NO",
+    "op_EX_M_PB",
+    "op_EX_M_CC",
+    "op_EX_M_PRG",
+    "op_EX_M_CLK",
+    "op_EX_M_START",
+    "op_EX_M_STOP",
+    "op_EX_M_CONT",
+    "op_EX_SB_CH",
+    "op_EX_SB_N",
+    "op_EX_SB_NO",
+    "op_EX_SB_PB",
+    "op_EX_SB_CC",
+    "op_EX_SB_PRG",
+    "op_EX_SB_CLK",
+    "op_EX_SB_START",
+    "op_EX_SB_STOP",
+    "op_EX_SB_CONT",
+    "op_EX_VOX_P",
+    "op_EX_VP",
+    "op_EX_VOX",
+    "op_EX_V",
+    "op_EX_VOX_O",
+    "op_EX_VO",
+    "op_EX_NOTE",
+    "op_EX_N",
+    "op_EX_NOTE_O",
+    "op_EX_NO",
+    "op_EX_ALLOFF",
+    "op_EX_AO",
+    "op_EX_T",
+    "op_EX_TV",
+    "op_EX_LP_REC",
+    "op_EX_LP_PLAY",
+    "op_EX_LP_REV",
+    "op_EX_LP_DOWN",
+    "op_EX_LP_CLR",
+    "op_EX_LP",
+    "op_EX_LP_DOWNQ",
+    "op_EX_LP_REVQ",
+    "op_SEED",
+    "op_RAND_SEED",
+    "op_SYM_RAND_SD",
+    "op_SYM_R_SD",
+    "op_TOSS_SEED",
+    "op_SYM_TOSS_SD",
+    "op_PROB_SEED",
+    "op_SYM_PROB_SD",
+    "op_DRUNK_SEED",
+    "op_SYM_DRUNK_SD",
+    "op_P_SEED",
+    "op_SYM_P_SD",
+    "op_MI_SYM_DOLLAR",
+    "op_MI_LN",
+    "op_MI_LNV",
+    "op_MI_LV",
+    "op_MI_LVV",
+    "op_MI_LO",
+    "op_MI_LC",
+    "op_MI_LCC",
+    "op_MI_LCCV",
+    "op_MI_NL",
+    "op_MI_N",
+    "op_MI_NV",
+    "op_MI_V",
+    "op_MI_VV",
+    "op_MI_OL",
+    "op_MI_O",
+    "op_MI_CL",
+    "op_MI_C",
+    "op_MI_CC",
+    "op_MI_CCV",
+    "op_MI_LCH",
+    "op_MI_NCH",
+    "op_MI_OCH",
+    "op_MI_CCH",
+    "op_MI_LE",
+    "op_MI_CLKD",
+    "op_MI_CLKR",
+};
+
+const char *const tele_mod_symbols[E_MOD__LENGTH] = {
+    "mod_IF",
+    "mod_ELIF",
+    "mod_ELSE",
+    "mod_L",
+    "mod_W",
+    "mod_EVERY",
+    "mod_EV",
+    "mod_SKIP",
+    "mod_OTHER",
+    "mod_PROB",
+    "mod_DEL",
+    "mod_DEL_X",
+    "mod_DEL_R",
+    "mod_DEL_G",
+    "mod_DEL_B",
+    "mod_P_MAP",
+    "mod_PN_MAP",
+    "mod_S",
+    "mod_EX1",
+    "mod_EX2",
+    "mod_EX3",
+    "mod_EX4",
+    "mod_JF0",
+    "mod_JF1",
+    "mod_JF2",
+    "mod_CROWN",
+    "mod_CROW1",
+    "mod_CROW2",
+    "mod_CROW3",
+    "mod_CROW4",
+};
+#endif
+
+#endif
@@ -54,13 +54,13 @@ static int16_t wrap(int16_t value, int16_t a, int16_t b) {
 ////////////////////////////////////////////////////////////////////////////////
 // P.N /////////////////////////////////////////////////////////////////////////
 
-static void op_P_N_get(const void *NOTUSED(data), scene_state_t *ss,
-                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_N_get(const void *NOTUSED(data), scene_state_t *ss,
+                exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->variables.p_n);
 }
 
-static void op_P_N_set(const void *NOTUSED(data), scene_state_t *ss,
-                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_N_set(const void *NOTUSED(data), scene_state_t *ss,
+                exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     ss->variables.p_n = normalise_pn(a);
 }
@@ -78,15 +78,15 @@ static int16_t p_get(scene_state_t *ss, int16_t pn, int16_t idx) {
     return ss_get_pattern_val(ss, pn, idx);
 }
 
-static void op_P_get(const void *NOTUSED(data), scene_state_t *ss,
-                     exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_get(const void *NOTUSED(data), scene_state_t *ss,
+              exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = ss->variables.p_n;
     int16_t a = cs_pop(cs);
     cs_push(cs, p_get(ss, pn, a));
 }
 
-static void op_PN_get(const void *NOTUSED(data), scene_state_t *ss,
-                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_get(const void *NOTUSED(data), scene_state_t *ss,
+               exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     int16_t a = cs_pop(cs);
     cs_push(cs, p_get(ss, pn, a));
@@ -100,16 +100,16 @@ static void p_set(scene_state_t *ss, int16_t pn, int16_t idx, int16_t val) {
     tele_pattern_updated();
 }
 
-static void op_P_set(const void *NOTUSED(data), scene_state_t *ss,
-                     exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_set(const void *NOTUSED(data), scene_state_t *ss,
+              exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = ss->variables.p_n;
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
     p_set(ss, pn, a, b);
 }
 
-static void op_PN_set(const void *NOTUSED(data), scene_state_t *ss,
-                      exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_set(const void *NOTUSED(data), scene_state_t *ss,
+               exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
@@ -125,14 +125,14 @@ const tele_op_t op_PN = MAKE_GET_SET_OP(PN, op_PN_get, op_PN_set, 2, true);
 // P.L and PN.L ////////////////////////////////////////////////////////////////
 
 // Get
-static void op_P_L_get(const void *NOTUSED(data), scene_state_t *ss,
-                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_L_get(const void *NOTUSED(data), scene_state_t *ss,
+                exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(ss->variables.p_n);
     cs_push(cs, ss_get_pattern_len(ss, pn));
 }
 
-static void op_PN_L_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_L_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(cs_pop(cs));
     cs_push(cs, ss_get_pattern_len(ss, pn));
 }
@@ -149,15 +149,15 @@ static void p_l_set(scene_state_t *ss, int16_t pn, int16_t l) {
     tele_pattern_updated();
 }
 
-static void op_P_L_set(const void *NOTUSED(data), scene_state_t *ss,
-                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_L_set(const void *NOTUSED(data), scene_state_t *ss,
+                exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = ss->variables.p_n;
     int16_t a = cs_pop(cs);
     p_l_set(ss, pn, a);
 }
 
-static void op_PN_L_set(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_L_set(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     int16_t a = cs_pop(cs);
     p_l_set(ss, pn, a);
@@ -173,28 +173,28 @@ const tele_op_t op_PN_L =
 // P.WRAP and PN.WRAP //////////////////////////////////////////////////////////
 
 // Get
-static void op_P_WRAP_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_WRAP_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(ss->variables.p_n);
     cs_push(cs, ss_get_pattern_wrap(ss, pn));
 }
 
-static void op_PN_WRAP_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_WRAP_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(cs_pop(cs));
     cs_push(cs, ss_get_pattern_wrap(ss, pn));
 }
 
 // Set
-static void op_P_WRAP_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_WRAP_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = ss->variables.p_n;
     int16_t a = cs_pop(cs);
     ss_set_pattern_wrap(ss, pn, a >= 1);
 }
 
-static void op_PN_WRAP_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_WRAP_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(cs_pop(cs));
     int16_t a = cs_pop(cs);
     ss_set_pattern_wrap(ss, pn, a >= 1);
@@ -211,29 +211,29 @@ const tele_op_t op_PN_WRAP =
 // P.START and PN.START ////////////////////////////////////////////////////////
 
 // Get
-static void op_P_START_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_START_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(ss->variables.p_n);
     cs_push(cs, ss_get_pattern_start(ss, pn));
 }
 
-static void op_PN_START_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_START_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(cs_pop(cs));
     cs_push(cs, ss_get_pattern_start(ss, pn));
 }
 
 // Set
-static void op_P_START_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_START_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(ss->variables.p_n);
     int16_t a = normalise_idx(ss, pn, cs_pop(cs));
     ss_set_pattern_start(ss, pn, a);
     tele_pattern_updated();
 }
 
-static void op_PN_START_set(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_START_set(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(cs_pop(cs));
     int16_t a = normalise_idx(ss, pn, cs_pop(cs));
     ss_set_pattern_start(ss, pn, a);
@@ -251,29 +251,29 @@ const tele_op_t op_PN_START =
 // P.END and PN.END ////////////////////////////////////////////////////////////
 
 // Get
-static void op_P_END_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_END_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(ss->variables.p_n);
     cs_push(cs, ss_get_pattern_end(ss, pn));
 }
 
-static void op_PN_END_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_END_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(cs_pop(cs));
     cs_push(cs, ss_get_pattern_end(ss, pn));
 }
 
 // Set
-static void op_P_END_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_END_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(ss->variables.p_n);
     int16_t a = normalise_idx(ss, pn, cs_pop(cs));
     ss_set_pattern_end(ss, pn, a);
     tele_pattern_updated();
 }
 
-static void op_PN_END_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_END_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(cs_pop(cs));
     int16_t a = normalise_idx(ss, pn, cs_pop(cs));
     ss_set_pattern_end(ss, pn, a);
@@ -291,14 +291,14 @@ const tele_op_t op_PN_END =
 // P.I and PN.I ////////////////////////////////////////////////////////////////
 
 // Get
-static void op_P_I_get(const void *NOTUSED(data), scene_state_t *ss,
-                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_I_get(const void *NOTUSED(data), scene_state_t *ss,
+                exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(ss->variables.p_n);
     cs_push(cs, ss_get_pattern_idx(ss, pn));
 }
 
-static void op_PN_I_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_I_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(cs_pop(cs));
     cs_push(cs, ss_get_pattern_idx(ss, pn));
 }
@@ -317,15 +317,15 @@ static void p_i_set(scene_state_t *ss, int16_t pn, int16_t i) {
     tele_pattern_updated();
 }
 
-static void op_P_I_set(const void *NOTUSED(data), scene_state_t *ss,
-                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_I_set(const void *NOTUSED(data), scene_state_t *ss,
+                exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = ss->variables.p_n;
     int16_t a = cs_pop(cs);
     p_i_set(ss, pn, a);
 }
 
-static void op_PN_I_set(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_I_set(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     int16_t a = cs_pop(cs);
     p_i_set(ss, pn, a);
@@ -341,29 +341,29 @@ const tele_op_t op_PN_I =
 // P.HERE and PN.HERE //////////////////////////////////////////////////////////
 
 // Get
-static void op_P_HERE_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_HERE_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(ss->variables.p_n);
     cs_push(cs, ss_get_pattern_val(ss, pn, ss_get_pattern_idx(ss, pn)));
 }
 
-static void op_PN_HERE_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_HERE_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(cs_pop(cs));
     cs_push(cs, ss_get_pattern_val(ss, pn, ss_get_pattern_idx(ss, pn)));
 }
 
 // Set
-static void op_P_HERE_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_HERE_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(ss->variables.p_n);
     int16_t a = cs_pop(cs);
     ss_set_pattern_val(ss, pn, ss_get_pattern_idx(ss, pn), a);
     tele_pattern_updated();
 }
 
-static void op_PN_HERE_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_HERE_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = normalise_pn(cs_pop(cs));
     int16_t a = cs_pop(cs);
     ss_set_pattern_val(ss, pn, ss_get_pattern_idx(ss, pn), a);
@@ -403,16 +403,22 @@ static void p_next_inc_i(scene_state_t *ss, int16_t pn) {
 }
 
 // Get
-static void op_P_NEXT_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_NEXT_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
+    cs_push(cs, p_next(ss));
+}
+
+int16_t p_next(scene_state_t *ss) {
     const int16_t pn = normalise_pn(ss->variables.p_n);
     p_next_inc_i(ss, pn);
-    cs_push(cs, ss_get_pattern_val(ss, pn, ss_get_pattern_idx(ss, pn)));
+    const int16_t idx = ss_get_pattern_idx(ss, pn);
+    const int16_t value = ss_get_pattern_val(ss, pn, idx);
     tele_pattern_updated();
+    return value;
 }
 
-static void op_PN_NEXT_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_NEXT_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     const int16_t pn = normalise_pn(cs_pop(cs));
     p_next_inc_i(ss, pn);
     cs_push(cs, ss_get_pattern_val(ss, pn, ss_get_pattern_idx(ss, pn)));
@@ -420,8 +426,8 @@ static void op_PN_NEXT_get(const void *NOTUSED(data), scene_state_t *ss,
 }
 
 // Set
-static void op_P_NEXT_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_NEXT_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     const int16_t pn = normalise_pn(ss->variables.p_n);
     int16_t a = cs_pop(cs);
     p_next_inc_i(ss, pn);
@@ -429,8 +435,8 @@ static void op_P_NEXT_set(const void *NOTUSED(data), scene_state_t *ss,
     tele_pattern_updated();
 }
 
-static void op_PN_NEXT_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_NEXT_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     const int16_t pn = normalise_pn(cs_pop(cs));
     int16_t a = cs_pop(cs);
     p_next_inc_i(ss, pn);
@@ -470,20 +476,22 @@ static void p_prev_dec_i(scene_state_t *ss, int16_t pn) {
     else
         idx--;
 
+    if (idx > len || idx < 0 || idx >= PATTERN_LENGTH) idx = 0;
+
     ss_set_pattern_idx(ss, pn, idx);
 }
 
 // Get
-static void op_P_PREV_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_PREV_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     const int16_t pn = normalise_pn(ss->variables.p_n);
     p_prev_dec_i(ss, pn);
     cs_push(cs, ss_get_pattern_val(ss, pn, ss_get_pattern_idx(ss, pn)));
     tele_pattern_updated();
 }
 
-static void op_PN_PREV_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_PREV_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     const int16_t pn = cs_pop(cs);
     p_prev_dec_i(ss, pn);
     cs_push(cs, ss_get_pattern_val(ss, pn, ss_get_pattern_idx(ss, pn)));
@@ -491,8 +499,8 @@ static void op_PN_PREV_get(const void *NOTUSED(data), scene_state_t *ss,
 }
 
 // Set
-static void op_P_PREV_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_PREV_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     const int16_t pn = normalise_pn(ss->variables.p_n);
     const int16_t a = cs_pop(cs);
     p_prev_dec_i(ss, pn);
@@ -500,8 +508,8 @@ static void op_P_PREV_set(const void *NOTUSED(data), scene_state_t *ss,
     tele_pattern_updated();
 }
 
-static void op_PN_PREV_set(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_PREV_set(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     const int16_t pn = cs_pop(cs);
     const int16_t a = cs_pop(cs);
     p_prev_dec_i(ss, pn);
@@ -536,8 +544,8 @@ static void p_ins_get(scene_state_t *ss, int16_t pn, int16_t idx, int16_t val) {
     ss_set_pattern_val(ss, pn, idx, val);
 }
 
-static void op_P_INS_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_INS_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = ss->variables.p_n;
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
@@ -546,8 +554,8 @@ static void op_P_INS_get(const void *NOTUSED(data), scene_state_t *ss,
     tele_pattern_updated();
 }
 
-static void op_PN_INS_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_INS_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     int16_t a = cs_pop(cs);
     int16_t b = cs_pop(cs);
@@ -588,16 +596,16 @@ static int16_t p_rm_get(scene_state_t *ss, int16_t pn, int16_t idx) {
     return 0;
 }
 
-static void op_P_RM_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_RM_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = ss->variables.p_n;
     int16_t a = cs_pop(cs);
     cs_push(cs, p_rm_get(ss, pn, a));
     tele_pattern_updated();
 }
 
-static void op_PN_RM_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_RM_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     int16_t a = cs_pop(cs);
     cs_push(cs, p_rm_get(ss, pn, a));
@@ -625,15 +633,15 @@ static void p_push_get(scene_state_t *ss, int16_t pn, int16_t val) {
     tele_pattern_updated();
 }
 
-static void op_P_PUSH_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_PUSH_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = ss->variables.p_n;
     int16_t a = cs_pop(cs);
     p_push_get(ss, pn, a);
 }
 
-static void op_PN_PUSH_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_PUSH_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     int16_t a = cs_pop(cs);
     p_push_get(ss, pn, a);
@@ -658,14 +666,14 @@ static int16_t p_pop_get(scene_state_t *ss, int16_t pn) {
         return 0;
 }
 
-static void op_P_POP_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_POP_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, p_pop_get(ss, ss->variables.p_n));
     tele_pattern_updated();
 }
 
-static void op_PN_POP_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_POP_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     cs_push(cs, p_pop_get(ss, pn));
     tele_pattern_updated();
@@ -701,13 +709,13 @@ static int16_t p_min_get(scene_state_t *ss, int16_t pn) {
     return pos;
 }
 
-static void op_P_MIN_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_MIN_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, p_min_get(ss, ss->variables.p_n));
 }
 
-static void op_PN_MIN_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_MIN_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     cs_push(cs, p_min_get(ss, pn));
 }
@@ -742,13 +750,13 @@ static int16_t p_max_get(scene_state_t *ss, int16_t pn) {
     return pos;
 }
 
-static void op_P_MAX_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_MAX_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, p_max_get(ss, ss->variables.p_n));
 }
 
-static void op_PN_MAX_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_MAX_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     cs_push(cs, p_max_get(ss, pn));
 }
@@ -778,14 +786,13 @@ static void p_shuffle(scene_state_t *ss, int16_t pn) {
     tele_pattern_updated();
 }
 
-static void op_P_SHUF_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es),
-                          command_state_t *NOTUSED(cs)) {
+void op_P_SHUF_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *NOTUSED(cs)) {
     p_shuffle(ss, ss->variables.p_n);
 }
 
-static void op_PN_SHUF_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_SHUF_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     p_shuffle(ss, cs_pop(cs));
 }
 
@@ -809,15 +816,14 @@ static void p_reverse(scene_state_t *ss, int16_t pn, int16_t start,
     tele_pattern_updated();
 }
 
-static void op_P_REV_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es),
-                         command_state_t *NOTUSED(cs)) {
+void op_P_REV_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *NOTUSED(cs)) {
     int16_t pn = ss->variables.p_n;
     p_reverse(ss, pn, ss_get_pattern_start(ss, pn), ss_get_pattern_end(ss, pn));
 }
 
-static void op_PN_REV_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_REV_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     p_reverse(ss, pn, ss_get_pattern_start(ss, pn), ss_get_pattern_end(ss, pn));
 }
@@ -849,13 +855,13 @@ static void p_rotate(scene_state_t *ss, int16_t pn, int16_t shift) {
     }
 }
 
-static void op_P_ROT_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_ROT_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     p_rotate(ss, ss->variables.p_n, cs_pop(cs));
 }
 
-static void op_PN_ROT_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_ROT_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     int16_t rot = cs_pop(cs);
     p_rotate(ss, pn, rot);
@@ -879,14 +885,13 @@ static void p_cycle(scene_state_t *ss, int16_t pn) {
     tele_pattern_updated();
 }
 
-static void op_P_CYC_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es),
-                         command_state_t *NOTUSED(cs)) {
+void op_P_CYC_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *NOTUSED(cs)) {
     p_cycle(ss, ss->variables.p_n);
 }
 
-static void op_PN_CYC_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_CYC_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     p_cycle(ss, cs_pop(cs));
 }
 
@@ -909,13 +914,13 @@ static int16_t p_rnd_get(scene_state_t *ss, int16_t pn) {
                               random_next(r) % (end - start + 1) + start);
 }
 
-static void op_P_RND_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_RND_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, p_rnd_get(ss, ss->variables.p_n));
 }
 
-static void op_PN_RND_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_RND_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     cs_push(cs, p_rnd_get(ss, pn));
 }
@@ -936,16 +941,16 @@ static void p_add_get(scene_state_t *ss, int16_t pn, int16_t idx, int16_t delta,
     ss_set_pattern_val(ss, pn, idx, value);
 }
 
-static void op_P_ADD_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_ADD_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t idx = cs_pop(cs);
     int16_t delta = cs_pop(cs);
     p_add_get(ss, ss->variables.p_n, idx, delta, 0, 0, 0);
     tele_pattern_updated();
 }
 
-static void op_PN_ADD_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_ADD_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     int16_t idx = cs_pop(cs);
     int16_t delta = cs_pop(cs);
@@ -953,8 +958,8 @@ static void op_PN_ADD_get(const void *NOTUSED(data), scene_state_t *ss,
     tele_pattern_updated();
 }
 
-static void op_P_ADDW_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_ADDW_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t idx = cs_pop(cs);
     int16_t delta = cs_pop(cs);
     int16_t min = cs_pop(cs);
@@ -963,8 +968,8 @@ static void op_P_ADDW_get(const void *NOTUSED(data), scene_state_t *ss,
     tele_pattern_updated();
 }
 
-static void op_PN_ADDW_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_ADDW_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     int16_t idx = cs_pop(cs);
     int16_t delta = cs_pop(cs);
@@ -994,16 +999,16 @@ static void p_sub_get(scene_state_t *ss, int16_t pn, int16_t idx, int16_t delta,
     ss_set_pattern_val(ss, pn, idx, value);
 }
 
-static void op_P_SUB_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_SUB_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t idx = cs_pop(cs);
     int16_t delta = cs_pop(cs);
     p_sub_get(ss, ss->variables.p_n, idx, delta, 0, 0, 0);
     tele_pattern_updated();
 }
 
-static void op_PN_SUB_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_SUB_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     int16_t idx = cs_pop(cs);
     int16_t delta = cs_pop(cs);
@@ -1011,8 +1016,8 @@ static void op_PN_SUB_get(const void *NOTUSED(data), scene_state_t *ss,
     tele_pattern_updated();
 }
 
-static void op_P_SUBW_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_P_SUBW_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t idx = cs_pop(cs);
     int16_t delta = cs_pop(cs);
     int16_t min = cs_pop(cs);
@@ -1021,8 +1026,8 @@ static void op_P_SUBW_get(const void *NOTUSED(data), scene_state_t *ss,
     tele_pattern_updated();
 }
 
-static void op_PN_SUBW_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_PN_SUBW_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t pn = cs_pop(cs);
     int16_t idx = cs_pop(cs);
     int16_t delta = cs_pop(cs);
@@ -1044,7 +1049,7 @@ const tele_op_t op_PN_SUBW = MAKE_GET_OP(PN.-W, op_PN_SUBW_get, 5, false);
 // mods: P.MAP, PN.MAP /////////////////////////////////////////////////////////
 
 static void p_map(scene_state_t *ss, exec_state_t *es,
-                  const tele_command_t *post_command, int16_t pn) {
+                  const tele_command_view_t *post_command, int16_t pn) {
     pn = normalise_pn(pn);
     int16_t start = ss_get_pattern_start(ss, pn);
     int16_t end = ss_get_pattern_end(ss, pn);
@@ -1064,13 +1069,13 @@ static void p_map(scene_state_t *ss, exec_state_t *es,
 
 static void mod_P_MAP_func(scene_state_t *ss, exec_state_t *es,
                            command_state_t *cs,
-                           const tele_command_t *post_command) {
+                           const tele_command_view_t *post_command) {
     p_map(ss, es, post_command, ss->variables.p_n);
 }
 
 static void mod_PN_MAP_func(scene_state_t *ss, exec_state_t *es,
                             command_state_t *cs,
-                            const tele_command_t *post_command) {
+                            const tele_command_view_t *post_command) {
     p_map(ss, es, post_command, cs_pop(cs));
 }
 
@@ -56,4 +56,7 @@ extern const tele_op_t op_PN_SUB;
 extern const tele_op_t op_P_SUBW;
 extern const tele_op_t op_PN_SUBW;
 
+// shared with the fused commands (see fuse.h), the value of P.NEXT
+int16_t p_next(scene_state_t *ss);
+
 #endif
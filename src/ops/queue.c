@@ -4,82 +4,82 @@
 #include "state.h"
 #include "teletype_io.h"
 
-static void op_Q_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                     command_state_t *cs);
-static void op_Q_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                     command_state_t *cs);
-static void op_Q_AVG_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_AVG_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_N_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                       command_state_t *cs);
-static void op_Q_N_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                       command_state_t *cs);
-static void op_Q_CLR_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_CLR_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_GRW_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_GRW_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_SUM_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_MIN_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_MIN_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_MAX_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_MAX_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_RND_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_RND_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_SRT_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_SRT_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_REV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_SH_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_Q_SH_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_Q_ADD_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_ADD_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_SUB_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_SUB_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_MUL_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_MUL_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_DIV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_DIV_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_MOD_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_MOD_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_Q_I_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                       command_state_t *cs);
-static void op_Q_I_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                       command_state_t *cs);
-static void op_Q_2P_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_Q_2P_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_Q_P2_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_Q_P2_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
+void op_Q_get(const void *data, scene_state_t *ss, exec_state_t *es,
+              command_state_t *cs);
+void op_Q_set(const void *data, scene_state_t *ss, exec_state_t *es,
+              command_state_t *cs);
+void op_Q_AVG_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_AVG_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_N_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                command_state_t *cs);
+void op_Q_N_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                command_state_t *cs);
+void op_Q_CLR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_CLR_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_GRW_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_GRW_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_SUM_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_MIN_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_MIN_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_MAX_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_MAX_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_RND_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_RND_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_SRT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_SRT_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_REV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_SH_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_Q_SH_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_Q_ADD_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_ADD_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_SUB_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_SUB_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_MUL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_MUL_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_DIV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_DIV_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_MOD_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_MOD_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_Q_I_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                command_state_t *cs);
+void op_Q_I_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                command_state_t *cs);
+void op_Q_2P_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_Q_2P_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_Q_P2_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_Q_P2_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
 
 
 const tele_op_t op_Q = MAKE_GET_SET_OP(Q, op_Q_get, op_Q_set, 0, true);
@@ -118,16 +118,16 @@ const tele_op_t op_Q_2P =
 const tele_op_t op_Q_P2 =
     MAKE_GET_SET_OP(Q.P2,  op_Q_P2_get,  op_Q_P2_set, 0, false);
 
-static void op_Q_get(const void *NOTUSED(data), scene_state_t *ss,
-                     exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_get(const void *NOTUSED(data), scene_state_t *ss,
+              exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     cs_push(cs, q[q_n - 1]);
     if (ss->variables.q_grow && ss->variables.q_n > 1) { ss->variables.q_n--; }
 }
 
-static void op_Q_set(const void *NOTUSED(data), scene_state_t *ss,
-                     exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_set(const void *NOTUSED(data), scene_state_t *ss,
+              exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     for (int8_t i = Q_LENGTH - 1; i > 0; i--) { q[i] = q[i - 1]; }
     q[0] = cs_pop(cs);
@@ -136,8 +136,8 @@ static void op_Q_set(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_Q_AVG_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_AVG_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int32_t avg = 0;
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
@@ -151,20 +151,20 @@ static void op_Q_AVG_get(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_Q_AVG_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_AVG_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     int16_t *q = ss->variables.q;
     for (int8_t i = 0; i < Q_LENGTH; i++) { q[i] = a; }
 }
 
-static void op_Q_N_get(const void *NOTUSED(data), scene_state_t *ss,
-                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_N_get(const void *NOTUSED(data), scene_state_t *ss,
+                exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->variables.q_n);
 }
 
-static void op_Q_N_set(const void *NOTUSED(data), scene_state_t *ss,
-                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_N_set(const void *NOTUSED(data), scene_state_t *ss,
+                exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t a = cs_pop(cs);
     if (a < 1)
         a = 1;
@@ -174,28 +174,28 @@ static void op_Q_N_set(const void *NOTUSED(data), scene_state_t *ss,
 }
 
 
-static void op_Q_CLR_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_CLR_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     ss->variables.q_n = 1;
     for (int8_t i = 0; i < Q_LENGTH; i++) { q[i] = 0; }
 }
 
-static void op_Q_CLR_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_CLR_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     ss->variables.q_n = 1;
     for (int8_t i = 0; i < Q_LENGTH; i++) { q[i] = 0; }
     q[0] = cs_pop(cs);
 }
 
-static void op_Q_GRW_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_GRW_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->variables.q_grow);
 }
 
-static void op_Q_GRW_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_GRW_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     ss->variables.q_grow = cs_pop(cs);
     ss->variables.q_grow = ss->variables.q_grow < 1 ? 0 : 1;
     if (!ss->variables.q_grow && ss->variables.q_n < 1) {
@@ -203,8 +203,8 @@ static void op_Q_GRW_set(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_Q_SUM_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_SUM_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t sum = 0;
@@ -212,8 +212,8 @@ static void op_Q_SUM_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, sum);
 }
 
-static void op_Q_MIN_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_MIN_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t min = INT16_MAX;
@@ -224,8 +224,8 @@ static void op_Q_MIN_get(const void *NOTUSED(data), scene_state_t *ss,
 }
 
 
-static void op_Q_MIN_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_MIN_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t min = cs_pop(cs);
@@ -235,8 +235,8 @@ static void op_Q_MIN_set(const void *NOTUSED(data), scene_state_t *ss,
 }
 
 
-static void op_Q_MAX_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_MAX_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t max = INT16_MIN;
@@ -246,8 +246,8 @@ static void op_Q_MAX_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, max);
 }
 
-static void op_Q_MAX_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_MAX_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t max = cs_pop(cs);
@@ -257,16 +257,16 @@ static void op_Q_MAX_set(const void *NOTUSED(data), scene_state_t *ss,
 }
 
 
-static void op_Q_RND_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_RND_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     cs_push(cs, q[rand() % q_n]);
 }
 
 
-static void op_Q_RND_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_RND_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t rnd = cs_pop(cs);
@@ -293,8 +293,8 @@ static void op_Q_RND_set(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_Q_SRT_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_SRT_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int8_t min_idx = 0;
@@ -315,8 +315,8 @@ static void op_Q_SRT_get(const void *NOTUSED(data), scene_state_t *ss,
 }
 
 
-static void op_Q_SRT_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_SRT_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int8_t min_idx = 0;
@@ -349,8 +349,8 @@ static void op_Q_SRT_set(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_Q_REV_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_REV_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t tmp;
@@ -363,8 +363,8 @@ static void op_Q_REV_get(const void *NOTUSED(data), scene_state_t *ss,
 }
 
 
-static void op_Q_SH_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_SH_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t tmp = q[q_n - 1];
@@ -374,8 +374,8 @@ static void op_Q_SH_get(const void *NOTUSED(data), scene_state_t *ss,
 }
 
 
-static void op_Q_SH_set(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_SH_set(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t nb_shifts = cs_pop(cs);
@@ -392,8 +392,8 @@ static void op_Q_SH_set(const void *NOTUSED(data), scene_state_t *ss,
     for (int8_t i = 0; i < q_n; i++) { q[(i + nb_shifts) % q_n] = tmp[i]; }
 }
 
-static void op_Q_ADD_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_ADD_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t add = cs_pop(cs);
@@ -401,8 +401,8 @@ static void op_Q_ADD_get(const void *NOTUSED(data), scene_state_t *ss,
     for (int8_t i = 0; i < q_n; i++) { q[i] = q[i] + add; }
 }
 
-static void op_Q_ADD_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_ADD_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t add = cs_pop(cs);
@@ -412,8 +412,8 @@ static void op_Q_ADD_set(const void *NOTUSED(data), scene_state_t *ss,
     q[i] = q[i] + add;
 }
 
-static void op_Q_SUB_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_SUB_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t sub = cs_pop(cs);
@@ -421,8 +421,8 @@ static void op_Q_SUB_get(const void *NOTUSED(data), scene_state_t *ss,
     for (int8_t i = 0; i < q_n; i++) { q[i] = q[i] - sub; }
 }
 
-static void op_Q_SUB_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_SUB_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t sub = cs_pop(cs);
@@ -432,8 +432,8 @@ static void op_Q_SUB_set(const void *NOTUSED(data), scene_state_t *ss,
     q[i] = q[i] - sub;
 }
 
-static void op_Q_MUL_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_MUL_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t mul = cs_pop(cs);
@@ -441,8 +441,8 @@ static void op_Q_MUL_get(const void *NOTUSED(data), scene_state_t *ss,
     for (int8_t i = 0; i < q_n; i++) { q[i] = q[i] * mul; }
 }
 
-static void op_Q_MUL_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_MUL_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t mul = cs_pop(cs);
@@ -452,8 +452,8 @@ static void op_Q_MUL_set(const void *NOTUSED(data), scene_state_t *ss,
     q[i] = q[i] * mul;
 }
 
-static void op_Q_DIV_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_DIV_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t div = cs_pop(cs);
@@ -462,8 +462,8 @@ static void op_Q_DIV_get(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_Q_DIV_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_DIV_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t div = cs_pop(cs);
@@ -475,8 +475,8 @@ static void op_Q_DIV_set(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_Q_MOD_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_MOD_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t mod = cs_pop(cs);
@@ -485,8 +485,8 @@ static void op_Q_MOD_get(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_Q_MOD_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_MOD_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t q_n = ss->variables.q_n;
     int16_t mod = cs_pop(cs);
@@ -498,8 +498,8 @@ static void op_Q_MOD_set(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_Q_I_get(const void *NOTUSED(data), scene_state_t *ss,
-                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_I_get(const void *NOTUSED(data), scene_state_t *ss,
+                exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int8_t i = cs_pop(cs);
     i = i < 0 ? 0 : i;
@@ -507,8 +507,8 @@ static void op_Q_I_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, q[i]);
 }
 
-static void op_Q_I_set(const void *NOTUSED(data), scene_state_t *ss,
-                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_I_set(const void *NOTUSED(data), scene_state_t *ss,
+                exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int8_t i = cs_pop(cs);
     int16_t value = cs_pop(cs);
@@ -517,8 +517,8 @@ static void op_Q_I_set(const void *NOTUSED(data), scene_state_t *ss,
     q[i] = value;
 }
 
-static void op_Q_2P_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_2P_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t pn = ss->variables.p_n;
     int8_t end_at = PATTERN_LENGTH < Q_LENGTH ? PATTERN_LENGTH : Q_LENGTH;
@@ -526,8 +526,8 @@ static void op_Q_2P_get(const void *NOTUSED(data), scene_state_t *ss,
     tele_pattern_updated();
 }
 
-static void op_Q_2P_set(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_2P_set(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t pn = cs_pop(cs);
     pn = pn < 0 ? 0 : pn;
@@ -537,8 +537,8 @@ static void op_Q_2P_set(const void *NOTUSED(data), scene_state_t *ss,
     tele_pattern_updated();
 }
 
-static void op_Q_P2_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_P2_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t pn = ss->variables.p_n;
     int8_t end_at = PATTERN_LENGTH < Q_LENGTH ? PATTERN_LENGTH : Q_LENGTH;
@@ -547,8 +547,8 @@ static void op_Q_P2_get(const void *NOTUSED(data), scene_state_t *ss,
     }
 }
 
-static void op_Q_P2_set(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_Q_P2_set(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t *q = ss->variables.q;
     int16_t pn = cs_pop(cs);
     pn = pn < 0 ? 0 : pn;
@@ -10,14 +10,14 @@
 
 #define MAKE_SEED_ALIAS_OP(n, v) MAKE_SEED_OP(n, v)
 
-static void op_peek_seed_i16(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_poke_seed_i16(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_SEED_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_SEED_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
+void op_peek_seed_i16(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_poke_seed_i16(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_SEED_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_SEED_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
 
 // clang-format off
 const tele_op_t op_SEED			= MAKE_GET_SET_OP(SEED, op_SEED_get, op_SEED_set, 0, true);
@@ -34,16 +34,16 @@ const tele_op_t op_P_SEED		= MAKE_SEED_OP(P.SEED, rand_states.s.pattern);
 const tele_op_t op_SYM_P_SD		= MAKE_SEED_ALIAS_OP(P.SD, rand_states.s.pattern);
 // clang-format on
 
-static void op_peek_seed_i16(const void *data, scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_peek_seed_i16(const void *data, scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     char *base = (char *)ss;
     size_t offset = (size_t)data;
     tele_rand_t *ptr = (tele_rand_t *)(base + offset);
     cs_push(cs, ptr->seed);
 }
 
-static void op_poke_seed_i16(const void *data, scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_poke_seed_i16(const void *data, scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t s = cs_pop(cs);
 
     char *base = (char *)ss;
@@ -54,20 +54,12 @@ static void op_poke_seed_i16(const void *data, scene_state_t *ss,
     random_seed(&ptr->rand, ptr->seed);
 }
 
-static void op_SEED_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_SEED_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->variables.seed);
 }
 
-static void op_SEED_set(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
-    uint16_t s = cs_pop(cs);
-
-    for (u8 i = 0; i < RAND_STATES_COUNT; i++) {
-        tele_rand_t *r = &ss->rand_states.a[i];
-        r->seed = s;
-        random_seed(&r->rand, r->seed);
-    }
-
-    ss->variables.seed = s;
+void op_SEED_set(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
+    ss_rand_seed(ss, cs_pop(cs));
 }
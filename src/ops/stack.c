@@ -5,15 +5,15 @@
 #include "teletype_io.h"
 
 static void mod_S_func(scene_state_t *ss, exec_state_t *es, command_state_t *cs,
-                       const tele_command_t *post_command);
-static void op_S_ALL_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_S_POP_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_S_CLR_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_S_L_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                       command_state_t *cs);
+                       const tele_command_view_t *post_command);
+void op_S_ALL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_S_POP_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_S_CLR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_S_L_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                command_state_t *cs);
 
 const tele_mod_t mod_S = MAKE_MOD(S, mod_S_func, 0);
 
@@ -24,41 +24,39 @@ const tele_op_t op_S_L = MAKE_GET_OP(S.L, op_S_L_get, 0, true);
 
 static void mod_S_func(scene_state_t *ss, exec_state_t *NOTUSED(es),
                        command_state_t *NOTUSED(cs),
-                       const tele_command_t *post_command) {
-    if (ss->stack_op.top < STACK_OP_SIZE) {
-        copy_command(&ss->stack_op.commands[ss->stack_op.top], post_command);
-        ss->stack_op.top++;
-        tele_has_stack(ss->stack_op.top > 0);
-    }
+                       const tele_command_view_t *post_command) {
+    if (ss_stack_op_push(ss, post_command)) tele_has_stack(true);
 }
 
-static void op_S_ALL_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *es, command_state_t *NOTUSED(cs)) {
+void op_S_ALL_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *es, command_state_t *NOTUSED(cs)) {
     for (int16_t i = 0; i < ss->stack_op.top; i++) {
-        process_command(ss, es,
-                        &ss->stack_op.commands[ss->stack_op.top - i - 1]);
+        tele_command_t stacked;
+        const tele_command_view_t command =
+            ss_stack_op_command(ss, ss->stack_op.top - i - 1, &stacked);
+        process_command(ss, es, &command);
     }
-    ss->stack_op.top = 0;
+    ss_stack_op_clear(ss);
     tele_has_stack(false);
 }
 
-static void op_S_POP_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *es, command_state_t *NOTUSED(cs)) {
-    if (ss->stack_op.top) {
-        ss->stack_op.top--;
-        process_command(ss, es, &ss->stack_op.commands[ss->stack_op.top]);
+void op_S_POP_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *es, command_state_t *NOTUSED(cs)) {
+    tele_command_t stacked;
+    tele_command_view_t command;
+    if (ss_stack_op_pop(ss, &stacked, &command)) {
+        process_command(ss, es, &command);
         if (ss->stack_op.top == 0) tele_has_stack(false);
     }
 }
 
-static void op_S_CLR_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es),
-                         command_state_t *NOTUSED(cs)) {
-    ss->stack_op.top = 0;
+void op_S_CLR_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *NOTUSED(cs)) {
+    ss_stack_op_clear(ss);
     tele_has_stack(false);
 }
 
-static void op_S_L_get(const void *NOTUSED(data), scene_state_t *ss,
-                       exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_S_L_get(const void *NOTUSED(data), scene_state_t *ss,
+                exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->stack_op.top);
 }
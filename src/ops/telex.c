@@ -7,218 +7,218 @@
 #include "teletype_io.h"
 
 // TXo Methods
-static void op_TO_TR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_TO_TR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_TO_TR_TOG_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_TO_TR_PULSE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TO_TR_TIME_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TO_TR_TIME_S_get(const void *data, scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs);
-static void op_TO_TR_TOG_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_TO_TR_PULSE_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TO_TR_TIME_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TO_TR_TIME_S_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TO_TR_TIME_M_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TO_TR_POL_get(const void *data, scene_state_t *ss,
+void op_TO_TR_TIME_M_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
+void op_TO_TR_POL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_TO_KILL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+
+void op_TO_TR_PULSE_DIV_get(const void *data, scene_state_t *ss,
+                            exec_state_t *es, command_state_t *cs);
+void op_TO_TR_PULSE_MUTE_get(const void *data, scene_state_t *ss,
                              exec_state_t *es, command_state_t *cs);
-static void op_TO_KILL_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
+void op_TO_TR_M_MUL_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
 
-static void op_TO_TR_PULSE_DIV_get(const void *data, scene_state_t *ss,
-                                   exec_state_t *es, command_state_t *cs);
-static void op_TO_TR_PULSE_MUTE_get(const void *data, scene_state_t *ss,
-                                    exec_state_t *es, command_state_t *cs);
-static void op_TO_TR_M_MUL_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
+void op_TO_M_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_TO_M_S_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_TO_M_M_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_TO_M_BPM_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_TO_M_ACT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_TO_M_SYNC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_TO_M_COUNT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+
+void op_TO_TR_M_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_TO_TR_M_S_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_TO_TR_M_M_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_TO_TR_M_BPM_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TO_TR_M_ACT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TO_TR_M_SYNC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
+void op_TO_TR_WIDTH_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TO_TR_M_COUNT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                          command_state_t *cs);
 
-static void op_TO_M_get(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_TO_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_TO_CV_SLEW_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TO_CV_SLEW_S_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
+void op_TO_CV_SLEW_M_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
+void op_TO_CV_SET_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_TO_CV_OFF_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_TO_CV_QT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_TO_CV_QT_SET_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
+void op_TO_CV_N_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_TO_CV_N_SET_get(const void *data, scene_state_t *ss, exec_state_t *es,
                         command_state_t *cs);
-static void op_TO_M_S_get(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_TO_CV_SCALE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TO_CV_LOG_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+
+void op_TO_OSC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_TO_OSC_SET_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TO_OSC_QT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_TO_OSC_QT_SET_get(const void *data, scene_state_t *ss, exec_state_t *es,
                           command_state_t *cs);
-static void op_TO_M_M_get(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_TO_OSC_FQ_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
+void op_TO_OSC_FQ_SET_get(const void *data, scene_state_t *ss, exec_state_t *es,
                           command_state_t *cs);
-static void op_TO_M_BPM_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_TO_M_ACT_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_TO_M_SYNC_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_TO_M_COUNT_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
+void op_TO_OSC_N_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_TO_OSC_N_SET_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
 
-static void op_TO_TR_M_get(const void *data, scene_state_t *ss,
+void op_TO_OSC_LFO_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TO_OSC_LFO_SET_get(const void *data, scene_state_t *ss,
                            exec_state_t *es, command_state_t *cs);
-static void op_TO_TR_M_S_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_TO_TR_M_M_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_TO_TR_M_BPM_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TO_TR_M_ACT_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TO_TR_M_SYNC_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TO_TR_WIDTH_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TO_TR_M_COUNT_get(const void *data, scene_state_t *ss,
-                                 exec_state_t *es, command_state_t *cs);
-
-static void op_TO_CV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_TO_OSC_WAVE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TO_OSC_SYNC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TO_OSC_PHASE_get(const void *data, scene_state_t *ss, exec_state_t *es,
                          command_state_t *cs);
-static void op_TO_CV_SLEW_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TO_CV_SLEW_S_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TO_CV_SLEW_M_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TO_CV_SET_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_TO_CV_OFF_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-static void op_TO_CV_QT_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_TO_CV_QT_SET_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TO_CV_N_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
-static void op_TO_CV_N_SET_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TO_CV_SCALE_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TO_CV_LOG_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
-
-static void op_TO_OSC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_TO_OSC_WIDTH_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
+void op_TO_OSC_RECT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TO_OSC_SLEW_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TO_OSC_SLEW_S_get(const void *data, scene_state_t *ss, exec_state_t *es,
                           command_state_t *cs);
-static void op_TO_OSC_SET_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_QT_get(const void *data, scene_state_t *ss,
+void op_TO_OSC_SLEW_M_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                          command_state_t *cs);
+void op_TO_OSC_SCALE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
+void op_TO_OSC_CYC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TO_OSC_CYC_S_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
+void op_TO_OSC_CYC_M_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
+void op_TO_OSC_CYC_SET_get(const void *data, scene_state_t *ss,
+                           exec_state_t *es, command_state_t *cs);
+void op_TO_OSC_CYC_S_SET_get(const void *data, scene_state_t *ss,
                              exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_QT_SET_get(const void *data, scene_state_t *ss,
-                                 exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_FQ_get(const void *data, scene_state_t *ss,
+void op_TO_OSC_CYC_M_SET_get(const void *data, scene_state_t *ss,
                              exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_FQ_SET_get(const void *data, scene_state_t *ss,
-                                 exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_N_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_N_SET_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-
-static void op_TO_OSC_LFO_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_LFO_SET_get(const void *data, scene_state_t *ss,
-                                  exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_WAVE_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_SYNC_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_PHASE_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_WIDTH_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_RECT_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_SLEW_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_SLEW_S_get(const void *data, scene_state_t *ss,
-                                 exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_SLEW_M_get(const void *data, scene_state_t *ss,
-                                 exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_SCALE_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_CYC_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_CYC_S_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_CYC_M_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_CYC_SET_get(const void *data, scene_state_t *ss,
-                                  exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_CYC_S_SET_get(const void *data, scene_state_t *ss,
-                                    exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_CYC_M_SET_get(const void *data, scene_state_t *ss,
-                                    exec_state_t *es, command_state_t *cs);
-static void op_TO_OSC_CTR_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-
-static void op_TO_ENV_ACT_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TO_ENV_ATT_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TO_ENV_ATT_S_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TO_ENV_ATT_M_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TO_ENV_DEC_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TO_ENV_DEC_S_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TO_ENV_DEC_M_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TO_ENV_TRIG_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-
-static void op_TO_ENV_EOR_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TO_ENV_EOC_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TO_ENV_LOOP_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-
-static void op_TO_CV_INIT_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TO_TR_INIT_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TO_INIT_get(const void *data, scene_state_t *ss,
-                           exec_state_t *es, command_state_t *cs);
+void op_TO_OSC_CTR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+
+void op_TO_ENV_ACT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TO_ENV_ATT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TO_ENV_ATT_S_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
+void op_TO_ENV_ATT_M_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
+void op_TO_ENV_DEC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TO_ENV_DEC_S_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
+void op_TO_ENV_DEC_M_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
+void op_TO_ENV_TRIG_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
 
-static void op_TO_ENV_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                          command_state_t *cs);
+void op_TO_ENV_EOR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TO_ENV_EOC_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TO_ENV_LOOP_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+
+void op_TO_CV_INIT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TO_TR_INIT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TO_INIT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+
+void op_TO_ENV_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
 
-static void op_TO_CV_CALIB_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TO_CV_RESET_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
+void op_TO_CV_CALIB_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TO_CV_RESET_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
 
 // TXi Methods
-static void op_TI_PARAM_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_TI_PARAM_QT_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TI_PARAM_N_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TI_PARAM_SCALE_get(const void *data, scene_state_t *ss,
-                                  exec_state_t *es, command_state_t *cs);
-static void op_TI_PARAM_MAP_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-
-static void op_TI_IN_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_TI_IN_QT_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_TI_IN_N_get(const void *data, scene_state_t *ss,
+void op_TI_PARAM_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_TI_PARAM_QT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TI_PARAM_N_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TI_PARAM_SCALE_get(const void *data, scene_state_t *ss,
                            exec_state_t *es, command_state_t *cs);
-static void op_TI_IN_SCALE_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TI_IN_MAP_get(const void *data, scene_state_t *ss,
-                             exec_state_t *es, command_state_t *cs);
+void op_TI_PARAM_MAP_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
 
-static void op_TI_PARAM_CALIB_get(const void *data, scene_state_t *ss,
-                                  exec_state_t *es, command_state_t *cs);
-static void op_TI_IN_CALIB_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TI_STORE_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_TI_RESET_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
+void op_TI_IN_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_TI_IN_QT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_TI_IN_N_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
+void op_TI_IN_SCALE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TI_IN_MAP_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                      command_state_t *cs);
 
-static void op_TI_PARAM_INIT_get(const void *data, scene_state_t *ss,
-                                 exec_state_t *es, command_state_t *cs);
-static void op_TI_IN_INIT_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TI_INIT_get(const void *data, scene_state_t *ss,
+void op_TI_PARAM_CALIB_get(const void *data, scene_state_t *ss,
                            exec_state_t *es, command_state_t *cs);
+void op_TI_IN_CALIB_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TI_STORE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_TI_RESET_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+
+void op_TI_PARAM_INIT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                          command_state_t *cs);
+void op_TI_IN_INIT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TI_INIT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                    command_state_t *cs);
 
 // clang-format off
 
@@ -448,444 +448,410 @@ void PRMInit(uint8_t input) {
 
 // TELEX get and set methods
 // TXo
-static void op_TO_TR_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_TR_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_TR, cs);
 }
-static void op_TO_TR_TOG_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_TR_TOG_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXCmd(TO, TO_TR_TOG, cs_pop(cs));
 }
-static void op_TO_TR_PULSE_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_TR_PULSE_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXCmd(TO, TO_TR_PULSE, cs_pop(cs));
 }
-static void op_TO_TR_TIME_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_TR_TIME_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_TR_TIME, cs);
 }
-static void op_TO_TR_TIME_S_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TO_TR_TIME_S_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_TR_TIME_S, cs);
 }
-static void op_TO_TR_TIME_M_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TO_TR_TIME_M_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_TR_TIME_M, cs);
 }
-static void op_TO_TR_POL_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_TR_POL_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_TR_POL, cs);
 }
-static void op_TO_KILL_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_KILL_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXCmd(TO, TO_KILL, cs_pop(cs));
 }
-static void op_TO_TR_PULSE_DIV_get(const void *NOTUSED(data), scene_state_t *ss,
-                                   exec_state_t *NOTUSED(es),
-                                   command_state_t *cs) {
+void op_TO_TR_PULSE_DIV_get(const void *NOTUSED(data), scene_state_t *ss,
+                            exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_TR_PULSE_DIV, cs);
 }
-static void op_TO_TR_PULSE_MUTE_get(const void *NOTUSED(data),
-                                    scene_state_t *ss,
-                                    exec_state_t *NOTUSED(es),
-                                    command_state_t *cs) {
+void op_TO_TR_PULSE_MUTE_get(const void *NOTUSED(data), scene_state_t *ss,
+                             exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_TR_PULSE_MUTE, cs);
 }
-static void op_TO_TR_M_MUL_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_TR_M_MUL_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_TR_M_MUL, cs);
 }
-static void op_TO_M_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_M_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXDeviceSet(TO, TO_M, cs);
 }
-static void op_TO_M_S_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_M_S_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXDeviceSet(TO, TO_M_S, cs);
 }
-static void op_TO_M_M_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_M_M_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXDeviceSet(TO, TO_M_M, cs);
 }
-static void op_TO_M_BPM_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_M_BPM_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXDeviceSet(TO, TO_M_BPM, cs);
 }
-static void op_TO_M_ACT_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_M_ACT_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXDeviceSet(TO, TO_M_ACT, cs);
 }
 
-static void op_TO_M_SYNC_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_M_SYNC_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXCmd(TO, TO_M_SYNC, DeviceToOutput(cs_pop(cs)));
 }
 
-static void op_TO_M_COUNT_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_M_COUNT_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXDeviceSet(TO, TO_M_COUNT, cs);
 }
-static void op_TO_TR_M_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_TR_M_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_TR_M, cs);
 }
-static void op_TO_TR_M_S_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_TR_M_S_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_TR_M_S, cs);
 }
-static void op_TO_TR_M_M_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_TR_M_M_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_TR_M_M, cs);
 }
-static void op_TO_TR_M_BPM_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_TR_M_BPM_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_TR_M_BPM, cs);
 }
-static void op_TO_TR_M_ACT_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_TR_M_ACT_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_TR_M_ACT, cs);
 }
-static void op_TO_TR_M_SYNC_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TO_TR_M_SYNC_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXCmd(TO, TO_TR_M_SYNC, cs_pop(cs));
 }
-static void op_TO_TR_WIDTH_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_TR_WIDTH_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_TR_WIDTH, cs);
 }
-static void op_TO_TR_M_COUNT_get(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs) {
+void op_TO_TR_M_COUNT_get(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_TR_M_COUNT, cs);
 }
-static void op_TO_CV_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_CV_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_CV, cs);
 }
-static void op_TO_CV_SLEW_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_CV_SLEW_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_CV_SLEW, cs);
 }
-static void op_TO_CV_SLEW_S_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TO_CV_SLEW_S_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_CV_SLEW_S, cs);
 }
-static void op_TO_CV_SLEW_M_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TO_CV_SLEW_M_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_CV_SLEW_M, cs);
 }
-static void op_TO_CV_SET_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_CV_SET_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_CV_SET, cs);
 }
-static void op_TO_CV_OFF_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_CV_OFF_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_CV_OFF, cs);
 }
-static void op_TO_CV_QT_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_CV_QT_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_CV_QT, cs);
 }
-static void op_TO_CV_QT_SET_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TO_CV_QT_SET_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_CV_QT_SET, cs);
 }
-static void op_TO_CV_N_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_CV_N_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_CV_N, cs);
 }
-static void op_TO_CV_N_SET_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_CV_N_SET_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_CV_N_SET, cs);
 }
-static void op_TO_CV_SCALE_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_CV_SCALE_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_CV_SCALE, cs);
 }
-static void op_TO_CV_LOG_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_CV_LOG_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_CV_LOG, cs);
 }
-static void op_TO_OSC_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_OSC_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC, cs);
 }
-static void op_TO_OSC_SET_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_OSC_SET_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_SET, cs);
 }
-static void op_TO_OSC_QT_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_OSC_QT_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_QT, cs);
 }
-static void op_TO_OSC_QT_SET_get(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs) {
+void op_TO_OSC_QT_SET_get(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_QT_SET, cs);
 }
-static void op_TO_OSC_FQ_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_OSC_FQ_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_FQ, cs);
 }
-static void op_TO_OSC_FQ_SET_get(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs) {
+void op_TO_OSC_FQ_SET_get(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_FQ_SET, cs);
 }
-static void op_TO_OSC_N_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_OSC_N_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_N, cs);
 }
-static void op_TO_OSC_N_SET_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TO_OSC_N_SET_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_N_SET, cs);
 }
-static void op_TO_OSC_LFO_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_OSC_LFO_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_LFO, cs);
 }
-static void op_TO_OSC_LFO_SET_get(const void *NOTUSED(data), scene_state_t *ss,
-                                  exec_state_t *NOTUSED(es),
-                                  command_state_t *cs) {
+void op_TO_OSC_LFO_SET_get(const void *NOTUSED(data), scene_state_t *ss,
+                           exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_LFO_SET, cs);
 }
-static void op_TO_OSC_WAVE_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_OSC_WAVE_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_WAVE, cs);
 }
-static void op_TO_OSC_SYNC_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_OSC_SYNC_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXCmd(TO, TO_OSC_SYNC, cs_pop(cs));
 }
-static void op_TO_OSC_PHASE_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TO_OSC_PHASE_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_PHASE, cs);
 }
-static void op_TO_OSC_WIDTH_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TO_OSC_WIDTH_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_WIDTH, cs);
 }
-static void op_TO_OSC_RECT_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_OSC_RECT_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_RECT, cs);
 }
-static void op_TO_OSC_SLEW_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_OSC_SLEW_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_SLEW, cs);
 }
-static void op_TO_OSC_SLEW_S_get(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs) {
+void op_TO_OSC_SLEW_S_get(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_SLEW_S, cs);
 }
-static void op_TO_OSC_SLEW_M_get(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs) {
+void op_TO_OSC_SLEW_M_get(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_SLEW_M, cs);
 }
-static void op_TO_OSC_SCALE_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TO_OSC_SCALE_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_SCALE, cs);
 }
-static void op_TO_OSC_CYC_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_OSC_CYC_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_CYC, cs);
 }
-static void op_TO_OSC_CYC_S_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TO_OSC_CYC_S_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_CYC_S, cs);
 }
-static void op_TO_OSC_CYC_M_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TO_OSC_CYC_M_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_CYC_M, cs);
 }
-static void op_TO_OSC_CYC_SET_get(const void *NOTUSED(data), scene_state_t *ss,
-                                  exec_state_t *NOTUSED(es),
-                                  command_state_t *cs) {
+void op_TO_OSC_CYC_SET_get(const void *NOTUSED(data), scene_state_t *ss,
+                           exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_CYC_SET, cs);
 }
-static void op_TO_OSC_CYC_S_SET_get(const void *NOTUSED(data),
-                                    scene_state_t *ss,
-                                    exec_state_t *NOTUSED(es),
-                                    command_state_t *cs) {
+void op_TO_OSC_CYC_S_SET_get(const void *NOTUSED(data), scene_state_t *ss,
+                             exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_CYC_S_SET, cs);
 }
-static void op_TO_OSC_CYC_M_SET_get(const void *NOTUSED(data),
-                                    scene_state_t *ss,
-                                    exec_state_t *NOTUSED(es),
-                                    command_state_t *cs) {
+void op_TO_OSC_CYC_M_SET_get(const void *NOTUSED(data), scene_state_t *ss,
+                             exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_CYC_M_SET, cs);
 }
-static void op_TO_OSC_CTR_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_OSC_CTR_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_OSC_CTR, cs);
 }
-static void op_TO_ENV_ACT_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_ENV_ACT_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_ENV_ACT, cs);
 }
-static void op_TO_ENV_ATT_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_ENV_ATT_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_ENV_ATT, cs);
 }
-static void op_TO_ENV_ATT_S_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TO_ENV_ATT_S_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_ENV_ATT_S, cs);
 }
-static void op_TO_ENV_ATT_M_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TO_ENV_ATT_M_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_ENV_ATT_M, cs);
 }
-static void op_TO_ENV_DEC_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_ENV_DEC_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_ENV_DEC, cs);
 }
-static void op_TO_ENV_DEC_S_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TO_ENV_DEC_S_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_ENV_DEC_S, cs);
 }
-static void op_TO_ENV_DEC_M_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TO_ENV_DEC_M_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_ENV_DEC_M, cs);
 }
-static void op_TO_ENV_TRIG_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_ENV_TRIG_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXCmd(TO, TO_ENV_TRIG, cs_pop(cs));
 }
-static void op_TO_ENV_EOR_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_ENV_EOR_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_ENV_EOR, cs);
 }
-static void op_TO_ENV_EOC_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_ENV_EOC_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_ENV_EOC, cs);
 }
-static void op_TO_ENV_LOOP_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_ENV_LOOP_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_ENV_LOOP, cs);
 }
-static void op_TO_CV_INIT_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_CV_INIT_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXCmd(TO, TO_CV_INIT, cs_pop(cs));
 }
-static void op_TO_TR_INIT_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_TR_INIT_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXCmd(TO, TO_TR_INIT, cs_pop(cs));
 }
-static void op_TO_INIT_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_INIT_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXCmd(TO, TO_INIT, DeviceToOutput(cs_pop(cs)));
 }
 
 
-static void op_TO_ENV_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_ENV_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TO, TO_ENV, cs);
 }
-static void op_TO_CV_CALIB_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_CV_CALIB_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXCmd(TO, TO_CV_CALIB, cs_pop(cs));
 }
-static void op_TO_CV_RESET_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TO_CV_RESET_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXCmd(TO, TO_CV_RESET, cs_pop(cs));
 }
 
 // TXi
-static void op_TI_PARAM_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TI_PARAM_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXReceive(TI, cs, 0, false);
 }
-static void op_TI_PARAM_QT_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TI_PARAM_QT_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXReceive(TI, cs, 1, false);
 }
-static void op_TI_PARAM_N_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TI_PARAM_N_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXReceive(TI, cs, 2, false);
 }
-static void op_TI_PARAM_SCALE_get(const void *NOTUSED(data), scene_state_t *ss,
-                                  exec_state_t *NOTUSED(es),
-                                  command_state_t *cs) {
+void op_TI_PARAM_SCALE_get(const void *NOTUSED(data), scene_state_t *ss,
+                           exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TI, TI_PARAM_SCALE, cs);
 }
-static void op_TI_PARAM_MAP_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TI_PARAM_MAP_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t output = cs_pop(cs);
     int16_t bottom = cs_pop(cs);
     int16_t top = cs_pop(cs);
     TXSend(TI, TI_PARAM_TOP, output, top, true);
     TXSend(TI, TI_PARAM_BOT, output, bottom, true);
 }
-static void op_TI_IN_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TI_IN_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXReceive(TI, cs, 0, true);
 }
-static void op_TI_IN_QT_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TI_IN_QT_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXReceive(TI, cs, 1, true);
 }
-static void op_TI_IN_N_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TI_IN_N_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXReceive(TI, cs, 2, true);
 }
-static void op_TI_IN_SCALE_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TI_IN_SCALE_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TI, TI_IN_SCALE, cs);
 }
-static void op_TI_IN_MAP_get(const void *NOTUSED(data), scene_state_t *ss,
-                             exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TI_IN_MAP_get(const void *NOTUSED(data), scene_state_t *ss,
+                      exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t output = cs_pop(cs);
     int16_t bottom = cs_pop(cs);
     int16_t top = cs_pop(cs);
     TXSend(TI, TI_IN_TOP, output, top, true);
     TXSend(TI, TI_IN_BOT, output, bottom, true);
 }
-static void op_TI_PARAM_CALIB_get(const void *NOTUSED(data), scene_state_t *ss,
-                                  exec_state_t *NOTUSED(es),
-                                  command_state_t *cs) {
+void op_TI_PARAM_CALIB_get(const void *NOTUSED(data), scene_state_t *ss,
+                           exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TI, TI_PARAM_CALIB, cs);
 }
-static void op_TI_IN_CALIB_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TI_IN_CALIB_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXSet(TI, TI_IN_CALIB, cs);
 }
-static void op_TI_STORE_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TI_STORE_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXCmd(TI, TI_STORE, DeviceToOutput(cs_pop(cs)));
 }
-static void op_TI_RESET_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TI_RESET_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     TXCmd(TI, TI_RESET, DeviceToOutput(cs_pop(cs)));
 }
-static void op_TI_PARAM_INIT_get(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs) {
+void op_TI_PARAM_INIT_get(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs) {
     PRMInit(cs_pop(cs));
 }
-static void op_TI_IN_INIT_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TI_IN_INIT_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     INInit(cs_pop(cs));
 }
-static void op_TI_INIT_get(const void *NOTUSED(data), scene_state_t *ss,
-                           exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TI_INIT_get(const void *NOTUSED(data), scene_state_t *ss,
+                    exec_state_t *NOTUSED(es), command_state_t *cs) {
     uint8_t end = cs_pop(cs) * 4;
     uint8_t start = end - 3;
     uint8_t i;
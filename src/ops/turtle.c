@@ -7,68 +7,68 @@
 #include "teletype_io.h"
 #include "turtle.h"
 
-static void op_TURTLE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_TURTLE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_TURTLE_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                   command_state_t *cs);
+void op_TURTLE_X_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_TURTLE_X_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_TURTLE_Y_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_TURTLE_Y_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_TURTLE_MOVE_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TURTLE_F_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                     command_state_t *cs);
+void op_TURTLE_FX1_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TURTLE_FX1_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TURTLE_FY1_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TURTLE_FY1_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TURTLE_FX2_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TURTLE_FX2_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TURTLE_FY2_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TURTLE_FY2_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TURTLE_SPEED_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
+void op_TURTLE_SPEED_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                         command_state_t *cs);
+void op_TURTLE_DIR_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TURTLE_DIR_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                       command_state_t *cs);
+void op_TURTLE_STEP_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TURTLE_BUMP_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TURTLE_BUMP_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TURTLE_WRAP_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TURTLE_WRAP_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TURTLE_BOUNCE_get(const void *data, scene_state_t *ss, exec_state_t *es,
                           command_state_t *cs);
-static void op_TURTLE_set(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_TURTLE_BOUNCE_set(const void *data, scene_state_t *ss, exec_state_t *es,
                           command_state_t *cs);
-static void op_TURTLE_X_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_X_set(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_Y_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_Y_set(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_MOVE_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_F_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_FX1_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_FX1_set(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_FY1_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_FY1_set(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_FX2_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_FX2_set(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_FY2_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_FY2_set(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_SPEED_get(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_SPEED_set(const void *data, scene_state_t *ss,
-                                exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_DIR_get(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_DIR_set(const void *data, scene_state_t *ss,
-                              exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_STEP_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_BUMP_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_BUMP_set(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_WRAP_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_WRAP_set(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_BOUNCE_get(const void *data, scene_state_t *ss,
-                                 exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_BOUNCE_set(const void *data, scene_state_t *ss,
-                                 exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_SCRIPT_set(const void *data, scene_state_t *ss,
-                                 exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_SCRIPT_get(const void *data, scene_state_t *ss,
-                                 exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_SHOW_set(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
-static void op_TURTLE_SHOW_get(const void *data, scene_state_t *ss,
-                               exec_state_t *es, command_state_t *cs);
+void op_TURTLE_SCRIPT_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                          command_state_t *cs);
+void op_TURTLE_SCRIPT_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                          command_state_t *cs);
+void op_TURTLE_SHOW_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
+void op_TURTLE_SHOW_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                        command_state_t *cs);
 
 const tele_op_t op_TURTLE =
     MAKE_GET_SET_OP(@, op_TURTLE_get, op_TURTLE_set, 0, true);
@@ -104,49 +104,49 @@ const tele_op_t op_TURTLE_SCRIPT = MAKE_GET_SET_OP(
 const tele_op_t op_TURTLE_SHOW =
     MAKE_GET_SET_OP(@SHOW, op_TURTLE_SHOW_get, op_TURTLE_SHOW_set, 0, true);
 
-static void op_TURTLE_get(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_get(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss_turtle_get_val(ss, &ss->turtle));
 }
 
-static void op_TURTLE_set(const void *NOTUSED(data), scene_state_t *ss,
-                          exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_set(const void *NOTUSED(data), scene_state_t *ss,
+                   exec_state_t *NOTUSED(es), command_state_t *cs) {
     ss_turtle_set_val(ss, &ss->turtle, cs_pop(cs));
     tele_pattern_updated();
 }
 
-static void op_TURTLE_X_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_X_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, turtle_get_x(&ss->turtle));
 }
 
-static void op_TURTLE_X_set(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_X_set(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     turtle_set_x(&ss->turtle, cs_pop(cs));
     tele_pattern_updated();
 }
 
-static void op_TURTLE_Y_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_Y_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, turtle_get_y(&ss->turtle));
 }
 
-static void op_TURTLE_Y_set(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_Y_set(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     turtle_set_y(&ss->turtle, cs_pop(cs));
     tele_pattern_updated();
 }
 
-static void op_TURTLE_MOVE_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_MOVE_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t x = cs_pop(cs);
     int16_t y = cs_pop(cs);
     turtle_move(&ss->turtle, x, y);
     tele_pattern_updated();
 }
 
-static void op_TURTLE_F_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_F_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t x1 = cs_pop(cs);
     int16_t y1 = cs_pop(cs);
     int16_t x2 = cs_pop(cs);
@@ -156,125 +156,120 @@ static void op_TURTLE_F_get(const void *NOTUSED(data), scene_state_t *ss,
     tele_pattern_updated();
 }
 
-static void op_TURTLE_FX1_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_FX1_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->turtle.fence.x1);
 }
 
-static void op_TURTLE_FX1_set(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_FX1_set(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t v = cs_pop(cs);
     ss->turtle.fence.x1 = v > 0 ? v : 0;
     turtle_correct_fence(&ss->turtle);
     tele_pattern_updated();
 }
 
-static void op_TURTLE_FY1_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_FY1_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->turtle.fence.y1);
 }
 
-static void op_TURTLE_FY1_set(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_FY1_set(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t v = cs_pop(cs);
     ss->turtle.fence.y1 = v > 0 ? v : 0;
     turtle_correct_fence(&ss->turtle);
     tele_pattern_updated();
 }
 
-static void op_TURTLE_FX2_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_FX2_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->turtle.fence.x2);
 }
 
-static void op_TURTLE_FX2_set(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_FX2_set(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t v = cs_pop(cs);
     ss->turtle.fence.x2 = v > 0 ? v : 0;
     turtle_correct_fence(&ss->turtle);
     tele_pattern_updated();
 }
 
-static void op_TURTLE_FY2_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_FY2_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->turtle.fence.y2);
 }
 
-static void op_TURTLE_FY2_set(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_FY2_set(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t v = cs_pop(cs);
     ss->turtle.fence.y2 = v > 0 ? v : 0;
     turtle_correct_fence(&ss->turtle);
     tele_pattern_updated();
 }
 
-static void op_TURTLE_SPEED_get(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TURTLE_SPEED_get(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, turtle_get_speed(&ss->turtle));
 }
 
-static void op_TURTLE_SPEED_set(const void *NOTUSED(data), scene_state_t *ss,
-                                exec_state_t *NOTUSED(es),
-                                command_state_t *cs) {
+void op_TURTLE_SPEED_set(const void *NOTUSED(data), scene_state_t *ss,
+                         exec_state_t *NOTUSED(es), command_state_t *cs) {
     turtle_set_speed(&ss->turtle, cs_pop(cs));
 }
 
-static void op_TURTLE_DIR_get(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_DIR_get(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, turtle_get_heading(&ss->turtle));
 }
 
-static void op_TURTLE_DIR_set(const void *NOTUSED(data), scene_state_t *ss,
-                              exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_DIR_set(const void *NOTUSED(data), scene_state_t *ss,
+                       exec_state_t *NOTUSED(es), command_state_t *cs) {
     turtle_set_heading(&ss->turtle, cs_pop(cs));
 }
 
-static void op_TURTLE_STEP_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es),
-                               command_state_t *NOTUSED(cs)) {
+void op_TURTLE_STEP_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es),
+                        command_state_t *NOTUSED(cs)) {
     turtle_step(&ss->turtle);
     tele_pattern_updated();
 }
 
-static void op_TURTLE_BUMP_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_BUMP_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->turtle.mode == TURTLE_BUMP);
 }
 
-static void op_TURTLE_BUMP_set(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_BUMP_set(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     if (cs_pop(cs)) turtle_set_mode(&ss->turtle, TURTLE_BUMP);
     tele_pattern_updated();
 }
 
-static void op_TURTLE_WRAP_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_WRAP_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->turtle.mode == TURTLE_WRAP);
 }
 
-static void op_TURTLE_WRAP_set(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_WRAP_set(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     if (cs_pop(cs)) turtle_set_mode(&ss->turtle, TURTLE_WRAP);
     tele_pattern_updated();
 }
 
-static void op_TURTLE_BOUNCE_get(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs) {
+void op_TURTLE_BOUNCE_get(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->turtle.mode == TURTLE_BOUNCE);
 }
 
-static void op_TURTLE_BOUNCE_set(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs) {
+void op_TURTLE_BOUNCE_set(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs) {
     if (cs_pop(cs)) turtle_set_mode(&ss->turtle, TURTLE_BOUNCE);
     tele_pattern_updated();
 }
 
-static void op_TURTLE_SCRIPT_get(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs) {
+void op_TURTLE_SCRIPT_get(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs) {
     script_number_t s = turtle_get_script(&ss->turtle);
     if (s == TEMP_SCRIPT)
         cs_push(cs, 0);
@@ -282,9 +277,8 @@ static void op_TURTLE_SCRIPT_get(const void *NOTUSED(data), scene_state_t *ss,
         cs_push(cs, turtle_get_script(&ss->turtle) + 1);
 }
 
-static void op_TURTLE_SCRIPT_set(const void *NOTUSED(data), scene_state_t *ss,
-                                 exec_state_t *NOTUSED(es),
-                                 command_state_t *cs) {
+void op_TURTLE_SCRIPT_set(const void *NOTUSED(data), scene_state_t *ss,
+                          exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t sn = cs_pop(cs);
     if (sn == 0)
         turtle_set_script(&ss->turtle, TEMP_SCRIPT);  // magic number
@@ -292,14 +286,14 @@ static void op_TURTLE_SCRIPT_set(const void *NOTUSED(data), scene_state_t *ss,
         turtle_set_script(&ss->turtle, sn - 1);
 }
 
-static void op_TURTLE_SHOW_get(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_SHOW_get(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, turtle_get_shown(&ss->turtle) ? 1 : 0);
     tele_pattern_updated();
 }
 
-static void op_TURTLE_SHOW_set(const void *NOTUSED(data), scene_state_t *ss,
-                               exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TURTLE_SHOW_set(const void *NOTUSED(data), scene_state_t *ss,
+                        exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t shown = cs_pop(cs);
     turtle_set_shown(&ss->turtle, shown != 0);
     tele_pattern_updated();
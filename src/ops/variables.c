@@ -6,40 +6,40 @@
 #include "teletype.h"
 #include "teletype_io.h"
 
-static void op_LAST_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_DRUNK_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_DRUNK_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                         command_state_t *cs);
-static void op_FLIP_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_FLIP_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_O_get(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_LAST_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_DRUNK_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_DRUNK_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                  command_state_t *cs);
+void op_FLIP_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_FLIP_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_O_get(const void *data, scene_state_t *ss, exec_state_t *es,
+              command_state_t *cs);
+void op_O_set(const void *data, scene_state_t *ss, exec_state_t *es,
+              command_state_t *cs);
+void op_I_get(const void *data, scene_state_t *ss, exec_state_t *es,
+              command_state_t *cs);
+void op_I_set(const void *data, scene_state_t *ss, exec_state_t *es,
+              command_state_t *cs);
+void op_TIME_get(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_TIME_set(const void *data, scene_state_t *ss, exec_state_t *es,
+                 command_state_t *cs);
+void op_TIME_ACT_get(const void *data, scene_state_t *ss, exec_state_t *es,
                      command_state_t *cs);
-static void op_O_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                     command_state_t *cs);
-static void op_I_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                     command_state_t *cs);
-static void op_I_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                     command_state_t *cs);
-static void op_TIME_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_TIME_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                        command_state_t *cs);
-static void op_TIME_ACT_get(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_TIME_ACT_set(const void *data, scene_state_t *ss,
-                            exec_state_t *es, command_state_t *cs);
-static void op_J_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                     command_state_t *cs);
-static void op_J_set(const void *data, scene_state_t *ss, exec_state_t *es,
-                     command_state_t *cs);
-static void op_K_get(const void *data, scene_state_t *ss, exec_state_t *es,
-                     command_state_t *cs);
-static void op_K_set(const void *data, scene_state_t *ss, exec_state_t *es,
+void op_TIME_ACT_set(const void *data, scene_state_t *ss, exec_state_t *es,
                      command_state_t *cs);
+void op_J_get(const void *data, scene_state_t *ss, exec_state_t *es,
+              command_state_t *cs);
+void op_J_set(const void *data, scene_state_t *ss, exec_state_t *es,
+              command_state_t *cs);
+void op_K_get(const void *data, scene_state_t *ss, exec_state_t *es,
+              command_state_t *cs);
+void op_K_set(const void *data, scene_state_t *ss, exec_state_t *es,
+              command_state_t *cs);
 
 // clang-format off
 const tele_op_t op_A          = MAKE_SIMPLE_VARIABLE_OP(A         , variables.a         );
@@ -69,28 +69,28 @@ const tele_op_t op_J     = MAKE_GET_SET_OP(J    , op_J_get, op_J_set, 0, true);
 const tele_op_t op_K     = MAKE_GET_SET_OP(K    , op_K_get, op_K_set, 0, true);
 // clang-format on
 
-static void op_TIME_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TIME_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int64_t delta = ss->variables.time_act
                         ? tele_get_ticks() - ss->variables.time
                         : ss->variables.time;
     cs_push(cs, delta & 0x7fff);
 }
 
-static void op_TIME_set(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TIME_set(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t new_time = cs_pop(cs);
     ss->variables.time =
         ss->variables.time_act ? tele_get_ticks() - new_time : new_time;
 }
 
-static void op_TIME_ACT_get(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TIME_ACT_get(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     cs_push(cs, ss->variables.time_act ? 1 : 0);
 }
 
-static void op_TIME_ACT_set(const void *NOTUSED(data), scene_state_t *ss,
-                            exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_TIME_ACT_set(const void *NOTUSED(data), scene_state_t *ss,
+                     exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t act = cs_pop(cs);
     if (act && ss->variables.time_act) return;
     if (!act && !ss->variables.time_act) return;
@@ -98,8 +98,8 @@ static void op_TIME_ACT_set(const void *NOTUSED(data), scene_state_t *ss,
     ss->variables.time = tele_get_ticks() - ss->variables.time;
 }
 
-static void op_LAST_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_LAST_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t script_number = cs_pop(cs) - 1;
 
     // when run in LIVE mode, SCRIPT will be 0.
@@ -110,8 +110,8 @@ static void op_LAST_get(const void *NOTUSED(data), scene_state_t *ss,
     cs_push(cs, last);
 }
 
-static void op_DRUNK_get(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_DRUNK_get(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t min = ss->variables.drunk_min;
     int16_t max = ss->variables.drunk_max;
     int16_t wrap = ss->variables.drunk_wrap;
@@ -127,25 +127,25 @@ static void op_DRUNK_get(const void *NOTUSED(data), scene_state_t *ss,
     ss->variables.drunk = normalise_value(min, max, wrap, new_value);
 }
 
-static void op_DRUNK_set(const void *NOTUSED(data), scene_state_t *ss,
-                         exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_DRUNK_set(const void *NOTUSED(data), scene_state_t *ss,
+                  exec_state_t *NOTUSED(es), command_state_t *cs) {
     ss->variables.drunk = cs_pop(cs);
 }
 
-static void op_FLIP_get(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_FLIP_get(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t flip = ss->variables.flip;
     cs_push(cs, flip);
     ss->variables.flip = flip == 0;
 }
 
-static void op_FLIP_set(const void *NOTUSED(data), scene_state_t *ss,
-                        exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_FLIP_set(const void *NOTUSED(data), scene_state_t *ss,
+                 exec_state_t *NOTUSED(es), command_state_t *cs) {
     ss->variables.flip = cs_pop(cs) != 0;
 }
 
-static void op_O_get(const void *NOTUSED(data), scene_state_t *ss,
-                     exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_O_get(const void *NOTUSED(data), scene_state_t *ss,
+              exec_state_t *NOTUSED(es), command_state_t *cs) {
     int16_t min = ss->variables.o_min;
     int16_t max = ss->variables.o_max;
     int16_t wrap = ss->variables.o_wrap;
@@ -159,41 +159,41 @@ static void op_O_get(const void *NOTUSED(data), scene_state_t *ss,
         normalise_value(min, max, wrap, current_value + ss->variables.o_inc);
 }
 
-static void op_O_set(const void *NOTUSED(data), scene_state_t *ss,
-                     exec_state_t *NOTUSED(es), command_state_t *cs) {
+void op_O_set(const void *NOTUSED(data), scene_state_t *ss,
+              exec_state_t *NOTUSED(es), command_state_t *cs) {
     ss->variables.o = cs_pop(cs);
 }
 
-static void op_I_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                     exec_state_t *es, command_state_t *cs) {
+void op_I_get(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+              exec_state_t *es, command_state_t *cs) {
     cs_push(cs, es_variables(es)->i);
 }
 
-static void op_I_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
-                     exec_state_t *es, command_state_t *cs) {
+void op_I_set(const void *NOTUSED(data), scene_state_t *NOTUSED(ss),
+              exec_state_t *es, command_state_t *cs) {
     es_variables(es)->i = cs_pop(cs);
 }
 
-static void op_J_get(const void *NOTUSED(data), scene_state_t *ss,
-                     exec_state_t *es, command_state_t *cs) {
+void op_J_get(const void *NOTUSED(data), scene_state_t *ss, exec_state_t *es,
+              command_state_t *cs) {
     int16_t sn = es_variables(es)->script_number;
     cs_push(cs, ss->variables.j[sn]);
 }
 
-static void op_J_set(const void *NOTUSED(data), scene_state_t *ss,
-                     exec_state_t *es, command_state_t *cs) {
+void op_J_set(const void *NOTUSED(data), scene_state_t *ss, exec_state_t *es,
+              command_state_t *cs) {
     int16_t sn = es_variables(es)->script_number;
     ss->variables.j[sn] = cs_pop(cs);
 }
 
-static void op_K_get(const void *NOTUSED(data), scene_state_t *ss,
-                     exec_state_t *es, command_state_t *cs) {
+void op_K_get(const void *NOTUSED(data), scene_state_t *ss, exec_state_t *es,
+              command_state_t *cs) {
     int16_t sn = es_variables(es)->script_number;
     cs_push(cs, ss->variables.k[sn]);
 }
 
-static void op_K_set(const void *NOTUSED(data), scene_state_t *ss,
-                     exec_state_t *es, command_state_t *cs) {
+void op_K_set(const void *NOTUSED(data), scene_state_t *ss, exec_state_t *es,
+              command_state_t *cs) {
     int16_t sn = es_variables(es)->script_number;
     ss->variables.k[sn] = cs_pop(cs);
 }
@@ -0,0 +1,260 @@
+#ifdef SIM
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+#endif
+
+#include "profiler.h"
+
+#include <stdio.h>  // snprintf
+#include <string.h>
+
+#ifdef SIM
+#include <time.h>
+#else
+#include "conf_board.h"  // FCPU_HZ
+#include "sysclk.h"
+#endif
+
+#include "ops/op.h"
+#include "state.h"
+
+
+////////////////////////////////////////////////////////////////////////////////
+// CLOCK ///////////////////////////////////////////////////////////////////////
+
+#ifdef SIM
+profile_ticks_t profiler_now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (profile_ticks_t)((uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec);
+}
+
+uint32_t profiler_ticks_to_ns(profile_ticks_t ticks) {
+    return ticks;
+}
+#else
+// wraps every 71 s at 60 MHz, well beyond anything that is timed
+profile_ticks_t profiler_now() {
+    return Get_system_register(AVR32_COUNT);
+}
+
+uint32_t profiler_ticks_to_ns(profile_ticks_t ticks) {
+    return (uint64_t)ticks * 1000000000 / FCPU_HZ;
+}
+#endif
+
+
+////////////////////////////////////////////////////////////////////////////////
+// HISTOGRAM ///////////////////////////////////////////////////////////////////
+
+static uint8_t bucket_index(profile_ticks_t v) {
+    if (v < PROFILE_SUB_BUCKETS) return v;
+
+    uint8_t msb = PROFILE_SUB_BUCKET_BITS;
+    while (msb < 31 && v >> (msb + 1)) msb++;
+
+    uint8_t sub = (v >> (msb - PROFILE_SUB_BUCKET_BITS)) &
+                  (PROFILE_SUB_BUCKETS - 1);
+    return (msb - PROFILE_SUB_BUCKET_BITS + 1) * PROFILE_SUB_BUCKETS + sub;
+}
+
+// the middle of the range of values that go in bucket i
+static profile_ticks_t bucket_value(uint8_t i) {
+    if (i < PROFILE_SUB_BUCKETS) return i;
+
+    uint8_t shift = i / PROFILE_SUB_BUCKETS - 1;
+    uint32_t sub = i % PROFILE_SUB_BUCKETS;
+    uint64_t low = (uint64_t)(PROFILE_SUB_BUCKETS + sub) << shift;
+    return low + ((1ull << shift) - 1) / 2;
+}
+
+// a zeroed histogram is an empty one
+void profile_hist_clear(profile_hist_t *h) {
+    memset(h, 0, sizeof(*h));
+}
+
+void profile_hist_add(profile_hist_t *h, profile_ticks_t elapsed) {
+    if (h->count == 0 || elapsed < h->min) h->min = elapsed;
+    if (elapsed > h->max) h->max = elapsed;
+    if (h->count < UINT32_MAX) h->count++;
+    h->total += elapsed;
+
+    uint8_t b = bucket_index(elapsed);
+    if (h->buckets[b] == UINT16_MAX) {
+        for (uint8_t i = 0; i < PROFILE_BUCKETS; i++) h->buckets[i] /= 2;
+    }
+    h->buckets[b]++;
+}
+
+profile_ticks_t profile_hist_percentile(const profile_hist_t *h,
+                                        uint8_t percentile) {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < PROFILE_BUCKETS; i++) total += h->buckets[i];
+    if (total == 0) return 0;
+    if (percentile == 0) return h->min;
+    if (percentile >= 100) return h->max;
+    uint32_t rank = ((uint64_t)total * percentile + 99) / 100;
+
+    uint32_t seen = 0;
+    uint8_t i = 0;
+    for (; i < PROFILE_BUCKETS - 1; i++) {
+        seen += h->buckets[i];
+        if (seen >= rank) break;
+    }
+
+    // the bucket's middle can be outside what was actually seen
+    profile_ticks_t v = bucket_value(i);
+    if (v < h->min) v = h->min;
+    if (v > h->max) v = h->max;
+    return v;
+}
+
+void profile_hist_stats(const profile_hist_t *h, profile_stats_t *stats) {
+    stats->count = h->count;
+    if (h->count == 0) {
+        stats->min = stats->mean = stats->p50 = stats->p99 = stats->max = 0;
+        return;
+    }
+
+    stats->min = profiler_ticks_to_ns(h->min);
+    stats->mean = profiler_ticks_to_ns(h->total / h->count);
+    stats->p50 = profiler_ticks_to_ns(profile_hist_percentile(h, 50));
+    stats->p99 = profiler_ticks_to_ns(profile_hist_percentile(h, 99));
+    stats->max = profiler_ticks_to_ns(h->max);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SCRIPTS AND DELAYS //////////////////////////////////////////////////////////
+
+#ifdef TELETYPE_PROFILE
+
+static profile_hist_t script_hist[SCRIPT_COUNT];
+static profile_hist_t delay_hist[SCRIPT_COUNT];
+static profile_counter_t op_counters[E_OP__LENGTH];
+static profile_counter_t mod_counters[E_MOD__LENGTH];
+
+void profiler_script(size_t script, profile_ticks_t start) {
+    profiler_script_elapsed(script, profiler_now() - start);
+}
+
+void profiler_script_elapsed(size_t script, profile_ticks_t elapsed) {
+    if (script < SCRIPT_COUNT) profile_hist_add(&script_hist[script], elapsed);
+}
+
+void profiler_delay(size_t origin_script, profile_ticks_t start) {
+    profile_ticks_t elapsed = profiler_now() - start;
+    if (origin_script < SCRIPT_COUNT)
+        profile_hist_add(&delay_hist[origin_script], elapsed);
+}
+
+static void counter_add(profile_counter_t *c, profile_ticks_t start) {
+    profile_ticks_t elapsed = profiler_now() - start;
+    if (c->count < UINT32_MAX) c->count++;
+    c->total += elapsed;
+}
+
+void profiler_op(tele_op_idx_t op, profile_ticks_t start) {
+    counter_add(&op_counters[op], start);
+}
+
+void profiler_mod(tele_mod_idx_t mod, profile_ticks_t start) {
+    counter_add(&mod_counters[mod], start);
+}
+
+const profile_hist_t *profiler_script_hist(size_t script) {
+    return script < SCRIPT_COUNT ? &script_hist[script] : NULL;
+}
+
+const profile_hist_t *profiler_delay_hist(size_t origin_script) {
+    return origin_script < SCRIPT_COUNT ? &delay_hist[origin_script] : NULL;
+}
+
+const profile_counter_t *profiler_op_counter(tele_op_idx_t op) {
+    return op < E_OP__LENGTH ? &op_counters[op] : NULL;
+}
+
+const profile_counter_t *profiler_mod_counter(tele_mod_idx_t mod) {
+    return mod < E_MOD__LENGTH ? &mod_counters[mod] : NULL;
+}
+
+void profiler_reset() {
+    memset(op_counters, 0, sizeof(op_counters));
+    memset(mod_counters, 0, sizeof(mod_counters));
+    for (size_t i = 0; i < SCRIPT_COUNT; i++) {
+        profile_hist_clear(&script_hist[i]);
+        profile_hist_clear(&delay_hist[i]);
+    }
+}
+
+static const char *script_name(size_t script) {
+    static const char *names[SCRIPT_COUNT] = { "1", "2", "3", "4", "5",  "6",
+                                               "7", "8", "M", "I", "LIVE" };
+    return names[script];
+}
+
+static void dump_hist(void (*print)(const char *line), const char *kind,
+                      size_t script, const profile_hist_t *h) {
+    if (h->count == 0) return;
+
+    profile_stats_t s;
+    profile_hist_stats(h, &s);
+
+    char line[96];
+    snprintf(line, sizeof(line),
+             "%s %s\t%lu\t%lu\t%lu\t%lu\t%lu\t%lu", kind, script_name(script),
+             (unsigned long)s.count, (unsigned long)s.min,
+             (unsigned long)s.mean, (unsigned long)s.p50, (unsigned long)s.p99,
+             (unsigned long)s.max);
+    print(line);
+}
+
+void profiler_dump(void (*print)(const char *line)) {
+    print("# name\tcount\tmin\tmean\tp50\tp99\tmax (ns)");
+    for (size_t i = 0; i < SCRIPT_COUNT; i++)
+        dump_hist(print, "SCRIPT", i, &script_hist[i]);
+    for (size_t i = 0; i < SCRIPT_COUNT; i++)
+        dump_hist(print, "DEL", i, &delay_hist[i]);
+}
+
+// print the counters from the largest total down, by picking the next largest
+// each time, which needs no extra memory and is quick enough for a dump
+static void dump_counters(void (*print)(const char *line),
+                          const profile_counter_t *counters, size_t length,
+                          bool ops) {
+    uint64_t last_total = UINT64_MAX;
+    size_t last = 0;
+
+    while (true) {
+        size_t next = length;
+        for (size_t i = 0; i < length; i++) {
+            const profile_counter_t *c = &counters[i];
+            if (c->count == 0) continue;
+            // after the previous one in (total desc, index asc) order
+            if (c->total > last_total ||
+                (c->total == last_total && i <= last))
+                continue;
+            if (next == length || c->total > counters[next].total) next = i;
+        }
+        if (next == length) return;
+
+        const profile_counter_t *c = &counters[next];
+        char line[64];
+        snprintf(line, sizeof(line), "%s\t%lu\t%lu\t%lu",
+                 ops ? tele_ops[next]->name : tele_mods[next]->name,
+                 (unsigned long)c->count,
+                 (unsigned long)(profiler_ticks_to_ns(c->total / 1000)),
+                 (unsigned long)profiler_ticks_to_ns(c->total / c->count));
+        print(line);
+
+        last_total = c->total;
+        last = next;
+    }
+}
+
+void profiler_dump_ops(void (*print)(const char *line)) {
+    print("# name\tcount\ttotal (us)\tmean (ns)");
+    dump_counters(print, op_counters, E_OP__LENGTH, true);
+    dump_counters(print, mod_counters, E_MOD__LENGTH, false);
+}
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ops/op_enum.h"
+
+// Execution time histograms for scripts and delays.
+//
+// Times are measured in profiler ticks: CPU cycles on the hardware (the
+// AVR32 COUNT register) and ns from the monotonic clock on the host. They are
+// converted to ns whenever they are reported.
+//
+// The histogram buckets are log-linear, each power of 2 is split into
+// PROFILE_SUB_BUCKETS, so p50 and p99 are within 1 / PROFILE_SUB_BUCKETS of
+// the real value. min, max, mean and count are exact.
+//
+// Every OP and MOD run by process_command is also counted, along with its
+// total time. Those times include anything the OP or MOD runs itself, so SCRIPT
+// includes the script it calls and a MOD includes its command. OPs that were
+// folded or fused when their command was compiled don't run, so they aren't
+// counted.
+//
+// The histogram code is always built, so that it can be tested, the tables
+// and the hooks in teletype.c are only there with TELETYPE_PROFILE defined.
+
+#define PROFILE_SUB_BUCKET_BITS 2
+#define PROFILE_SUB_BUCKETS (1 << PROFILE_SUB_BUCKET_BITS)
+#define PROFILE_BUCKETS \
+    ((32 - PROFILE_SUB_BUCKET_BITS + 1) * PROFILE_SUB_BUCKETS)
+
+typedef uint32_t profile_ticks_t;
+
+typedef struct {
+    uint32_t count;
+    profile_ticks_t min;
+    profile_ticks_t max;
+    uint64_t total;
+    // halved when one of them would overflow, which keeps the percentiles
+    uint16_t buckets[PROFILE_BUCKETS];
+} profile_hist_t;
+
+typedef struct {
+    uint32_t count;
+    uint64_t total;
+} profile_counter_t;
+
+// all in ns
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t mean;
+    uint32_t p50;
+    uint32_t p99;
+    uint32_t max;
+} profile_stats_t;
+
+profile_ticks_t profiler_now(void);
+uint32_t profiler_ticks_to_ns(profile_ticks_t ticks);
+
+void profile_hist_clear(profile_hist_t *h);
+void profile_hist_add(profile_hist_t *h, profile_ticks_t elapsed);
+// percentile is 0 - 100
+profile_ticks_t profile_hist_percentile(const profile_hist_t *h,
+                                        uint8_t percentile);
+void profile_hist_stats(const profile_hist_t *h, profile_stats_t *stats);
+
+#ifdef TELETYPE_PROFILE
+// delays are grouped by the script that added them
+void profiler_script(size_t script, profile_ticks_t start);
+// for a run of a script that took elapsed, e.g. one run a slice at a time
+void profiler_script_elapsed(size_t script, profile_ticks_t elapsed);
+void profiler_delay(size_t origin_script, profile_ticks_t start);
+
+void profiler_op(tele_op_idx_t op, profile_ticks_t start);
+void profiler_mod(tele_mod_idx_t mod, profile_ticks_t start);
+
+const profile_hist_t *profiler_script_hist(size_t script);
+const profile_hist_t *profiler_delay_hist(size_t origin_script);
+const profile_counter_t *profiler_op_counter(tele_op_idx_t op);
+const profile_counter_t *profiler_mod_counter(tele_mod_idx_t mod);
+
+void profiler_reset(void);
+
+// writes a header and then one line per script and per delay origin that has
+// run, "name count min mean p50 p99 max" tab separated with times in ns, each
+// line is passed to print without a line ending
+void profiler_dump(void (*print)(const char *line));
+
+// as profiler_dump, for every OP and MOD that has run, most total time first,
+// as "name count total mean" with total in us and mean in ns
+void profiler_dump_ops(void (*print)(const char *line));
+#endif
+
+#endif
@@ -46,7 +46,7 @@ typedef struct {
 static inline scale_t scale_init(SCALE_T izero, SCALE_T imax, SCALE_T ozero,
                                  SCALE_T omax) {
     scale_t ret;
-    if (izero == imax) imax = 1;
+    if (izero == imax) imax = izero + 1;
     // Impart 16 bits of precision
     ret.m = TO_Q15(omax - ozero) / (imax - izero);
     ret.b = ozero - FROM_Q15(ret.m * izero);
@@ -0,0 +1,87 @@
+#include "scanner.h"
+
+#include <string.h>
+
+#include "command.h"
+#include "match_token.h"
+#include "teletype.h"
+
+// Splits a command into tokens in a single pass, matching each one in place
+// without copying it.
+//
+// - ' ', '\n' and '\t' separate tokens
+// - ": " is a PRE_SEP, and "; " a SUB_SEP
+// - a ':' or ';' without a space after it is an error
+// - anything else up to the next one of those is a token, which must be a
+//   number, an OP or a MOD
+
+static bool is_separator(char c) {
+    return c == ' ' || c == '\n' || c == '\t';
+}
+
+static bool is_token_end(char c) {
+    return c == 0 || is_separator(c) || c == ':' || c == ';';
+}
+
+static error_t push_data(tele_command_t *out, tele_word_t tag, int16_t value) {
+    td_set(&out->data[out->length], tag, value);
+
+    // increase the command length
+    out->length++;
+
+    // if the command length is now too long, abort
+    if (out->length >= COMMAND_MAX_LENGTH) return E_LENGTH;
+    return E_OK;
+}
+
+error_t scanner(const char *cmd, tele_command_t *out,
+                char error_msg[TELE_ERROR_MSG_LENGTH]) {
+    const char *p = cmd;
+
+    // reset outputs
+    error_msg[0] = 0;
+    out->length = 0;
+    out->separator = -1;
+
+    while (*p) {
+        error_t status = E_OK;
+
+        if (is_separator(*p)) {
+            p++;
+            continue;
+        }
+        else if (*p == ':') {
+            if (p[1] != ' ') return E_NEED_SPACE_PRE_SEP;
+            // it's a PRE_SEP, we need to record it's position
+            // (validate checks for too many PRE_SEP tokens)
+            out->separator = out->length;
+            status = push_data(out, PRE_SEP, 0);
+            p += 2;
+        }
+        else if (*p == ';') {
+            if (p[1] != ' ') return E_NEED_SPACE_SUB_SEP;
+            status = push_data(out, SUB_SEP, 0);
+            p += 2;
+        }
+        else {
+            const char *start = p;
+            while (!is_token_end(*p)) p++;
+            size_t len = p - start;
+
+            tele_data_t data;
+            if (!match_token(start, len, &data)) {
+                // can't match the token, fail
+                if (len > TELE_ERROR_MSG_LENGTH - 1)
+                    len = TELE_ERROR_MSG_LENGTH - 1;
+                memcpy(error_msg, start, len);
+                error_msg[len] = 0;
+                return E_PARSE;
+            }
+            status = push_data(out, td_tag(&data), td_value(&data));
+        }
+
+        if (status != E_OK) return status;
+    }
+
+    return E_OK;
+}
@@ -3,6 +3,8 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include "ii.h"
+#include "teletype.h"
 #include "teletype_io.h"
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -15,14 +17,26 @@ void ss_init(scene_state_t *ss) {
     ss_grid_init(ss);
     ss_rand_init(ss);
     ss_midi_init(ss);
+    ss_i2c_init(ss);
+    chaos_init(&ss->chaos);
+    arena_init(&ss->arena);
+    for (size_t i = 0; i < DELAY_SIZE; i++)
+        ss->delay.commands[i].block = ARENA_NONE;
+    for (size_t i = 0; i < STACK_OP_SIZE; i++)
+        ss->stack_op.commands[i].block = ARENA_NONE;
+    trigger_init(&ss->triggers);
+    ss->delay.next_seq = 0;
+    ss->delay.running = -1;
     ss->delay.count = 0;
-    for (size_t i = 0; i < TR_COUNT; i++) { ss->tr_pulse_timer[i] = 0; }
+    ss_delay_clear(ss);
+    for (size_t i = 0; i < TR_COUNT; i++) { ss->tr_pulse_active[i] = false; }
     for (size_t i = 0; i < NB_NBX_SCALES; i++) {
         ss->variables.n_scale_bits[i] = bit_reverse(0b101011010101, 12);
         ss->variables.n_scale_root[i] = 0;
     }
     ss->stack_op.top = 0;
     memset(&ss->scripts, 0, ss_scripts_size());
+    memset(&ss->compiled, 0, sizeof(ss->compiled));
     turtle_init(&ss->turtle);
     uint32_t ticks = tele_get_ticks();
     for (size_t i = 0; i < TEMP_SCRIPT; i++) ss->scripts[i].last_time = ticks;
@@ -165,6 +179,28 @@ void ss_rand_init(scene_state_t *ss) {
     }
 }
 
+// seed every random state with s, as SEED does
+void ss_rand_seed(scene_state_t *ss, uint16_t s) {
+    for (u8 i = 0; i < RAND_STATES_COUNT; i++) {
+        tele_rand_t *r = &ss->rand_states.a[i];
+        r->seed = s;
+        random_seed(&r->rand, r->seed);
+    }
+    ss->variables.seed = s;
+}
+
+// I2C
+
+void ss_i2c_init(scene_state_t *ss) {
+    ss->i2c.crow = CROW_ADDR_0;
+    ss->i2c.disting = 0;
+    ss->i2c.disting_midi_channel = 0;
+    ss->i2c.disting_sb_channel = 0;
+    ss->i2c.jf = JF_ADDR;
+    ss->i2c.jf_note_count = 1;
+    ss->i2c.matrixarchate = 0;
+}
+
 // MIDI
 
 void ss_midi_init(scene_state_t *ss) {
@@ -315,10 +351,39 @@ void ss_copy_script_command(tele_command_t *dest, scene_state_t *ss,
     memcpy(dest, &ss->scripts[script_idx].c[c_idx], sizeof(tele_command_t));
 }
 
-// private
+// private, compiles cmd unless it's given already compiled
 static void ss_set_script_command(scene_state_t *ss, script_number_t script_idx,
-                                  size_t c_idx, const tele_command_t *cmd) {
+                                  size_t c_idx, const tele_command_t *cmd,
+                                  const compiled_command_t *compiled) {
     memcpy(&ss->scripts[script_idx].c[c_idx], cmd, sizeof(tele_command_t));
+    if (compiled)
+        memcpy(&ss->compiled[script_idx][c_idx], compiled,
+               sizeof(compiled_command_t));
+    else
+        compile_command(cmd, &ss->compiled[script_idx][c_idx]);
+}
+
+// private, moves a command and its compiled form to another line
+static void ss_move_script_command(scene_state_t *ss,
+                                   script_number_t script_idx, size_t dst_idx,
+                                   size_t src_idx) {
+    ss_set_script_command(ss, script_idx, dst_idx,
+                          &ss->scripts[script_idx].c[src_idx],
+                          &ss->compiled[script_idx][src_idx]);
+}
+
+const compiled_command_t *ss_get_script_compiled(scene_state_t *ss,
+                                                 script_number_t script_idx,
+                                                 size_t c_idx) {
+    return &ss->compiled[script_idx][c_idx];
+}
+
+// must be called after the scripts have been written to directly (e.g. when
+// loading a scene from flash)
+void ss_compile_scripts(scene_state_t *ss) {
+    for (size_t s = 0; s < SCRIPT_COUNT; s++)
+        for (size_t c = 0; c < SCRIPT_MAX_COMMANDS; c++)
+            compile_command(&ss->scripts[s].c[c], &ss->compiled[s][c]);
 }
 
 bool ss_get_script_comment(scene_state_t *ss, script_number_t script_idx,
@@ -340,6 +405,13 @@ void ss_toggle_script_comment(scene_state_t *ss, script_number_t script_idx,
 void ss_overwrite_script_command(scene_state_t *ss, script_number_t script_idx,
                                  size_t command_idx,
                                  const tele_command_t *cmd) {
+    ss_overwrite_script_compiled(ss, script_idx, command_idx, cmd, NULL);
+}
+
+void ss_overwrite_script_compiled(scene_state_t *ss,
+                                  script_number_t script_idx,
+                                  size_t command_idx, const tele_command_t *cmd,
+                                  const compiled_command_t *compiled) {
     // Few of the commands in this file bounds-check.
     // Are we trusting calling code in this file or not?
     // If so, why here?  If not, we need much more bounds-checking
@@ -350,7 +422,7 @@ void ss_overwrite_script_command(scene_state_t *ss, script_number_t script_idx,
     // TODO: why check upper bound here but not lower?
     if (command_idx >= SCRIPT_MAX_COMMANDS) return;
 
-    ss_set_script_command(ss, script_idx, command_idx, cmd);
+    ss_set_script_command(ss, script_idx, command_idx, cmd, compiled);
 
     const uint8_t script_len = ss_get_script_len(ss, script_idx);
 
@@ -361,6 +433,12 @@ void ss_overwrite_script_command(scene_state_t *ss, script_number_t script_idx,
 
 void ss_insert_script_command(scene_state_t *ss, script_number_t script_idx,
                               size_t command_idx, const tele_command_t *cmd) {
+    ss_insert_script_compiled(ss, script_idx, command_idx, cmd, NULL);
+}
+
+void ss_insert_script_compiled(scene_state_t *ss, script_number_t script_idx,
+                               size_t command_idx, const tele_command_t *cmd,
+                               const compiled_command_t *compiled) {
     if (command_idx >= SCRIPT_MAX_COMMANDS) return;
 
     uint8_t script_len = ss_get_script_len(ss, script_idx);
@@ -370,17 +448,14 @@ void ss_insert_script_command(scene_state_t *ss, script_number_t script_idx,
     }
 
     // shuffle down
-    for (size_t i = script_len; i > command_idx; i--) {
-        const tele_command_t *cmd =
-            ss_get_script_command(ss, script_idx, i - 1);
-        ss_set_script_command(ss, script_idx, i, cmd);
-    }
+    for (size_t i = script_len; i > command_idx; i--)
+        ss_move_script_command(ss, script_idx, i, i - 1);
 
     // increase length
     ss_set_script_len(ss, script_idx, script_len + 1);
 
     // overwrite at command_idx
-    ss_overwrite_script_command(ss, script_idx, command_idx, cmd);
+    ss_overwrite_script_compiled(ss, script_idx, command_idx, cmd, compiled);
 }
 
 void ss_delete_script_command(scene_state_t *ss, script_number_t script_idx,
@@ -393,21 +468,21 @@ void ss_delete_script_command(scene_state_t *ss, script_number_t script_idx,
         script_len--;
         ss_set_script_len(ss, script_idx, script_len);
 
-        for (size_t n = command_idx; n < script_len; n++) {
-            const tele_command_t *cmd =
-                ss_get_script_command(ss, script_idx, n + 1);
-            ss_set_script_command(ss, script_idx, n, cmd);
-        }
+        for (size_t n = command_idx; n < script_len; n++)
+            ss_move_script_command(ss, script_idx, n, n + 1);
 
         tele_command_t blank_command;
         blank_command.length = 0;
+        blank_command.separator = -1;
         blank_command.comment = false;
-        ss_set_script_command(ss, script_idx, script_len, &blank_command);
+        ss_set_script_command(ss, script_idx, script_len, &blank_command,
+                              NULL);
     }
 }
 
 void ss_clear_script(scene_state_t *ss, size_t script_idx) {
     memset(&ss->scripts[script_idx], 0, sizeof(scene_script_t));
+    memset(&ss->compiled[script_idx], 0, sizeof(ss->compiled[script_idx]));
     ss->variables.j[script_idx] = 0;
     ss->variables.k[script_idx] = 0;
 }
@@ -447,6 +522,207 @@ void ss_sync_every(scene_state_t *ss, int16_t count) {
         }
 }
 
+// delays
+
+// true if slot a is due before slot b
+static bool ss_delay_before(scene_delay_t *d, uint8_t a, uint8_t b) {
+    // compare as differences so that wrapping of the ticks or next_seq is
+    // harmless
+    int32_t dt = (int32_t)(d->deadline[a] - d->deadline[b]);
+    if (dt != 0) return dt < 0;
+    return (int16_t)(d->seq[a] - d->seq[b]) < 0;
+}
+
+static void ss_delay_sift_up(scene_delay_t *d, uint8_t i) {
+    uint8_t slot = d->heap[i];
+    while (i > 0) {
+        uint8_t parent = (i - 1) / 2;
+        if (!ss_delay_before(d, slot, d->heap[parent])) break;
+        d->heap[i] = d->heap[parent];
+        i = parent;
+    }
+    d->heap[i] = slot;
+}
+
+// Commands stored by DEL and S run from the compiled form of the script line
+// they were copied from, as long as that line still has the same words, so
+// that they aren't compiled every time they run. Any others (e.g. from a
+// delayed command, or a line that has since been edited) are compiled each
+// time they run, as keeping a compiled form for each would take more RAM than
+// all the delays and stack entries themselves.
+
+// private, records the script line that cmd is a view of, if any
+static void ss_set_command_source(scene_state_t *ss, arena_command_t *stored,
+                                  const tele_command_view_t *cmd) {
+    const uintptr_t at =
+        (uintptr_t)cmd->compiled - (uintptr_t)&ss->compiled[0][0];
+    if (cmd->compiled != NULL && at < sizeof(ss->compiled))
+        stored->source = at / sizeof(compiled_command_t);
+}
+
+// private, loads a stored command in to out, and returns the view to run it
+// with, of its script line if it was copied from one that hasn't changed
+static tele_command_view_t ss_command_view(scene_state_t *ss,
+                                           const arena_command_t *stored,
+                                           tele_command_t *out) {
+    arena_load(&ss->arena, stored, out);
+    tele_command_view_t view = command_view(out);
+    if (stored->source == ARENA_NONE) return view;
+
+    const uint8_t script = stored->source / SCRIPT_MAX_COMMANDS;
+    const uint8_t line = stored->source % SCRIPT_MAX_COMMANDS;
+    const tele_command_t *c = &ss->scripts[script].c[line];
+    if (c->length != stored->offset + stored->length ||
+        memcmp(&c->data[stored->offset], out->data,
+               stored->length * sizeof(tele_data_t)))
+        return view;
+
+    view.base = c;
+    view.compiled = &ss->compiled[script][line];
+    view.offset = stored->offset;
+    return view;
+}
+
+static void ss_delay_sift_down(scene_delay_t *d, uint8_t i) {
+    uint8_t slot = d->heap[i];
+    for (;;) {
+        uint8_t child = 2 * i + 1;
+        if (child >= d->count) break;
+        if (child + 1 < d->count &&
+            ss_delay_before(d, d->heap[child + 1], d->heap[child]))
+            child++;
+        if (!ss_delay_before(d, d->heap[child], slot)) break;
+        d->heap[i] = d->heap[child];
+        i = child;
+    }
+    d->heap[i] = slot;
+}
+
+// remove every pending delay
+void ss_delay_clear(scene_state_t *ss) {
+    for (uint8_t i = 0; i < ss->delay.count; i++)
+        arena_release(&ss->arena, &ss->delay.commands[ss->delay.heap[i]]);
+    ss->delay.count = 0;
+    ss->delay.free_count = 0;
+    ss->delay.used = 0;
+}
+
+uint8_t ss_delay_count(scene_state_t *ss) {
+    return ss->delay.count;
+}
+
+// schedule cmd to be run in time ms, returns false if there are no free slots
+// or not enough room in the command arena
+bool ss_delay_add(scene_state_t *ss, int16_t time, uint8_t origin_script,
+                  int16_t origin_i, const tele_command_view_t *cmd) {
+    scene_delay_t *d = &ss->delay;
+    int8_t slot = -1;
+
+    if (d->free_count)
+        slot = d->free[--d->free_count];
+    else if (d->used < DELAY_SIZE)
+        slot = d->used++;
+    if (slot == -1) return false;
+    if (!arena_store(&ss->arena, &d->commands[slot], cmd)) {
+        d->free[d->free_count++] = slot;
+        return false;
+    }
+    ss_set_command_source(ss, &d->commands[slot], cmd);
+
+    if (time < 1) time = 1;
+    d->deadline[slot] = tele_get_ticks() + time;
+    d->seq[slot] = d->next_seq++;
+    d->origin_script[slot] = origin_script;
+    d->origin_i[slot] = origin_i;
+
+    d->heap[d->count] = slot;
+    d->count++;
+    ss_delay_sift_up(d, d->count - 1);
+
+    return true;
+}
+
+// the deadline of the earliest pending delay, returns false if there are none
+bool ss_delay_next_deadline(scene_state_t *ss, uint32_t *deadline) {
+    if (ss->delay.count == 0) return false;
+    *deadline = ss->delay.deadline[ss->delay.heap[0]];
+    return true;
+}
+
+// take the next delay that is due at now off the heap, the slot is kept (and
+// so its command can be loaded) until it's passed to ss_delay_release, which
+// must be done before the command is run, returns -1 if nothing is due
+int8_t ss_delay_pop_due(scene_state_t *ss, uint32_t now) {
+    scene_delay_t *d = &ss->delay;
+    if (d->count == 0) return -1;
+
+    uint8_t slot = d->heap[0];
+    if ((int32_t)(d->deadline[slot] - now) > 0) return -1;
+
+    d->count--;
+    if (d->count) {
+        d->heap[0] = d->heap[d->count];
+        ss_delay_sift_down(d, 0);
+    }
+    d->running = slot;
+
+    return slot;
+}
+
+// loads the command of a delay in to out, and returns the view to run
+tele_command_view_t ss_delay_command(scene_state_t *ss, int8_t slot,
+                                     tele_command_t *out) {
+    return ss_command_view(ss, &ss->delay.commands[slot], out);
+}
+
+// frees the slot taken by ss_delay_pop_due, does nothing if the delays have
+// been reset since
+void ss_delay_release(scene_state_t *ss, int8_t slot) {
+    scene_delay_t *d = &ss->delay;
+    if (d->running != slot) return;
+    arena_release(&ss->arena, &d->commands[slot]);
+    d->free[d->free_count++] = slot;
+    d->running = -1;
+}
+
+// S commands
+
+void ss_stack_op_clear(scene_state_t *ss) {
+    for (uint8_t i = 0; i < ss->stack_op.top; i++)
+        arena_release(&ss->arena, &ss->stack_op.commands[i]);
+    ss->stack_op.top = 0;
+}
+
+// returns false if the stack is full or there isn't room in the command arena
+bool ss_stack_op_push(scene_state_t *ss, const tele_command_view_t *cmd) {
+    scene_stack_op_t *s = &ss->stack_op;
+    if (s->top >= STACK_OP_SIZE ||
+        !arena_store(&ss->arena, &s->commands[s->top], cmd))
+        return false;
+    ss_set_command_source(ss, &s->commands[s->top], cmd);
+    s->top++;
+    return true;
+}
+
+// loads the command i from the bottom of the stack in to out, and returns the
+// view to run
+tele_command_view_t ss_stack_op_command(scene_state_t *ss, uint8_t i,
+                                        tele_command_t *out) {
+    return ss_command_view(ss, &ss->stack_op.commands[i], out);
+}
+
+// as ss_stack_op_command for the top of the stack, which is removed, returns
+// false if the stack is empty
+bool ss_stack_op_pop(scene_state_t *ss, tele_command_t *out,
+                     tele_command_view_t *view) {
+    scene_stack_op_t *s = &ss->stack_op;
+    if (s->top == 0) return false;
+    s->top--;
+    *view = ss_command_view(ss, &s->commands[s->top], out);
+    arena_release(&ss->arena, &s->commands[s->top]);
+    return true;
+}
+
 bool every_is_now(scene_state_t *ss, every_count_t *e) {
     ss->every_last = e->count == 0;
     return e->count == 0;
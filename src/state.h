@@ -5,10 +5,13 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "arena.h"
+#include "chaos.h"
 #include "command.h"
 #include "every.h"
 #include "random.h"
 #include "scale.h"
+#include "trigger.h"
 #include "turtle.h"
 #include "types.h"
 
@@ -16,8 +19,7 @@
 #define CV_COUNT 4
 #define Q_LENGTH 64
 #define TR_COUNT 4
-#define TRIGGER_INPUTS 8
-#define DELAY_SIZE 64
+#define DELAY_SIZE 120
 #define STACK_OP_SIZE 16
 #define PATTERN_COUNT 4
 #define PATTERN_LENGTH 64
@@ -56,6 +58,63 @@
 #define NB_NBX_SCALES 16
 
 
+////////////////////////////////////////////////////////////////////////////////
+// EXEC STATE //////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+    bool if_else_condition;
+    int16_t i;
+    bool while_continue;
+    uint16_t while_depth;
+    bool breaking;
+    script_number_t script_number;
+    uint8_t line_number;
+    bool delayed;
+} exec_vars_t;
+
+typedef struct {
+    exec_vars_t variables[EXEC_DEPTH];
+    uint8_t exec_depth;
+    bool overflow;
+} exec_state_t;
+
+extern void es_init(exec_state_t *es);
+extern size_t es_depth(exec_state_t *es);
+extern size_t es_push(exec_state_t *es);
+extern size_t es_pop(exec_state_t *es);
+extern void es_set_script_number(exec_state_t *es, uint8_t script_number);
+extern void es_set_line_number(exec_state_t *es, uint8_t line_number);
+extern uint8_t es_get_line_number(exec_state_t *es);
+extern exec_vars_t *es_variables(exec_state_t *es);
+
+////////////////////////////////////////////////////////////////////////////////
+// COMMAND STATE ///////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+    int16_t values[STACK_SIZE];
+    int16_t top;
+} command_state_stack_t;
+
+typedef struct { command_state_stack_t stack; } command_state_t;
+
+extern void cs_init(command_state_t *cs);
+extern int16_t cs_stack_size(command_state_t *cs);
+
+// by declaring the following static inline, each compilation unit (i.e. C
+// file), gets its own copy of the function
+static inline int16_t cs_pop(command_state_t *cs) {
+    cs->stack.top--;
+    return cs->stack.values[cs->stack.top];
+}
+
+static inline void cs_push(command_state_t *cs, int16_t data) {
+    cs->stack.values[cs->stack.top] = data;
+    cs->stack.top++;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 // SCENE STATE /////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -103,6 +162,7 @@ typedef struct {
     int16_t n_scale_root[NB_NBX_SCALES];
     int16_t scene;
     uint8_t script_pol[8];
+    uint16_t script_slice;  // words per slice, 0 to run scripts to the end
     int64_t time;
     uint8_t time_act;
     int16_t tr[TR_COUNT];
@@ -127,17 +187,31 @@ typedef struct {
     int16_t val[PATTERN_LENGTH];
 } scene_pattern_t;
 
+// Delays are kept in slots, the pending ones are ordered by a binary min-heap
+// of slot numbers keyed on their deadline in tele_get_ticks() (and then on the
+// order they were added, so that delays due at the same time run first in
+// first out). Slots below used are either pending, running or on the free
+// list, slots from used onwards have not been handed out since the last
+// clear. The commands are kept in the scene's command arena.
 typedef struct {
     // TODO add a delay variables struct?
-    tele_command_t commands[DELAY_SIZE];
-    int16_t time[DELAY_SIZE];
+    arena_command_t commands[DELAY_SIZE];
+    uint32_t deadline[DELAY_SIZE];
+    uint16_t seq[DELAY_SIZE];
     uint8_t origin_script[DELAY_SIZE];
     int16_t origin_i[DELAY_SIZE];
-    uint8_t count;
+    uint8_t heap[DELAY_SIZE];
+    uint8_t free[DELAY_SIZE];
+    uint8_t free_count;
+    uint8_t used;
+    int8_t running;  // slot popped and not yet released, -1 if none
+    uint8_t count;   // number of pending delays
+    uint16_t next_seq;
 } scene_delay_t;
 
+// the commands are kept in the scene's command arena
 typedef struct {
-    tele_command_t commands[STACK_OP_SIZE];
+    arena_command_t commands[STACK_OP_SIZE];
     uint8_t top;
 } scene_stack_op_t;
 
@@ -148,6 +222,43 @@ typedef struct {
     uint32_t last_time;
 } scene_script_t;
 
+typedef struct {
+    uint8_t start;  // index of the first word
+    uint8_t end;    // index of the last word
+    uint8_t fused;  // a fused_t (see fuse.h), FUSED_NONE to run each word
+} compiled_sub_t;
+
+// a pure OP whose params are all constants, evaluated when compiled
+typedef struct {
+    uint8_t start;  // index of the OP
+    uint8_t end;    // index of the last word of its last param
+    int16_t value;
+} compiled_fold_t;
+
+#define COMMAND_MAX_FOLDS 4
+
+// The executable form of a script command, built once when the command is
+// stored rather than every time it is run. The subs before the PRE separator
+// (or of the whole command if there isn't one) come first, followed by the
+// subs of the POST command.
+//
+// There's one for every script line in each scene_state_t, so it's kept small
+// (52 bytes, 3.4 KB a scene), an OP word's fn is looked up from its OP when
+// it's run (see op_compiled_fn in ops/op.h) rather than kept here.
+typedef struct compiled_command_s {
+    // set_words has a bit set for each OP word that runs its set fn, every
+    // other OP word runs its get fn
+    uint16_t set_words;
+    compiled_sub_t subs[COMMAND_MAX_SUBS];
+    uint8_t pre_count;
+    uint8_t post_count;
+    // the words of a fold are skipped, its value is pushed instead when the
+    // word at its end is reached, fold_ends has a bit set for each end
+    uint16_t fold_ends;
+    compiled_fold_t folds[COMMAND_MAX_FOLDS];
+    uint8_t fold_count;
+} compiled_command_t;
+
 typedef struct {
     u8 enabled;
     u8 group;
@@ -238,6 +349,18 @@ typedef struct {
     uint8_t clock_div;
 } scene_midi_t;
 
+// the selected units of i2c devices, as set by their SEL ops and MODs, and any
+// other state their ops keep between commands
+typedef struct {
+    uint8_t crow;     // address
+    uint8_t disting;  // unit from 0
+    uint8_t disting_midi_channel;
+    uint8_t disting_sb_channel;
+    uint8_t jf;  // address
+    uint8_t jf_note_count;
+    uint8_t matrixarchate;  // unit from 0
+} scene_i2c_t;
+
 typedef struct {
     random_state_t rand;
     s16 seed;
@@ -259,17 +382,23 @@ typedef struct {
     bool initializing;
     scene_variables_t variables;
     scene_pattern_t patterns[PATTERN_COUNT];
+    command_arena_t arena;  // shared by delay and stack_op
     scene_delay_t delay;
     scene_stack_op_t stack_op;
-    int16_t tr_pulse_timer[TR_COUNT];
+    uint32_t tr_pulse_deadline[TR_COUNT];  // in tele_get_ticks()
+    bool tr_pulse_active[TR_COUNT];
+    trigger_queue_t triggers;
     scene_script_t scripts[SCRIPT_COUNT];
+    compiled_command_t compiled[SCRIPT_COUNT][SCRIPT_MAX_COMMANDS];
     scene_turtle_t turtle;
     bool every_last;
     scene_grid_t grid;
     scene_rand_t rand_states;
     cal_data_t cal;
     int8_t i2c_op_address;
+    scene_i2c_t i2c;
     scene_midi_t midi;
+    chaos_state_t chaos;
 } scene_state_t;
 
 extern void ss_init(scene_state_t *ss);
@@ -279,7 +408,9 @@ extern void ss_pattern_init(scene_state_t *ss, size_t pattern_no);
 extern void ss_grid_init(scene_state_t *ss);
 extern void ss_grid_common_init(grid_common_t *gc);
 extern void ss_rand_init(scene_state_t *ss);
+extern void ss_rand_seed(scene_state_t *ss, uint16_t s);
 extern void ss_midi_init(scene_state_t *ss);
+extern void ss_i2c_init(scene_state_t *ss);
 
 extern void ss_set_in(scene_state_t *ss, int16_t value);
 extern void ss_set_param(scene_state_t *ss, int16_t value);
@@ -325,9 +456,21 @@ void ss_overwrite_script_command(scene_state_t *ss, script_number_t script_idx,
                                  size_t command_idx, const tele_command_t *cmd);
 void ss_insert_script_command(scene_state_t *ss, script_number_t script_idx,
                               size_t command_idx, const tele_command_t *cmd);
+// as above, for commands already compiled by parse_and_compile
+void ss_overwrite_script_compiled(scene_state_t *ss,
+                                  script_number_t script_idx,
+                                  size_t command_idx, const tele_command_t *cmd,
+                                  const compiled_command_t *compiled);
+void ss_insert_script_compiled(scene_state_t *ss, script_number_t script_idx,
+                               size_t command_idx, const tele_command_t *cmd,
+                               const compiled_command_t *compiled);
 void ss_delete_script_command(scene_state_t *ss, script_number_t script_idx,
                               size_t command_idx);
 void ss_clear_script(scene_state_t *ss, size_t script_idx);
+const compiled_command_t *ss_get_script_compiled(scene_state_t *ss,
+                                                 script_number_t script_idx,
+                                                 size_t c_idx);
+void ss_compile_scripts(scene_state_t *ss);
 
 scene_script_t *ss_scripts_ptr(scene_state_t *ss);
 size_t ss_scripts_size(void);
@@ -335,6 +478,22 @@ int16_t ss_get_script_last(scene_state_t *ss, script_number_t idx);
 void ss_update_script_last(scene_state_t *ss, script_number_t idx);
 every_count_t *ss_get_every(scene_state_t *ss, script_number_t idx,
                             uint8_t line);
+
+void ss_delay_clear(scene_state_t *ss);
+uint8_t ss_delay_count(scene_state_t *ss);
+bool ss_delay_add(scene_state_t *ss, int16_t time, uint8_t origin_script,
+                  int16_t origin_i, const tele_command_view_t *cmd);
+bool ss_delay_next_deadline(scene_state_t *ss, uint32_t *deadline);
+int8_t ss_delay_pop_due(scene_state_t *ss, uint32_t now);
+tele_command_view_t ss_delay_command(scene_state_t *ss, int8_t slot,
+                                     tele_command_t *out);
+void ss_delay_release(scene_state_t *ss, int8_t slot);
+void ss_stack_op_clear(scene_state_t *ss);
+bool ss_stack_op_push(scene_state_t *ss, const tele_command_view_t *cmd);
+tele_command_view_t ss_stack_op_command(scene_state_t *ss, uint8_t i,
+                                        tele_command_t *out);
+bool ss_stack_op_pop(scene_state_t *ss, tele_command_t *out,
+                     tele_command_view_t *view);
 void ss_sync_every(scene_state_t *ss, int16_t count);
 bool every_is_now(scene_state_t *ss, every_count_t *e);
 bool skip_is_now(scene_state_t *ss, every_count_t *e);
@@ -370,61 +529,5 @@ void ss_set_fader_min(scene_state_t *ss, int16_t fader, int16_t min);
 void ss_set_fader_max(scene_state_t *ss, int16_t fader, int16_t max);
 void ss_reset_fader_cal(scene_state_t *ss, int16_t fader);
 
-////////////////////////////////////////////////////////////////////////////////
-// EXEC STATE //////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////
-
-typedef struct {
-    bool if_else_condition;
-    int16_t i;
-    bool while_continue;
-    uint16_t while_depth;
-    bool breaking;
-    script_number_t script_number;
-    uint8_t line_number;
-    bool delayed;
-} exec_vars_t;
-
-typedef struct {
-    exec_vars_t variables[EXEC_DEPTH];
-    uint8_t exec_depth;
-    bool overflow;
-} exec_state_t;
-
-extern void es_init(exec_state_t *es);
-extern size_t es_depth(exec_state_t *es);
-extern size_t es_push(exec_state_t *es);
-extern size_t es_pop(exec_state_t *es);
-extern void es_set_script_number(exec_state_t *es, uint8_t script_number);
-extern void es_set_line_number(exec_state_t *es, uint8_t line_number);
-extern uint8_t es_get_line_number(exec_state_t *es);
-extern exec_vars_t *es_variables(exec_state_t *es);
-
-////////////////////////////////////////////////////////////////////////////////
-// COMMAND STATE ///////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////
-
-typedef struct {
-    int16_t values[STACK_SIZE];
-    int16_t top;
-} command_state_stack_t;
-
-typedef struct { command_state_stack_t stack; } command_state_t;
-
-extern void cs_init(command_state_t *cs);
-extern int16_t cs_stack_size(command_state_t *cs);
-
-// by declaring the following static inline, each compilation unit (i.e. C
-// file), gets its own copy of the function
-static inline int16_t cs_pop(command_state_t *cs) {
-    cs->stack.top--;
-    return cs->stack.values[cs->stack.top];
-}
-
-static inline void cs_push(command_state_t *cs, int16_t data) {
-    cs->stack.values[cs->stack.top] = data;
-    cs->stack.top++;
-}
-
 
 #endif
@@ -3,134 +3,310 @@
 #include <string.h>
 #include <unistd.h>  // ssize_t
 
+#include "every.h"
+#include "fuse.h"
 #include "helpers.h"
+#include "ops/controlflow.h"
 #include "ops/op.h"
+#include "profiler.h"
+#include "random.h"
 #include "scanner.h"
 #include "table.h"
 #include "teletype.h"
 #include "teletype_io.h"
 #include "util.h"
 
+#if defined(TELETYPE_THREADED) && !defined(__GNUC__)
+#error "TELETYPE_THREADED needs computed goto, a GCC extension"
+#endif
 
-bool processing_delays = false;
 
 /////////////////////////////////////////////////////////////////
 // DELAY ////////////////////////////////////////////////////////
 
 void clear_delays(scene_state_t *ss) {
-    for (int16_t i = 0; i < TR_COUNT; i++) { ss->tr_pulse_timer[i] = 0; }
-
-    for (int16_t i = 0; i < DELAY_SIZE; i++) { ss->delay.time[i] = 0; }
+    for (int16_t i = 0; i < TR_COUNT; i++) { ss->tr_pulse_active[i] = false; }
 
-    ss->delay.count = 0;
-    ss->stack_op.top = 0;
+    ss_delay_clear(ss);
+    ss_stack_op_clear(ss);
 
     tele_has_delays(false);
     tele_has_stack(false);
 }
 
+// run the command of a delay, in the context of the script that queued it
+static void run_delayed_command(scene_state_t *ss, uint8_t origin_script,
+                                int16_t origin_i,
+                                const tele_command_view_t *command) {
+    // New execution context setup needs to es_push, but it's
+    // decoupled to allow SCRIPT to work
+    exec_state_t es;
+    es_init(&es);
+    es_push(&es);
+
+    // THIS, I and EVERY see the origin of the delay, the delay flag is
+    // required to protect the script number from SCRIPT
+    // TODO: investigate delayed nested SCRIPTs
+    es_variables(&es)->delayed = true;
+    es_variables(&es)->script_number = origin_script;
+    es_variables(&es)->i = origin_i;
+    es_set_line_number(&es, 0);
+
+    do {
+        process_command(ss, &es, command);
+    } while (es_variables(&es)->while_continue && !es_variables(&es)->breaking);
+}
+
 
 /////////////////////////////////////////////////////////////////
 // PARSE ////////////////////////////////////////////////////////
 
 error_t parse(const char *cmd, tele_command_t *out,
               char error_msg[TELE_ERROR_MSG_LENGTH]) {
-    // call the Ragel generated scanner function
+    // split the command into tokens and match them
     return scanner(cmd, out, error_msg);
 }
 
 /////////////////////////////////////////////////////////////////
-// VALIDATE /////////////////////////////////////////////////////
+// VALIDATE AND COMPILE /////////////////////////////////////////
+
+// The stack of a sub command as it will be when it's run, with the values that
+// are already known when compiling, used to fold constant expressions.
+typedef struct {
+    struct {
+        bool known;
+        int16_t value;
+        uint8_t end;  // index of the last word of the expression it's from
+    } values[COMMAND_MAX_LENGTH];
+    uint8_t top;
+} fold_stack_t;
+
+static void fold_push(fold_stack_t *st, bool known, int16_t value,
+                      uint8_t end) {
+    if (st->top >= COMMAND_MAX_LENGTH) return;
+    st->values[st->top].known = known;
+    st->values[st->top].value = value;
+    st->values[st->top].end = end;
+    st->top++;
+}
 
-error_t validate(const tele_command_t *c,
-                 char error_msg[TELE_ERROR_MSG_LENGTH]) {
-    error_msg[0] = 0;
+static void fold_pop(fold_stack_t *st, uint8_t count) {
+    st->top = count < st->top ? st->top - count : 0;
+}
+
+// run the get fn of the OP at idx on the stack, if it's pure and all its
+// params are known, its value is then known too and recorded in out
+static void fold_op(tele_op_idx_t op, uint8_t idx, fold_stack_t *st,
+                    compiled_command_t *out) {
+    const uint8_t params = op_params(op);
+    const bool returns = op_returns(op);
+    bool known = op_purity(op) == OP_PURE && returns && params > 0 &&
+                 st->top >= params;
+    for (uint8_t i = 0; known && i < params; i++)
+        known = st->values[st->top - 1 - i].known;
+
+    if (!known) {
+        fold_pop(st, params);
+        if (returns) fold_push(st, false, 0, idx);
+        return;
+    }
+
+    // the params go on in the same order as when running, so the first param
+    // is at the top
+    command_state_t cs;
+    cs_init(&cs);
+    for (uint8_t i = st->top - params; i < st->top; i++)
+        cs_push(&cs, st->values[i].value);
+    tele_op_get[op](tele_op_data[op], NULL, NULL, &cs);
+    const int16_t value = cs_pop(&cs);
+    const uint8_t end = st->values[st->top - params].end;
+    fold_pop(st, params);
+
+    // this fold replaces any folds in its params, they were added last
+    while (out->fold_count && out->folds[out->fold_count - 1].start <= end) {
+        out->fold_count--;
+        out->fold_ends &= ~(1 << out->folds[out->fold_count].end);
+    }
+
+    if (out->fold_count == COMMAND_MAX_FOLDS) {
+        fold_push(st, false, 0, idx);
+        return;
+    }
+
+    out->folds[out->fold_count].start = idx;
+    out->folds[out->fold_count].end = end;
+    out->folds[out->fold_count].value = value;
+    out->fold_count++;
+    out->fold_ends |= 1 << end;
+    fold_push(st, true, value, end);
+}
+
+// Validates c and compiles it in to out (unless it's NULL) in a single right
+// to left pass over its words.
+//
+// Every OP gets its get or set fn and each sub command the most values it will
+// have on the stack. Pure OPs with constant params are evaluated (folded) here
+// rather than every time the command runs, and subs of a common shape are
+// fused in to a single handler (see fuse.h). The words of the command are left
+// as they are so that it still prints as it was typed.
+//
+// The whole command is compiled even when it isn't valid, so that
+// compile_command works on commands that were never validated (e.g. loaded
+// from flash), the error returned is the first one found from the right.
+static error_t check_command(const tele_command_t *c, compiled_command_t *out,
+                             char error_msg[TELE_ERROR_MSG_LENGTH]) {
+    error_t error = E_OK;
     int16_t stack_depth = 0;
-    uint8_t idx = c->length;
     int8_t sep_count = 0;
 
-    while (idx--) {  // process words right to left
-        tele_word_t word_type = c->data[idx].tag;
-        int16_t word_value = c->data[idx].value;
+    // the subs are found last first, and put in order at the end
+    compiled_sub_t subs[COMMAND_MAX_SUBS];
+    uint8_t sub_count = 0;
+    uint8_t post_count = 0;
+    int16_t sub_end = c->length - 1;
+    const bool has_sep = c->separator >= 0 && c->separator < c->length;
+    fold_stack_t fold_stack = {.top = 0 };
+
+    error_msg[0] = 0;
+    if (out) {
+        out->set_words = 0;
+        out->fold_ends = 0;
+        out->fold_count = 0;
+    }
+
+    for (int16_t idx = c->length - 1; idx >= -1; idx--) {
+        // the start of the command, a SUB_SEP and the PRE_SEP all end the sub
+        // command to their right
+        if (out && (idx == -1 || td_tag(&c->data[idx]) == SUB_SEP ||
+                    (has_sep && idx == c->separator))) {
+            if (sub_end > idx) {
+                subs[sub_count].start = idx + 1;
+                subs[sub_count].end = sub_end;
+                sub_count++;
+            }
+            if (has_sep && idx == c->separator) post_count = sub_count;
+            sub_end = idx - 1;
+            fold_stack.top = 0;
+        }
+        if (idx == -1) break;
+
+        tele_word_t word_type = td_tag(&c->data[idx]);
+        int16_t word_value = td_value(&c->data[idx]);
         // A first_cmd is either at the beginning of the command or immediately
         // after the PRE_SEP or COMMAND_SEP
-        bool first_cmd = idx == 0 || c->data[idx - 1].tag == PRE_SEP ||
-                         c->data[idx - 1].tag == SUB_SEP;
+        bool first_cmd = idx == 0 || td_tag(&c->data[idx - 1]) == PRE_SEP ||
+                         td_tag(&c->data[idx - 1]) == SUB_SEP;
+        error_t word_error = E_OK;
+        const char *word_name = NULL;
 
-        if (word_type == NUMBER || word_type == XNUMBER ||
-            word_type == BNUMBER || word_type == RNUMBER) {
+        if (td_is_number(&c->data[idx])) {
             stack_depth++;
+            if (out) fold_push(&fold_stack, true, word_value, idx);
         }
         else if (word_type == OP) {
-            const tele_op_t *op = tele_ops[word_value];
+            const uint8_t params = op_params(word_value);
+            const bool returns = op_returns(word_value);
+            const bool has_set = op_has_set(word_value);
+            word_name = tele_op_names[word_value];
+
+            // if we're in the first command position, and there is a set fn
+            // pointer and we have enough params, then run set, else run get
+            if (out && first_cmd && has_set && stack_depth >= params + 1) {
+                out->set_words |= 1 << idx;
+                fold_pop(&fold_stack, params + 1);
+            }
+            else if (out)
+                fold_op(word_value, idx, &fold_stack, out);
 
             // if we're not a first_cmd we need to return something
-            if (!first_cmd && !op->returns) {
-                strcpy(error_msg, op->name);
-                return E_NOT_LEFT;
-            }
+            if (!first_cmd && !returns) word_error = E_NOT_LEFT;
 
-            stack_depth -= op->params;
+            stack_depth -= params;
 
-            if (stack_depth < 0) {
-                strcpy(error_msg, op->name);
-                return E_NEED_PARAMS;
-            }
+            if (stack_depth < 0 && word_error == E_OK)
+                word_error = E_NEED_PARAMS;
 
-            stack_depth += op->returns ? 1 : 0;
+            stack_depth += returns ? 1 : 0;
 
             // if we are in the first_cmd position and there is a set fn
             // decrease the stack depth
             // TODO this is technically wrong. the only reason we get away with
             // it is that it's idx == 0, and the while loop is about to end.
-            if (first_cmd && op->set != NULL) stack_depth--;
+            if (first_cmd && has_set) stack_depth--;
         }
         else if (word_type == MOD) {
-            error_t mod_error = E_OK;
+            word_name = tele_mods[word_value]->name;
 
             if (idx != 0)
-                mod_error = E_NO_MOD_HERE;
+                word_error = E_NO_MOD_HERE;
             else if (c->separator == -1)
-                mod_error = E_NEED_PRE_SEP;
+                word_error = E_NEED_PRE_SEP;
             else if (stack_depth < tele_mods[word_value]->params)
-                mod_error = E_NEED_PARAMS;
+                word_error = E_NEED_PARAMS;
             else if (stack_depth > tele_mods[word_value]->params)
-                mod_error = E_EXTRA_PARAMS;
-
-            if (mod_error != E_OK) {
-                strcpy(error_msg, tele_mods[word_value]->name);
-                return mod_error;
-            }
+                word_error = E_EXTRA_PARAMS;
 
             stack_depth = 0;
         }
         else if (word_type == PRE_SEP) {
             sep_count++;
-            if (sep_count > 1) return E_MANY_PRE_SEP;
-
-            if (idx == 0) return E_PLACE_PRE_SEP;
-
-            if (c->data[0].tag != MOD) return E_PLACE_PRE_SEP;
-
-            if (stack_depth > 1) return E_EXTRA_PARAMS;
+            if (sep_count > 1)
+                word_error = E_MANY_PRE_SEP;
+            else if (idx == 0 || td_tag(&c->data[0]) != MOD)
+                word_error = E_PLACE_PRE_SEP;
+            else if (stack_depth > 1)
+                word_error = E_EXTRA_PARAMS;
 
             // reset the stack depth
             stack_depth = 0;
         }
         else if (word_type == SUB_SEP) {
-            if (sep_count > 0) return E_NO_SUB_SEP_IN_PRE;
-
-            if (stack_depth > 1) return E_EXTRA_PARAMS;
+            if (sep_count > 0)
+                word_error = E_NO_SUB_SEP_IN_PRE;
+            else if (stack_depth > 1)
+                word_error = E_EXTRA_PARAMS;
 
             // reset the stack depth
             stack_depth = 0;
         }
+
+        if (word_error != E_OK && error == E_OK) {
+            error = word_error;
+            if (word_name) strcpy(error_msg, word_name);
+        }
     }
 
-    if (stack_depth > 1)
-        return E_EXTRA_PARAMS;
-    else
-        return E_OK;
+    if (error == E_OK && stack_depth > 1) error = E_EXTRA_PARAMS;
+
+    if (out) {
+        for (uint8_t i = 0; i < sub_count; i++) {
+            out->subs[i] = subs[sub_count - 1 - i];
+            out->subs[i].fused =
+                fuse_sub(c, out->subs[i].start, out->subs[i].end);
+        }
+        out->pre_count = sub_count - post_count;
+        out->post_count = post_count;
+    }
+
+    return error;
+}
+
+error_t validate(const tele_command_t *c,
+                 char error_msg[TELE_ERROR_MSG_LENGTH]) {
+    return check_command(c, NULL, error_msg);
+}
+
+void compile_command(const tele_command_t *c, compiled_command_t *out) {
+    char error_msg[TELE_ERROR_MSG_LENGTH];
+    check_command(c, out, error_msg);
+}
+
+error_t parse_and_compile(const char *cmd, tele_command_t *out,
+                          compiled_command_t *compiled,
+                          char error_msg[TELE_ERROR_MSG_LENGTH]) {
+    error_t status = scanner(cmd, out, error_msg);
+    if (status != E_OK) return status;
+    return check_command(out, compiled, error_msg);
 }
 
 /////////////////////////////////////////////////////////////////
@@ -148,7 +324,7 @@ process_result_t run_script(scene_state_t *ss, size_t script_no) {
 process_result_t run_script_with_exec_state(scene_state_t *ss, exec_state_t *es,
                                             size_t script_no) {
 #ifdef TELETYPE_PROFILE
-    tele_profile_script(script_no);
+    profile_ticks_t profile_start = profiler_now();
 #endif
     process_result_t result = {.has_value = false, .value = 0 };
 
@@ -162,10 +338,16 @@ process_result_t run_script_with_exec_state(scene_state_t *ss, exec_state_t *es,
 
         // BREAK implemented with break...
         if (es_variables(es)->breaking) break;
+        const tele_command_view_t command = {
+            .base = ss_get_script_command(ss, script_no, i),
+            .compiled = ss_get_script_compiled(ss, script_no, i),
+            .offset = 0,
+            .length = ss_get_script_command(ss, script_no, i)->length
+        };
+
         do {
             // TODO: Check for 0-length commands before we bother?
-            result = process_command(ss, es,
-                                     ss_get_script_command(ss, script_no, i));
+            result = process_command(ss, es, &command);
             // and WHILE implemented with while!
         } while (es_variables(es)->while_continue &&
                  !es_variables(es)->breaking);
@@ -175,7 +357,7 @@ process_result_t run_script_with_exec_state(scene_state_t *ss, exec_state_t *es,
     ss_update_script_last(ss, script_no);
 
 #ifdef TELETYPE_PROFILE
-    tele_profile_script(script_no);
+    profiler_script(script_no, profile_start);
 #endif
     return result;
 }
@@ -191,8 +373,9 @@ process_result_t run_command(scene_state_t *ss, const tele_command_t *cmd) {
     // the lack of a script number here is a bug, so if you use this code,
     // something needs to set the script number
     // es_variables(es)->script_number =
+    const tele_command_view_t command = command_view(cmd);
     do {
-        o = process_command(ss, &es, cmd);
+        o = process_command(ss, &es, &command);
     } while (es_variables(&es)->while_continue && !es_variables(&es)->breaking);
     return o;
 }
@@ -201,94 +384,164 @@ process_result_t run_command(scene_state_t *ss, const tele_command_t *cmd) {
 /////////////////////////////////////////////////////////////////
 // PROCESS //////////////////////////////////////////////////////
 
-// run a single command inside a given exec_state
-process_result_t process_command(scene_state_t *ss, exec_state_t *es,
-                                 const tele_command_t *c) {
-    command_state_t cs;
-    cs_init(&cs);  // initialise this here as well as inside the loop, in case
-                   // the command has 0 length
-
-    // 1. Do we have a PRE seperator?
-    // ------------------------------
-    // if we do then only process the PRE part, the MOD will determine if the
-    // POST should be run and take care of running it
-    ssize_t start_idx = 0;
-    ssize_t end_idx = c->separator == -1 ? c->length : c->separator;
-
-    // 2. Determine the location of all the SUB commands
-    // -------------------------------------------------
-    // an array of structs to hold the start and end of each sub command
-    struct sub_idx {
-        ssize_t start;
-        ssize_t end;
-    } subs[COMMAND_MAX_LENGTH];
-
-    ssize_t sub_len = 0;
-    ssize_t sub_start = 0;
-
-    // iterate through c->data to find all the SUB_SEPs and add to the array
-    for (ssize_t idx = start_idx; idx < end_idx; idx++) {
-        tele_word_t word_type = c->data[idx].tag;
-        if (word_type == SUB_SEP && idx > sub_start) {
-            subs[sub_len].start = sub_start;
-            subs[sub_len].end = idx - 1;
-            sub_len++;
-            sub_start = idx + 1;
+// run the words sub_start to sub_end of a compiled command on cs, right to
+// left, as we are using a stack based language
+static inline void process_words(scene_state_t *ss, exec_state_t *es,
+                                 const tele_command_t *c,
+                                 const compiled_command_t *cc,
+                                 command_state_t *cs, ssize_t sub_start,
+                                 ssize_t sub_end) {
+#ifdef TELETYPE_THREADED
+    // The same as the loop below, but each word jumps straight to the code
+    // for its tag, and each of those ends with its own jump to the next word,
+    // rather than going through a chain of ifs at the top of a loop.
+    static const void *const word_labels[] = {
+        [NUMBER] = &&word_number, [XNUMBER] = &&word_number,
+        [BNUMBER] = &&word_number, [RNUMBER] = &&word_number,
+        [OP] = &&word_op,         [MOD] = &&word_mod,
+        [PRE_SEP] = &&word_next,  [SUB_SEP] = &&word_next
+    };
+    ssize_t idx = sub_end + 1;
+
+#define NEXT_WORD()                                     \
+    do {                                                \
+        if (--idx < sub_start) return;                  \
+        if (cc->fold_ends & (1 << idx)) goto word_fold; \
+        goto *word_labels[td_tag(&c->data[idx])];       \
+    } while (0)
+
+    NEXT_WORD();
+
+word_fold:
+    // push the value of the fold and skip the rest of its words
+    for (uint8_t f = 0; f < cc->fold_count; f++) {
+        if (cc->folds[f].end == idx) {
+            cs_push(cs, cc->folds[f].value);
+            idx = cc->folds[f].start;
+            break;
         }
     }
+    NEXT_WORD();
+
+word_number:
+    cs_push(cs, td_value(&c->data[idx]));
+    NEXT_WORD();
 
-    // the last sub command won't have been added, manually add it here
-    if (end_idx > sub_start) {
-        subs[sub_len].start = sub_start;
-        subs[sub_len].end = end_idx - 1;
-        sub_len++;
+word_op: {
+    const int16_t word_value = td_value(&c->data[idx]);
+    const tele_op_fn_t fn = op_compiled_fn(c, cc, idx);
+    if (fn != NULL) {
+#ifdef TELETYPE_PROFILE
+        profile_ticks_t profile_start = profiler_now();
+#endif
+        fn(tele_op_data[word_value], ss, es, cs);
+#ifdef TELETYPE_PROFILE
+        profiler_op(word_value, profile_start);
+#endif
     }
+    NEXT_WORD();
+}
+
+word_mod: {
+    const int16_t word_value = td_value(&c->data[idx]);
+    const tele_command_view_t post_command = {
+        .base = c,
+        .compiled = cc,
+        .offset = c->separator + 1,
+        .length = c->length - c->separator - 1
+    };
+#ifdef TELETYPE_PROFILE
+    profile_ticks_t profile_start = profiler_now();
+#endif
+    tele_mods[word_value]->func(ss, es, cs, &post_command);
+#ifdef TELETYPE_PROFILE
+    profiler_mod(word_value, profile_start);
+#endif
+    NEXT_WORD();
+}
+
+word_next:
+    NEXT_WORD();
+
+#undef NEXT_WORD
+#else
+    for (ssize_t idx = sub_end; idx >= sub_start; idx--) {
+        const tele_word_t word_type = td_tag(&c->data[idx]);
+        const int16_t word_value = td_value(&c->data[idx]);
+
+        if (cc->fold_ends & (1 << idx)) {
+            // push the value of the fold and skip the rest of its words
+            for (uint8_t f = 0; f < cc->fold_count; f++) {
+                if (cc->folds[f].end == idx) {
+                    cs_push(cs, cc->folds[f].value);
+                    idx = cc->folds[f].start;
+                    break;
+                }
+            }
+        }
+        else if (word_type == OP) {
+            const tele_op_fn_t fn = op_compiled_fn(c, cc, idx);
+            if (fn == NULL) continue;
+#ifdef TELETYPE_PROFILE
+            profile_ticks_t profile_start = profiler_now();
+#endif
+            fn(tele_op_data[word_value], ss, es, cs);
+#ifdef TELETYPE_PROFILE
+            profiler_op(word_value, profile_start);
+#endif
+        }
+        else if (td_is_number(&c->data[idx])) {
+            cs_push(cs, word_value);
+        }
+        else if (word_type == MOD) {
+            // hand the MOD a view of the POST command rather than a copy, it
+            // runs from the same compiled form as we do
+            const tele_command_view_t post_command = {
+                .base = c,
+                .compiled = cc,
+                .offset = c->separator + 1,
+                .length = c->length - c->separator - 1
+            };
+#ifdef TELETYPE_PROFILE
+            profile_ticks_t profile_start = profiler_now();
+#endif
+            tele_mods[word_value]->func(ss, es, cs, &post_command);
+#ifdef TELETYPE_PROFILE
+            profiler_mod(word_value, profile_start);
+#endif
+        }
+    }
+#endif
+}
+
+// run the subs of a compiled command inside a given exec_state
+static process_result_t process_compiled_subs(scene_state_t *ss,
+                                              exec_state_t *es,
+                                              const tele_command_t *c,
+                                              const compiled_command_t *cc,
+                                              const compiled_sub_t *subs,
+                                              uint8_t sub_len) {
+    command_state_t cs;
+    cs_init(&cs);  // initialise this here as well as inside the loop, in case
+                   // the command has 0 length
 
-    // 3. Loop through each sub command and execute it
-    // -----------------------------------------------
     // iterate through sub commands from left to right
-    for (ssize_t sub_idx = 0; sub_idx < sub_len && !es_variables(es)->breaking;
+    for (uint8_t sub_idx = 0; sub_idx < sub_len && !es_variables(es)->breaking;
          sub_idx++) {
-        const ssize_t sub_start = subs[sub_idx].start;
-        const ssize_t sub_end = subs[sub_idx].end;
-
         // initialise the command state for each sub, otherwise a value left on
         // the stack for the previous sub, can cause the set fn to trigger when
         // it shouldn't
         cs_init(&cs);
 
-        // as we are using a stack based language, we must process commands from
-        // right to left
-        for (ssize_t idx = sub_end; idx >= sub_start; idx--) {
-            const tele_word_t word_type = c->data[idx].tag;
-            const int16_t word_value = c->data[idx].value;
-
-            if (word_type == NUMBER || word_type == XNUMBER ||
-                word_type == BNUMBER || word_type == RNUMBER) {
-                cs_push(&cs, word_value);
-            }
-            else if (word_type == OP) {
-                const tele_op_t *op = tele_ops[word_value];
-
-                // if we're in the first command position, and there is a set fn
-                // pointer and we have enough params, then run set, else run get
-                if (idx == sub_start && op->set != NULL &&
-                    cs_stack_size(&cs) >= op->params + 1)
-                    op->set(op->data, ss, es, &cs);
-                else
-                    op->get(op->data, ss, es, &cs);
-            }
-            else if (word_type == MOD) {
-                tele_command_t post_command;
-                post_command.comment = false;
-                copy_post_command(&post_command, c);
-                tele_mods[word_value]->func(ss, es, &cs, &post_command);
-            }
+        if (subs[sub_idx].fused != FUSED_NONE) {
+            run_fused(subs[sub_idx].fused, ss, c, subs[sub_idx].start);
+            continue;
         }
+
+        process_words(ss, es, c, cc, &cs, subs[sub_idx].start,
+                      subs[sub_idx].end);
     }
 
-    // 4. Return
-    // ---------
     // sometimes we have single value left of the stack, if so return it
     if (cs_stack_size(&cs)) {
         process_result_t o = {.has_value = true, .value = cs_pop(&cs) };
@@ -300,11 +553,295 @@ process_result_t process_command(scene_state_t *ss, exec_state_t *es,
     }
 }
 
+// run a single command inside a given exec_state
+process_result_t process_command(scene_state_t *ss, exec_state_t *es,
+                                 const tele_command_view_t *v) {
+    compiled_command_t compiled;
+    const compiled_command_t *cc = v->compiled;
+    if (cc == NULL) {
+        compile_command(v->base, &compiled);
+        cc = &compiled;
+    }
+
+    // for a view of a whole command only process the PRE part, the MOD will
+    // determine if the POST should be run and take care of running it
+    if (v->offset == 0)
+        return process_compiled_subs(ss, es, v->base, cc, cc->subs,
+                                     cc->pre_count);
+    else
+        return process_compiled_subs(ss, es, v->base, cc,
+                                     &cc->subs[cc->pre_count], cc->post_count);
+}
+
+
+/////////////////////////////////////////////////////////////////
+// SLICE ////////////////////////////////////////////////////////
+
+// how far a run_frame_t has got through its line
+enum { RUN_LINE, RUN_PRE, RUN_POST };
+
+static void run_frame_push(script_run_t *run, size_t script_no) {
+    run_frame_t *f = &run->frames[run->depth++];
+    f->script_no = script_no;
+    f->line = 0;
+    f->step = RUN_LINE;
+    es_set_script_number(&run->es, script_no);
+}
+
+// the end of run_script_with_exec_state, and of op_SCRIPT_set for a script
+// that was called
+static void run_frame_pop(scene_state_t *ss, script_run_t *run) {
+    const uint8_t script_no = run->frames[--run->depth].script_no;
+    es_variables(&run->es)->breaking = false;
+    ss_update_script_last(ss, script_no);
+    if (run->depth) es_pop(&run->es);
+}
+
+// op_SCRIPT_set, with a frame in place of run_script_with_exec_state
+static void run_call(script_run_t *run, int16_t script) {
+    uint16_t a = script - 1;
+    if (a > INIT_SCRIPT) return;
+
+    es_push(&run->es);
+    if (!run->es.overflow)
+        run_frame_push(run, a);
+    else
+        es_pop(&run->es);
+}
+
+// the MODs whose POST a run runs itself, so that it can stop part way through
+// a loop or a SCRIPT in the POST, the others run theirs to the end
+static bool run_has_mod(int16_t mod) {
+    switch (mod) {
+        case E_MOD_PROB:
+        case E_MOD_IF:
+        case E_MOD_ELIF:
+        case E_MOD_ELSE:
+        case E_MOD_L:
+        case E_MOD_W:
+        case E_MOD_EVERY:
+        case E_MOD_EV:
+        case E_MOD_SKIP:
+        case E_MOD_OTHER: return true;
+        default: return false;
+    }
+}
+
+// the start of the MOD's func, returns true if the POST should run
+static bool run_mod_start(scene_state_t *ss, exec_state_t *es, run_frame_t *f,
+                          int16_t mod, command_state_t *cs) {
+    switch (mod) {
+        case E_MOD_PROB: return mod_PROB_start(ss, cs_pop(cs));
+        case E_MOD_IF: return mod_IF_start(es, cs_pop(cs));
+        case E_MOD_ELIF: return mod_ELIF_start(es, cs_pop(cs));
+        case E_MOD_ELSE: return mod_ELSE_start(es);
+        case E_MOD_L: {
+            int16_t a = cs_pop(cs);
+            int16_t b = cs_pop(cs);
+            f->i_depth = es->exec_depth - 1;
+            mod_L_start(es, a, b, &f->loop);
+            return true;
+        }
+        case E_MOD_W: return mod_W_start(es, cs_pop(cs));
+        case E_MOD_EVERY:
+        case E_MOD_EV: return mod_EVERY_start(ss, es, cs_pop(cs));
+        case E_MOD_SKIP: return mod_SKIP_start(ss, es, cs_pop(cs));
+        case E_MOD_OTHER: return mod_OTHER_start(ss);
+        default: return false;
+    }
+}
+
+// the rest of the MOD's func, after each time its POST has run
+static void run_mod_end(exec_state_t *es, run_frame_t *f) {
+    if (f->mod == E_MOD_L) {
+        int16_t *i = &es->variables[f->i_depth].i;
+        if (mod_L_next(es, i, &f->loop)) {
+            f->sub = 0;
+            return;
+        }
+    }
+    else if (f->mod == E_MOD_W)
+        mod_W_next(es);
+
+    // back to the PRE, whose only sub is the MOD's
+    f->step = RUN_PRE;
+    f->sub = 1;
+}
+
+// runs a sub of the line that f is on, returns how many words it has
+static uint8_t run_sub(scene_state_t *ss, script_run_t *run, run_frame_t *f,
+                       const tele_command_t *c, const compiled_command_t *cc,
+                       const compiled_sub_t *sub) {
+    const tele_word_t tag = td_tag(&c->data[sub->start]);
+    const int16_t value = td_value(&c->data[sub->start]);
+    command_state_t cs;
+    cs_init(&cs);
+
+    if (sub->fused != FUSED_NONE)
+        run_fused(sub->fused, ss, c, sub->start);
+    else if (tag == MOD && run_has_mod(value)) {
+        process_words(ss, &run->es, c, cc, &cs, sub->start + 1, sub->end);
+        if (run_mod_start(ss, &run->es, f, value, &cs)) {
+            f->step = RUN_POST;
+            f->sub = 0;
+            f->mod = value;
+        }
+    }
+    else if (tag == OP && value == E_OP_SCRIPT &&
+             cc->set_words & (1 << sub->start)) {
+        process_words(ss, &run->es, c, cc, &cs, sub->start + 1, sub->end);
+        run_call(run, cs_pop(&cs));
+    }
+    else
+        process_words(ss, &run->es, c, cc, &cs, sub->start, sub->end);
+
+    return sub->end - sub->start + 1;
+}
+
+void run_script_start(script_run_t *run, size_t script_no) {
+    es_init(&run->es);
+    es_push(&run->es);
+    run->depth = 0;
+    run_frame_push(run, script_no);
+#ifdef TELETYPE_PROFILE
+    run->profile_elapsed = 0;
+#endif
+}
+
+// the same as run_script_with_exec_state, with the loops of it, of
+// process_command and of the MODs above turned in to steps of the top frame,
+// so that it can return between any two of them
+bool run_script_slice(scene_state_t *ss, script_run_t *run, uint16_t words) {
+    exec_state_t *es = &run->es;
+    uint32_t spent = 0;
+
+    while (run->depth) {
+        if (words && spent >= words) return false;
+        spent++;
+
+        run_frame_t *f = &run->frames[run->depth - 1];
+        if (f->step == RUN_LINE) {
+            if (f->line >= ss_get_script_len(ss, f->script_no)) {
+                run_frame_pop(ss, run);
+                continue;
+            }
+            es_set_line_number(es, f->line);
+
+            // Commented code doesn't run.
+            if (ss_get_script_comment(ss, f->script_no, f->line)) {
+                f->line++;
+                continue;
+            }
+
+            if (es_variables(es)->breaking) {
+                run_frame_pop(ss, run);
+                continue;
+            }
+
+            f->step = RUN_PRE;
+            f->sub = 0;
+            continue;
+        }
+
+        const tele_command_t *c =
+            ss_get_script_command(ss, f->script_no, f->line);
+        const compiled_command_t *cc =
+            ss_get_script_compiled(ss, f->script_no, f->line);
+        const bool breaking = es_variables(es)->breaking;
+
+        if (f->step == RUN_PRE) {
+            if (f->sub < cc->pre_count && !breaking)
+                spent += run_sub(ss, run, f, c, cc, &cc->subs[f->sub++]);
+            // W runs the line again
+            else if (es_variables(es)->while_continue && !breaking)
+                f->sub = 0;
+            else {
+                f->line++;
+                f->step = RUN_LINE;
+            }
+        }
+        else if (f->sub < cc->post_count && !breaking) {
+            const uint8_t sub = cc->pre_count + f->sub++;
+            spent += run_sub(ss, run, f, c, cc, &cc->subs[sub]);
+        }
+        else
+            run_mod_end(es, f);
+    }
+
+    return true;
+}
+
+void script_runs_init(script_runs_t *runs) {
+    for (size_t i = 0; i <= INIT_SCRIPT; i++) runs->runs[i].depth = 0;
+    runs->slicing = -1;
+}
+
+void script_runs_init_others(script_runs_t *runs) {
+    for (int8_t i = 0; i <= INIT_SCRIPT; i++)
+        if (i != runs->slicing) runs->runs[i].depth = 0;
+}
+
+// a slice of a run, with the time of each slice added up and profiled as one
+// run of the script when it finishes
+static void run_slice(scene_state_t *ss, script_runs_t *runs, size_t script_no,
+                      uint16_t words) {
+    script_run_t *run = &runs->runs[script_no];
+#ifdef TELETYPE_PROFILE
+    const profile_ticks_t profile_start = profiler_now();
+#endif
+    runs->slicing = script_no;
+    const bool finished = run_script_slice(ss, run, words);
+    runs->slicing = -1;
+#ifdef TELETYPE_PROFILE
+    run->profile_elapsed += profiler_now() - profile_start;
+    if (finished) profiler_script_elapsed(script_no, run->profile_elapsed);
+#else
+    (void)finished;
+#endif
+}
+
+bool tele_run_script(scene_state_t *ss, script_runs_t *runs, size_t script_no) {
+    script_run_t *run = &runs->runs[script_no];
+    const uint16_t words = ss->variables.script_slice;
+
+    // each run of a script starts where the last one left the scene, so one
+    // that hasn't finished isn't started again, a trigger input's edges wait
+    // in its queue until then (see tele_running_inputs), a metro tick is
+    // skipped
+    if (run->depth) return false;
+
+    if (words == 0) {
+        run_script(ss, script_no);
+        return true;
+    }
+
+    run_script_start(run, script_no);
+    run_slice(ss, runs, script_no, words);
+    return true;
+}
+
+uint8_t tele_running_inputs(const script_runs_t *runs) {
+    uint8_t running = 0;
+    for (uint8_t i = 0; i < TRIGGER_INPUTS; i++)
+        if (runs->runs[i].depth) running |= 1 << i;
+    return running;
+}
+
+bool tele_run_slices(scene_state_t *ss, script_runs_t *runs) {
+    bool ran = false;
+    for (size_t i = 0; i <= INIT_SCRIPT; i++) {
+        if (runs->runs[i].depth == 0) continue;
+        run_slice(ss, runs, i, ss->variables.script_slice);
+        ran = true;
+    }
+    return ran;
+}
+
 
 /////////////////////////////////////////////////////////////////
 // TICK /////////////////////////////////////////////////////////
 
-void tele_tick(scene_state_t *ss, uint8_t time) {
+void tele_tick(scene_state_t *ss) {
     // could be a while() if there is reason to expect a user to cascade moves
     // with SCRIPTs without the tick delay
     if (ss->turtle.stepped && ss->turtle.script_number != TEMP_SCRIPT) {
@@ -312,72 +849,61 @@ void tele_tick(scene_state_t *ss, uint8_t time) {
         run_script(ss, turtle_get_script(&ss->turtle));
     }
 
-    // process delays
-    for (int16_t i = 0; i < DELAY_SIZE; i++) {
-        if (ss->delay.time[i]) {
-            ss->delay.time[i] -= time;
-            if (ss->delay.time[i] <= 0) {
+    tele_run_deadlines(ss);
+}
+
+// run the delays and end the TR pulses that are due at tele_get_ticks(), the
+// target should call this as soon as it can after tele_next_deadline
+void tele_run_deadlines(scene_state_t *ss) {
+    uint32_t now = tele_get_ticks();
+
+    // process delays, only the ones that are due are visited (earliest
+    // first), delays added while running them are due no sooner than now + 1
+    int8_t i;
+    while ((i = ss_delay_pop_due(ss, now)) >= 0) {
 #ifdef TELETYPE_PROFILE
-                tele_profile_delay(i);
+        profile_ticks_t profile_start = profiler_now();
 #endif
-                // Workaround for issue #80. (0 is the signifier for "empty")
-                // Setting delay.time[i] to 1 prevents delayed delay commands
-                //     from seeing a perfectly-timed delay slot as empty
-                //     while it's still being processed.
-                ss->delay.time[i] = 1;
-
-                // Instead of just running the command, we use the TEMP script
-                // to execute it.  This is required for THIS to be tracked, as
-                // it needs to have a script number.
-                // TODO: dynamically allocate scripts to prevent waste
-                ss_clear_script(ss, TEMP_SCRIPT);
-                ss_overwrite_script_command(ss, TEMP_SCRIPT, 0,
-                                            &ss->delay.commands[i]);
-
-                // We always need to execute from within an execution context
-                // TODO: ensure all code does so!
-                // New execution context setup needs to es_push, but it's
-                // decoupled to allow SCRIPT to work
-                exec_state_t es;
-                es_init(&es);
-                es_push(&es);
-
-                // The delay flag is required to protect the script number
-                // TODO: investigate delayed nested SCRIPTs
-                es_variables(&es)->delayed = true;
-                es_variables(&es)->script_number = ss->delay.origin_script[i];
-                es_variables(&es)->i = ss->delay.origin_i[i];
-
-                run_script_with_exec_state(ss, &es, TEMP_SCRIPT);
-
-                ss->delay.time[i] = 0;
-                ss->delay.count--;
-                if (ss->delay.count == 0) tele_has_delays(false);
+        // the slot is freed before the command runs, as the command may
+        // clear or reset the delays (DEL.CLR, INIT)
+        const uint8_t origin_script = ss->delay.origin_script[i];
+        const int16_t origin_i = ss->delay.origin_i[i];
+        tele_command_t delayed;
+        const tele_command_view_t command = ss_delay_command(ss, i, &delayed);
+        ss_delay_release(ss, i);
+        if (ss_delay_count(ss) == 0) tele_has_delays(false);
+
+        run_delayed_command(ss, origin_script, origin_i, &command);
 #ifdef TELETYPE_PROFILE
-                tele_profile_delay(i);
+        profiler_delay(origin_script, profile_start);
 #endif
-            }
-        }
     }
 
     // process tr pulses
     for (int16_t i = 0; i < TR_COUNT; i++) {
-        if (ss->tr_pulse_timer[i]) {
-            // prevent tr_pulse_timer from being greater than tr_time
-            int16_t tr_time = ss->variables.tr_time[i];
-            if (tr_time < 0) tr_time = 0;
-            if (ss->tr_pulse_timer[i] > tr_time)
-                ss->tr_pulse_timer[i] = tr_time;
-
-            ss->tr_pulse_timer[i] -= time;
-
-            if (ss->tr_pulse_timer[i] <= 0) {
-                ss->tr_pulse_timer[i] = 0;
-                ss->variables.tr[i] = ss->variables.tr_pol[i] == 0;
-                tele_tr(i, ss->variables.tr[i]);
-            }
+        if (ss->tr_pulse_active[i] &&
+            (int32_t)(ss->tr_pulse_deadline[i] - now) <= 0) {
+            ss->tr_pulse_active[i] = false;
+            ss->variables.tr[i] = ss->variables.tr_pol[i] == 0;
+            tele_tr(i, ss->variables.tr[i]);
+        }
+    }
+}
+
+// the earliest tele_get_ticks() at which tele_run_deadlines has something to
+// do, returns false if there are no delays or TR pulses pending
+bool tele_next_deadline(scene_state_t *ss, uint32_t *deadline) {
+    bool found = ss_delay_next_deadline(ss, deadline);
+
+    for (int16_t i = 0; i < TR_COUNT; i++) {
+        if (ss->tr_pulse_active[i] &&
+            (!found || (int32_t)(ss->tr_pulse_deadline[i] - *deadline) < 0)) {
+            *deadline = ss->tr_pulse_deadline[i];
+            found = true;
         }
     }
+
+    return found;
 }
 
 /////////////////////////////////////////////////////////////////
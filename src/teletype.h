@@ -6,10 +6,14 @@
 #include <stdint.h>
 
 #include "command.h"
+#include "profiler.h"
 #include "state.h"
 
 #define TELE_ERROR_MSG_LENGTH 16
 // #define TELETYPE_PROFILE // un-comment this line to enable profiling
+// un-comment this line to run commands with computed goto dispatch (GCC only),
+// the simulator and firmware builds define it
+// #define TELETYPE_THREADED
 
 typedef enum {
     E_OK,
@@ -32,19 +36,85 @@ typedef struct {
     int16_t value;
 } process_result_t;
 
+// An L between runs of its POST (see mod_L_start), the counter, its last
+// value and which way it goes
+typedef struct {
+    int32_t l;
+    int16_t end;
+    bool forward;
+} loop_state_t;
+
+// A run of a script that can stop after a number of words and carry on from
+// the same place later (see run_script_slice), so that a long W or L doesn't
+// hold up triggers, the metro and the screen. There's a frame for the script
+// and for each SCRIPT it calls, with how far it has got through its line, the
+// rest of the state is in the exec_state_t. A run only stops between subs,
+// when there's nothing on the command_state_t stack to keep.
+typedef struct {
+    uint8_t script_no;
+    uint8_t line;
+    uint8_t step;  // how far through the line, see teletype.c
+    uint8_t sub;   // the next sub of the PRE or POST
+    uint8_t mod;   // the tele_mod_idx_t whose POST is running
+    // L: the exec_vars_t whose I is the loop's, and the loop
+    uint8_t i_depth;
+    loop_state_t loop;
+} run_frame_t;
+
+typedef struct {
+    exec_state_t es;
+    run_frame_t frames[EXEC_DEPTH];
+    uint8_t depth;  // 0 when it isn't running
+#ifdef TELETYPE_PROFILE
+    // the time of its slices so far, profiled as one run when it finishes
+    profile_ticks_t profile_elapsed;
+#endif
+} script_run_t;
+
+// a run for each script that can be started by tele_run_script
+typedef struct {
+    script_run_t runs[INIT_SCRIPT + 1];
+    int8_t slicing;  // the run whose slice is running, or -1
+} script_runs_t;
 
 error_t parse(const char *cmd, tele_command_t *out,
               char error_msg[TELE_ERROR_MSG_LENGTH]);
 error_t validate(const tele_command_t *c,
                  char error_msg[TELE_ERROR_MSG_LENGTH]);
+// parse, validate and compile a command in one go, compiled is only complete
+// when E_OK is returned and may be NULL
+error_t parse_and_compile(const char *cmd, tele_command_t *out,
+                          compiled_command_t *compiled,
+                          char error_msg[TELE_ERROR_MSG_LENGTH]);
 process_result_t run_script(scene_state_t *ss, size_t script_no);
 process_result_t run_script_with_exec_state(scene_state_t *ss, exec_state_t *es,
                                             size_t script_no);
 process_result_t run_command(scene_state_t *ss, const tele_command_t *cmd);
+void run_script_start(script_run_t *run, size_t script_no);
+// runs until about words words have been run, or to the end if words is 0,
+// returns true if the script has finished
+bool run_script_slice(scene_state_t *ss, script_run_t *run, uint16_t words);
 process_result_t process_command(scene_state_t *ss, exec_state_t *es,
-                                 const tele_command_t *c);
+                                 const tele_command_view_t *v);
+void compile_command(const tele_command_t *c, compiled_command_t *out);
+
+void script_runs_init(script_runs_t *runs);
+// stops every run but the one whose slice is running, for a SCENE, so that
+// none of the old scene's runs carry on in the new one
+void script_runs_init_others(script_runs_t *runs);
+// runs a script as the scene's SCRIPT.SLICE says, either to the end or for a
+// slice, tele_run_slices then runs the rest a slice at a time, returns false
+// and runs nothing if the script's last run hasn't finished
+bool tele_run_script(scene_state_t *ss, script_runs_t *runs, size_t script_no);
+// a bit for each trigger input whose script hasn't finished, for trigger_pop
+uint8_t tele_running_inputs(const script_runs_t *runs);
+// runs a slice of each script that hasn't finished, the target should call
+// this on each turn of its event loop, returns false if there weren't any
+bool tele_run_slices(scene_state_t *ss, script_runs_t *runs);
 
-void tele_tick(scene_state_t *ss, uint8_t);
+void tele_tick(scene_state_t *ss);
+void tele_run_deadlines(scene_state_t *ss);
+bool tele_next_deadline(scene_state_t *ss, uint32_t *deadline);
 
 void clear_delays(scene_state_t *ss);
 
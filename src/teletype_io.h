@@ -50,10 +50,8 @@ extern bool tele_get_input_state(uint8_t);
 
 void tele_save_calibration(void);
 
-#ifdef TELETYPE_PROFILE
-void tele_profile_script(size_t);
-void tele_profile_delay(uint8_t);
-#endif
+// print a line of profiler output, used by PROF.DUMP
+void tele_profile_print(const char *line);
 
 // emulate grid key press
 extern void grid_key_press(uint8_t x, uint8_t y, uint8_t z);
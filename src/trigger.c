@@ -0,0 +1,101 @@
+#include "trigger.h"
+
+static void count(int16_t *counter) {
+    if (*counter < INT16_MAX) (*counter)++;
+}
+
+// the i-th oldest queued edge of an input
+static trigger_edge_t *edge(trigger_input_t *in, uint8_t i) {
+    return &in->edges[(in->head + i) % TRIGGER_QUEUE_MAX];
+}
+
+static void remove_oldest(trigger_input_t *in) {
+    in->head = (in->head + 1) % TRIGGER_QUEUE_MAX;
+    in->count--;
+}
+
+void trigger_init(trigger_queue_t *q) {
+    for (uint8_t i = 0; i < TRIGGER_INPUTS; i++) {
+        trigger_input_t *in = &q->inputs[i];
+        in->head = 0;
+        in->count = 0;
+        in->depth = TRIGGER_QUEUE_DEFAULT;
+        in->policy = TRIGGER_DROP_NEWEST;
+        in->dropped = 0;
+        in->overruns = 0;
+    }
+    q->next_seq = 0;
+}
+
+void trigger_clear(trigger_queue_t *q) {
+    for (uint8_t i = 0; i < TRIGGER_INPUTS; i++) q->inputs[i].count = 0;
+}
+
+bool trigger_push(trigger_queue_t *q, uint8_t input, bool state) {
+    if (input >= TRIGGER_INPUTS) return false;
+    trigger_input_t *in = &q->inputs[input];
+
+    if (in->policy == TRIGGER_COALESCE) {
+        for (uint8_t i = 0; i < in->count; i++) {
+            if (edge(in, i)->state == state) return true;
+        }
+    }
+
+    bool kept = true;
+    if (in->count >= in->depth) {
+        count(&in->overruns);
+        count(&in->dropped);
+        if (in->policy != TRIGGER_DROP_OLDEST) return false;
+        remove_oldest(in);
+        kept = false;
+    }
+
+    trigger_edge_t *e = edge(in, in->count++);
+    e->seq = q->next_seq++;
+    e->state = state;
+    return kept;
+}
+
+int8_t trigger_pop(trigger_queue_t *q, uint8_t busy, bool *state) {
+    int8_t oldest = -1;
+    uint16_t seq = 0;
+    for (uint8_t i = 0; i < TRIGGER_INPUTS; i++) {
+        const trigger_input_t *in = &q->inputs[i];
+        if (in->count == 0 || busy & (1 << i)) continue;
+        // seq wraps, so compare the difference
+        const uint16_t s = in->edges[in->head].seq;
+        if (oldest < 0 || (int16_t)(s - seq) < 0) {
+            oldest = i;
+            seq = s;
+        }
+    }
+    if (oldest < 0) return -1;
+
+    trigger_input_t *in = &q->inputs[oldest];
+    *state = in->edges[in->head].state;
+    remove_oldest(in);
+    return oldest;
+}
+
+uint8_t trigger_count(const trigger_queue_t *q, uint8_t input) {
+    if (input >= TRIGGER_INPUTS) return 0;
+    return q->inputs[input].count;
+}
+
+void trigger_set_depth(trigger_queue_t *q, uint8_t input, int16_t depth) {
+    if (input >= TRIGGER_INPUTS) return;
+    trigger_input_t *in = &q->inputs[input];
+    if (depth < 1) depth = 1;
+    if (depth > TRIGGER_QUEUE_MAX) depth = TRIGGER_QUEUE_MAX;
+    in->depth = depth;
+    while (in->count > in->depth) {
+        remove_oldest(in);
+        count(&in->dropped);
+    }
+}
+
+void trigger_set_policy(trigger_queue_t *q, uint8_t input,
+                        trigger_policy_t policy) {
+    if (input >= TRIGGER_INPUTS || policy >= TRIGGER_POLICY_COUNT) return;
+    q->inputs[input].policy = policy;
+}
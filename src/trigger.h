@@ -0,0 +1,69 @@
+#ifndef _TRIGGER_H_
+#define _TRIGGER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The edges on the trigger inputs whose scripts haven't run yet. The target
+// pushes each edge that should run a script as it arrives, and pops them one
+// at a time when it's ready to run a script, oldest first across all inputs.
+// An input whose script is still running a slice at a time (see
+// SCRIPT.SLICE) keeps its edges until the run has finished.
+//
+// - each input queues up to its depth of edges, 1 to TRIGGER_QUEUE_MAX
+// - an edge that arrives when its input is full is an overrun, and the input's
+//   policy picks the edge that's dropped, TRIGGER_DROP_NEWEST drops the edge
+//   that arrived, TRIGGER_DROP_OLDEST the oldest queued edge
+// - with TRIGGER_COALESCE an edge is merged in to a queued edge of the same
+//   input and direction, full or not, so that a burst runs the script once,
+//   if there isn't one to merge with when it's full the edge is dropped
+// - each input counts its dropped edges and overruns until the counts are set
+//   back to 0, a merged edge isn't dropped, as its script still runs
+
+#define TRIGGER_INPUTS 8
+#define TRIGGER_QUEUE_MAX 8
+#define TRIGGER_QUEUE_DEFAULT 4
+
+typedef enum {
+    TRIGGER_DROP_NEWEST,
+    TRIGGER_DROP_OLDEST,
+    TRIGGER_COALESCE,
+    TRIGGER_POLICY_COUNT
+} trigger_policy_t;
+
+typedef struct {
+    uint16_t seq;  // the order edges arrived in, across all inputs
+    bool state;
+} trigger_edge_t;
+
+typedef struct {
+    trigger_edge_t edges[TRIGGER_QUEUE_MAX];
+    uint8_t head;
+    uint8_t count;
+    uint8_t depth;
+    uint8_t policy;  // a trigger_policy_t
+    int16_t dropped;
+    int16_t overruns;
+} trigger_input_t;
+
+typedef struct {
+    trigger_input_t inputs[TRIGGER_INPUTS];
+    uint16_t next_seq;
+} trigger_queue_t;
+
+void trigger_init(trigger_queue_t *q);
+// removes every queued edge, leaving the depths, policies and counts
+void trigger_clear(trigger_queue_t *q);
+// returns false if an edge was dropped
+bool trigger_push(trigger_queue_t *q, uint8_t input, bool state);
+// removes the oldest edge of the inputs that don't have their bit set in busy,
+// returns its input, or -1 if there aren't any
+int8_t trigger_pop(trigger_queue_t *q, uint8_t busy, bool *state);
+uint8_t trigger_count(const trigger_queue_t *q, uint8_t input);
+// depth is limited to 1 to TRIGGER_QUEUE_MAX, edges that no longer fit are
+// dropped, oldest first
+void trigger_set_depth(trigger_queue_t *q, uint8_t input, int16_t depth);
+void trigger_set_policy(trigger_queue_t *q, uint8_t input,
+                        trigger_policy_t policy);
+
+#endif
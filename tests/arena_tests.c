@@ -0,0 +1,104 @@
+#include "arena_tests.h"
+
+#include "greatest/greatest.h"
+
+#include "arena.h"
+#include "ops/op_enum.h"
+#include "teletype.h"
+
+static void make_command(tele_command_t *cmd, uint8_t length) {
+    cmd->length = length;
+    cmd->separator = -1;
+    cmd->comment = false;
+    for (uint8_t i = 0; i < length; i++)
+        td_set(&cmd->data[i], NUMBER, 1000 + i);
+}
+
+TEST arena_should_round_trip() {
+    static command_arena_t a;
+    arena_init(&a);
+
+    for (uint8_t length = 0; length < COMMAND_MAX_LENGTH; length++) {
+        tele_command_t cmd, out;
+        make_command(&cmd, length);
+        const tele_command_view_t view = command_view(&cmd);
+
+        arena_command_t stored;
+        ASSERT(arena_store(&a, &stored, &view));
+        ASSERT_EQ(arena_free_blocks(&a),
+                  ARENA_BLOCKS - (length + ARENA_BLOCK_WORDS - 1) /
+                                     ARENA_BLOCK_WORDS);
+
+        arena_load(&a, &stored, &out);
+        ASSERT_EQ(out.length, length);
+        ASSERT_EQ(out.separator, -1);
+        for (uint8_t i = 0; i < length; i++)
+            ASSERT_EQ(td_value(&out.data[i]), 1000 + i);
+
+        arena_release(&a, &stored);
+        ASSERT_EQ(arena_free_blocks(&a), ARENA_BLOCKS);
+    }
+    PASS();
+}
+
+// the POST command of a view is stored without the MOD or PRE separator
+TEST arena_should_store_views() {
+    static command_arena_t a;
+    arena_init(&a);
+
+    tele_command_t cmd, out;
+    char error_msg[TELE_ERROR_MSG_LENGTH];
+    ASSERT_EQ(parse("DEL 10: X ADD X 1", &cmd, error_msg), E_OK);
+    const tele_command_view_t post = {
+        .base = &cmd, .compiled = NULL, .offset = 3, .length = 4
+    };
+
+    arena_command_t stored;
+    ASSERT(arena_store(&a, &stored, &post));
+    arena_load(&a, &stored, &out);
+    ASSERT_EQ(out.length, 4);
+    ASSERT_EQ(out.separator, -1);
+    ASSERT_EQ(td_value(&out.data[0]), E_OP_X);
+    ASSERT_EQ(td_value(&out.data[3]), 1);
+    PASS();
+}
+
+// a command that doesn't fit isn't stored at all, and freed blocks can be
+// used again in any order
+TEST arena_should_overflow_cleanly() {
+    static command_arena_t a;
+    static arena_command_t stored[ARENA_BLOCKS];
+    arena_init(&a);
+
+    tele_command_t cmd;
+    make_command(&cmd, COMMAND_MAX_LENGTH - 1);
+    const tele_command_view_t view = command_view(&cmd);
+    const uint8_t per_command =
+        (COMMAND_MAX_LENGTH - 1 + ARENA_BLOCK_WORDS - 1) / ARENA_BLOCK_WORDS;
+
+    uint8_t n = 0;
+    while (arena_store(&a, &stored[n], &view)) n++;
+    ASSERT_EQ(n, ARENA_BLOCKS / per_command);
+    ASSERT_EQ(arena_free_blocks(&a), ARENA_BLOCKS % per_command);
+
+    // every other one
+    for (uint8_t i = 0; i < n; i += 2) arena_release(&a, &stored[i]);
+    for (uint8_t i = 0; i < n; i += 2)
+        ASSERT(arena_store(&a, &stored[i], &view));
+    ASSERT_FALSE(arena_store(&a, &stored[n], &view));
+
+    tele_command_t out;
+    for (uint8_t i = 0; i < n; i++) {
+        arena_load(&a, &stored[i], &out);
+        ASSERT_EQ(out.length, COMMAND_MAX_LENGTH - 1);
+        ASSERT_EQ(td_value(&out.data[COMMAND_MAX_LENGTH - 2]),
+                  1000 + COMMAND_MAX_LENGTH - 2);
+    }
+    PASS();
+}
+
+SUITE(arena_suite) {
+    RUN_TEST(arena_should_round_trip);
+    RUN_TEST(arena_should_store_views);
+    RUN_TEST(arena_should_overflow_cleanly);
+}
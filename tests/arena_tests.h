@@ -0,0 +1,8 @@
+#ifndef _ARENA_TESTS_H_
+#define _ARENA_TESTS_H_
+
+#include "greatest/greatest.h"
+
+SUITE_EXTERN(arena_suite);
+
+#endif
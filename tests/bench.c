@@ -0,0 +1,238 @@
+// Benchmarks for every OP and MOD, for looking up their names, and for parse,
+// validate, parse_and_compile and process_command on some typical commands.
+//
+// Output is one tab separated line per case, "kind name ns/op", so that runs
+// from different commits can be compared with diff, join or a spreadsheet:
+//
+//     make bench > before.tsv
+//
+// Every OP is run with 1 for each of its params (1 is a valid index, time and
+// divisor for all of them), and as a set if it has one. MODs get "X 1" as
+// their POST command. I2C ops only measure the cost on the teletype side, as
+// tele_ii_tx and tele_ii_rx do nothing here. The scene state isn't reset
+// between runs of the same case, so ops that fill something up (DEL, S, Q) are
+// mostly measured full.
+
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "helpers.h"
+#include "match_token.h"
+#include "ops/op.h"
+#include "teletype.h"
+
+// each case is repeated until it has run for at least this long, and the
+// fastest of BENCH_SAMPLES such runs is reported, to leave out the runs where
+// the host was busy with something else
+#define BENCH_MIN_NS 1000000
+#define BENCH_SAMPLES 5
+
+typedef void (*bench_fn_t)(void *arg);
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static uint64_t bench_run(bench_fn_t fn, void *arg, uint64_t n) {
+    uint64_t start = now_ns();
+    for (uint64_t i = 0; i < n; i++) fn(arg);
+    return now_ns() - start;
+}
+
+// returns the time of a call to fn in ns
+static double bench(bench_fn_t fn, void *arg) {
+    uint64_t n = 1;
+    while (bench_run(fn, arg, n) < BENCH_MIN_NS) n *= 2;
+
+    uint64_t best = UINT64_MAX;
+    for (int i = 0; i < BENCH_SAMPLES; i++) {
+        uint64_t elapsed = bench_run(fn, arg, n);
+        if (elapsed < best) best = elapsed;
+    }
+    return (double)best / n;
+}
+
+static void report(const char *kind, const char *name, double ns) {
+    printf("%s\t%s\t%.1f\n", kind, name, ns);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// OPs and MODs
+
+typedef struct {
+    scene_state_t ss;
+    exec_state_t es;
+    tele_command_t cmd;
+    compiled_command_t compiled;
+    tele_command_view_t view;
+} process_case_t;
+
+static process_case_t pc;
+
+static void process_case_init(process_case_t *c) {
+    ss_init(&c->ss);
+    c->ss.initializing = false;
+    es_init(&c->es);
+    es_push(&c->es);
+    es_variables(&c->es)->script_number = 0;
+    compile_command(&c->cmd, &c->compiled);
+    c->view = command_view(&c->cmd);
+    c->view.compiled = &c->compiled;
+}
+
+static void push_word(tele_command_t *cmd, tele_word_t tag, int16_t value) {
+    td_set(&cmd->data[cmd->length], tag, value);
+    cmd->length++;
+}
+
+static void run_process(void *arg) {
+    process_case_t *c = arg;
+    process_command(&c->ss, &c->es, &c->view);
+}
+
+static void bench_op(size_t idx, bool set) {
+    const tele_op_t *op = tele_ops[idx];
+
+    pc.cmd.length = 0;
+    pc.cmd.separator = -1;
+    pc.cmd.comment = false;
+    push_word(&pc.cmd, OP, idx);
+    for (uint8_t i = 0; i < op->params + set; i++)
+        push_word(&pc.cmd, NUMBER, 1);
+    process_case_init(&pc);
+
+    report(set ? "set" : "get", op->name, bench(run_process, &pc));
+}
+
+static void bench_mod(size_t idx) {
+    const tele_mod_t *mod = tele_mods[idx];
+
+    pc.cmd.length = 0;
+    pc.cmd.comment = false;
+    push_word(&pc.cmd, MOD, idx);
+    for (uint8_t i = 0; i < mod->params; i++) push_word(&pc.cmd, NUMBER, 1);
+    pc.cmd.separator = pc.cmd.length;
+    push_word(&pc.cmd, PRE_SEP, 0);
+    push_word(&pc.cmd, OP, E_OP_X);
+    push_word(&pc.cmd, NUMBER, 1);
+    process_case_init(&pc);
+
+    report("mod", mod->name, bench(run_process, &pc));
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// match_token
+
+// the time per name, over every OP and MOD name and some numbers
+static const char *numbers[] = { "1", "-1", "100", "16384", "XFF", "B101",
+                                 "R0011" };
+
+static void run_match_names(void *NOTUSED(arg)) {
+    tele_data_t data;
+    for (size_t i = 0; i < E_OP__LENGTH; i++)
+        match_token(tele_ops[i]->name, strlen(tele_ops[i]->name), &data);
+    for (size_t i = 0; i < E_MOD__LENGTH; i++)
+        match_token(tele_mods[i]->name, strlen(tele_mods[i]->name), &data);
+}
+
+static void run_match_numbers(void *NOTUSED(arg)) {
+    tele_data_t data;
+    for (size_t i = 0; i < sizeof(numbers) / sizeof(numbers[0]); i++)
+        match_token(numbers[i], strlen(numbers[i]), &data);
+}
+
+static void bench_match_token(void) {
+    report("match", "OP and MOD names",
+           bench(run_match_names, NULL) / (E_OP__LENGTH + E_MOD__LENGTH));
+    report("match", "numbers", bench(run_match_numbers, NULL) /
+                                   (sizeof(numbers) / sizeof(numbers[0])));
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// parse, validate and process
+
+static const char *commands[] = {
+    "X 1",
+    "CV 1 N 60",
+    "CV 1 N ADD 48 12",
+    "TR.P 2",
+    "X ADD X 1",
+    "CV 1 N P.NEXT",
+    "P.N WRAP ADD P.N 1 0 3",
+    "A WRAP ADD A 1 0 7",
+    "IF GT X 3: X 0; Y ADD Y 1",
+    "L 1 4: TR.P I",
+    "DEL.X 4 50: TR.P 1",
+    "CV 2 ADD N P.HERE V 1",
+    "X RRAND 1 7; Y ADD Y X; Z MUL X Y",
+    "Z ADD MUL X 3 SUB Y DIV Z ADD T 2",
+};
+
+typedef struct {
+    const char *text;
+    tele_command_t cmd;
+    compiled_command_t compiled;
+    char error_msg[TELE_ERROR_MSG_LENGTH];
+} parse_case_t;
+
+static void run_parse(void *arg) {
+    parse_case_t *c = arg;
+    parse(c->text, &c->cmd, c->error_msg);
+}
+
+static void run_validate(void *arg) {
+    parse_case_t *c = arg;
+    validate(&c->cmd, c->error_msg);
+}
+
+static void run_parse_and_compile(void *arg) {
+    parse_case_t *c = arg;
+    parse_and_compile(c->text, &c->cmd, &c->compiled, c->error_msg);
+}
+
+static void bench_command(const char *text) {
+    parse_case_t c = {.text = text };
+
+    report("parse", text, bench(run_parse, &c));
+
+    if (parse(text, &pc.cmd, c.error_msg) != E_OK ||
+        validate(&pc.cmd, c.error_msg) != E_OK) {
+        fprintf(stderr, "can't benchmark \"%s\": %s\n", text, c.error_msg);
+        return;
+    }
+    c.cmd = pc.cmd;
+    report("validate", text, bench(run_validate, &c));
+    report("parse_and_compile", text, bench(run_parse_and_compile, &c));
+
+    pc.cmd.comment = false;
+    process_case_init(&pc);
+    report("process", text, bench(run_process, &pc));
+}
+
+
+int main(int argc, char **argv) {
+    printf("# kind\tname\tns/op\n");
+
+    for (size_t i = 0; i < E_OP__LENGTH; i++) {
+        if (tele_ops[i]->get) bench_op(i, false);
+        if (tele_ops[i]->set) bench_op(i, true);
+    }
+
+    for (size_t i = 0; i < E_MOD__LENGTH; i++) bench_mod(i);
+
+    bench_match_token();
+
+    for (size_t i = 0; i < sizeof(commands) / sizeof(commands[0]); i++)
+        bench_command(commands[i]);
+
+    return 0;
+}
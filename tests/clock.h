@@ -0,0 +1,15 @@
+#ifndef _CLOCK_H_
+#define _CLOCK_H_
+
+#include <stdint.h>
+
+#include "state.h"
+
+// the tests run against a virtual clock, this is what tele_get_ticks returns
+extern uint32_t test_ticks;
+
+// advance the virtual clock by ms, running the deadlines on every ms like the
+// hardware does
+void test_advance_ticks(scene_state_t *ss, uint32_t ms);
+
+#endif
@@ -0,0 +1,88 @@
+#include "cost_tests.h"
+
+#include "greatest/greatest.h"
+
+#include "cost.h"
+#include "script_helper.h"
+#include "teletype.h"
+
+TEST cost_helper(char *line, uint32_t cost, bool unknown_loops) {
+    scene_state_t ss;
+    ss_init(&ss);
+    char *lines[1] = { line };
+    CHECK_CALL(load_script(&ss, TT_SCRIPT_1, 1, lines));
+
+    cost_t c = script_cost(&ss, TT_SCRIPT_1, NULL);
+    ASSERT_EQm(line, c.cost, cost);
+    ASSERT_EQm(line, c.unknown_loops, unknown_loops);
+    PASS();
+}
+
+TEST test_cost_commands() {
+    CHECK_CALL(cost_helper("X 1", 1, false));
+    CHECK_CALL(cost_helper("X ADD X 1", 3, false));
+    CHECK_CALL(cost_helper("X 1; Y 2; Z 3", 3, false));
+    CHECK_CALL(cost_helper("IF GT X 3: X 0", 4, false));
+    CHECK_CALL(cost_helper("L 1 4: TR.P I", 9, false));
+    CHECK_CALL(cost_helper("L 4 1: TR.P I", 9, false));
+    CHECK_CALL(cost_helper("L 1 X: TR.P 1", 3, true));
+    CHECK_CALL(cost_helper("W LT X 10: X ADD X 1", 6 * WHILE_DEPTH, false));
+    CHECK_CALL(cost_helper("P.MAP: ADD I 1", 1 + 2 * PATTERN_LENGTH, false));
+    CHECK_CALL(cost_helper("DEL 10: TR.P 1", 1, false));
+    CHECK_CALL(cost_helper("L -32768 32767: X 1", 1 + 65536, false));
+    PASS();
+}
+
+TEST test_cost_scripts() {
+    scene_state_t ss;
+    ss_init(&ss);
+
+    char *script1[2] = { "L 1 64: SCRIPT 2", "X 1" };
+    char *script2[2] = { "L 1 64: X ADD X 1", "Y 1" };
+    CHECK_CALL(load_script(&ss, TT_SCRIPT_1, 2, script1));
+    CHECK_CALL(load_script(&ss, TT_SCRIPT_2, 2, script2));
+
+    ASSERT_EQ(script_cost(&ss, TT_SCRIPT_2, NULL).cost, 1 + 64 * 3 + 1);
+    ASSERT_EQ(script_cost(&ss, TT_SCRIPT_1, NULL).cost,
+              1 + 64 * (1 + 194) + 1);
+
+    // commented lines don't run
+    ss_set_script_comment(&ss, TT_SCRIPT_2, 0, true);
+    ASSERT_EQ(script_cost(&ss, TT_SCRIPT_1, NULL).cost, 1 + 64 * (1 + 1) + 1);
+
+    // a SCRIPT that could be any script counts as the worst of them
+    ss_set_script_comment(&ss, TT_SCRIPT_2, 0, false);
+    char *script3[1] = { "$ ADD X 1" };
+    CHECK_CALL(load_script(&ss, TT_SCRIPT_3, 1, script3));
+    cost_t c = script_cost(&ss, TT_SCRIPT_3, NULL);
+    ASSERT(c.cost >= 3 + script_cost(&ss, TT_SCRIPT_1, NULL).cost);
+
+    // calls stop where the exec stack would overflow
+    char *script4[1] = { "SCRIPT 4" };
+    CHECK_CALL(load_script(&ss, TT_SCRIPT_4, 1, script4));
+    ASSERT_EQ(script_cost(&ss, TT_SCRIPT_4, NULL).cost, EXEC_DEPTH);
+
+    PASS();
+}
+
+TEST test_cost_table() {
+    scene_state_t ss;
+    ss_init(&ss);
+    static cost_table_t table;
+    for (size_t i = 0; i < E_OP__LENGTH; i++) table.op[i] = 2;
+    for (size_t i = 0; i < E_MOD__LENGTH; i++) table.mod[i] = 10;
+    table.op[E_OP_TR_PULSE] = 100;
+    table.op[E_OP_TR_P] = 100;
+
+    char *script1[1] = { "L 1 4: TR.P I" };
+    CHECK_CALL(load_script(&ss, TT_SCRIPT_1, 1, script1));
+    ASSERT_EQ(script_cost(&ss, TT_SCRIPT_1, &table).cost, 10 + 4 * 102);
+
+    PASS();
+}
+
+SUITE(cost_suite) {
+    RUN_TEST(test_cost_commands);
+    RUN_TEST(test_cost_scripts);
+    RUN_TEST(test_cost_table);
+}
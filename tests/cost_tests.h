@@ -0,0 +1,8 @@
+#ifndef _COST_TESTS_H_
+#define _COST_TESTS_H_
+
+#include "greatest/greatest.h"
+
+SUITE_EXTERN(cost_suite);
+
+#endif
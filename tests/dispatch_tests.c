@@ -0,0 +1,147 @@
+#include "dispatch_tests.h"
+
+#include "greatest/greatest.h"
+
+#include "dispatch.h"
+
+// libavr32
+#include "events.h"
+
+// the keyboard coming and going is UI, like its keys, not device IO
+TEST dispatch_should_classify_events() {
+    const uint8_t timing[3] = { kEventTrigger, kEventTimer, kEventAppCustom };
+    const uint8_t ui[8] = { kEventFront,      kEventKeyTimer,
+                            kEventHidConnect, kEventHidDisconnect,
+                            kEventHidTimer,   kEventScreenRefresh,
+                            kEventMonomePoll, kEventMonomeRefresh };
+    const uint8_t io[12] = {
+        kEventPollADC,        kEventMscConnect,      kEventFtdiConnect,
+        kEventFtdiDisconnect, kEventSerialConnect,   kEventSerialDisconnect,
+        kEventMonomeConnect,  kEventMonomeDisconnect, kEventMonomeGridKey,
+        kEventMidiConnect,    kEventMidiDisconnect,  kEventMidiPacket
+    };
+
+    for (uint8_t i = 0; i < 3; i++)
+        ASSERT_EQ(dispatch_priority(timing[i]), DISPATCH_TIMING);
+    for (uint8_t i = 0; i < 8; i++)
+        ASSERT_EQ(dispatch_priority(ui[i]), DISPATCH_UI);
+    for (uint8_t i = 0; i < 12; i++)
+        ASSERT_EQ(dispatch_priority(io[i]), DISPATCH_IO);
+    PASS();
+}
+
+TEST dispatch_should_order_by_priority() {
+    dispatch_t d;
+    dispatch_init(&d);
+    uint8_t type;
+    int32_t data;
+
+    ASSERT_FALSE(dispatch_pop(&d, &type, &data));
+
+    ASSERT(dispatch_push(&d, DISPATCH_UI, 1, 10));
+    ASSERT(dispatch_push(&d, DISPATCH_IO, 2, 20));
+    ASSERT(dispatch_push(&d, DISPATCH_UI, 3, 30));
+    ASSERT(dispatch_push(&d, DISPATCH_TIMING, 4, 40));
+    ASSERT(dispatch_push(&d, DISPATCH_IO, 5, 50));
+    ASSERT(dispatch_push(&d, DISPATCH_TIMING, 6, 60));
+
+    // by priority, and in the order they arrived within one
+    const uint8_t order[6] = { 4, 6, 2, 5, 1, 3 };
+    for (uint8_t i = 0; i < 6; i++) {
+        ASSERT(dispatch_pop(&d, &type, &data));
+        ASSERT_EQ(type, order[i]);
+        ASSERT_EQ(data, order[i] * 10);
+    }
+    ASSERT_FALSE(dispatch_pop(&d, &type, &data));
+    PASS();
+}
+
+TEST dispatch_should_fill_up() {
+    dispatch_t d;
+    dispatch_init(&d);
+    uint8_t type;
+    int32_t data;
+
+    for (uint8_t i = 0; i < DISPATCH_EVENTS; i++) {
+        ASSERT_FALSE(dispatch_full(&d));
+        ASSERT(dispatch_push(&d, i % DISPATCH_PRIORITIES, i, i));
+    }
+    ASSERT(dispatch_full(&d));
+    ASSERT_FALSE(dispatch_push(&d, DISPATCH_TIMING, 99, 99));
+
+    ASSERT(dispatch_pop(&d, &type, &data));
+    ASSERT_EQ(type, 0);
+    ASSERT_FALSE(dispatch_full(&d));
+    ASSERT(dispatch_push(&d, DISPATCH_TIMING, 99, 99));
+    ASSERT(dispatch_pop(&d, &type, &data));
+    ASSERT_EQ(type, 3);
+    PASS();
+}
+
+// a flood of timing events, refilled as fast as they're handled, lets the
+// others through once every DISPATCH_STARVE events
+TEST dispatch_should_not_starve() {
+    dispatch_t d;
+    dispatch_init(&d);
+    uint8_t type;
+    int32_t data;
+
+    ASSERT(dispatch_push(&d, DISPATCH_UI, DISPATCH_UI, 0));
+    ASSERT(dispatch_push(&d, DISPATCH_IO, DISPATCH_IO, 0));
+
+    uint16_t handled[DISPATCH_PRIORITIES] = { 0 };
+    uint16_t waited[DISPATCH_PRIORITIES] = { 0 };
+    uint16_t longest[DISPATCH_PRIORITIES] = { 0 };
+    for (uint16_t turn = 0; turn < 1000; turn++) {
+        while (!dispatch_full(&d))
+            dispatch_push(&d, DISPATCH_TIMING, DISPATCH_TIMING, 0);
+        ASSERT(dispatch_pop(&d, &type, &data));
+        ASSERT(type < DISPATCH_PRIORITIES);
+        handled[type]++;
+        for (uint8_t p = 0; p < DISPATCH_PRIORITIES; p++) waited[p]++;
+        waited[type] = 0;
+        // the UI and IO events come back once they've been handled
+        if (type != DISPATCH_TIMING) dispatch_push(&d, type, type, 0);
+        for (uint8_t p = 0; p < DISPATCH_PRIORITIES; p++)
+            if (waited[p] > longest[p]) longest[p] = waited[p];
+    }
+
+    ASSERT(longest[DISPATCH_IO] <= DISPATCH_STARVE + 1);
+    ASSERT(longest[DISPATCH_UI] <= DISPATCH_STARVE + 1);
+    ASSERT(handled[DISPATCH_UI] >= 1000 / (DISPATCH_STARVE + 2));
+    ASSERT(handled[DISPATCH_TIMING] > handled[DISPATCH_IO]);
+    ASSERT(handled[DISPATCH_TIMING] > handled[DISPATCH_UI]);
+    PASS();
+}
+
+// a timing event that arrives behind a backlog of UI events is next
+TEST dispatch_should_preempt() {
+    dispatch_t d;
+    dispatch_init(&d);
+    uint8_t type;
+    int32_t data;
+
+    for (uint8_t i = 0; i < DISPATCH_EVENTS - 1; i++)
+        ASSERT(dispatch_push(&d, DISPATCH_UI, DISPATCH_UI, i));
+    ASSERT(dispatch_pop(&d, &type, &data));
+    ASSERT_EQ(data, 0);
+
+    ASSERT(dispatch_push(&d, DISPATCH_TIMING, DISPATCH_TIMING, 0));
+    ASSERT(dispatch_pop(&d, &type, &data));
+    ASSERT_EQ(type, DISPATCH_TIMING);
+
+    for (uint8_t i = 1; i < DISPATCH_EVENTS - 1; i++) {
+        ASSERT(dispatch_pop(&d, &type, &data));
+        ASSERT_EQ(data, i);
+    }
+    ASSERT_FALSE(dispatch_pop(&d, &type, &data));
+    PASS();
+}
+
+SUITE(dispatch_suite) {
+    RUN_TEST(dispatch_should_classify_events);
+    RUN_TEST(dispatch_should_order_by_priority);
+    RUN_TEST(dispatch_should_fill_up);
+    RUN_TEST(dispatch_should_not_starve);
+    RUN_TEST(dispatch_should_preempt);
+}
@@ -0,0 +1,8 @@
+#ifndef _DISPATCH_TESTS_H_
+#define _DISPATCH_TESTS_H_
+
+#include "greatest/greatest.h"
+
+SUITE_EXTERN(dispatch_suite);
+
+#endif
@@ -0,0 +1,52 @@
+// teletype_io.h for the tests and benchmarks, outputs go nowhere and the
+// clock only moves when test_advance_ticks is called
+
+#include <stdint.h>
+
+#include "clock.h"
+#include "teletype.h"
+#include "teletype_io.h"
+
+uint32_t test_ticks = 0;
+
+uint32_t tele_get_ticks() {
+    return test_ticks;
+}
+
+void test_advance_ticks(scene_state_t *ss, uint32_t ms) {
+    for (uint32_t i = 0; i < ms; i++) {
+        test_ticks++;
+        tele_run_deadlines(ss);
+    }
+}
+
+void tele_metro_updated() {}
+void tele_metro_reset() {}
+void tele_tr(uint8_t i, int16_t v) {}
+void tele_cv(uint8_t i, int16_t v, uint8_t s) {}
+void tele_cv_slew(uint8_t i, int16_t v) {}
+void tele_update_adc(uint8_t force) {}
+void tele_has_delays(bool i) {}
+void tele_has_stack(bool i) {}
+void tele_cv_off(uint8_t i, int16_t v) {}
+void tele_ii_tx(uint8_t addr, uint8_t *data, uint8_t l) {}
+void tele_ii_rx(uint8_t addr, uint8_t *data, uint8_t l) {}
+void tele_scene(uint8_t i, uint8_t init_grid, uint8_t init_pattern) {}
+void tele_pattern_updated() {}
+void tele_kill() {}
+void tele_mute() {}
+void tele_vars_updated() {}
+bool tele_get_input_state(uint8_t n) {
+    return false;
+}
+void device_flip() {}
+void set_live_submode(uint8_t submode) {}
+void select_dash_screen(uint8_t screen) {}
+void print_dashboard_value(uint8_t index, int16_t value) {}
+int16_t get_dashboard_value(uint8_t index) {
+    return 0;
+}
+void reset_midi_counter() {}
+void tele_save_calibration() {}
+void tele_profile_print(const char *line) {}
+void grid_key_press(uint8_t x, uint8_t y, uint8_t z) {}
@@ -18,8 +18,8 @@ TEST match_token_should_return_op() {
         tele_data_t data;
         bool result = match_token(text, strlen(text), &data);
         ASSERT_EQm(text, result, true);
-        ASSERT_EQm(text, data.tag, OP);
-        ASSERT_EQm(text, data.value, (int16_t)i);
+        ASSERT_EQm(text, td_tag(&data), OP);
+        ASSERT_EQm(text, td_value(&data), (int16_t)i);
     }
     PASS();
 }
@@ -32,8 +32,87 @@ TEST match_token_should_return_mod() {
         tele_data_t data;
         bool result = match_token(text, strlen(text), &data);
         ASSERT_EQm(text, result, true);
-        ASSERT_EQm(text, data.tag, MOD);
-        ASSERT_EQm(text, data.value, (int16_t)i);
+        ASSERT_EQm(text, td_tag(&data), MOD);
+        ASSERT_EQm(text, td_value(&data), (int16_t)i);
+    }
+    PASS();
+}
+
+static bool match_helper(const char* text, tele_data_t* data) {
+    return match_token(text, strlen(text), data);
+}
+
+TEST match_token_should_return_number() {
+    const struct {
+        const char* text;
+        tele_word_t tag;
+        int16_t value;
+    } numbers[] = {
+        { "0", NUMBER, 0 },
+        { "42", NUMBER, 42 },
+        { "-42", NUMBER, -42 },
+        { "32767", NUMBER, 32767 },
+        { "40000", NUMBER, 32767 },
+        { "-32768", NUMBER, -32768 },
+        { "-99999999999", NUMBER, -32768 },
+        { "010", NUMBER, 8 },  // a leading 0 is octal
+        { "09", NUMBER, 0 },   // which stops at the 9
+        { "XFF", XNUMBER, 255 },
+        { "XFFFF", XNUMBER, -1 },
+        { "X10000", XNUMBER, 0 },
+        { "B101", BNUMBER, 5 },
+        { "B1000000000000000", BNUMBER, -32768 },
+        { "R1", RNUMBER, 1 },
+        { "R0011", RNUMBER, 12 },
+    };
+
+    for (size_t i = 0; i < sizeof(numbers) / sizeof(numbers[0]); i++) {
+        tele_data_t data;
+        ASSERT_EQm(numbers[i].text, match_helper(numbers[i].text, &data), true);
+        ASSERT_EQm(numbers[i].text, td_tag(&data), numbers[i].tag);
+        ASSERT_EQm(numbers[i].text, td_value(&data), numbers[i].value);
+    }
+    PASS();
+}
+
+TEST match_token_should_fail() {
+    const char* tokens[] = { "",    "XG",  "X1G", "B2",   "R12",  "--1",
+                             "1-2", "Xff", "|01", "ADD1", "ADDD", "AD" };
+
+    for (size_t i = 0; i < sizeof(tokens) / sizeof(tokens[0]); i++) {
+        tele_data_t data;
+        ASSERT_EQm(tokens[i], match_helper(tokens[i], &data), false);
+    }
+    PASS();
+}
+
+// the token is only the first len chars, it doesn't need to end in a NUL
+TEST match_token_should_use_len() {
+    tele_data_t data;
+    ASSERT_EQ(match_token("ADD 1", 3, &data), true);
+    ASSERT_EQ(td_tag(&data), OP);
+    ASSERT_EQ(td_value(&data), E_OP_ADD);
+    ASSERT_EQ(match_token("12345", 2, &data), true);
+    ASSERT_EQ(td_tag(&data), NUMBER);
+    ASSERT_EQ(td_value(&data), 12);
+    ASSERT_EQ(match_token("X1", 1, &data), true);
+    ASSERT_EQ(td_tag(&data), OP);
+    ASSERT_EQ(td_value(&data), E_OP_X);
+    PASS();
+}
+
+// words are packed in to 3 bytes, and every value must survive that
+TEST words_should_be_packed() {
+    ASSERT_EQ(sizeof(tele_data_t), 3);
+    ASSERT_EQ(sizeof(tele_command_t),
+              3 + COMMAND_MAX_LENGTH * sizeof(tele_data_t));
+
+    const int16_t values[] = { 0, 1, -1, 255, 256, -256, INT16_MAX, INT16_MIN };
+    tele_data_t data;
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        td_set(&data, RNUMBER, values[i]);
+        ASSERT_EQ(td_tag(&data), RNUMBER);
+        ASSERT_EQ(td_value(&data), values[i]);
     }
     PASS();
 }
@@ -41,4 +120,8 @@ TEST match_token_should_return_mod() {
 SUITE(match_token_suite) {
     RUN_TEST(match_token_should_return_op);
     RUN_TEST(match_token_should_return_mod);
+    RUN_TEST(match_token_should_return_number);
+    RUN_TEST(match_token_should_fail);
+    RUN_TEST(match_token_should_use_len);
+    RUN_TEST(words_should_be_packed);
 }
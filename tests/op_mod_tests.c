@@ -29,6 +29,22 @@ TEST unique_mods() {
     PASS();
 }
 
+// Check the generated op tables match the ops, run 'utils/op_enums.py' if not
+TEST op_tables() {
+    for (size_t i = 0; i < E_OP__LENGTH; i++) {
+        const tele_op_t *op = tele_ops[i];
+        ASSERT_STR_EQ(op->name, tele_op_names[i]);
+        ASSERT_EQm(op->name, op_params(i), op->params);
+        ASSERT_EQm(op->name, op_returns(i), op->returns);
+        ASSERT_EQm(op->name, op_has_set(i), op->set != NULL);
+        ASSERT_EQm(op->name, op_purity(i), op->purity);
+        ASSERT_EQm(op->name, tele_op_data[i], op->data);
+        ASSERT_EQm(op->name, tele_op_get[i], op->get);
+        ASSERT_EQm(op->name, tele_op_set[i], op->set);
+    }
+    PASS();
+}
+
 // Check every op manipulates the stack correctly
 TEST op_stack_size() {
     for (size_t i = 0; i < E_OP__LENGTH; i++) {
@@ -99,6 +115,7 @@ TEST mod_stack_size() {
         exec_state_t es;
         es_init(&es);
         es_push(&es);
+        es_variables(&es)->script_number = 1;
         command_state_t cs;
         cs_init(&cs);
 
@@ -109,11 +126,10 @@ TEST mod_stack_size() {
         for (int j = 0; j < mod->params + stack_extra; j++) cs_push(&cs, 0);
 
         // execute func
-        const tele_command_t sub_command = {.length = 1,
-                                            .separator = 0,
-                                            .data = { {.tag = OP,
-                                                       .value = E_OP_A } } };
-        mod->func(&ss, &es, &cs, &sub_command);
+        tele_command_t sub_command = {.length = 1, .separator = 0 };
+        td_set(&sub_command.data[0], OP, E_OP_A);
+        const tele_command_view_t post_command = command_view(&sub_command);
+        mod->func(&ss, &es, &cs, &post_command);
 
         // check that the stack has the correct number of items in it
         ASSERT_EQm(mod->name, cs_stack_size(&cs), stack_extra);
@@ -124,6 +140,7 @@ TEST mod_stack_size() {
 SUITE(op_mod_suite) {
     RUN_TEST(unique_ops);
     RUN_TEST(unique_mods);
+    RUN_TEST(op_tables);
     RUN_TEST(op_stack_size);
     RUN_TEST(mod_stack_size);
 }
@@ -177,6 +177,101 @@ TEST parser_test_sub_commands() {
     PASS();
 }
 
+TEST parser_test_errors() {
+    tele_command_t cmd;
+    char error_msg[TELE_ERROR_MSG_LENGTH];
+
+    ASSERT_EQ(parse("X 1 FOO", &cmd, error_msg), E_PARSE);
+    ASSERT_STR_EQ(error_msg, "FOO");
+    ASSERT_EQ(parse("IF X:Y 1", &cmd, error_msg), E_NEED_SPACE_PRE_SEP);
+    ASSERT_EQ(parse("X 1;", &cmd, error_msg), E_NEED_SPACE_SUB_SEP);
+
+    // long tokens are cut short to fit in error_msg
+    ASSERT_EQ(parse("ABCDEFGHIJKLMNOPQRSTUVWXYZ", &cmd, error_msg), E_PARSE);
+    ASSERT_EQ(strlen(error_msg), TELE_ERROR_MSG_LENGTH - 1);
+
+    ASSERT_EQ(parse("X 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16", &cmd,
+                    error_msg),
+              E_LENGTH);
+
+    // tabs and newlines separate too
+    ASSERT_EQ(parse("IF X:\tY\n1", &cmd, error_msg), E_NEED_SPACE_PRE_SEP);
+    ASSERT_EQ(parse("IF X: Y\t1\n", &cmd, error_msg), E_OK);
+    ASSERT_EQ(cmd.length, 5);
+    ASSERT_EQ(cmd.separator, 2);
+
+    PASS();
+}
+
+// parse_and_compile must agree with parse, validate and compile_command
+TEST parse_and_compile_should_match() {
+    for (size_t i = 0; i < CORPUS_COUNT; i++) {
+        char* text = corpus[i];
+        tele_command_t cmd, fused_cmd;
+        compiled_command_t compiled, fused;
+        char error_msg[TELE_ERROR_MSG_LENGTH];
+
+        ASSERT_EQm(text, parse(text, &cmd, error_msg), E_OK);
+        ASSERT_EQm(text, validate(&cmd, error_msg), E_OK);
+        compile_command(&cmd, &compiled);
+        ASSERT_EQm(text, parse_and_compile(text, &fused_cmd, &fused, error_msg),
+                   E_OK);
+
+        ASSERT_EQm(text, fused_cmd.length, cmd.length);
+        ASSERT_EQm(text, fused_cmd.separator, cmd.separator);
+        ASSERT_EQm(text, fused.pre_count, compiled.pre_count);
+        ASSERT_EQm(text, fused.post_count, compiled.post_count);
+        ASSERT_EQm(text, fused.set_words, compiled.set_words);
+        for (uint8_t j = 0; j < compiled.pre_count + compiled.post_count; j++) {
+            ASSERT_EQm(text, fused.subs[j].start, compiled.subs[j].start);
+            ASSERT_EQm(text, fused.subs[j].end, compiled.subs[j].end);
+        }
+    }
+
+    PASS();
+}
+
+TEST parse_and_compile_metadata() {
+    tele_command_t cmd;
+    compiled_command_t compiled;
+    char error_msg[TELE_ERROR_MSG_LENGTH];
+
+    ASSERT_EQ(parse_and_compile("IF GT X 3: X ADD 1 2; Y; P 1 2", &cmd,
+                                &compiled, error_msg),
+              E_OK);
+    ASSERT_EQ(cmd.separator, 4);
+    ASSERT_EQ(compiled.pre_count, 1);
+    ASSERT_EQ(compiled.post_count, 3);
+
+    // IF GT X 3
+    ASSERT_EQ(compiled.subs[0].start, 0);
+    ASSERT_EQ(compiled.subs[0].end, 3);
+    // X ADD 1 2, X is set
+    ASSERT_EQ(compiled.subs[1].start, 5);
+    ASSERT_EQ(compiled.subs[1].end, 8);
+    ASSERT_EQ(op_compiled_fn(&cmd, &compiled, 5), tele_ops[E_OP_X]->set);
+    ASSERT_EQ(op_compiled_fn(&cmd, &compiled, 6), tele_ops[E_OP_ADD]->get);
+    // Y, a get
+    ASSERT_EQ(compiled.subs[2].start, 10);
+    ASSERT_EQ(compiled.subs[2].end, 10);
+    ASSERT_EQ(op_compiled_fn(&cmd, &compiled, 10), tele_ops[E_OP_Y]->get);
+    // P 1 2, a set
+    ASSERT_EQ(compiled.subs[3].start, 12);
+    ASSERT_EQ(compiled.subs[3].end, 14);
+    ASSERT_EQ(op_compiled_fn(&cmd, &compiled, 12), tele_ops[E_OP_P]->set);
+
+    // errors are the same as validate's
+    ASSERT_EQ(parse_and_compile("X 1 2", &cmd, &compiled, error_msg),
+              E_EXTRA_PARAMS);
+    ASSERT_EQ(parse_and_compile("ADD 1", &cmd, &compiled, error_msg),
+              E_NEED_PARAMS);
+    ASSERT_STR_EQ(error_msg, "ADD");
+    ASSERT_EQ(parse_and_compile("X 1 FOO", &cmd, &compiled, error_msg),
+              E_PARSE);
+
+    PASS();
+}
+
 // This test asserts that the parser always returns the correct op, it does this
 // by starting with the op in question, extracting the name and running that
 // through the parser. Then asserting that only 1 op is returned in
@@ -190,8 +285,8 @@ TEST parser_should_return_op() {
         error_t result = parse(text, &cmd, error_msg);
         ASSERT_EQm(text, result, E_OK);
         ASSERT_EQm(text, cmd.length, 1);
-        ASSERT_EQm(text, cmd.data[0].tag, OP);
-        ASSERT_EQm(text, cmd.data[0].value, (int16_t)i);
+        ASSERT_EQm(text, td_tag(&cmd.data[0]), OP);
+        ASSERT_EQm(text, td_value(&cmd.data[0]), (int16_t)i);
     }
     PASS();
 }
@@ -206,8 +301,8 @@ TEST parser_should_return_mod() {
         error_t result = parse(text, &cmd, error_msg);
         ASSERT_EQm(text, result, E_OK);
         ASSERT_EQm(text, cmd.length, 1);
-        ASSERT_EQm(text, cmd.data[0].tag, MOD);
-        ASSERT_EQm(text, cmd.data[0].value, (int16_t)i);
+        ASSERT_EQm(text, td_tag(&cmd.data[0]), MOD);
+        ASSERT_EQm(text, td_value(&cmd.data[0]), (int16_t)i);
     }
     PASS();
 }
@@ -235,6 +330,9 @@ TEST print_command_corpus_should_be_unchanged() {
 SUITE(parser_suite) {
     RUN_TEST(should_parse_and_validate);
     RUN_TEST(parser_test_sub_commands);
+    RUN_TEST(parser_test_errors);
+    RUN_TEST(parse_and_compile_should_match);
+    RUN_TEST(parse_and_compile_metadata);
     RUN_TEST(parser_should_return_op);
     RUN_TEST(parser_should_return_mod);
     RUN_TEST(print_command_corpus_should_be_unchanged);
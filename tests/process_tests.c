@@ -6,7 +6,12 @@
 
 #include "greatest/greatest.h"
 
+#include "clock.h"
+#include "fuse.h"
+#include "ops/op.h"
+#include "script_helper.h"
 #include "teletype.h"
+
 // runs multiple lines of commands and then asserts that the final answer is
 // correct (allows contiuation of state)
 TEST process_helper_state(scene_state_t* ss, size_t n, char* lines[],
@@ -22,7 +27,8 @@ TEST process_helper_state(scene_state_t* ss, size_t n, char* lines[],
         error_t error = parse(lines[i], &cmd, error_msg);
         if (error != E_OK) { FAIL(); }
         if (validate(&cmd, error_msg) != E_OK) { FAIL(); }
-        result = process_command(ss, &es, &cmd);
+        const tele_command_view_t command = command_view(&cmd);
+        result = process_command(ss, &es, &command);
     }
 
     ASSERT_EQ(result.has_value, true);
@@ -159,6 +165,246 @@ TEST test_L() {
     PASS();
 }
 
+TEST test_L_sub_commands() {
+    char* test1[3] = { "X 0; Y 0", "L 1 4: X ADD X I; Y ADD Y 1",
+                       "ADD X Y" };
+    CHECK_CALL(process_helper(3, test1, 14));
+
+    PASS();
+}
+
+TEST test_DEL() {
+    scene_state_t ss;
+    ss_init(&ss);
+
+    // the POST command must outlive the line that stored it
+    char* test1[4] = { "X 0; Y 0", "I 3", "DEL 10: X ADD X I; Y 2", "X" };
+    CHECK_CALL(process_helper_state(&ss, 4, test1, 0));
+
+    test_advance_ticks(&ss, 10);
+    char* test2[1] = { "ADD X Y" };
+    CHECK_CALL(process_helper_state(&ss, 1, test2, 5));
+
+    PASS();
+}
+
+TEST test_DEL_order() {
+    scene_state_t ss;
+    ss_init(&ss);
+
+    // earliest deadline first, equal deadlines in the order they were added
+    char* test1[5] = { "X 0", "DEL 10: X ADD MUL X 10 1",
+                       "DEL 10: X ADD MUL X 10 2", "DEL 5: X ADD MUL X 10 3",
+                       "X" };
+    CHECK_CALL(process_helper_state(&ss, 5, test1, 0));
+    ASSERT_EQ(ss_delay_count(&ss), 3);
+
+    test_advance_ticks(&ss, 4);
+    char* test2[1] = { "X" };
+    CHECK_CALL(process_helper_state(&ss, 1, test2, 0));
+
+    test_advance_ticks(&ss, 6);
+    CHECK_CALL(process_helper_state(&ss, 1, test2, 312));
+    ASSERT_EQ(ss_delay_count(&ss), 0);
+
+    // DEL.X fills every slot and no more
+    char* test3[3] = { "X 0", "DEL.X 130 1: X ADD X 1", "X" };
+    CHECK_CALL(process_helper_state(&ss, 3, test3, 0));
+    ASSERT_EQ(ss_delay_count(&ss), DELAY_SIZE);
+
+    test_advance_ticks(&ss, 10);
+    CHECK_CALL(process_helper_state(&ss, 1, test2, 10));
+    ASSERT_EQ(ss_delay_count(&ss), DELAY_SIZE - 10);
+
+    test_advance_ticks(&ss, 255);
+    CHECK_CALL(process_helper_state(&ss, 1, test2, DELAY_SIZE));
+
+    PASS();
+}
+
+TEST test_DEL_CLR() {
+    scene_state_t ss;
+    ss_init(&ss);
+
+    char* test1[4] = { "X 0", "DEL 10: X 5", "DEL.CLR", "X" };
+    CHECK_CALL(process_helper_state(&ss, 4, test1, 0));
+    ASSERT_EQ(ss_delay_count(&ss), 0);
+
+    test_advance_ticks(&ss, 10);
+    char* test2[1] = { "X" };
+    CHECK_CALL(process_helper_state(&ss, 1, test2, 0));
+
+    // clearing from a delayed command drops the delays still pending, but
+    // leaves the scheduler usable
+    char* test3[4] = { "DEL 10: DEL.CLR; Y 1", "DEL 10: X 5", "DEL 20: X 7",
+                       "X" };
+    CHECK_CALL(process_helper_state(&ss, 4, test3, 0));
+
+    test_advance_ticks(&ss, 20);
+    char* test4[1] = { "ADD X Y" };
+    CHECK_CALL(process_helper_state(&ss, 1, test4, 1));
+    ASSERT_EQ(ss_delay_count(&ss), 0);
+
+    char* test5[3] = { "DEL 2: X 3", "DEL 1: Y 4", "X" };
+    CHECK_CALL(process_helper_state(&ss, 3, test5, 0));
+    test_advance_ticks(&ss, 2);
+    CHECK_CALL(process_helper_state(&ss, 1, test4, 7));
+
+    PASS();
+}
+
+// a delayed INIT resets the delays and the command arena from under the delay
+// that is running, which must leave both whole
+TEST test_DEL_INIT() {
+    scene_state_t ss;
+    ss_init(&ss);
+
+    char* test1[4] = { "X 7", "DEL 1: INIT", "DEL 2: X 5", "X" };
+    CHECK_CALL(process_helper_state(&ss, 4, test1, 7));
+
+    test_advance_ticks(&ss, 2);
+    char* test2[1] = { "X" };
+    CHECK_CALL(process_helper_state(&ss, 1, test2, 0));
+    ASSERT_EQ(ss_delay_count(&ss), 0);
+    ASSERT_EQ(arena_free_blocks(&ss.arena), ARENA_BLOCKS);
+
+    // every block is on the free list once, and the list ends
+    uint16_t blocks = 0;
+    for (uint8_t b = ss.arena.free; b != ARENA_NONE && blocks <= ARENA_BLOCKS;
+         b = ss.arena.blocks[b].next)
+        blocks++;
+    ASSERT_EQ(blocks, ARENA_BLOCKS);
+
+    char* test3[3] = { "DEL 1: X 3", "DEL 1: Y 4", "X" };
+    CHECK_CALL(process_helper_state(&ss, 3, test3, 0));
+    test_advance_ticks(&ss, 1);
+    char* test4[1] = { "ADD X Y" };
+    CHECK_CALL(process_helper_state(&ss, 1, test4, 7));
+    ASSERT_EQ(arena_free_blocks(&ss.arena), ARENA_BLOCKS);
+
+    PASS();
+}
+
+TEST test_DEL_timing() {
+    scene_state_t ss;
+    ss_init(&ss);
+    uint32_t deadline;
+
+    char* test1[3] = { "X 0", "DEL 3: X 1", "X" };
+    CHECK_CALL(process_helper_state(&ss, 3, test1, 0));
+    ASSERT(tele_next_deadline(&ss, &deadline));
+    ASSERT_EQ(deadline, test_ticks + 3);
+
+    // due on the ms asked for, not on a coarser clock
+    test_advance_ticks(&ss, 2);
+    char* test2[1] = { "X" };
+    CHECK_CALL(process_helper_state(&ss, 1, test2, 0));
+    test_advance_ticks(&ss, 1);
+    CHECK_CALL(process_helper_state(&ss, 1, test2, 1));
+    ASSERT_FALSE(tele_next_deadline(&ss, &deadline));
+
+    PASS();
+}
+
+TEST test_TR_PULSE_timing() {
+    scene_state_t ss;
+    ss_init(&ss);
+    uint32_t deadline;
+
+    char* test1[3] = { "TR.TIME 1 5", "TR.P 1", "TR 1" };
+    CHECK_CALL(process_helper_state(&ss, 3, test1, 1));
+    ASSERT(tele_next_deadline(&ss, &deadline));
+    ASSERT_EQ(deadline, test_ticks + 5);
+
+    test_advance_ticks(&ss, 4);
+    char* test2[1] = { "TR 1" };
+    CHECK_CALL(process_helper_state(&ss, 1, test2, 1));
+    test_advance_ticks(&ss, 1);
+    CHECK_CALL(process_helper_state(&ss, 1, test2, 0));
+    ASSERT_FALSE(tele_next_deadline(&ss, &deadline));
+
+    // shortening TR.TIME shortens a pulse that is running
+    char* test3[3] = { "TR.P 1", "TR.TIME 1 2", "TR 1" };
+    CHECK_CALL(process_helper_state(&ss, 3, test3, 1));
+    test_advance_ticks(&ss, 2);
+    CHECK_CALL(process_helper_state(&ss, 1, test2, 0));
+
+    PASS();
+}
+
+TEST test_S() {
+    scene_state_t ss;
+    ss_init(&ss);
+
+    char* test1[4] = { "X 1", "S: X ADD X 2", "S: X MUL X 3", "X" };
+    CHECK_CALL(process_helper_state(&ss, 4, test1, 1));
+
+    // S.ALL runs the most recently stored command first
+    char* test2[2] = { "S.ALL", "X" };
+    CHECK_CALL(process_helper_state(&ss, 2, test2, 5));
+    ASSERT_EQ(arena_free_blocks(&ss.arena), ARENA_BLOCKS);
+
+    PASS();
+}
+
+// DEL and S share the command arena, long commands run out of it before the
+// delay slots run out, and it's all given back as they run or are cleared
+TEST test_DEL_S_arena() {
+    scene_state_t ss;
+    ss_init(&ss);
+
+    // 9 words, and so 2 blocks, for the POST command of each delay
+    char* test1[3] = { "X 0", "DEL.X 200 1: X ADD X 1; Y ADD Y 1", "X" };
+    CHECK_CALL(process_helper_state(&ss, 3, test1, 0));
+    ASSERT_EQ(ss_delay_count(&ss), ARENA_BLOCKS / 2);
+    ASSERT_EQ(arena_free_blocks(&ss.arena), 0);
+
+    // there's no room for S either, until a delay has run
+    char* test2[2] = { "S: X 100", "S.L" };
+    CHECK_CALL(process_helper_state(&ss, 2, test2, 0));
+    test_advance_ticks(&ss, 1);
+    char* test3[2] = { "S: X ADD X 100", "S.L" };
+    CHECK_CALL(process_helper_state(&ss, 2, test3, 1));
+    ASSERT_EQ(arena_free_blocks(&ss.arena), 1);
+
+    char* test4[2] = { "S.POP", "X" };
+    CHECK_CALL(process_helper_state(&ss, 2, test4, 101));
+
+    char* test5[2] = { "DEL.CLR", "S.L" };
+    CHECK_CALL(process_helper_state(&ss, 2, test5, 0));
+    ASSERT_EQ(arena_free_blocks(&ss.arena), ARENA_BLOCKS);
+
+    // short delays aren't capped by the arena
+    char* test6[2] = { "DEL.X 200 1: X", "X" };
+    CHECK_CALL(process_helper_state(&ss, 2, test6, 101));
+    ASSERT_EQ(ss_delay_count(&ss), DELAY_SIZE);
+
+    PASS();
+}
+
+// 64 of the longest DELs fit in the arena with the S stack full of the
+// longest S commands
+TEST test_DEL_S_arena_longest() {
+    static scene_state_t ss;
+    ss_init(&ss);
+
+    char* stack[STACK_OP_SIZE + 1];
+    for (uint8_t i = 0; i < STACK_OP_SIZE; i++)
+        stack[i] = "S: X ABS ADD 1 ADD 2 ADD 3 ADD 4 ADD 5 6";
+    stack[STACK_OP_SIZE] = "S.L";
+    CHECK_CALL(process_helper_state(&ss, STACK_OP_SIZE + 1, stack,
+                                    STACK_OP_SIZE));
+
+    char* delays[65];
+    for (uint8_t i = 0; i < 64; i++)
+        delays[i] = "DEL 100: X ADD 1 ADD 2 ADD 3 ADD 4 ADD 5 6";
+    delays[64] = "X";
+    CHECK_CALL(process_helper_state(&ss, 65, delays, 0));
+    ASSERT_EQ(ss_delay_count(&ss), 64);
+
+    PASS();
+}
+
 TEST test_O() {
     scene_state_t ss;
     ss_init(&ss);
@@ -281,6 +527,173 @@ TEST test_sub_commands() {
     PASS();
 }
 
+TEST fold_helper(const char* text, uint8_t count, uint8_t start,
+                 uint8_t end) {
+    tele_command_t cmd;
+    compiled_command_t compiled;
+    char error_msg[TELE_ERROR_MSG_LENGTH];
+    ASSERT_EQm(text, parse_and_compile(text, &cmd, &compiled, error_msg),
+               E_OK);
+    ASSERT_EQm(text, compiled.fold_count, count);
+    if (count) {
+        ASSERT_EQm(text, compiled.folds[0].start, start);
+        ASSERT_EQm(text, compiled.folds[0].end, end);
+        ASSERTm(text, compiled.fold_ends & (1 << end));
+    }
+
+    // the command itself is unchanged
+    char out[64];
+    print_command(&cmd, out);
+    ASSERT_STR_EQm(text, out, text);
+
+    PASS();
+}
+
+TEST test_fold() {
+    CHECK_CALL(fold_helper("CV 1 N ADD 12 7", 1, 2, 5));
+    CHECK_CALL(fold_helper("TR.TIME 1 MUL 10 5", 1, 2, 4));
+    CHECK_CALL(fold_helper("ADD ADD 1 2 SUB 4 3", 1, 0, 6));
+    // folds are found right to left
+    CHECK_CALL(fold_helper("IF EQ 1 1: X V 5", 2, 6, 7));
+    CHECK_CALL(fold_helper("CV 1 N RAND 5", 0, 0, 0));
+    CHECK_CALL(fold_helper("X ADD X 1", 0, 0, 0));
+    CHECK_CALL(fold_helper("ADD 1 X", 0, 0, 0));
+
+    char* test1[1] = { "ADD ADD 1 2 SUB 4 3" };
+    CHECK_CALL(process_helper(1, test1, 4));
+
+    char* test2[3] = { "X 5", "IF EQ 1 1: X ADD X MUL 2 3", "X" };
+    CHECK_CALL(process_helper(3, test2, 11));
+
+    char* test3[2] = { "X N 12; Y N ADD 10 2", "EQ X Y" };
+    CHECK_CALL(process_helper(2, test3, 1));
+
+    PASS();
+}
+
+// every pure OP must give the same answer folded and run
+TEST test_fold_pure_ops() {
+    const int16_t params[2][4] = { { 3, 5, 7, 2 }, { -300, 1, 2, 9000 } };
+
+    for (size_t i = 0; i < E_OP__LENGTH; i++) {
+        const tele_op_t* op = tele_ops[i];
+        if (op->purity != OP_PURE) continue;
+
+        for (size_t p = 0; p < 2; p++) {
+            tele_command_t cmd = {.length = 0, .separator = -1 };
+            td_set(&cmd.data[cmd.length++], OP, i);
+            for (uint8_t j = 0; j < op->params; j++) {
+                td_set(&cmd.data[cmd.length++], NUMBER, params[p][j % 4]);
+            }
+
+            compiled_command_t folded, unfolded;
+            compile_command(&cmd, &folded);
+            ASSERT_EQm(op->name, folded.fold_count, 1);
+            unfolded = folded;
+            unfolded.fold_count = 0;
+            unfolded.fold_ends = 0;
+
+            scene_state_t ss;
+            ss_init(&ss);
+            exec_state_t es;
+            es_init(&es);
+            es_push(&es);
+            tele_command_view_t view = command_view(&cmd);
+
+            view.compiled = &folded;
+            process_result_t a = process_command(&ss, &es, &view);
+            view.compiled = &unfolded;
+            process_result_t b = process_command(&ss, &es, &view);
+            ASSERT_EQm(op->name, a.has_value, true);
+            ASSERT_EQm(op->name, a.value, b.value);
+        }
+    }
+
+    PASS();
+}
+
+// runs text on a copy of ss fused and on another copy not fused, the scene
+// states must match afterwards
+TEST fuse_helper(scene_state_t* ss, const char* text, fused_t fused) {
+    tele_command_t cmd;
+    compiled_command_t compiled, unfused;
+    char error_msg[TELE_ERROR_MSG_LENGTH];
+    ASSERT_EQm(text, parse_and_compile(text, &cmd, &compiled, error_msg),
+               E_OK);
+    // the last sub is the one to fuse
+    const uint8_t sub_count = compiled.pre_count + compiled.post_count;
+    ASSERT_EQm(text, compiled.subs[sub_count - 1].fused, fused);
+
+    unfused = compiled;
+    for (uint8_t i = 0; i < sub_count; i++) unfused.subs[i].fused = FUSED_NONE;
+
+    static scene_state_t a, b;
+    a = *ss;
+    b = *ss;
+    exec_state_t es;
+    es_init(&es);
+    es_push(&es);
+    tele_command_view_t view = command_view(&cmd);
+    view.compiled = &compiled;
+    process_result_t ra = process_command(&a, &es, &view);
+    view.compiled = &unfused;
+    process_result_t rb = process_command(&b, &es, &view);
+
+    ASSERT_EQm(text, ra.has_value, rb.has_value);
+    ASSERTm(text, memcmp(&a, &b, sizeof(scene_state_t)) == 0);
+    *ss = a;
+
+    PASS();
+}
+
+TEST test_fuse() {
+    static scene_state_t ss;
+    ss_init(&ss);
+
+    char* fused[] = {
+        "X ADD X 1",           "Y SUB Y 3",          "A + A -1",
+        "T ADD T X7FFF",       "B WRAP ADD B 1 0 3", "C WRP SUB C 1 -2 2",
+        "D WRAP ADD D 5 7 0",  "CV 1 N P.NEXT",      "CV 5 N P.NEXT",
+        "TR.P 1",              "TR.PULSE 2",         "TR.P 0",
+        "X 1; Y ADD Y 1",      "IF 1: Z ADD Z 2",
+    };
+    fused_t kind[] = {
+        FUSED_VAR_ADD,      FUSED_VAR_SUB,      FUSED_VAR_ADD,
+        FUSED_VAR_ADD,      FUSED_VAR_WRAP_ADD, FUSED_VAR_WRAP_SUB,
+        FUSED_VAR_WRAP_ADD, FUSED_CV_N_P_NEXT,  FUSED_CV_N_P_NEXT,
+        FUSED_TR_P,         FUSED_TR_P,         FUSED_TR_P,
+        FUSED_VAR_ADD,      FUSED_VAR_ADD,
+    };
+    char* not_fused[] = {
+        "X ADD Y 1", "X ADD X Y", "X MUL X 2",      "J ADD J 1",
+        "TR.P X",    "CV 1 N P.HERE", "CV 1 N P.NEXT 1", "X WRAP ADD X 1 0 Y",
+        "ADD X 1",
+    };
+
+    ss_set_pattern_len(&ss, 0, 5);
+    for (int16_t i = 0; i < 5; i++) ss_set_pattern_val(&ss, 0, i, i * 7);
+    ss.variables.tr_time[0] = ss.variables.tr_time[1] = 10;
+
+    // each a few times so that they wrap and overflow
+    for (int r = 0; r < 8; r++) {
+        for (size_t i = 0; i < sizeof(fused) / sizeof(fused[0]); i++)
+            CHECK_CALL(fuse_helper(&ss, fused[i], kind[i]));
+    }
+    ASSERT_EQ(ss.variables.x, 1);
+    ASSERT_EQ(ss.variables.b, 2);  // B starts at 2
+    ASSERT_EQ(ss_get_pattern_idx(&ss, 0), 1);
+
+    for (size_t i = 0; i < sizeof(not_fused) / sizeof(not_fused[0]); i++) {
+        tele_command_t cmd;
+        compiled_command_t compiled;
+        char error_msg[TELE_ERROR_MSG_LENGTH];
+        parse_and_compile(not_fused[i], &cmd, &compiled, error_msg);
+        ASSERT_EQm(not_fused[i], compiled.subs[0].fused, FUSED_NONE);
+    }
+
+    PASS();
+}
+
 TEST test_blank_command() {
     scene_state_t ss;
     ss_init(&ss);
@@ -296,7 +709,8 @@ TEST test_blank_command() {
     if (error != E_OK) { FAIL(); }
     if (validate(&cmd, error_msg) != E_OK) { FAIL(); }
 
-    process_result_t result = process_command(&ss, &es, &cmd);
+    const tele_command_view_t command = command_view(&cmd);
+    process_result_t result = process_command(&ss, &es, &command);
 
     ASSERT_EQ(result.has_value, false);
     ASSERT_EQ(result.value, 0);
@@ -304,6 +718,319 @@ TEST test_blank_command() {
     PASS();
 }
 
+// stores each line in script 1 (replacing what was there), then runs the
+// script and asserts that the answer from the last line is correct
+TEST script_helper_state(scene_state_t* ss, size_t n, char* lines[],
+                         int16_t answer) {
+    CHECK_CALL(load_script(ss, TT_SCRIPT_1, n, lines));
+
+    process_result_t result = run_script(ss, TT_SCRIPT_1);
+    ASSERT_EQ(result.has_value, true);
+    ASSERT_EQm(lines[n - 1], result.value, answer);
+
+    PASS();
+}
+
+TEST test_script_commands() {
+    scene_state_t ss;
+    ss_init(&ss);
+
+    char* test1[3] = { "X 1", "Y ADD X 2", "Y" };
+    CHECK_CALL(script_helper_state(&ss, 3, test1, 3));
+
+    // the compiled form must follow the commands when lines are shuffled
+    tele_command_t cmd;
+    char error_msg[TELE_ERROR_MSG_LENGTH];
+    if (parse("X 5", &cmd, error_msg) != E_OK) { FAIL(); }
+    cmd.comment = false;
+    ss_insert_script_command(&ss, TT_SCRIPT_1, 1, &cmd);
+    process_result_t result = run_script(&ss, TT_SCRIPT_1);
+    ASSERT_EQ(result.value, 7);
+
+    ss_delete_script_command(&ss, TT_SCRIPT_1, 1);
+    result = run_script(&ss, TT_SCRIPT_1);
+    ASSERT_EQ(result.value, 3);
+
+    char* test2[3] = { "X 0", "L 1 10: X ADD X I; Y X", "Y" };
+    CHECK_CALL(script_helper_state(&ss, 3, test2, 55));
+
+    char* test3[3] = { "X 0", "IF 1: X 1; Y 2; Z 3", "ADD X ADD Y Z" };
+    CHECK_CALL(script_helper_state(&ss, 3, test3, 6));
+
+    PASS();
+}
+
+TEST test_DEL_script() {
+    scene_state_t ss;
+    ss_init(&ss);
+
+    tele_command_t cmd;
+    char error_msg[TELE_ERROR_MSG_LENGTH];
+    if (parse("Y 9", &cmd, error_msg) != E_OK) { FAIL(); }
+    cmd.comment = false;
+    ss_overwrite_script_command(&ss, TEMP_SCRIPT, 0, &cmd);
+
+    // a delayed command sees the script and I it was queued from
+    char* test1[4] = { "X 0", "I 4", "DEL 5: X ADD I SCRIPT", "X" };
+    CHECK_CALL(script_helper_state(&ss, 4, test1, 0));
+
+    test_advance_ticks(&ss, 5);
+    char* test2[1] = { "X" };
+    CHECK_CALL(process_helper_state(&ss, 1, test2, 5));
+
+    // and leaves the live mode command in TEMP alone
+    ASSERT_EQ(ss_get_script_len(&ss, TEMP_SCRIPT), 1);
+    run_script(&ss, TEMP_SCRIPT);
+    char* test3[1] = { "Y" };
+    CHECK_CALL(process_helper_state(&ss, 1, test3, 9));
+
+    PASS();
+}
+
+// DEL and S run their commands from the compiled form of the script line they
+// were stored from, until that line is changed
+TEST test_DEL_S_compiled() {
+    scene_state_t ss;
+    ss_init(&ss);
+
+    char* lines[3] = { "X 1", "DEL 5: X ADD X 2", "S: X MUL X 3" };
+    CHECK_CALL(load_script(&ss, TT_SCRIPT_1, 3, lines));
+    run_script(&ss, TT_SCRIPT_1);
+
+    tele_command_t stored;
+    tele_command_view_t view =
+        ss_delay_command(&ss, ss.delay.heap[0], &stored);
+    ASSERT_EQ(view.compiled, ss_get_script_compiled(&ss, TT_SCRIPT_1, 1));
+    ASSERT_EQ(view.offset, 3);
+    ASSERT_EQ(view.length, 4);
+    view = ss_stack_op_command(&ss, 0, &stored);
+    ASSERT_EQ(view.compiled, ss_get_script_compiled(&ss, TT_SCRIPT_1, 2));
+
+    // once the line is edited they're compiled as they run
+    tele_command_t cmd;
+    char error_msg[TELE_ERROR_MSG_LENGTH];
+    ASSERT_EQ(parse("S: X MUL X 4", &cmd, error_msg), E_OK);
+    cmd.comment = false;
+    ss_overwrite_script_command(&ss, TT_SCRIPT_1, 2, &cmd);
+    view = ss_stack_op_command(&ss, 0, &stored);
+    ASSERT_EQ(view.compiled, NULL);
+
+    char* test1[2] = { "S.POP", "X" };
+    CHECK_CALL(process_helper_state(&ss, 2, test1, 3));
+    test_advance_ticks(&ss, 5);
+    char* test2[1] = { "X" };
+    CHECK_CALL(process_helper_state(&ss, 1, test2, 5));
+
+    PASS();
+}
+
+// a scene for test_interleaved_scenes, INIT_SCRIPT is run once and then
+// TT_SCRIPT_1 once per ms, the value of its last line is the trace
+#define INTERLEAVE_LINES 5
+#define INTERLEAVE_STEPS 40
+
+typedef struct {
+    char* init[INTERLEAVE_LINES];
+    char* step[INTERLEAVE_LINES];
+} interleave_scene_t;
+
+TEST interleave_load(scene_state_t* ss, interleave_scene_t* scene) {
+    ss_init(ss);
+    CHECK_CALL(load_script(ss, INIT_SCRIPT, INTERLEAVE_LINES, scene->init));
+    CHECK_CALL(load_script(ss, TT_SCRIPT_1, INTERLEAVE_LINES, scene->step));
+    run_script(ss, INIT_SCRIPT);
+    PASS();
+}
+
+// all of the state an interpreter keeps is in its scene_state_t, so scenes
+// run interleaved in the same process give the same results as run alone
+TEST test_interleaved_scenes() {
+    // CHAOS, the EX and MA units, DEL and S are all kept per scene
+    interleave_scene_t scenes[2] = {
+        { { "CHAOS.ALG 2", "CHAOS.R 3000", "EX 3", "MA.SELECT 2", "Z 0" },
+          { "X CHAOS", "DEL 2: Y ADD Y X", "S: Z ADD Z 1; EX ADD 1 MOD Z 4",
+            "IF GT S.L 1: S.POP",
+            "ADD ADD X Y ADD MUL EX 100 MA.SELECT" } },
+        { { "CHAOS.ALG 3", "CHAOS.R 150", "CHAOS 90", "MA.SELECT 3", "EX 2" },
+          { "X CHAOS", "DEL 3: Y SUB Y X", "S: Z ADD Z 7",
+            "IF GT S.L 2: S.ALL",
+            "ADD ADD X Y ADD MUL EX 100 ADD Z MA.SELECT" } },
+    };
+    static scene_state_t ss[2];
+    int16_t alone[2][INTERLEAVE_STEPS];
+    const uint32_t start = test_ticks;
+
+    for (uint8_t s = 0; s < 2; s++) {
+        test_ticks = start;
+        CHECK_CALL(interleave_load(&ss[s], &scenes[s]));
+        for (uint8_t i = 0; i < INTERLEAVE_STEPS; i++) {
+            alone[s][i] = run_script(&ss[s], TT_SCRIPT_1).value;
+            test_advance_ticks(&ss[s], 1);
+        }
+    }
+
+    test_ticks = start;
+    CHECK_CALL(interleave_load(&ss[0], &scenes[0]));
+    CHECK_CALL(interleave_load(&ss[1], &scenes[1]));
+    for (uint8_t i = 0; i < INTERLEAVE_STEPS; i++) {
+        for (uint8_t s = 0; s < 2; s++)
+            ASSERT_EQ(run_script(&ss[s], TT_SCRIPT_1).value, alone[s][i]);
+        test_ticks++;
+        tele_run_deadlines(&ss[0]);
+        tele_run_deadlines(&ss[1]);
+    }
+
+    PASS();
+}
+
+// a script run a slice at a time leaves the scene as running it to the end
+// does, however small the slices
+TEST test_run_script_slice() {
+    char* script1[6] = { "X 0; Y 0; I 7", "W LT X 50: X ADD X 1; Y ADD Y X",
+                         "L 1 4: $ 2; Z ADD Z I", "L 6 3: Z ADD Z I",
+                         "IF GT X 10: $ 3", "ELIF 1: Z 0" };
+    char* script2[6] = { "A ADD A I", "EVERY 2: B ADD B 1",
+                         "SKIP 3: C ADD C 1", "OTHER: D ADD D 1",
+                         "PROB 50: T ADD T 1", "W LT Y 1300: $ 4" };
+    char* script3[4] = { "X ADD X 1", "IF GT X 53: BREAK", "Y ADD Y 1",
+                         "$ 3" };
+    char* script4[2] = { "Y ADD Y 7", "L 1 10: BRK" };
+    static scene_state_t start, whole, sliced;
+    const uint16_t words[4] = { 1, 3, 17, 0 };
+
+    ss_init(&start);
+    CHECK_CALL(load_script(&start, TT_SCRIPT_1, 6, script1));
+    CHECK_CALL(load_script(&start, TT_SCRIPT_2, 6, script2));
+    CHECK_CALL(load_script(&start, TT_SCRIPT_3, 4, script3));
+    CHECK_CALL(load_script(&start, TT_SCRIPT_4, 2, script4));
+
+    whole = start;
+    for (uint8_t i = 0; i < 3; i++) run_script(&whole, TT_SCRIPT_1);
+
+    for (uint8_t w = 0; w < 4; w++) {
+        sliced = start;
+        uint32_t slices = 0;
+        for (uint8_t i = 0; i < 3; i++) {
+            script_run_t run;
+            run_script_start(&run, TT_SCRIPT_1);
+            do { slices++; } while (!run_script_slice(&sliced, &run, words[w]));
+        }
+        if (words[w] == 0)
+            ASSERT_EQ(slices, 3);
+        else
+            ASSERT(slices > 3);
+        ASSERT_EQ(memcmp(&sliced, &whole, sizeof(scene_state_t)), 0);
+    }
+
+    PASS();
+}
+
+// SCRIPT.SLICE chooses between running a script to the end and a slice at a
+// time, a script isn't started again until its last run has finished
+TEST test_SCRIPT_SLICE() {
+    char* script1[3] = { "Y ADD Y 1", "X 0", "W LT X 1000: X ADD X 1" };
+    static scene_state_t ss;
+    static script_runs_t runs;
+
+    ss_init(&ss);
+    script_runs_init(&runs);
+    CHECK_CALL(load_script(&ss, TT_SCRIPT_1, 3, script1));
+
+    ASSERT(tele_run_script(&ss, &runs, TT_SCRIPT_1));
+    ASSERT_EQ(ss.variables.x, 1000);
+    ASSERT_FALSE(tele_run_slices(&ss, &runs));
+
+    char* test1[2] = { "$.SLICE 20", "SCRIPT.SLICE" };
+    CHECK_CALL(process_helper_state(&ss, 2, test1, 20));
+    ASSERT(tele_run_script(&ss, &runs, TT_SCRIPT_1));
+    ASSERT_EQ(ss.variables.y, 2);
+    ASSERT(ss.variables.x < 1000);
+    ASSERT_EQ(tele_running_inputs(&runs), 1 << TT_SCRIPT_1);
+
+    ASSERT_FALSE(tele_run_script(&ss, &runs, TT_SCRIPT_1));
+    ASSERT_EQ(ss.variables.y, 2);
+    ASSERT(ss.variables.x < 1000);
+
+    uint32_t turns = 0;
+    while (tele_run_slices(&ss, &runs)) turns++;
+    ASSERT_EQ(ss.variables.x, 1000);
+    ASSERT(turns > 10);
+    ASSERT_EQ(tele_running_inputs(&runs), 0);
+
+    ASSERT(tele_run_script(&ss, &runs, TT_SCRIPT_1));
+    ASSERT_EQ(ss.variables.y, 3);
+
+    char* test2[2] = { "SCRIPT.SLICE -1", "SCRIPT.SLICE" };
+    CHECK_CALL(process_helper_state(&ss, 2, test2, 0));
+
+    PASS();
+}
+
+// a SCENE stops the unfinished runs of the old scene, but not the one that
+// called it
+TEST test_SCRIPT_SLICE_scene() {
+    char* script[2] = { "X 0", "W LT X 1000: X ADD X 1" };
+    static scene_state_t ss;
+    static script_runs_t runs;
+
+    ss_init(&ss);
+    script_runs_init(&runs);
+    CHECK_CALL(load_script(&ss, TT_SCRIPT_1, 2, script));
+    CHECK_CALL(load_script(&ss, TT_SCRIPT_2, 2, script));
+    ss.variables.script_slice = 20;
+
+    ASSERT(tele_run_script(&ss, &runs, TT_SCRIPT_1));
+    ASSERT(tele_run_script(&ss, &runs, TT_SCRIPT_2));
+    ASSERT_EQ(tele_running_inputs(&runs),
+              (1 << TT_SCRIPT_1) | (1 << TT_SCRIPT_2));
+
+    // as it is when script 2 calls SCENE in a slice
+    runs.slicing = TT_SCRIPT_2;
+    script_runs_init_others(&runs);
+    runs.slicing = -1;
+    ASSERT_EQ(tele_running_inputs(&runs), 1 << TT_SCRIPT_2);
+
+    // and from outside a slice, e.g. a delay or the live command
+    script_runs_init_others(&runs);
+    ASSERT_EQ(tele_running_inputs(&runs), 0);
+    ASSERT_FALSE(tele_run_slices(&ss, &runs));
+
+    PASS();
+}
+
+// the trigger queue of each input, and its counts, from scripts
+TEST test_SCRIPT_Q() {
+    static scene_state_t ss;
+    ss_init(&ss);
+
+    char* test1[2] = { "$.Q 0 2", "$.Q 8" };
+    CHECK_CALL(process_helper_state(&ss, 2, test1, 2));
+    char* test2[2] = { "SCRIPT.Q 3 100", "SCRIPT.Q 3" };
+    CHECK_CALL(process_helper_state(&ss, 2, test2, TRIGGER_QUEUE_MAX));
+    char* test3[1] = { "$.Q 9" };
+    CHECK_CALL(process_helper_state(&ss, 1, test3, 0));
+
+    char* test4[2] = { "$.QP 1 2", "$.QP 1" };
+    CHECK_CALL(process_helper_state(&ss, 2, test4, TRIGGER_COALESCE));
+    char* test5[2] = { "$.QP 1 7", "SCRIPT.QP 1" };
+    CHECK_CALL(process_helper_state(&ss, 2, test5, TRIGGER_COALESCE));
+
+    for (uint8_t i = 0; i < 4; i++) trigger_push(&ss.triggers, 1, true);
+    for (uint8_t i = 0; i < 3; i++) trigger_push(&ss.triggers, 5, true);
+    char* test6[1] = { "$.DROP 2" };
+    CHECK_CALL(process_helper_state(&ss, 1, test6, 2));
+    char* test7[1] = { "SCRIPT.OVER 6" };
+    CHECK_CALL(process_helper_state(&ss, 1, test7, 1));
+    char* test8[1] = { "$.DROP 0" };
+    CHECK_CALL(process_helper_state(&ss, 1, test8, 3));
+    char* test9[2] = { "$.DROP 2 -4", "$.DROP 0" };
+    CHECK_CALL(process_helper_state(&ss, 2, test9, 1));
+    char* test10[2] = { "$.OVER 0 0", "$.OVER 0" };
+    CHECK_CALL(process_helper_state(&ss, 2, test10, 0));
+
+    PASS();
+}
+
 SUITE(process_suite) {
     RUN_TEST(test_numbers);
     RUN_TEST(test_ADD);
@@ -311,11 +1038,32 @@ SUITE(process_suite) {
     RUN_TEST(test_IF);
     RUN_TEST(test_FLIP);
     RUN_TEST(test_L);
+    RUN_TEST(test_L_sub_commands);
+    RUN_TEST(test_DEL);
+    RUN_TEST(test_DEL_order);
+    RUN_TEST(test_DEL_CLR);
+    RUN_TEST(test_DEL_INIT);
+    RUN_TEST(test_DEL_timing);
+    RUN_TEST(test_TR_PULSE_timing);
+    RUN_TEST(test_S);
+    RUN_TEST(test_DEL_S_arena);
+    RUN_TEST(test_DEL_S_arena_longest);
     RUN_TEST(test_O);
     RUN_TEST(test_P);
     RUN_TEST(test_Q);
     RUN_TEST(test_PN);
     RUN_TEST(test_X);
     RUN_TEST(test_sub_commands);
+    RUN_TEST(test_fold);
+    RUN_TEST(test_fold_pure_ops);
+    RUN_TEST(test_fuse);
     RUN_TEST(test_blank_command);
+    RUN_TEST(test_script_commands);
+    RUN_TEST(test_DEL_script);
+    RUN_TEST(test_DEL_S_compiled);
+    RUN_TEST(test_interleaved_scenes);
+    RUN_TEST(test_run_script_slice);
+    RUN_TEST(test_SCRIPT_SLICE);
+    RUN_TEST(test_SCRIPT_SLICE_scene);
+    RUN_TEST(test_SCRIPT_Q);
 }
@@ -0,0 +1,95 @@
+#include "profiler_tests.h"
+
+#include "greatest/greatest.h"
+
+#include "profiler.h"
+
+// the sub bucket bits give the accuracy of the percentiles
+#define ASSERT_NEAR(expected, actual)                               \
+    ASSERT_IN_RANGE((expected), (actual),                           \
+                    (expected) / PROFILE_SUB_BUCKETS + 1)
+
+TEST test_hist_empty() {
+    profile_hist_t h;
+    profile_stats_t s;
+    profile_hist_clear(&h);
+    profile_hist_stats(&h, &s);
+
+    ASSERT_EQ(s.count, 0);
+    ASSERT_EQ(s.min, 0);
+    ASSERT_EQ(s.mean, 0);
+    ASSERT_EQ(s.p50, 0);
+    ASSERT_EQ(s.p99, 0);
+    ASSERT_EQ(s.max, 0);
+    PASS();
+}
+
+TEST test_hist_exact() {
+    profile_hist_t h;
+    profile_hist_clear(&h);
+
+    profile_hist_add(&h, 3);
+    ASSERT_EQ(profile_hist_percentile(&h, 50), 3);
+    ASSERT_EQ(profile_hist_percentile(&h, 99), 3);
+
+    profile_hist_add(&h, 1000);
+    profile_hist_add(&h, 500);
+    ASSERT_EQ(h.count, 3);
+    ASSERT_EQ(h.min, 3);
+    ASSERT_EQ(h.max, 1000);
+    ASSERT_EQ(h.total, 1503);
+    ASSERT_EQ(profile_hist_percentile(&h, 0), 3);
+    ASSERT_EQ(profile_hist_percentile(&h, 100), 1000);
+    PASS();
+}
+
+TEST test_hist_percentiles() {
+    profile_hist_t h;
+    profile_hist_clear(&h);
+
+    // 1 ... 10000, out of order
+    for (uint32_t i = 0; i < 10000; i++)
+        profile_hist_add(&h, (i * 7919) % 10000 + 1);
+
+    ASSERT_EQ(h.count, 10000);
+    ASSERT_EQ(h.min, 1);
+    ASSERT_EQ(h.max, 10000);
+    ASSERT_EQ(h.total / h.count, 5000);
+    ASSERT_NEAR(5000, profile_hist_percentile(&h, 50));
+    ASSERT_NEAR(9900, profile_hist_percentile(&h, 99));
+    ASSERT_EQ(profile_hist_percentile(&h, 0), 1);
+    PASS();
+}
+
+TEST test_hist_saturate() {
+    profile_hist_t h;
+    profile_hist_clear(&h);
+
+    // more than a bucket can count, the p99 outlier must not be lost
+    for (uint32_t i = 0; i < 99000; i++) profile_hist_add(&h, 100);
+    for (uint32_t i = 0; i < 2000; i++) profile_hist_add(&h, 100000);
+
+    ASSERT_EQ(h.count, 101000);
+    ASSERT_NEAR(100, profile_hist_percentile(&h, 50));
+    ASSERT_NEAR(100000, profile_hist_percentile(&h, 99));
+    PASS();
+}
+
+TEST test_hist_large() {
+    profile_hist_t h;
+    profile_hist_clear(&h);
+
+    profile_hist_add(&h, UINT32_MAX);
+    profile_hist_add(&h, 0x80000000);
+    ASSERT_EQ(profile_hist_percentile(&h, 100), UINT32_MAX);
+    ASSERT_NEAR(0x80000000, profile_hist_percentile(&h, 50));
+    PASS();
+}
+
+SUITE(profiler_suite) {
+    RUN_TEST(test_hist_empty);
+    RUN_TEST(test_hist_exact);
+    RUN_TEST(test_hist_percentiles);
+    RUN_TEST(test_hist_saturate);
+    RUN_TEST(test_hist_large);
+}
@@ -0,0 +1,8 @@
+#ifndef _PROFILER_TESTS_H_
+#define _PROFILER_TESTS_H_
+
+#include "greatest/greatest.h"
+
+SUITE_EXTERN(profiler_suite);
+
+#endif
@@ -0,0 +1,17 @@
+#include "script_helper.h"
+
+#include "teletype.h"
+
+greatest_test_res load_script(scene_state_t *ss, script_number_t script_no,
+                              size_t n, char *lines[]) {
+    ss_clear_script(ss, script_no);
+    for (size_t i = 0; i < n; i++) {
+        tele_command_t cmd;
+        char error_msg[TELE_ERROR_MSG_LENGTH];
+        ASSERT_EQm(lines[i], parse(lines[i], &cmd, error_msg), E_OK);
+        ASSERT_EQm(lines[i], validate(&cmd, error_msg), E_OK);
+        cmd.comment = false;
+        ss_overwrite_script_command(ss, script_no, i, &cmd);
+    }
+    PASS();
+}
@@ -0,0 +1,15 @@
+#ifndef _SCRIPT_HELPER_H_
+#define _SCRIPT_HELPER_H_
+
+#include <stddef.h>
+
+#include "greatest/greatest.h"
+
+#include "state.h"
+
+// replaces the script script_no with the n lines given, failing the calling
+// test if any of them don't parse or validate, use with CHECK_CALL
+greatest_test_res load_script(scene_state_t *ss, script_number_t script_no,
+                              size_t n, char *lines[]);
+
+#endif
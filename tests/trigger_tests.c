@@ -0,0 +1,243 @@
+#include "trigger_tests.h"
+
+#include "greatest/greatest.h"
+
+#include "trigger.h"
+
+TEST trigger_should_pop_in_arrival_order() {
+    trigger_queue_t q;
+    trigger_init(&q);
+    bool state;
+
+    ASSERT_EQ(trigger_pop(&q, 0, &state), -1);
+
+    const uint8_t inputs[6] = { 3, 0, 7, 3, 1, 0 };
+    for (uint8_t i = 0; i < 6; i++)
+        ASSERT(trigger_push(&q, inputs[i], i % 2));
+    ASSERT_EQ(trigger_count(&q, 3), 2);
+
+    for (uint8_t i = 0; i < 6; i++) {
+        ASSERT_EQ(trigger_pop(&q, 0, &state), inputs[i]);
+        ASSERT_EQ(state, i % 2);
+    }
+    ASSERT_EQ(trigger_pop(&q, 0, &state), -1);
+    PASS();
+}
+
+// the queue keeps arrival order when the sequence numbers wrap
+TEST trigger_should_wrap() {
+    trigger_queue_t q;
+    trigger_init(&q);
+    bool state;
+
+    q.next_seq = UINT16_MAX - 1;
+    ASSERT(trigger_push(&q, 5, true));
+    ASSERT(trigger_push(&q, 2, true));
+    ASSERT(trigger_push(&q, 4, true));
+    ASSERT(trigger_push(&q, 0, true));
+    ASSERT_EQ(q.next_seq, 2);
+
+    ASSERT_EQ(trigger_pop(&q, 0, &state), 5);
+    ASSERT_EQ(trigger_pop(&q, 0, &state), 2);
+    ASSERT_EQ(trigger_pop(&q, 0, &state), 4);
+    ASSERT_EQ(trigger_pop(&q, 0, &state), 0);
+    PASS();
+}
+
+// a busy input keeps its edges, the others pop past them
+TEST trigger_should_skip_busy() {
+    trigger_queue_t q;
+    trigger_init(&q);
+    bool state;
+
+    ASSERT(trigger_push(&q, 2, true));
+    ASSERT(trigger_push(&q, 6, false));
+    ASSERT(trigger_push(&q, 2, false));
+
+    ASSERT_EQ(trigger_pop(&q, 1 << 2, &state), 6);
+    ASSERT_EQ(state, false);
+    ASSERT_EQ(trigger_pop(&q, 1 << 2, &state), -1);
+    ASSERT_EQ(trigger_count(&q, 2), 2);
+
+    ASSERT_EQ(trigger_pop(&q, 0, &state), 2);
+    ASSERT_EQ(state, true);
+    ASSERT_EQ(trigger_pop(&q, 0, &state), 2);
+    ASSERT_EQ(state, false);
+    PASS();
+}
+
+TEST trigger_should_drop_newest() {
+    trigger_queue_t q;
+    trigger_init(&q);
+    bool state;
+
+    trigger_set_depth(&q, 0, 2);
+    ASSERT(trigger_push(&q, 0, true));
+    ASSERT(trigger_push(&q, 0, true));
+    ASSERT_FALSE(trigger_push(&q, 0, false));
+    ASSERT_EQ(q.inputs[0].dropped, 1);
+    ASSERT_EQ(q.inputs[0].overruns, 1);
+
+    ASSERT_EQ(trigger_pop(&q, 0, &state), 0);
+    ASSERT(state);
+    ASSERT_EQ(trigger_pop(&q, 0, &state), 0);
+    ASSERT(state);
+    ASSERT_EQ(trigger_pop(&q, 0, &state), -1);
+    PASS();
+}
+
+TEST trigger_should_drop_oldest() {
+    trigger_queue_t q;
+    trigger_init(&q);
+    bool state;
+
+    trigger_set_depth(&q, 0, 2);
+    trigger_set_policy(&q, 0, TRIGGER_DROP_OLDEST);
+    ASSERT(trigger_push(&q, 0, true));
+    ASSERT(trigger_push(&q, 0, true));
+    ASSERT_FALSE(trigger_push(&q, 0, false));
+    ASSERT_EQ(q.inputs[0].dropped, 1);
+    ASSERT_EQ(q.inputs[0].overruns, 1);
+
+    ASSERT_EQ(trigger_pop(&q, 0, &state), 0);
+    ASSERT(state);
+    ASSERT_EQ(trigger_pop(&q, 0, &state), 0);
+    ASSERT_FALSE(state);
+    ASSERT_EQ(trigger_pop(&q, 0, &state), -1);
+    PASS();
+}
+
+TEST trigger_should_coalesce() {
+    trigger_queue_t q;
+    trigger_init(&q);
+    bool state;
+
+    trigger_set_policy(&q, 2, TRIGGER_COALESCE);
+    ASSERT(trigger_push(&q, 2, true));
+    ASSERT(trigger_push(&q, 2, false));
+    ASSERT(trigger_push(&q, 2, true));
+    ASSERT(trigger_push(&q, 2, false));
+    ASSERT(trigger_push(&q, 2, true));
+    ASSERT_EQ(trigger_count(&q, 2), 2);
+    // other inputs aren't merged in
+    ASSERT(trigger_push(&q, 3, true));
+    // merged edges aren't dropped
+    ASSERT_EQ(q.inputs[2].dropped, 0);
+    ASSERT_EQ(q.inputs[2].overruns, 0);
+    ASSERT_EQ(q.inputs[3].dropped, 0);
+
+    ASSERT_EQ(trigger_pop(&q, 0, &state), 2);
+    ASSERT(state);
+    ASSERT_EQ(trigger_pop(&q, 0, &state), 2);
+    ASSERT_FALSE(state);
+    ASSERT_EQ(trigger_pop(&q, 0, &state), 3);
+
+    // with nothing to merge with a full input drops the edge
+    trigger_set_depth(&q, 2, 1);
+    ASSERT(trigger_push(&q, 2, true));
+    ASSERT_FALSE(trigger_push(&q, 2, false));
+    ASSERT_EQ(q.inputs[2].dropped, 1);
+    ASSERT_EQ(q.inputs[2].overruns, 1);
+    ASSERT_EQ(trigger_pop(&q, 0, &state), 2);
+    ASSERT(state);
+    PASS();
+}
+
+TEST trigger_should_set_depth() {
+    trigger_queue_t q;
+    trigger_init(&q);
+    bool state;
+
+    trigger_set_depth(&q, 1, 100);
+    ASSERT_EQ(q.inputs[1].depth, TRIGGER_QUEUE_MAX);
+    for (uint8_t i = 0; i < TRIGGER_QUEUE_MAX; i++)
+        ASSERT(trigger_push(&q, 1, i == TRIGGER_QUEUE_MAX - 1));
+
+    trigger_set_depth(&q, 1, -5);
+    ASSERT_EQ(q.inputs[1].depth, 1);
+    ASSERT_EQ(trigger_count(&q, 1), 1);
+    ASSERT_EQ(q.inputs[1].dropped, TRIGGER_QUEUE_MAX - 1);
+    ASSERT_EQ(q.inputs[1].overruns, 0);
+
+    ASSERT_EQ(trigger_pop(&q, 0, &state), 1);
+    ASSERT(state);
+    PASS();
+}
+
+TEST trigger_should_clear() {
+    trigger_queue_t q;
+    trigger_init(&q);
+    bool state;
+
+    trigger_set_depth(&q, 4, 1);
+    trigger_set_policy(&q, 4, TRIGGER_DROP_OLDEST);
+    for (uint8_t i = 0; i < 3; i++) trigger_push(&q, 4, true);
+    trigger_push(&q, 6, false);
+    trigger_clear(&q);
+    ASSERT_EQ(trigger_pop(&q, 0, &state), -1);
+    ASSERT_EQ(q.inputs[4].depth, 1);
+    ASSERT_EQ(q.inputs[4].policy, TRIGGER_DROP_OLDEST);
+    ASSERT_EQ(q.inputs[4].dropped, 2);
+
+    ASSERT(trigger_push(&q, 4, true));
+    ASSERT_EQ(trigger_pop(&q, 0, &state), 4);
+    PASS();
+}
+
+// a synthetic stream of bursts on every input, drained more slowly than it
+// arrives, loses no edges that aren't counted and never exceeds the depths
+TEST trigger_should_account_for_bursts() {
+    trigger_queue_t q;
+    trigger_init(&q);
+    bool state;
+    uint32_t pushed[TRIGGER_INPUTS] = { 0 };
+    uint32_t popped[TRIGGER_INPUTS] = { 0 };
+    uint32_t merged[TRIGGER_INPUTS] = { 0 };
+    uint32_t rng = 12345;
+
+    for (uint8_t i = 0; i < TRIGGER_INPUTS; i++) {
+        trigger_set_policy(&q, i, i % TRIGGER_POLICY_COUNT);
+        trigger_set_depth(&q, i, 1 + i);
+    }
+
+    for (uint16_t t = 0; t < 2000; t++) {
+        rng = rng * 1103515245 + 12345;
+        const uint8_t input = (rng >> 16) % TRIGGER_INPUTS;
+        const uint8_t burst = (rng >> 8) % 6;
+        for (uint8_t i = 0; i < burst; i++) {
+            const uint8_t queued = trigger_count(&q, input);
+            const int16_t dropped = q.inputs[input].dropped;
+            trigger_push(&q, input, i % 2 == 0);
+            pushed[input]++;
+            // neither queued nor dropped, so merged in to a queued edge
+            if (trigger_count(&q, input) == queued &&
+                q.inputs[input].dropped == dropped)
+                merged[input]++;
+            ASSERT(trigger_count(&q, input) <= q.inputs[input].depth);
+        }
+        int8_t popped_input;
+        if (t % 2 && (popped_input = trigger_pop(&q, 0, &state)) >= 0)
+            popped[popped_input]++;
+    }
+
+    for (uint8_t i = 0; i < TRIGGER_INPUTS; i++) {
+        const trigger_input_t *in = &q.inputs[i];
+        ASSERT_EQ(pushed[i], popped[i] + in->dropped + merged[i] +
+                                 trigger_count(&q, i));
+        ASSERT_EQ(in->dropped, in->overruns);
+        if (in->policy != TRIGGER_COALESCE) ASSERT_EQ(merged[i], 0);
+    }
+    PASS();
+}
+
+SUITE(trigger_suite) {
+    RUN_TEST(trigger_should_pop_in_arrival_order);
+    RUN_TEST(trigger_should_wrap);
+    RUN_TEST(trigger_should_skip_busy);
+    RUN_TEST(trigger_should_drop_newest);
+    RUN_TEST(trigger_should_drop_oldest);
+    RUN_TEST(trigger_should_coalesce);
+    RUN_TEST(trigger_should_set_depth);
+    RUN_TEST(trigger_should_clear);
+    RUN_TEST(trigger_should_account_for_bursts);
+}
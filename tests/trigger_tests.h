@@ -0,0 +1,8 @@
+#ifndef _TRIGGER_TESTS_H_
+#define _TRIGGER_TESTS_H_
+
+#include "greatest/greatest.h"
+
+SUITE_EXTERN(trigger_suite);
+
+#endif
@@ -65,7 +65,8 @@ TEST process_helper_state(scene_state_t *ss, size_t n, char *lines[],
             log_print();
             FAILm("Validation failure");
         }
-        result = process_command(ss, &es, &cmd);
+        const tele_command_view_t command = command_view(&cmd);
+        result = process_command(ss, &es, &command);
     }
 
     if (result.has_value != true) {
@@ -1,3 +1,4 @@
+from glob import glob
 from os import path
 import re
 import subprocess
@@ -6,6 +7,7 @@ _THIS_FILE = path.realpath(__file__)
 _THIS_DIR = path.dirname(_THIS_FILE)
 
 OP_C = path.abspath(path.join(_THIS_DIR, "../../src/ops/op.c"))
+OPS_DIR = path.dirname(OP_C)
 
 
 def list_tele_ops():
@@ -34,6 +36,25 @@ def list_mods():
     return map(_convert_struct_name_to_op_name, list_tele_mods())
 
 
+def op_definitions():
+    """Return a dict of struct name to (macro, [args]) for the MAKE_*_OP and
+    MAKE_MOD definitions in src/ops"""
+    defs = {}
+    for f in sorted(glob(path.join(OPS_DIR, "*.c"))):
+        with open(f, "r") as g:
+            src = g.read()
+        for m in re.finditer(r"const\s+tele_(?:op|mod)_t\s+(\w+)\s*=\s*"
+                             r"(\w+)\s*\(([^;]*)\)\s*;", src):
+            args = [a.strip() for a in m.group(3).split(",")]
+            defs[m.group(1)] = (m.group(2), args)
+    return defs
+
+
+def op_names():
+    """Return a dict of struct name to the name the op or mod is typed as"""
+    return {k: args[0] for (k, (_, args)) in op_definitions().items()}
+
+
 def _remove_comments(op_c):
     out = op_c.splitlines()
     out = filter(_is_not_comment, out)
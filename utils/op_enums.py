@@ -3,7 +3,8 @@
 import sys
 from os import path
 
-from common import list_tele_ops, list_tele_mods, OP_C
+from common import (list_tele_ops, list_tele_mods, op_definitions, op_names,
+                    OP_C)
 
 if (sys.version_info.major, sys.version_info.minor) < (3, 6):
     raise Exception("need Python 3.6 or later")
@@ -11,6 +12,8 @@ if (sys.version_info.major, sys.version_info.minor) < (3, 6):
 THIS_FILE = path.realpath(__file__)
 THIS_DIR = path.dirname(THIS_FILE)
 OP_ENUM_H = path.abspath(path.join(THIS_DIR, "../src/ops/op_enum.h"))
+OP_HASH_H = path.abspath(path.join(THIS_DIR, "../src/ops/op_hash.h"))
+OP_TABLE_H = path.abspath(path.join(THIS_DIR, "../src/ops/op_table.h"))
 
 HEADER_PRE = """// clang-format off
 
@@ -42,6 +45,229 @@ def make_enum(name, prefix, entries):
     return output
 
 
+HASH_HEADER_PRE = """// clang-format off
+
+#ifndef _OP_HASH_H_
+#define _OP_HASH_H_
+
+// This file has been autogenerated by 'utils/op_enums.py'
+//
+// A perfect hash of the OP and MOD names, only to be included by
+// src/match_token.c, which has the hash functions that match these tables.
+//
+// A name's FNV-1a hash picks a bucket with its top bits, and the hash mixed
+// with that bucket's displacement picks its slot. Slots hold an OP index, a
+// MOD index plus E_OP__LENGTH, or OP_HASH_EMPTY.
+
+#include <stdint.h>
+
+"""
+HASH_HEADER_POST = "#endif\n"
+
+M32 = 0xFFFFFFFF
+
+
+def fnv1a(name):
+    h = 2166136261
+    for c in name.encode("ascii"):
+        h ^= c
+        h = (h * 16777619) & M32
+    return h
+
+
+def mix(h, displacement):
+    # must match op_hash_slot in src/match_token.c
+    x = (h ^ (displacement * 0x9E3779B9)) & M32
+    x ^= x >> 16
+    x = (x * 0x045D9F3B) & M32
+    x ^= x >> 16
+    return x
+
+
+def make_hash(names):
+    """Return (bucket_bits, displacements, slots) for a perfect hash of names,
+    using the hash and displace method, the biggest buckets are placed first"""
+    slot_count = 1
+    while slot_count < len(names):
+        slot_count *= 2
+
+    while True:
+        bucket_bits = max((slot_count // 4).bit_length() - 1, 0)
+        buckets = [[] for _ in range(1 << bucket_bits)]
+        for (i, n) in enumerate(names):
+            h = fnv1a(n)
+            buckets[h >> (32 - bucket_bits) if bucket_bits else 0].append(
+                (i, h))
+
+        slots = [None] * slot_count
+        displacements = [0] * len(buckets)
+        order = sorted(range(len(buckets)), key=lambda b: -len(buckets[b]))
+        for b in order:
+            if not buckets[b]:
+                continue
+            for d in range(1 << 16):
+                s = [mix(h, d) & (slot_count - 1) for (_, h) in buckets[b]]
+                if len(set(s)) == len(s) and all(slots[x] is None for x in s):
+                    break
+            else:
+                break
+            displacements[b] = d
+            for ((i, _), x) in zip(buckets[b], s):
+                slots[x] = i
+        else:
+            return (bucket_bits, displacements, slots)
+
+        slot_count *= 2
+
+
+def make_table(ctype, name, values):
+    output = f"static const {ctype} {name}[{len(values)}] = {{\n"
+    for i in range(0, len(values), 8):
+        row = ", ".join(f"{v:5}" for v in values[i:i + 8])
+        output += f"    {row},\n"
+    output += "};\n\n"
+    return output
+
+
+def make_op_hash(ops, mods):
+    names = op_names()
+    keys = [names["op_" + o] for o in ops] + [names["mod_" + m] for m in mods]
+    (bucket_bits, displacements, slots) = make_hash(keys)
+    empty = 0xFFFF
+    output = ""
+    output += f"#define OP_HASH_BUCKET_BITS {bucket_bits}\n"
+    output += f"#define OP_HASH_SLOT_COUNT {len(slots)}\n"
+    output += f"#define OP_HASH_EMPTY {empty}\n\n"
+    output += make_table("uint16_t", "op_hash_displacements", displacements)
+    output += make_table("uint16_t", "op_hash_slots",
+                         [empty if s is None else s for s in slots])
+    return output
+
+
+TABLE_HEADER_PRE = """// clang-format off
+
+#ifndef _OP_TABLE_H_
+#define _OP_TABLE_H_
+
+// This file has been autogenerated by 'utils/op_enums.py'
+//
+// The descriptors of the OPs as parallel tables indexed by E_OP_* (see op.h),
+// read from their MAKE_*_OP definitions, only to be included by src/ops/op.c.
+// The get and set fns are declared here, the op modules don't make them
+// static. Host builds also get the C name of each OP and MOD descriptor.
+
+"""
+TABLE_HEADER_POST = "#endif\n"
+
+# must match the OP_INFO_* defines in src/ops/op.h
+OP_INFO_RETURNS = 0x10
+OP_INFO_SET = 0x20
+OP_INFO_PURITY_SHIFT = 6
+OP_SIDE_EFFECTS, OP_READS_STATE, OP_PURE = range(3)
+
+
+def op_fns(macro, args):
+    """Return the (get, set) fn names of a MAKE_*_OP, "NULL" for none"""
+    if macro in ("MAKE_GET_OP", "MAKE_PURE_OP", "MAKE_PURE_ALIAS_OP"):
+        return (args[1], "NULL")
+    elif macro in ("MAKE_GET_SET_OP", "MAKE_ALIAS_OP"):
+        return (args[1], args[2])
+    elif macro == "MAKE_SIMPLE_VARIABLE_OP":
+        return ("op_peek_i16", "op_poke_i16")
+    elif macro in ("MAKE_SEED_OP", "MAKE_SEED_ALIAS_OP"):
+        return ("op_peek_seed_i16", "op_poke_seed_i16")
+    elif macro == "MAKE_SIMPLE_I2C_OP":
+        return ("op_simple_i2c", "NULL")
+    raise Exception(f"unknown OP macro: {macro}")
+
+
+def op_descriptor(macro, args):
+    """Return (params, returns, has_set, purity, data) for a MAKE_*_OP"""
+    if macro in ("MAKE_GET_OP", "MAKE_PURE_OP", "MAKE_PURE_ALIAS_OP"):
+        purity = OP_SIDE_EFFECTS if macro == "MAKE_GET_OP" else OP_PURE
+        return (int(args[2]), args[3] == "true", False, purity, "NULL")
+    elif macro in ("MAKE_GET_SET_OP", "MAKE_ALIAS_OP"):
+        return (int(args[3]), args[4] == "true", args[2] != "NULL",
+                OP_SIDE_EFFECTS, "NULL")
+    elif macro == "MAKE_SIMPLE_VARIABLE_OP":
+        return (0, True, True, OP_READS_STATE,
+                f"(const void *)offsetof(scene_state_t, {args[1]})")
+    elif macro in ("MAKE_SEED_OP", "MAKE_SEED_ALIAS_OP"):
+        return (0, True, True, OP_SIDE_EFFECTS,
+                f"(const void *)offsetof(scene_state_t, {args[1]})")
+    elif macro == "MAKE_SIMPLE_I2C_OP":
+        return (1, False, False, OP_SIDE_EFFECTS, f"(const void *){args[1]}")
+    raise Exception(f"unknown OP macro: {macro}")
+
+
+def make_op_table(ops):
+    defs = op_definitions()
+    info = []
+    data = []
+    names = []
+    gets = []
+    sets = []
+    for o in ops:
+        (macro, args) = defs["op_" + o]
+        (get, set_) = op_fns(macro, args)
+        gets.append(get)
+        sets.append(set_)
+        (params, returns, has_set, purity, d) = op_descriptor(macro, args)
+        if params > 0x0F:
+            raise Exception(f"too many params for the info table: {o}")
+        info.append(params | (OP_INFO_RETURNS if returns else 0) |
+                    (OP_INFO_SET if has_set else 0) |
+                    (purity << OP_INFO_PURITY_SHIFT))
+        data.append(d)
+        name = args[0].replace("\\", "\\\\").replace('"', '\\"')
+        names.append(f'"{name}"')
+
+    proto = "    void f(const void *data, scene_state_t *ss, exec_state_t *es, \\"
+    output = "#define OP_FN(f)".ljust(len(proto) - 1) + "\\\n"
+    output += proto + "\n"
+    output += "           command_state_t *cs)\n"
+    for f in sorted(set(gets + sets) - {"NULL"}):
+        output += f"OP_FN({f});\n"
+    output += "#undef OP_FN\n\n"
+
+    for (name, fns) in (("tele_op_get", gets), ("tele_op_set", sets)):
+        output += f"const tele_op_fn_t {name}[E_OP__LENGTH] = {{\n"
+        for (o, f) in zip(ops, fns):
+            output += f"    {f},  // {o}\n"
+        output += "};\n\n"
+
+    output += "const uint8_t tele_op_info[E_OP__LENGTH] = {\n"
+    for i in range(0, len(info), 8):
+        row = ", ".join(f"0x{v:02X}" for v in info[i:i + 8])
+        output += f"    {row},\n"
+    output += "};\n\n"
+
+    output += "const void *const tele_op_data[E_OP__LENGTH] = {\n"
+    for (o, d) in zip(ops, data):
+        output += f"    {d},  // {o}\n"
+    output += "};\n\n"
+
+    output += "const char *const tele_op_names[E_OP__LENGTH] = {\n"
+    for n in names:
+        output += f"    {n},\n"
+    output += "};\n\n"
+    return output
+
+
+def make_symbol_table(ops, mods):
+    output = "#ifdef SIM\n"
+    output += "const char *const tele_op_symbols[E_OP__LENGTH] = {\n"
+    for o in ops:
+        output += f'    "op_{o}",\n'
+    output += "};\n\n"
+    output += "const char *const tele_mod_symbols[E_MOD__LENGTH] = {\n"
+    for m in mods:
+        output += f'    "mod_{m}",\n'
+    output += "};\n"
+    output += "#endif\n\n"
+    return output
+
+
 def main():
     print("reading:    {}".format(OP_C))
     print("generating: {}".format(OP_ENUM_H))
@@ -53,6 +279,17 @@ def main():
     with open(OP_ENUM_H, "w") as g:
         g.write(header)
 
+    print("generating: {}".format(OP_HASH_H))
+    header = HASH_HEADER_PRE + make_op_hash(ops, mods) + HASH_HEADER_POST
+    with open(OP_HASH_H, "w") as g:
+        g.write(header)
+
+    print("generating: {}".format(OP_TABLE_H))
+    header = (TABLE_HEADER_PRE + make_op_table(ops) +
+              make_symbol_table(ops, mods) + TABLE_HEADER_POST)
+    with open(OP_TABLE_H, "w") as g:
+        g.write(header)
+
 
 if __name__ == '__main__':
     main()